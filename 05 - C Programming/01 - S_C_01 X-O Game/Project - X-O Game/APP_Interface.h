@@ -17,20 +17,34 @@
 /* STD LIB */
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <time.h>
 
 /* LIB */
 #include "../X-O Game/STD_TYPES.h"
 
+/* ENG */
+#include "ENG_Interface.h"
+
+/**************************************************************************************************************************/
+/* APP Macros */
+
+/* Number of games of each kind the engine is timed on by default */
+#define APP_U32_BENCHMARK_GAMES     1000000
+
 /**************************************************************************************************************************/
 /* APP Functions' Prototypes */
 
-void    startProgram   ( void );
-void    drawBoard      ( uint8_t *board );
-void    updateBoard    ( uint8_t *board, uint8_t position, uint8_t value );
-uint8_t getPlayerSymbol( uint8_t playerNumber, uint8_t* symbol );
-void    setPlayerConfig( uint8_t *configArray );
-void    loadAndUpdate  ( uint8_t playerNumber );
-void    getGameState   ( uint8_t *board, uint8_t *gameState );  
+void    startProgram          ( void );
+void    drawBoard             ( uint8_t *board );
+void    updateBoard           ( uint8_t *board, uint8_t position, uint8_t value );
+uint8_t getPlayerSymbol       ( uint8_t playerNumber, uint8_t* symbol );
+void    setPlayerConfig       ( uint8_t *configArray );
+void    loadAndUpdate         ( uint8_t playerNumber );
+void    getGameState          ( ST_engBoard_t *game, uint8_t *gameState );
+uint8_t getComputerConfig     ( void );
+void    loadComputerMove      ( uint8_t playerNumber );
+void    startBenchmarkProgram ( uint32_t gamesCount );
 
 /**************************************************************************************************************************/
 
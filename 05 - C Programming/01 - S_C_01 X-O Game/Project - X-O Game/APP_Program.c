@@ -11,6 +11,8 @@
 
 uint8_t board[9] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
 uint8_t configArray[2] = { 0 };
+ST_engBoard_t game;
+uint8_t computerPlayer = 0;
 
 /**************************************************************************************************************************/
 /*
@@ -23,15 +25,20 @@ void    startProgram   ( void )
 {
     uint8_t gameState = 2;
 
+    engInit();
+    engInitBoard( &game );
+    srand( ( unsigned int )time( NULL ) );
+
     drawBoard( &board[0] );
     setPlayerConfig( &configArray[0] );
+    computerPlayer = getComputerConfig();
 
     /* Loop: Until any of the player wins, or a match draw takes place */
     while ( gameState == 2 )
     {
         loadAndUpdate( 1 );
         drawBoard( &board[0] );
-        getGameState( &board[0], &gameState );
+        getGameState( &game, &gameState );
        
         /* Check 1: Player one wins, gameState is updated to 0, after his/her move */
         if ( gameState == 0 )
@@ -47,9 +54,18 @@ void    startProgram   ( void )
             break;
         }
 
-        loadAndUpdate( 2 );
+        /* Check 2.1: Player two is the computer */
+        if ( computerPlayer )
+        {
+            loadComputerMove( 2 );
+        }
+        else
+        {
+            loadAndUpdate( 2 );
+        }
+
         drawBoard( &board[0] );
-        getGameState( &board[0], &gameState );
+        getGameState( &game, &gameState );
         
         /* Check 3: Player one wins, gameState is updated to 0, after his/her move */
         if ( gameState == 0 )
@@ -181,54 +197,210 @@ void loadAndUpdate( uint8_t playerNumber )
         printf( "\n\n Player %d Choose the cell number: ", playerNumber );        
         scanf( "%d", &cellNumber);
 
-    } while ( ( ( cellNumber == 0 ) || ( cellNumber > 9 ) ) || ( board[cellNumber - 1] == 'X' ) || ( board[cellNumber - 1] == 'O' ) );
+    } while ( ( ( cellNumber == 0 ) || ( cellNumber > 9 ) ) || !( ( engGetMoves( &game ) >> ( cellNumber - 1 ) ) & 1 ) );
    
-    /* Update the X-O board with the new valid move */
+    /* Update the X-O board and the bitboards with the new valid move */
     updateBoard( &board[0], cellNumber - 1, configArray[playerNumber - 1] );
+    engPlayMove( &game, ( uint8_t )( cellNumber - 1 ) );
 }
 
 /**************************************************************************************************************************/
 /*
  Name: getGameState
- Input: Pointer to uint8_t board and Pointer to uint8_t gameState
+ Input: Pointer to game bitboards and Pointer to uint8_t gameState
  Output: void
- Description: Function to get the game state after each player's turn.
+ Description: Function to get the game state after each player's turn, by testing the bitboard of the player who moved against the 8 win masks.
 */
-void    getGameState( uint8_t* board, uint8_t* gameState )
+void    getGameState( ST_engBoard_t* game, uint8_t* gameState )
 {
-    /* Check 1: Player wins the match */
-    if ( ( ( board[0] == board[1] ) && ( board[1] == board[2] ) )     /* 1st Row */
-      || ( ( board[3] == board[4] ) && ( board[4] == board[5] ) )     /* 2nd Row */
-      || ( ( board[6] == board[7] ) && ( board[7] == board[8] ) )     /* 3rd Row */
-      || ( ( board[0] == board[3] ) && ( board[3] == board[6] ) )     /* 1st Col */
-      || ( ( board[1] == board[4] ) && ( board[4] == board[7] ) )     /* 2nd Col */
-      || ( ( board[2] == board[5] ) && ( board[5] == board[8] ) )     /* 3rd Col */
-      || ( ( board[0] == board[4] ) && ( board[4] == board[8] ) )     /* 1st Dgl */
-      || ( ( board[2] == board[4] ) && ( board[4] == board[6] ) ) )   /* 2nd Dgl */
+    /* Update gameState with 0 for Winning, 1 for Drawing, or 2 for Continuing */
+    *gameState = engGetState( game );
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: getComputerConfig
+ Input: void
+ Output: uint8_t 1 if player two is the computer, else 0
+ Description: Function to ask if player two is the computer, which plays perfectly.
+*/
+uint8_t getComputerConfig( void )
+{
+    uint8_t answer = 0;
+
+    /* Loop: Until a valid answer */
+    while ( 1 )
     {
-        /* Update gameState with 0 for Winning */
-        *gameState = 0;
-        return;
+        printf( "\n\n Is player 2 the computer? Y or N: " );
+        scanf( " %c", &answer );
+
+        /* Check: Required answer */
+        switch ( answer )
+        {
+            /* Case 1: 'Y' lowercase or uppercase */
+            case 'Y':
+            case 'y':
+                return 1;
+
+            /* Case 2: 'N' lowercase or uppercase */
+            case 'N':
+            case 'n':
+                return 0;
+
+            /* Case 3: Any other invalid answer */
+            default:
+                printf( " \nWrong Input " );
+                break;
+        }
     }
-    /* Check 2: No player wins the match */
-    else
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: loadComputerMove
+ Input: uint8_t playerNumber
+ Output: void
+ Description: Function to get a perfect move from the engine, a random one of the best moves, and then updates the board with it.
+*/
+void loadComputerMove( uint8_t playerNumber )
+{
+    uint8_t cell = engGetBestMove( &game, ( uint32_t )rand() );
+
+    printf( "\n\n Player %d (computer) chooses the cell number: %d", playerNumber, cell + 1 );
+
+    /* Update the X-O board and the bitboards with the computer move */
+    updateBoard( &board[0], cell, configArray[playerNumber - 1] );
+    engPlayMove( &game, cell );
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: appNow
+ Input: void
+ Output: f64_t seconds
+ Description: Static Function to get a monotonic-enough wall clock in seconds, to time the benchmark.
+*/
+static f64_t appNow( void )
+{
+    struct timespec now;
+
+    timespec_get( &now, TIME_UTC );
+
+    return ( f64_t )now.tv_sec + ( ( f64_t )now.tv_nsec / 1e9 );
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: appRandom
+ Input: Pointer to uint32_t seed
+ Output: uint32_t random number
+ Description: Static Function to get the next xorshift random number of a seed, fast enough not to hide the engine time.
+*/
+static uint32_t appRandom( uint32_t* seed )
+{
+    *seed ^= ( *seed << 13 ) & 0xFFFFFFFF;
+    *seed ^= *seed >> 17;
+    *seed ^= ( *seed << 5 ) & 0xFFFFFFFF;
+
+    return *seed;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: appPlayGame
+ Input: uint8_t perfectPlayers, bit n set if player n + 1 plays perfectly, else randomly, and Pointer to uint32_t seed
+ Output: uint8_t result, 0 for a draw, else the number of the player who wins
+ Description: Static Function to play a whole game on the bitboards with no drawing, for the benchmark.
+*/
+static uint8_t appPlayGame( uint8_t perfectPlayers, uint32_t* seed )
+{
+    ST_engBoard_t benchmarkGame;
+    uint8_t state = ENG_U8_STATE_CONTINUE;
+
+    engInitBoard( &benchmarkGame );
+
+    /* Loop: Until any of the player wins, or a match draw takes place */
+    while ( state == ENG_U8_STATE_CONTINUE )
     {
-        /* Loop: Until the end of board to check each cell */
-        for (uint8_t index = 0; index < 9; index++)
+        uint8_t cell = 0;
+
+        /* Check 1: Player to move plays perfectly, or any empty cell */
+        if ( ( perfectPlayers >> benchmarkGame.turn ) & 1 )
         {
-            /* Check 3: Game is not yet finished */
-            if ( ( board[index] != 'X' ) && ( board[index] != 'O' ) )
+            cell = engGetBestMove( &benchmarkGame, appRandom( seed ) );
+        }
+        else
+        {
+            uint16_t moves = engGetMoves( &benchmarkGame );
+            uint8_t  count = 0, pick = 0;
+
+            for ( uint16_t rest = moves; rest != 0; rest &= rest - 1 )
+            {
+                count++;
+            }
+
+            pick = ( uint8_t )( appRandom( seed ) % count );
+
+            while ( pick-- != 0 )
+            {
+                moves &= moves - 1;
+            }
+
+            while ( !( ( moves >> cell ) & 1 ) )
             {
-                /* Update gameState with 2 for Continuing */
-                *gameState = 2;
-                return;
+                cell++;
             }
         }
 
-        /* Update gameState with 1 for Drawing */
-        *gameState = 1;
-        return;
+        engPlayMove( &benchmarkGame, cell );
+        state = engGetState( &benchmarkGame );
     }
+
+    return ( state == ENG_U8_STATE_WIN ) ? ( uint8_t )( ( benchmarkGame.turn ^ 1 ) + 1 ) : 0;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: startBenchmarkProgram
+ Input: uint32_t gamesCount
+ Output: void
+ Description: Function to time gamesCount games of each kind: random against random, for the move generation and win checks, the computer against itself, and the computer as each player against random moves, and print the games per second and the results. The computer must never lose.
+*/
+void startBenchmarkProgram( uint32_t gamesCount )
+{
+    const char* names[4] = { "Random vs random", "Computer vs random", "Random vs computer", "Computer vs computer" };
+    uint32_t seed = 2463534242U;
+    f64_t start = 0.0;
+
+    /* Solve all positions once, so each kind is timed with a full transposition table */
+    start = appNow();
+    engInit();
+    engInitBoard( &game );
+    engSolve( &game );
+    printf( "\n Solved all positions in %.3f ms, score of the empty board = %d", ( appNow() - start ) * 1e3, engSolve( &game ) );
+
+    /* Loop: Until each kind of game is timed, bit n of kind set if player n + 1 is the computer */
+    for ( uint8_t kind = 0; kind < 4; kind++ )
+    {
+        uint32_t results[3] = { 0 };
+        f64_t seconds = 0.0;
+
+        start = appNow();
+
+        for ( uint32_t gameNumber = 0; gameNumber < gamesCount; gameNumber++ )
+        {
+            results[appPlayGame( kind, &seed )]++;
+        }
+
+        seconds = appNow() - start;
+
+        printf( "\n %-20s: %lu games in %.3f s: %.0f games/s, %.1f ns per game, player 1 wins %lu, player 2 wins %lu, draws %lu",
+                names[kind], ( unsigned long )gamesCount, seconds, ( seconds > 0.0 ) ? ( ( f64_t )gamesCount / seconds ) : 0.0,
+                ( gamesCount > 0 ) ? ( seconds * 1e9 / ( f64_t )gamesCount ) : 0.0,
+                ( unsigned long )results[1], ( unsigned long )results[2], ( unsigned long )results[0] );
+    }
+
+    printf( "\n" );
 }
 
 /**************************************************************************************************************************/
\ No newline at end of file
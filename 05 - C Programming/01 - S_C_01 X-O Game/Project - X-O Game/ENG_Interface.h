@@ -0,0 +1,62 @@
+/*
+ * ENG_Interface.h
+ *
+ *     Created on: Oct 17, 2026
+ *         Author: Abdelrhman Walaa - https://github.com/AbdelrhmanWalaa
+ *    Description: This file contains all X-O Engine (ENG) functions' prototypes and definitions (Macros) to avoid magic numbers.
+ */
+
+#ifndef ENG_INTERFACE_H_
+#define ENG_INTERFACE_H_
+
+/**************************************************************************************************************************/
+/* ENG Includes */
+
+/* LIB */
+#include "../X-O Game/STD_TYPES.h"
+
+/**************************************************************************************************************************/
+/* ENG Macros */
+
+/* All 9 cells, bit n is cell n + 1 */
+#define ENG_U16_FULL_BOARD          0x1FF
+
+/* Number of lines a player wins with: 3 rows, 3 columns and 2 diagonals */
+#define ENG_U8_WIN_MASKS            8
+/* Number of symmetries of the board: 4 rotations, each one mirrored or not */
+#define ENG_U8_SYMMETRIES           8
+/* Number of positions, each cell is empty, or marked by the player to move or by the other one: 3 ^ 9 */
+#define ENG_U16_POSITIONS           19683
+/* Score of a position not yet solved */
+#define ENG_S8_UNKNOWN              -128
+
+/* Game States, the same as getGameState */
+#define ENG_U8_STATE_WIN            0       /* Player who moved last wins */
+#define ENG_U8_STATE_DRAW           1       /* Board is full, no player wins */
+#define ENG_U8_STATE_CONTINUE       2       /* Otherwise */
+
+/*
+ * Board of a game as two 9-bit bitboards, one per player: a move is one OR, the empty cells are one NOT, and a player
+ * wins if one of the 8 masks of rows, columns and diagonals is all set in his/her bitboard.
+ */
+typedef struct engBoard
+{
+    uint16_t marks[2];              /* Cells of player 1, who moves first, and of player 2 */
+    uint8_t  turn;                  /* Player to move, 0 or 1 */
+} ST_engBoard_t;
+
+/**************************************************************************************************************************/
+/* ENG Functions' Prototypes */
+
+void     engInit        ( void );
+void     engInitBoard   ( ST_engBoard_t *board );
+uint16_t engGetMoves    ( const ST_engBoard_t *board );
+void     engPlayMove    ( ST_engBoard_t *board, uint8_t cell );
+uint8_t  engHasWon      ( uint16_t marks );
+uint8_t  engGetState    ( const ST_engBoard_t *board );
+sint8_t  engSolve       ( const ST_engBoard_t *board );
+uint8_t  engGetBestMove ( const ST_engBoard_t *board, uint32_t random );
+
+/**************************************************************************************************************************/
+
+#endif /* ENG_INTERFACE_H_ */
\ No newline at end of file
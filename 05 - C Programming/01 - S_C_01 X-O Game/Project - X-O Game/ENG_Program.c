@@ -0,0 +1,314 @@
+/*
+ * ENG_Program.c
+ *
+ *     Created on: Oct 17, 2026
+ *         Author: Abdelrhman Walaa - https://github.com/AbdelrhmanWalaa
+ *    Description: This file contains all X-O Engine (ENG) functions' implementation.
+ */
+
+/* ENG */
+#include "ENG_Interface.h"
+
+/* Masks of the 3 rows, 3 columns and 2 diagonals */
+static const uint16_t engWinMasks[ENG_U8_WIN_MASKS] = { 0x007, 0x038, 0x1C0, 0x049, 0x092, 0x124, 0x111, 0x054 };
+
+/* Cell each cell goes to, by each symmetry: identity, rotations by 90, 180 and 270, and mirrors by columns, rows and both diagonals */
+static const uint8_t engSymmetryCells[ENG_U8_SYMMETRIES][9] =
+{
+    { 0, 1, 2, 3, 4, 5, 6, 7, 8 },
+    { 2, 5, 8, 1, 4, 7, 0, 3, 6 },
+    { 8, 7, 6, 5, 4, 3, 2, 1, 0 },
+    { 6, 3, 0, 7, 4, 1, 8, 5, 2 },
+    { 2, 1, 0, 5, 4, 3, 8, 7, 6 },
+    { 6, 7, 8, 3, 4, 5, 0, 1, 2 },
+    { 0, 3, 6, 1, 4, 7, 2, 5, 8 },
+    { 8, 5, 2, 7, 4, 1, 6, 3, 0 }
+};
+
+/* Bitboard each bitboard goes to, by each symmetry */
+static uint16_t engSymmetryMasks[ENG_U8_SYMMETRIES][ENG_U16_FULL_BOARD + 1];
+/* Bitboard as a base 3 number with a digit 1 for each set cell, so a position is base3[player] + 2 * base3[opponent] */
+static uint16_t engBase3[ENG_U16_FULL_BOARD + 1];
+/* Transposition table: score of each position, only set for the smallest one of its symmetries */
+static sint8_t  engTable[ENG_U16_POSITIONS];
+
+/**************************************************************************************************************************/
+/*
+ Name: engInit
+ Input: void
+ Output: void
+ Description: Function to build the symmetry and base 3 tables of the bitboards, and empty the transposition table, before any position is solved.
+*/
+void engInit( void )
+{
+    /* Loop: Until each bitboard is built */
+    for ( uint16_t marks = 0; marks <= ENG_U16_FULL_BOARD; marks++ )
+    {
+        uint16_t power = 1;
+
+        engBase3[marks] = 0;
+
+        for ( uint8_t cell = 0; cell < 9; cell++ )
+        {
+            engBase3[marks] += ( ( marks >> cell ) & 1 ) * power;
+            power *= 3;
+        }
+
+        for ( uint8_t symmetry = 0; symmetry < ENG_U8_SYMMETRIES; symmetry++ )
+        {
+            engSymmetryMasks[symmetry][marks] = 0;
+
+            for ( uint8_t cell = 0; cell < 9; cell++ )
+            {
+                engSymmetryMasks[symmetry][marks] |= ( ( marks >> cell ) & 1 ) << engSymmetryCells[symmetry][cell];
+            }
+        }
+    }
+
+    for ( uint16_t position = 0; position < ENG_U16_POSITIONS; position++ )
+    {
+        engTable[position] = ENG_S8_UNKNOWN;
+    }
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: engInitBoard
+ Input: Pointer to board
+ Output: void
+ Description: Function to empty the board, player 1 moves first.
+*/
+void engInitBoard( ST_engBoard_t *board )
+{
+    board->marks[0] = 0;
+    board->marks[1] = 0;
+    board->turn     = 0;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: engGetMoves
+ Input: Pointer to board
+ Output: uint16_t bitboard of the empty cells
+ Description: Function to get the empty cells of the board, the moves of the player to move.
+*/
+uint16_t engGetMoves( const ST_engBoard_t *board )
+{
+    return ~( board->marks[0] | board->marks[1] ) & ENG_U16_FULL_BOARD;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: engPlayMove
+ Input: Pointer to board and uint8_t cell
+ Output: void
+ Description: Function to mark an empty cell, from 0 to 8, for the player to move, then the other player is to move.
+*/
+void engPlayMove( ST_engBoard_t *board, uint8_t cell )
+{
+    board->marks[board->turn] |= ( uint16_t )( 1 << cell );
+    board->turn ^= 1;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: engHasWon
+ Input: uint16_t marks
+ Output: uint8_t 1 if the bitboard has a row, column or diagonal, else 0
+ Description: Function to check the bitboard of a player against the 8 win masks.
+*/
+uint8_t engHasWon( uint16_t marks )
+{
+    /* Loop: Until a mask is all set, or the end of masks */
+    for ( uint8_t mask = 0; mask < ENG_U8_WIN_MASKS; mask++ )
+    {
+        if ( ( marks & engWinMasks[mask] ) == engWinMasks[mask] )
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: engGetState
+ Input: Pointer to board
+ Output: uint8_t gameState
+ Description: Function to get the game state after a move: only the player who moved last can have won.
+*/
+uint8_t engGetState( const ST_engBoard_t *board )
+{
+    /* Check 1: Player who moved last wins */
+    if ( engHasWon( board->marks[board->turn ^ 1] ) )
+    {
+        return ENG_U8_STATE_WIN;
+    }
+    /* Check 2: Board is full */
+    else if ( engGetMoves( board ) == 0 )
+    {
+        return ENG_U8_STATE_DRAW;
+    }
+
+    return ENG_U8_STATE_CONTINUE;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: engGetPosition
+ Input: uint16_t player and uint16_t opponent
+ Output: uint16_t position
+ Description: Static Function to get the index of a position in the transposition table, the smallest one of its 8 symmetries, so a position and its rotations and mirrors are solved once.
+*/
+static uint16_t engGetPosition( uint16_t player, uint16_t opponent )
+{
+    uint16_t position = ENG_U16_POSITIONS;
+
+    /* Loop: Until the end of symmetries */
+    for ( uint8_t symmetry = 0; symmetry < ENG_U8_SYMMETRIES; symmetry++ )
+    {
+        uint16_t symmetric = engBase3[engSymmetryMasks[symmetry][player]] + ( 2 * engBase3[engSymmetryMasks[symmetry][opponent]] );
+
+        position = ( symmetric < position ) ? symmetric : position;
+    }
+
+    return position;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: engCountCells
+ Input: uint16_t marks
+ Output: uint8_t number of set cells
+ Description: Static Function to count the set cells of a bitboard.
+*/
+static uint8_t engCountCells( uint16_t marks )
+{
+    uint8_t count = 0;
+
+    /* Loop: Until the lowest set cell is cleared for each set cell */
+    while ( marks != 0 )
+    {
+        marks &= marks - 1;
+        count++;
+    }
+
+    return count;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: engNegamax
+ Input: uint16_t player and uint16_t opponent
+ Output: sint8_t score
+ Description: Static Function to get the score of a position with perfect play for the player to move: 0 for a draw, else 1 + the empty cells left when the game is won, positive if the player to move wins, negative if he/she loses, so a faster win scores more. The score of a position is the best of the negated scores of its moves, and is kept in the transposition table.
+*/
+static sint8_t engNegamax( uint16_t player, uint16_t opponent )
+{
+    uint16_t moves = ~( player | opponent ) & ENG_U16_FULL_BOARD;
+    uint16_t position = 0;
+    sint8_t  best = ENG_S8_UNKNOWN;
+
+    /* Check 1: Opponent won with the last move, or the board is full */
+    if ( engHasWon( opponent ) )
+    {
+        return ( sint8_t )( -( engCountCells( moves ) + 1 ) );
+    }
+    else if ( moves == 0 )
+    {
+        return 0;
+    }
+
+    position = engGetPosition( player, opponent );
+
+    /* Check 2: Position, or one of its symmetries, is already solved */
+    if ( engTable[position] != ENG_S8_UNKNOWN )
+    {
+        return engTable[position];
+    }
+
+    /* Loop: Until the end of moves, the lowest empty cell first */
+    while ( moves != 0 )
+    {
+        uint16_t move  = moves & ( uint16_t )( ~moves + 1 );
+        sint8_t  score = ( sint8_t )( -engNegamax( opponent, player | move ) );
+
+        best   = ( score > best ) ? score : best;
+        moves ^= move;
+    }
+
+    engTable[position] = best;
+
+    return best;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: engSolve
+ Input: Pointer to board
+ Output: sint8_t score
+ Description: Function to get the score of the board with perfect play for the player to move, see engNegamax.
+*/
+sint8_t engSolve( const ST_engBoard_t *board )
+{
+    return engNegamax( board->marks[board->turn], board->marks[board->turn ^ 1] );
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: engGetBestMove
+ Input: Pointer to board and uint32_t random
+ Output: uint8_t cell
+ Description: Function to get a perfect move, from 0 to 8, for the player to move, or 0 if the board is full. If many moves have the best score, random picks one of them, so games vary.
+*/
+uint8_t engGetBestMove( const ST_engBoard_t *board, uint32_t random )
+{
+    uint16_t player    = board->marks[board->turn];
+    uint16_t opponent  = board->marks[board->turn ^ 1];
+    uint16_t moves     = engGetMoves( board );
+    uint16_t bestMoves = 0;
+    sint8_t  best      = ENG_S8_UNKNOWN;
+    uint8_t  pick      = 0;
+
+    /* Check: No empty cell */
+    if ( moves == 0 )
+    {
+        return 0;
+    }
+
+    /* Loop 1: Until the end of moves, keep the ones with the best score */
+    for ( uint8_t cell = 0; cell < 9; cell++ )
+    {
+        if ( ( moves >> cell ) & 1 )
+        {
+            sint8_t score = ( sint8_t )( -engNegamax( opponent, player | ( uint16_t )( 1 << cell ) ) );
+
+            if ( score > best )
+            {
+                best      = score;
+                bestMoves = 0;
+            }
+
+            if ( score == best )
+            {
+                bestMoves |= ( uint16_t )( 1 << cell );
+            }
+        }
+    }
+
+    pick = ( uint8_t )( random % engCountCells( bestMoves ) );
+
+    /* Loop 2: Until the picked one of the best moves */
+    for ( uint8_t cell = 0; cell < 9; cell++ )
+    {
+        if ( ( ( bestMoves >> cell ) & 1 ) && ( pick-- == 0 ) )
+        {
+            return cell;
+        }
+    }
+
+    return 0;
+}
+
+/**************************************************************************************************************************/
\ No newline at end of file
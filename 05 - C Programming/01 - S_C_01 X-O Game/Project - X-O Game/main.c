@@ -7,9 +7,17 @@
  /* APP */
 #include "APP_Interface.h"
 
-int main(void)
+int main( int argc, char *argv[] )
 {
-    startProgram();
+    /* Check: Benchmark is asked for, with an optional number of games */
+    if ( ( argc >= 2 ) && ( strcmp( argv[1], "--benchmark" ) == 0 ) )
+    {
+        startBenchmarkProgram( ( argc >= 3 ) ? ( uint32_t )strtoul( argv[2], NULL, 10 ) : APP_U32_BENCHMARK_GAMES );
+    }
+    else
+    {
+        startProgram();
+    }
 
     return 0;
 }
\ No newline at end of file
@@ -7,9 +7,19 @@
 /* Main */
 #include "main.h"
 
-int main(void)
+int main(int argc, char *argv[])
 {
-    startProgram();
+    /* Check: A file is given, check it only */
+    if (argc == 2)
+    {
+        startFileProgram(argv[1]);
+    }
+    else
+    {
+        startProgram();
+        startStreamProgram();
+        startParallelProgram();
+    }
 
     system("pause");
 
@@ -247,4 +257,239 @@ void startProgram(void)
     }
 }
 
+/**************************************************************************************************************************/
+/*
+ Name: fillBenchmarkBuffer
+ Input: Pointer uint8 buffer and size_t size
+ Output: void
+ Description: Static Function to fill a buffer with balanced generated text: runs of letters, with one bracket of any type in MAIN_BENCHMARK_SPACING bytes on average, nested up to MAIN_BENCHMARK_DEPTH deep.
+*/
+static void fillBenchmarkBuffer(uint8_t *buffer, size_t size)
+{
+    const uint8_t openers[] = "([{<";
+    const uint8_t closers[] = ")]}>";
+    uint8_t stack[MAIN_BENCHMARK_DEPTH];
+    uint32_t depth = 0;
+    uint32_t seed = 2463534242U;
+    size_t index = 0;
+
+    /* Loop: Until there is only room left to close all openers */
+    while (index < (size - MAIN_BENCHMARK_DEPTH))
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+
+        /* Check 1: Letter, opener, or closer */
+        if ((seed % MAIN_BENCHMARK_SPACING) != 0)
+        {
+            buffer[index++] = (uint8_t)('a' + ((seed >> 8) % 26));
+        }
+        else if ((depth == 0) || ((depth < MAIN_BENCHMARK_DEPTH) && ((seed >> 8) & 1)))
+        {
+            stack[depth] = (uint8_t)((seed >> 9) & 3);
+            buffer[index++] = openers[stack[depth++]];
+        }
+        else
+        {
+            buffer[index++] = closers[stack[--depth]];
+        }
+    }
+
+    /* Loop: Until all openers are closed, then the rest is spaces */
+    while (depth != 0)
+    {
+        buffer[index++] = closers[stack[--depth]];
+    }
+
+    while (index < size)
+    {
+        buffer[index++] = ' ';
+    }
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: printStreamResult
+ Input: Pointer stream result structure
+ Output: void
+ Description: Static Function to print the result of a stream check, and its throughput.
+*/
+static void printStreamResult(const ST_streamResult_t *result)
+{
+    /* Check: Result is balanced or not */
+    if (result->state == BLPAR_INT8_BALANCED)
+    {
+        printf("Balanced!");
+    }
+    else if (result->state == BLPAR_INT8_NO_PAR_USED)
+    {
+        printf("No parentheses used!");
+    }
+    else
+    {
+        printf("Not balanced at offset %llu!", (unsigned long long)result->errorOffset);
+    }
+
+    printf(" %llu bytes, %llu brackets, in %.3f s: %.2f GB/s\n", (unsigned long long)result->bytesCount,
+           (unsigned long long)result->bracketsCount, result->seconds, result->gigabytesPerSecond);
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: startStreamProgram
+ Input: void
+ Output: void
+ Description: Function to check the main program expressions, and two with [] and <>, with the stream checker a few bytes at a time, then time it on a generated input.
+*/
+void startStreamProgram(void)
+{
+    ST_streamChecker_t checker;
+    ST_streamResult_t result;
+    uint8_t* buffer = NULL;
+
+    uint8_t expressions[12][50] = { "{(2+3)}", "{((2+3)}", "[(2+3)]", "{(2+3)/((3+3)*(15-10))}", "(2+3)/((3+3)*(15-10))", "{{2+3)/((3+3)*(15-10)))", "{(2+3(/((3+3)*(15-10))}", "{(2+3)/((3+3(*)15-10))}", "})2+3)/((3+3)*(15-10))}", "{(2+3)/(<3+3>*(15-10))}", "[<2+3>*{4}]", "<2+3]" };
+
+    printf("/**************************************/\n");
+    printf("/********** Stream Checker ************/\n");
+    printf("/**************************************/\n");
+    printf("\n");
+
+    /* Loop: Until the end of expressions */
+    for (uint8_t index = 0; index < 12; index++)
+    {
+        size_t length = strlen((const char*)expressions[index]);
+
+        createStreamChecker(&checker);
+
+        /* Loop: Until the whole expression is fed, a few bytes at a time */
+        for (size_t offset = 0; offset < length; offset += MAIN_STREAM_CHUNK_SIZE)
+        {
+            feedStreamChecker(&checker, &expressions[index][offset], ((length - offset) < MAIN_STREAM_CHUNK_SIZE) ? (length - offset) : MAIN_STREAM_CHUNK_SIZE);
+        }
+
+        finishStreamChecker(&checker, &result);
+        freeStreamChecker(&checker);
+
+        /* Check: Expression is balanced or not */
+        (result.state == BLPAR_INT8_BALANCED) ? printf("Expression %d: \"%s\" is balanced!", index + 1, expressions[index]) : printf("Expression %d: \"%s\" is not balanced at offset %llu!", index + 1, expressions[index], (unsigned long long)result.errorOffset);
+
+        printf("\n\n");
+    }
+
+    /* Step 2: Time the stream checker on a generated input */
+    buffer = malloc(MAIN_BENCHMARK_SIZE);
+
+    if (buffer == NULL)
+    {
+        printf("No memory for %llu bytes!\n", (unsigned long long)MAIN_BENCHMARK_SIZE);
+        return;
+    }
+
+    fillBenchmarkBuffer(buffer, MAIN_BENCHMARK_SIZE);
+
+    printf("Generated input: ");
+    isBalancedBuffer(buffer, MAIN_BENCHMARK_SIZE, &result);
+    printStreamResult(&result);
+    printf("\n");
+
+    free(buffer);
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: startFileProgram
+ Input: Pointer char fileName
+ Output: void
+ Description: Function to check the brackets of a file of any size with the stream checker.
+*/
+void startFileProgram(const char *fileName)
+{
+    ST_streamResult_t result;
+    int8_t errorState = isBalancedFile(fileName, &result);
+
+    /* Check: File is checked or not */
+    if (errorState == STREAM_INT8_FILE_ERROR)
+    {
+        printf("File \"%s\" can't be read!\n", fileName);
+    }
+    else if (errorState == STREAM_INT8_NO_MEMORY)
+    {
+        printf("No memory to check file \"%s\"!\n", fileName);
+    }
+    else
+    {
+        printf("File \"%s\": ", fileName);
+        printStreamResult(&result);
+    }
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: startParallelProgram
+ Input: void
+ Output: void
+ Description: Function to check the main program expressions with the parallel checker, each split over a few threads, then time it on a generated input with 1 thread up to one per core, against the stream checker.
+*/
+void startParallelProgram(void)
+{
+    ST_streamResult_t streamResult;
+    ST_streamResult_t result;
+    uint32_t coresCount = parallelCoresCount();
+    uint8_t* buffer = NULL;
+
+    uint8_t expressions[12][50] = { "{(2+3)}", "{((2+3)}", "[(2+3)]", "{(2+3)/((3+3)*(15-10))}", "(2+3)/((3+3)*(15-10))", "{{2+3)/((3+3)*(15-10)))", "{(2+3(/((3+3)*(15-10))}", "{(2+3)/((3+3(*)15-10))}", "})2+3)/((3+3)*(15-10))}", "{(2+3)/(<3+3>*(15-10))}", "[<2+3>*{4}]", "<2+3]" };
+
+    printf("/**************************************/\n");
+    printf("/********* Parallel Checker ***********/\n");
+    printf("/**************************************/\n");
+    printf("\n");
+
+    /* Loop: Until the end of expressions */
+    for (uint8_t index = 0; index < 12; index++)
+    {
+        isBalancedParallel(expressions[index], strlen((const char*)expressions[index]), MAIN_PARALLEL_THREADS, &result);
+
+        /* Check: Expression is balanced or not */
+        (result.state == BLPAR_INT8_BALANCED) ? printf("Expression %d: \"%s\" is balanced!", index + 1, expressions[index]) : printf("Expression %d: \"%s\" is not balanced at offset %llu!", index + 1, expressions[index], (unsigned long long)result.errorOffset);
+
+        printf("\n\n");
+    }
+
+    /* Step 2: Time the parallel checker on a generated input, from 1 thread up to one per core */
+    buffer = malloc(MAIN_BENCHMARK_SIZE);
+
+    if (buffer == NULL)
+    {
+        printf("No memory for %llu bytes!\n", (unsigned long long)MAIN_BENCHMARK_SIZE);
+        return;
+    }
+
+    fillBenchmarkBuffer(buffer, MAIN_BENCHMARK_SIZE);
+
+    printf("Stream checker: ");
+    isBalancedBuffer(buffer, MAIN_BENCHMARK_SIZE, &streamResult);
+    printStreamResult(&streamResult);
+
+    /* Loop: Until one thread per core, doubling the threads */
+    for (uint32_t threadsCount = 1; ; threadsCount = ((threadsCount * 2) < coresCount) ? (threadsCount * 2) : coresCount)
+    {
+        isBalancedParallel(buffer, MAIN_BENCHMARK_SIZE, threadsCount, &result);
+
+        printf("%u thread(s): ", threadsCount);
+        printStreamResult(&result);
+        printf("    %.2fx the stream checker, %s result\n", (result.seconds > 0.0) ? (streamResult.seconds / result.seconds) : 0.0,
+               ((result.state == streamResult.state) && (result.errorOffset == streamResult.errorOffset)) ? "same" : "NOT the same");
+
+        if (threadsCount >= coresCount)
+        {
+            break;
+        }
+    }
+
+    printf("\n");
+
+    free(buffer);
+}
+
 /**************************************************************************************************************************/
\ No newline at end of file
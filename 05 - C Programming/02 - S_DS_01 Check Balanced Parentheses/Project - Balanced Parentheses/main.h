@@ -13,13 +13,28 @@
 /* Main Includes */
 #include "stack.h"
 #include "balanced.h"
+#include "stream.h"
+#include "parallel.h"
+#include <string.h>
 
 #pragma warning(disable : 4996)
 
+/* Number of bytes each expression is fed to the stream checker at once, to show it works across chunks */
+#define MAIN_STREAM_CHUNK_SIZE		4
+/* Size of the generated input the stream checker is timed on, its brackets nesting depth, and 1 byte in how many is a bracket */
+#define MAIN_BENCHMARK_SIZE			((size_t)256 << 20)
+#define MAIN_BENCHMARK_DEPTH		64
+#define MAIN_BENCHMARK_SPACING		32
+/* Number of threads each expression is split over by the parallel checker */
+#define MAIN_PARALLEL_THREADS		4
+
 /**************************************************************************************************************************/
 /* Main Functions' Prototypes */
 void startTestProgram(void);
 void startProgram(void);
+void startStreamProgram(void);
+void startFileProgram(const char* fileName);
+void startParallelProgram(void);
 
 /**************************************************************************************************************************/
 
@@ -0,0 +1,484 @@
+/*
+ * parallel.c
+ *
+ *     Created on: Oct 17, 2026
+ *         Author: Abdelrhman Walaa - https://github.com/AbdelrhmanWalaa
+ *    Description: This file contains all Parallel Balanced Parentheses functions' implementation.
+ */
+
+/* Parallel */
+#include "parallel.h"
+
+/* Platform threads and number of cores */
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+/**************************************************************************************************************************/
+/*
+ Name: parallelCoresCount
+ Input: void
+ Output: uint32 number of cores
+ Description: Function to get the number of cores the OS runs threads on, at least 1.
+*/
+uint32_t parallelCoresCount(void)
+{
+#ifdef _WIN32
+	SYSTEM_INFO info;
+
+	GetSystemInfo(&info);
+
+	return (info.dwNumberOfProcessors != 0) ? (uint32_t)info.dwNumberOfProcessors : 1;
+#else
+	long cores = sysconf(_SC_NPROCESSORS_ONLN);
+
+	return (cores > 0) ? (uint32_t)cores : 1;
+#endif
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: parallelThread
+ Input: Pointer to chunk
+ Output: 0
+ Description: Static Function run by every thread, to run the current phase on its chunk.
+*/
+#ifdef _WIN32
+static DWORD WINAPI parallelThread(LPVOID parameter)
+{
+	ST_parallelChunk_t *chunk = parameter;
+
+	chunk->phase(chunk);
+
+	return 0;
+}
+#else
+static void *parallelThread(void *parameter)
+{
+	ST_parallelChunk_t *chunk = parameter;
+
+	chunk->phase(chunk);
+
+	return NULL;
+}
+#endif
+
+/**************************************************************************************************************************/
+/*
+ Name: parallelRun
+ Input: Pointer to chunks, uint32 count and Pointer to phase function
+ Output: void
+ Description: Static Function to run a phase on all chunks, the first one on the calling thread and each other one on its own thread, and wait for all of them. A chunk its thread can't be started for is run on the calling thread.
+*/
+static void parallelRun(ST_parallelChunk_t *chunks, uint32_t count, void (*phase)(ST_parallelChunk_t *chunk))
+{
+#ifdef _WIN32
+	HANDLE threads[PARALLEL_MAX_THREADS];
+#else
+	pthread_t threads[PARALLEL_MAX_THREADS];
+#endif
+	uint8_t started[PARALLEL_MAX_THREADS];
+
+	/* Loop: Until a thread is started for each chunk but the first */
+	for (uint32_t index = 1; index < count; index++)
+	{
+		chunks[index].phase = phase;
+#ifdef _WIN32
+		threads[index] = CreateThread(NULL, 0, parallelThread, &chunks[index], 0, NULL);
+		started[index] = (threads[index] != NULL);
+#else
+		started[index] = (pthread_create(&threads[index], NULL, parallelThread, &chunks[index]) == 0);
+#endif
+	}
+
+	phase(&chunks[0]);
+
+	/* Loop: Until all threads are done */
+	for (uint32_t index = 1; index < count; index++)
+	{
+		if (started[index])
+		{
+#ifdef _WIN32
+			WaitForSingleObject(threads[index], INFINITE);
+			CloseHandle(threads[index]);
+#else
+			pthread_join(threads[index], NULL);
+#endif
+		}
+		else
+		{
+			phase(&chunks[index]);
+		}
+	}
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: parallelBracket
+ Input: Pointer to chunk, uint8 bracket and size_t index
+ Output: int8 errorState
+ Description: Static Function to take one bracket of the chunk at its index, push it if it is an opener, pop its opener if it is a closer, or keep it under the openers if no opener of the chunk is left.
+*/
+static int8_t parallelBracket(ST_parallelChunk_t *chunk, uint8_t bracket, size_t index)
+{
+	uint8_t data = 0;
+
+	chunk->bracketsCount++;
+
+	/* Check 1: Required bracket */
+	switch (bracket)
+	{
+		/* Case 1: Bracket is an opener */
+		case '(':
+		case '[':
+		case '{':
+		case '<':
+			if (pushGrowable(&chunk->arena, bracket) == STACK_INT8_NO_MEMORY)
+			{
+				chunk->errorState = STREAM_INT8_NO_MEMORY;
+			}
+			break;
+
+		/* Case 2: Bracket is a closer, no opener of the chunk is left so it is matched once the chunks before it are known */
+		default:
+			if (chunk->arena.count == chunk->closersCount)
+			{
+				if (pushGrowable(&chunk->arena, bracket) == STACK_INT8_NO_MEMORY)
+				{
+					chunk->errorState = STREAM_INT8_NO_MEMORY;
+				}
+				else
+				{
+					chunk->closersCount++;
+				}
+			}
+			else
+			{
+				popGrowable(&chunk->arena, &data);
+
+				if (data != STREAM_OPENER(bracket))
+				{
+					chunk->errorState = BLPAR_INT8_NOT_BALANCED;
+					chunk->errorOffset = chunk->offset + index;
+				}
+			}
+			break;
+	}
+
+	return chunk->errorState;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: parallelReduce
+ Input: Pointer to chunk
+ Output: void
+ Description: Static Function to reduce a chunk to its closers not matched and its openers not closed, stopping at the first closer that doesn't match its opener of the chunk.
+*/
+static void parallelReduce(ST_parallelChunk_t *chunk)
+{
+	size_t index = 0;
+
+#ifdef STREAM_SIMD_SSE2
+	/* Loop: Until the last full block of the chunk */
+	for (; (index + STREAM_BLOCK_SIZE) <= chunk->size; index += STREAM_BLOCK_SIZE)
+	{
+		uint32_t mask = streamBracketsMask(&chunk->bytes[index]);
+
+		/* Loop: Until all brackets of the block are checked */
+		while (mask != 0)
+		{
+			uint32_t bit = streamFirstBit(mask);
+
+			mask &= mask - 1;
+
+			if (parallelBracket(chunk, chunk->bytes[index + bit], index + bit) != STREAM_INT8_OK)
+			{
+				return;
+			}
+		}
+	}
+#endif
+
+	/* Loop: Until the end of chunk, one byte at a time */
+	for (; index < chunk->size; index++)
+	{
+		switch (chunk->bytes[index])
+		{
+			case '(': case ')': case '[': case ']': case '{': case '}': case '<': case '>':
+				if (parallelBracket(chunk, chunk->bytes[index], index) != STREAM_INT8_OK)
+				{
+					return;
+				}
+				break;
+		}
+	}
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: parallelLocateCloser
+ Input: Pointer to chunk and uint64 closer
+ Output: uint64 offset
+ Description: Static Function to find the offset of a closer of the chunk arena, from the bottom, by checking the depth of the chunk again. Only needed once that closer is known to be an error.
+*/
+static uint64_t parallelLocateCloser(const ST_parallelChunk_t *chunk, uint64_t closer)
+{
+	uint64_t depth = 0;
+	uint64_t closers = 0;
+
+	/* Loop: Until the closer is found */
+	for (size_t index = 0; index < chunk->size; index++)
+	{
+		switch (chunk->bytes[index])
+		{
+			case '(': case '[': case '{': case '<':
+				depth++;
+				break;
+
+			case ')': case ']': case '}': case '>':
+				if (depth != 0)
+				{
+					depth--;
+				}
+				else if (closers++ == closer)
+				{
+					return chunk->offset + index;
+				}
+				break;
+		}
+	}
+
+	return chunk->offset + chunk->size;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: parallelLocateOpener
+ Input: Pointer to chunk and uint64 opener
+ Output: uint64 offset
+ Description: Static Function to find the offset of an opener of the chunk arena, from the bottom of the openers, by checking the depth of the chunk again: it is the last opener pushed at that depth.
+*/
+static uint64_t parallelLocateOpener(const ST_parallelChunk_t *chunk, uint64_t opener)
+{
+	uint64_t depth = 0;
+	uint64_t offset = chunk->offset;
+
+	/* Loop: Until the end of chunk */
+	for (size_t index = 0; index < chunk->size; index++)
+	{
+		switch (chunk->bytes[index])
+		{
+			case '(': case '[': case '{': case '<':
+				if (depth++ == opener)
+				{
+					offset = chunk->offset + index;
+				}
+				break;
+
+			case ')': case ']': case '}': case '>':
+				if (depth != 0)
+				{
+					depth--;
+				}
+				break;
+		}
+	}
+
+	return offset;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: parallelOwner
+ Input: Pointer to chunks, uint32 index and uint64 level
+ Output: uint32 index of the owner chunk
+ Description: Static Function to find, from the chunk before index back, the chunk that pushed the opener at that level of the input stack: the first one its openers start at or below the level.
+*/
+static uint32_t parallelOwner(const ST_parallelChunk_t *chunks, uint32_t index, uint64_t level)
+{
+	/* Loop: Until a chunk with openers at the level */
+	while (level < (chunks[index - 1].startDepth - chunks[index - 1].closersCount))
+	{
+		index--;
+	}
+
+	return index - 1;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: parallelMatch
+ Input: Pointer to chunk
+ Output: void
+ Description: Static Function to match the closers kept in a chunk arena with the openers of the chunks before it, from the top of the input stack down, and keep the offset of the first one that doesn't match.
+*/
+static void parallelMatch(ST_parallelChunk_t *chunk)
+{
+	uint64_t count = (chunk->closersCount < chunk->startDepth) ? chunk->closersCount : chunk->startDepth;
+	uint32_t owner = chunk->index - 1;
+
+	/* Loop: Until all closers that have an opener are matched */
+	for (uint64_t closer = 0; closer < count; closer++)
+	{
+		uint64_t level = chunk->startDepth - 1 - closer;
+		const ST_parallelChunk_t *previous = NULL;
+
+		owner = parallelOwner(chunk->chunks, owner + 1, level);
+		previous = &chunk->chunks[owner];
+
+		if (previous->arena.elements[previous->closersCount + (level - (previous->startDepth - previous->closersCount))] != STREAM_OPENER(chunk->arena.elements[closer]))
+		{
+			chunk->errorState = BLPAR_INT8_NOT_BALANCED;
+			chunk->errorOffset = parallelLocateCloser(chunk, closer);
+			return;
+		}
+	}
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: isBalancedParallel
+ Input: Pointer uint8 buffer, size_t size, uint32 threadsCount and Pointer stream result structure
+ Output: int8 errorState
+ Description: Function to check the brackets of a whole buffer over threadsCount threads, or one per core if 0, and store the result with its throughput. The state and error offset are the same as isBalancedBuffer: the first closer that doesn't match, else the first opener that is never closed. All bytes are counted as checked.
+*/
+int8_t isBalancedParallel(const uint8_t *buffer, size_t size, uint32_t threadsCount, ST_streamResult_t *result)
+{
+	ST_parallelChunk_t chunks[PARALLEL_MAX_THREADS];
+	uint32_t lastChunk = 0;
+	uint64_t depth = 0;
+	int8_t errorState = STREAM_INT8_OK;
+	double start = streamNow();
+
+	/* Check 1: Number of threads, one per core with chunks not too small, at least one byte per thread */
+	if (threadsCount == 0)
+	{
+		threadsCount = parallelCoresCount();
+
+		if (threadsCount > (size / PARALLEL_MIN_CHUNK_SIZE))
+		{
+			threadsCount = (uint32_t)(size / PARALLEL_MIN_CHUNK_SIZE);
+		}
+	}
+
+	if (threadsCount > PARALLEL_MAX_THREADS)
+	{
+		threadsCount = PARALLEL_MAX_THREADS;
+	}
+
+	if (threadsCount > size)
+	{
+		threadsCount = (uint32_t)size;
+	}
+
+	if (threadsCount == 0)
+	{
+		threadsCount = 1;
+	}
+
+	/* Step 1: Split the buffer, and reduce each chunk on its own thread */
+	for (uint32_t index = 0; index < threadsCount; index++)
+	{
+		size_t first = ((size / threadsCount) * index) + ((index < (size % threadsCount)) ? index : (size % threadsCount));
+		size_t next = ((size / threadsCount) * (index + 1)) + (((index + 1) < (size % threadsCount)) ? (index + 1) : (size % threadsCount));
+
+		chunks[index].bytes = &buffer[first];
+		chunks[index].offset = first;
+		chunks[index].size = next - first;
+		createGrowableStack(&chunks[index].arena);
+		chunks[index].closersCount = 0;
+		chunks[index].bracketsCount = 0;
+		chunks[index].startDepth = 0;
+		chunks[index].errorOffset = 0;
+		chunks[index].errorState = STREAM_INT8_OK;
+		chunks[index].chunks = chunks;
+		chunks[index].index = index;
+	}
+
+	parallelRun(chunks, threadsCount, parallelReduce);
+
+	/* Step 2: Scan the depth of the input stack at the start of each chunk, until the first chunk with an error */
+	lastChunk = threadsCount - 1;
+
+	for (uint32_t index = 0; index < threadsCount; index++)
+	{
+		chunks[index].startDepth = depth;
+
+		/* Check 2.1: Closers of the chunk pop more openers than the input stack has */
+		if (chunks[index].closersCount > depth)
+		{
+			chunks[index].errorState = BLPAR_INT8_NOT_BALANCED;
+			chunks[index].errorOffset = parallelLocateCloser(&chunks[index], depth);
+		}
+
+		/* Check 2.2: No chunk after an error is needed */
+		if (chunks[index].errorState != STREAM_INT8_OK)
+		{
+			lastChunk = index;
+			break;
+		}
+
+		depth = depth - chunks[index].closersCount + (chunks[index].arena.count - chunks[index].closersCount);
+	}
+
+	/* Step 3: Match the closers kept by each chunk with the openers of the chunks before it */
+	if (lastChunk != 0)
+	{
+		parallelRun(&chunks[1], lastChunk, parallelMatch);
+	}
+
+	/* Step 4: Result is the first error of all chunks, else the first opener never closed */
+	result->state = BLPAR_INT8_BALANCED;
+	result->errorOffset = 0;
+	result->bytesCount = size;
+	result->bracketsCount = 0;
+
+	for (uint32_t index = 0; index <= lastChunk; index++)
+	{
+		result->bracketsCount += chunks[index].bracketsCount;
+
+		if ((chunks[index].errorState != STREAM_INT8_OK) && (result->state == BLPAR_INT8_BALANCED))
+		{
+			errorState = chunks[index].errorState;
+			result->state = BLPAR_INT8_NOT_BALANCED;
+			result->errorOffset = chunks[index].errorOffset;
+		}
+	}
+
+	/* Check 3: No closer errors, but openers are never closed */
+	if ((result->state == BLPAR_INT8_BALANCED) && (depth != 0))
+	{
+		uint32_t owner = parallelOwner(chunks, threadsCount, 0);
+
+		result->state = BLPAR_INT8_NOT_BALANCED;
+		result->errorOffset = parallelLocateOpener(&chunks[owner], 0);
+	}
+	/* Check 4: No brackets at all */
+	else if ((result->state == BLPAR_INT8_BALANCED) && (result->bracketsCount == 0))
+	{
+		result->state = BLPAR_INT8_NO_PAR_USED;
+	}
+
+	/* Check 5: Arena of a chunk couldn't grow, nothing is known after it */
+	if (errorState != STREAM_INT8_NO_MEMORY)
+	{
+		errorState = result->state;
+	}
+
+	/* Loop: Until all arenas are freed */
+	for (uint32_t index = 0; index < threadsCount; index++)
+	{
+		freeGrowableStack(&chunks[index].arena);
+	}
+
+	result->seconds = streamNow() - start;
+	result->gigabytesPerSecond = (result->seconds > 0.0) ? ((double)result->bytesCount / result->seconds / 1e9) : 0.0;
+
+	return errorState;
+}
+
+/**************************************************************************************************************************/
\ No newline at end of file
@@ -0,0 +1,58 @@
+/*
+ * parallel.h
+ *
+ *   Created on: Oct 17, 2026
+ *       Author: Abdelrhman Walaa - https://github.com/AbdelrhmanWalaa
+ *  Description: This file contains all Parallel Balanced Parentheses functions' prototypes and definitions (Macros) to avoid magic numbers.
+ */
+
+#ifndef PARALLEL_H_
+#define PARALLEL_H_
+
+/**************************************************************************************************************************/
+/* Parallel Includes */
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "stack.h"
+#include "balanced.h"
+#include "stream.h"
+
+/**************************************************************************************************************************/
+/* Parallel Macros */
+
+/* Max. number of threads an input is split over */
+#define PARALLEL_MAX_THREADS			64
+/* Min. size of a chunk when the number of threads is picked from the number of cores */
+#define PARALLEL_MIN_CHUNK_SIZE			(1 << 16)
+
+/*
+ * Each thread reduces its chunk to a summary kept in its own arena: the closers that don't match any opener of the
+ * chunk, then the openers that are never closed in the chunk, e.g. "]>(a)({" is kept as "]>({". A scan of the
+ * summaries gives the depth of the input stack at the start of each chunk, so each thread then matches its closers
+ * against the openers of the chunks before it with no locks. Offsets are only looked for once an error is found.
+ */
+typedef struct parallelChunk {
+	const uint8_t* bytes;
+	uint64_t offset;				// Offset of the chunk in the input
+	size_t size;
+	ST_growableStack_t arena;		// Closers not matched in the chunk, then openers not closed in the chunk
+	uint64_t closersCount;			// Closers at the bottom of the arena
+	uint64_t bracketsCount;
+	uint64_t startDepth;			// Openers on the input stack before the chunk, from the scan
+	uint64_t errorOffset;			// Offset of the first closer that doesn't match, if errorState is BLPAR_INT8_NOT_BALANCED
+	int8_t errorState;				// STREAM_INT8_OK, BLPAR_INT8_NOT_BALANCED or STREAM_INT8_NO_MEMORY
+	struct parallelChunk* chunks;	// All chunks of the input, the ones before this chunk are read when matching
+	uint32_t index;
+	void (*phase)(struct parallelChunk* chunk);
+}ST_parallelChunk_t;
+
+/**************************************************************************************************************************/
+/* Parallel Functions' Prototypes */
+
+uint32_t parallelCoresCount(void);
+int8_t isBalancedParallel(const uint8_t* buffer, size_t size, uint32_t threadsCount, ST_streamResult_t* result);
+
+/**************************************************************************************************************************/
+
+#endif /* PARALLEL_H_ */
\ No newline at end of file
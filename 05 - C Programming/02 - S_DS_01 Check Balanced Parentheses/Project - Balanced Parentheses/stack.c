@@ -184,4 +184,88 @@ int8_t isEmpty(ST_stack_t *stack)
 	return errorState;
 }
 
+/**************************************************************************************************************************/
+/*
+ Name: createGrowableStack
+ Input: Pointer growable stack structure
+ Output: void
+ Description: Function to take a reference to growable stack type, and initialize it empty with no elements allocated yet.
+*/
+void createGrowableStack(ST_growableStack_t *stack)
+{
+	stack->elements = NULL;
+	stack->count = 0;
+	stack->size = 0;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: pushGrowable
+ Input: Pointer growable stack structure and uint8 data
+ Output: int8 errorState
+ Description: Function to take a reference to the growable stack and data to store, then stores the data passed into the stack, doubling its size first if it is full.
+*/
+int8_t pushGrowable(ST_growableStack_t *stack, uint8_t data)
+{
+	int8_t errorState = STACK_INT8_OK;
+
+	/* Check 1: Stack is full, grow it */
+	if (stack->count == stack->size)
+	{
+		size_t newSize = (stack->size == 0) ? STACK_GROWABLE_MIN_SIZE : (stack->size * 2);
+		uint8_t *newElements = realloc(stack->elements, newSize);
+
+		/* Check 1.1: Stack can't grow */
+		if (newElements == NULL)
+		{
+			return STACK_INT8_NO_MEMORY;
+		}
+
+		stack->elements = newElements;
+		stack->size = newSize;
+	}
+
+	stack->elements[stack->count++] = data;
+
+	return errorState;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: popGrowable
+ Input: Pointer growable stack structure and Pointer to uint8 data
+ Output: int8 errorState
+ Description: Function to take a reference to the growable stack, then stores the data popped from the stack in a data variable.
+*/
+int8_t popGrowable(ST_growableStack_t *stack, uint8_t *data)
+{
+	int8_t errorState = STACK_INT8_OK;
+
+	/* Check 1: Stack is empty */
+	if (stack->count == 0)
+	{
+		errorState = STACK_INT8_EMPTY_STACK;
+	}
+	/* Check 2: Stack is not empty */
+	else
+	{
+		*data = stack->elements[--stack->count];
+	}
+
+	return errorState;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: freeGrowableStack
+ Input: Pointer growable stack structure
+ Output: void
+ Description: Function to take a reference to the growable stack, then frees its elements and leaves it empty.
+*/
+void freeGrowableStack(ST_growableStack_t *stack)
+{
+	free(stack->elements);
+	createGrowableStack(stack);
+}
+
 /**************************************************************************************************************************/
\ No newline at end of file
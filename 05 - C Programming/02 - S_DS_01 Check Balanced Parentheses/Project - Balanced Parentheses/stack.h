@@ -12,6 +12,7 @@
 /**************************************************************************************************************************/
 /* Stack Includes */
 #include <stdio.h>
+#include <stdlib.h>
 
 /**************************************************************************************************************************/
 /* Stack Macros */
@@ -28,10 +29,20 @@ typedef struct stack {
 	int8_t top;
 }ST_stack_t;
 
+/* Growable stack, its elements are reallocated to twice their size whenever it is full */
+#define STACK_GROWABLE_MIN_SIZE	64
+
+typedef struct growableStack {
+	uint8_t* elements;
+	size_t count;
+	size_t size;
+}ST_growableStack_t;
+
 /* Stack Return Types */
 #define STACK_INT8_FULL_STACK			 -1		// If the stack is full
 #define STACK_INT8_EMPTY_STACK			 -2		// If the stack is empty
 #define STACK_INT8_OK					  0		// If the stack neither full nor empty
+#define STACK_INT8_NO_MEMORY			 -3		// If the growable stack can't grow
 
 /**************************************************************************************************************************/
 /* Stack Functions' Prototypes */
@@ -44,6 +55,11 @@ int8_t getStackTop(ST_stack_t* stack, uint8_t* topData);
 int8_t isFull(ST_stack_t* stack);
 int8_t isEmpty(ST_stack_t* stack);
 
+void createGrowableStack(ST_growableStack_t* stack);
+int8_t pushGrowable(ST_growableStack_t* stack, uint8_t data);
+int8_t popGrowable(ST_growableStack_t* stack, uint8_t* data);
+void freeGrowableStack(ST_growableStack_t* stack);
+
 /**************************************************************************************************************************/
 
 #endif /* STACK_H_ */
\ No newline at end of file
@@ -0,0 +1,344 @@
+/*
+ * stream.c
+ *
+ *     Created on: Oct 17, 2026
+ *         Author: Abdelrhman Walaa - https://github.com/AbdelrhmanWalaa
+ *    Description: This file contains all Stream Balanced Parentheses functions' implementation.
+ */
+
+/* Stream */
+#include "stream.h"
+
+/**************************************************************************************************************************/
+/*
+ Name: streamNow
+ Input: void
+ Output: double time in seconds
+ Description: Function to read the wall clock, to time the checks.
+*/
+double streamNow(void)
+{
+	struct timespec time;
+
+	timespec_get(&time, TIME_UTC);
+
+	return (double)time.tv_sec + ((double)time.tv_nsec / 1e9);
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: streamBracket
+ Input: Pointer stream checker structure, uint8 bracket and uint64 offset
+ Output: int8 errorState
+ Description: Static Function to take one bracket at its offset, push it if it is an opener, or pop its opener if it is a closer, and keep the offset of the first closer that doesn't match.
+*/
+static int8_t streamBracket(ST_streamChecker_t *checker, uint8_t bracket, uint64_t offset)
+{
+	uint8_t data = 0;
+
+	checker->bracketsCount++;
+
+	/* Check 1: Required bracket */
+	switch (bracket)
+	{
+		/* Case 1: Bracket is an opener, the offset of the bottom one is kept as the first one not closed */
+		case '(':
+		case '[':
+		case '{':
+		case '<':
+			if (checker->stack.count == 0)
+			{
+				checker->firstOpenerOffset = offset;
+			}
+
+			if (pushGrowable(&checker->stack, bracket) == STACK_INT8_NO_MEMORY)
+			{
+				checker->errorState = STREAM_INT8_NO_MEMORY;
+			}
+			break;
+
+		/* Case 2: Bracket is a closer */
+		default:
+			if ((popGrowable(&checker->stack, &data) == STACK_INT8_EMPTY_STACK) || (data != STREAM_OPENER(bracket)))
+			{
+				checker->errorState = BLPAR_INT8_NOT_BALANCED;
+				checker->errorOffset = offset;
+			}
+			break;
+	}
+
+	return checker->errorState;
+}
+
+#ifdef STREAM_SIMD_SSE2
+/**************************************************************************************************************************/
+/*
+ Name: streamBrackets16
+ Input: 16 bytes
+ Output: 16 bytes mask
+ Description: Static Function to set the bytes that are brackets to 0xFF, and all others to 0. Each pair of brackets differs by one bit, but for '[' and ']', so: '(' and ')' are 0x28 with bit 0 cleared, '<' and '>' are 0x3C with bit 1 cleared, and '[' '{' and ']' '}' are 0x5B and 0x5D with bit 5 cleared.
+*/
+static __m128i streamBrackets16(__m128i bytes)
+{
+	__m128i folded = _mm_and_si128(bytes, _mm_set1_epi8((char)0xDF));
+	__m128i round = _mm_cmpeq_epi8(_mm_and_si128(bytes, _mm_set1_epi8((char)0xFE)), _mm_set1_epi8(0x28));
+	__m128i angle = _mm_cmpeq_epi8(_mm_and_si128(bytes, _mm_set1_epi8((char)0xFD)), _mm_set1_epi8(0x3C));
+	__m128i squareCurly = _mm_or_si128(_mm_cmpeq_epi8(folded, _mm_set1_epi8(0x5B)), _mm_cmpeq_epi8(folded, _mm_set1_epi8(0x5D)));
+
+	return _mm_or_si128(_mm_or_si128(round, angle), squareCurly);
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: streamBracketsMask
+ Input: Pointer to STREAM_BLOCK_SIZE bytes
+ Output: uint32 mask
+ Description: Function to get a mask with bit N set if byte N of the block is a bracket.
+*/
+uint32_t streamBracketsMask(const uint8_t *block)
+{
+	__m128i low = _mm_loadu_si128((const __m128i *)block);
+	__m128i high = _mm_loadu_si128((const __m128i *)(block + 16));
+
+	return (uint32_t)_mm_movemask_epi8(streamBrackets16(low)) | ((uint32_t)_mm_movemask_epi8(streamBrackets16(high)) << 16);
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: streamFirstBit
+ Input: uint32 mask, not 0
+ Output: uint32 index of the lowest bit set
+ Description: Function to find the next bracket in a mask.
+*/
+uint32_t streamFirstBit(uint32_t mask)
+{
+#if defined(_MSC_VER)
+	unsigned long index;
+
+	_BitScanForward(&index, mask);
+
+	return (uint32_t)index;
+#else
+	return (uint32_t)__builtin_ctz(mask);
+#endif
+}
+#endif
+
+/**************************************************************************************************************************/
+/*
+ Name: createStreamChecker
+ Input: Pointer stream checker structure
+ Output: void
+ Description: Function to take a reference to stream checker type, and initialize it for a new input with no bytes fed yet.
+*/
+void createStreamChecker(ST_streamChecker_t *checker)
+{
+	createGrowableStack(&checker->stack);
+	checker->offset = 0;
+	checker->bracketsCount = 0;
+	checker->firstOpenerOffset = 0;
+	checker->errorOffset = 0;
+	checker->errorState = STREAM_INT8_OK;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: feedStreamChecker
+ Input: Pointer stream checker structure, Pointer uint8 chunk and size_t size
+ Output: int8 errorState
+ Description: Function to take the next chunk of an input of any length, in any number of chunks of any size, and check its brackets (), [], {} and <>. A SIMD pass finds the brackets of each block of the chunk, so only they are looked at one by one. Once a closer doesn't match, returns BLPAR_INT8_NOT_BALANCED and the chunks after it aren't checked.
+*/
+int8_t feedStreamChecker(ST_streamChecker_t *checker, const uint8_t *chunk, size_t size)
+{
+	size_t index = 0;
+
+	/* Check 1: Input already not balanced, or the stack can't grow */
+	if (checker->errorState != STREAM_INT8_OK)
+	{
+		return checker->errorState;
+	}
+
+#ifdef STREAM_SIMD_SSE2
+	/* Loop: Until the last full block of the chunk */
+	for (; (index + STREAM_BLOCK_SIZE) <= size; index += STREAM_BLOCK_SIZE)
+	{
+		uint32_t mask = streamBracketsMask(&chunk[index]);
+
+		/* Loop: Until all brackets of the block are checked */
+		while (mask != 0)
+		{
+			uint32_t bit = streamFirstBit(mask);
+
+			mask &= mask - 1;
+
+			if (streamBracket(checker, chunk[index + bit], checker->offset + index + bit) != STREAM_INT8_OK)
+			{
+				checker->offset += index + bit + 1;
+				return checker->errorState;
+			}
+		}
+	}
+#endif
+
+	/* Loop: Until the end of chunk, one byte at a time */
+	for (; index < size; index++)
+	{
+		switch (chunk[index])
+		{
+			case '(': case ')': case '[': case ']': case '{': case '}': case '<': case '>':
+				if (streamBracket(checker, chunk[index], checker->offset + index) != STREAM_INT8_OK)
+				{
+					checker->offset += index + 1;
+					return checker->errorState;
+				}
+				break;
+		}
+	}
+
+	checker->offset += size;
+
+	return STREAM_INT8_OK;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: finishStreamChecker
+ Input: Pointer stream checker structure and Pointer stream result structure
+ Output: int8 errorState
+ Description: Function to take a reference to the stream checker once all chunks are fed, and store its result: the offset of the first mismatch is the first closer that doesn't match, else the first opener that is never closed. Returns the state of the result, or STREAM_INT8_NO_MEMORY if the stack couldn't grow.
+*/
+int8_t finishStreamChecker(ST_streamChecker_t *checker, ST_streamResult_t *result)
+{
+	result->bytesCount = checker->offset;
+	result->bracketsCount = checker->bracketsCount;
+	result->errorOffset = 0;
+	result->seconds = 0.0;
+	result->gigabytesPerSecond = 0.0;
+
+	/* Check 1: Stack couldn't grow, nothing is known about the input */
+	if (checker->errorState == STREAM_INT8_NO_MEMORY)
+	{
+		result->state = BLPAR_INT8_NOT_BALANCED;
+		return STREAM_INT8_NO_MEMORY;
+	}
+	/* Check 2: A closer doesn't match */
+	else if (checker->errorState == BLPAR_INT8_NOT_BALANCED)
+	{
+		result->state = BLPAR_INT8_NOT_BALANCED;
+		result->errorOffset = checker->errorOffset;
+	}
+	/* Check 3: An opener is never closed */
+	else if (checker->stack.count != 0)
+	{
+		result->state = BLPAR_INT8_NOT_BALANCED;
+		result->errorOffset = checker->firstOpenerOffset;
+	}
+	/* Check 4: No brackets at all */
+	else if (checker->bracketsCount == 0)
+	{
+		result->state = BLPAR_INT8_NO_PAR_USED;
+	}
+	else
+	{
+		result->state = BLPAR_INT8_BALANCED;
+	}
+
+	return result->state;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: freeStreamChecker
+ Input: Pointer stream checker structure
+ Output: void
+ Description: Function to take a reference to the stream checker, then frees its stack.
+*/
+void freeStreamChecker(ST_streamChecker_t *checker)
+{
+	freeGrowableStack(&checker->stack);
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: isBalancedBuffer
+ Input: Pointer uint8 buffer, size_t size and Pointer stream result structure
+ Output: int8 errorState
+ Description: Function to check the brackets of a whole buffer, e.g. a memory-mapped file, in one pass and store the result with its throughput.
+*/
+int8_t isBalancedBuffer(const uint8_t *buffer, size_t size, ST_streamResult_t *result)
+{
+	int8_t errorState = STREAM_INT8_OK;
+	ST_streamChecker_t checker;
+	double start = streamNow();
+
+	createStreamChecker(&checker);
+	feedStreamChecker(&checker, buffer, size);
+	errorState = finishStreamChecker(&checker, result);
+	freeStreamChecker(&checker);
+
+	result->seconds = streamNow() - start;
+	result->gigabytesPerSecond = (result->seconds > 0.0) ? ((double)result->bytesCount / result->seconds / 1e9) : 0.0;
+
+	return errorState;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: isBalancedFile
+ Input: Pointer char fileName and Pointer stream result structure
+ Output: int8 errorState
+ Description: Function to check the brackets of a file of any size, read STREAM_CHUNK_SIZE bytes at a time, and store the result with its throughput, reading the file included. Returns STREAM_INT8_FILE_ERROR if the file can't be opened or read.
+*/
+int8_t isBalancedFile(const char *fileName, ST_streamResult_t *result)
+{
+	int8_t errorState = STREAM_INT8_OK;
+	ST_streamChecker_t checker;
+	size_t size = 0;
+	double start = streamNow();
+	uint8_t *chunk = malloc(STREAM_CHUNK_SIZE);
+	FILE *file = fopen(fileName, "rb");
+
+	/* Check 1: File can't be opened, or no memory for a chunk */
+	if ((file == NULL) || (chunk == NULL))
+	{
+		free(chunk);
+
+		if (file != NULL)
+		{
+			fclose(file);
+			return STREAM_INT8_NO_MEMORY;
+		}
+
+		return STREAM_INT8_FILE_ERROR;
+	}
+
+	createStreamChecker(&checker);
+
+	/* Loop: Until the end of file, or the first closer that doesn't match */
+	while ((size = fread(chunk, 1, STREAM_CHUNK_SIZE, file)) != 0)
+	{
+		if (feedStreamChecker(&checker, chunk, size) != STREAM_INT8_OK)
+		{
+			break;
+		}
+	}
+
+	errorState = finishStreamChecker(&checker, result);
+
+	/* Check 2: File can't be read to its end */
+	if ((checker.errorState == STREAM_INT8_OK) && ferror(file))
+	{
+		errorState = STREAM_INT8_FILE_ERROR;
+	}
+
+	freeStreamChecker(&checker);
+	fclose(file);
+	free(chunk);
+
+	result->seconds = streamNow() - start;
+	result->gigabytesPerSecond = (result->seconds > 0.0) ? ((double)result->bytesCount / result->seconds / 1e9) : 0.0;
+
+	return errorState;
+}
+
+/**************************************************************************************************************************/
\ No newline at end of file
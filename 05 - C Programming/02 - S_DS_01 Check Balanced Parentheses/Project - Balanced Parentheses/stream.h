@@ -0,0 +1,82 @@
+/*
+ * stream.h
+ *
+ *   Created on: Oct 17, 2026
+ *       Author: Abdelrhman Walaa - https://github.com/AbdelrhmanWalaa
+ *  Description: This file contains all Stream Balanced Parentheses functions' prototypes and definitions (Macros) to avoid magic numbers.
+ */
+
+#ifndef STREAM_H_
+#define STREAM_H_
+
+/**************************************************************************************************************************/
+/* Stream Includes */
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+#include "stack.h"
+#include "balanced.h"
+
+/* SSE2 is always there on x64, and on x86 unless built with /arch:IA32 */
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define STREAM_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**************************************************************************************************************************/
+/* Stream Macros */
+
+/* Number of bytes read from a file at once */
+#define STREAM_CHUNK_SIZE				(1 << 20)
+/* Number of bytes the SIMD pass looks at once */
+#define STREAM_BLOCK_SIZE				32
+/* Opener of a closer: the character before it for ')', else two characters before it */
+#define STREAM_OPENER(closer)			((uint8_t)(((closer) == ')') ? '(' : ((closer) - 2)))
+
+typedef struct streamChecker {
+	ST_growableStack_t stack;		// Openers not matched yet
+	uint64_t offset;				// Bytes fed so far
+	uint64_t bracketsCount;
+	uint64_t firstOpenerOffset;		// Offset of the opener at the bottom of the stack
+	uint64_t errorOffset;			// Offset of the first closer that doesn't match
+	int8_t errorState;				// STREAM_INT8_OK until a closer doesn't match, or the stack can't grow
+}ST_streamChecker_t;
+
+typedef struct streamResult {
+	int8_t state;					// BLPAR_INT8_BALANCED, BLPAR_INT8_NOT_BALANCED or BLPAR_INT8_NO_PAR_USED
+	uint64_t errorOffset;			// Offset of the first mismatch, if not balanced
+	uint64_t bytesCount;			// Bytes checked, up to the first closer that doesn't match
+	uint64_t bracketsCount;
+	double seconds;
+	double gigabytesPerSecond;
+}ST_streamResult_t;
+
+/* Stream Return Types */
+#define STREAM_INT8_OK					  0		// If the bytes were checked
+#define STREAM_INT8_NO_MEMORY			 -3		// If the stack can't grow
+#define STREAM_INT8_FILE_ERROR			 -4		// If the file can't be read
+
+/**************************************************************************************************************************/
+/* Stream Functions' Prototypes */
+
+double streamNow(void);
+void createStreamChecker(ST_streamChecker_t* checker);
+int8_t feedStreamChecker(ST_streamChecker_t* checker, const uint8_t* chunk, size_t size);
+int8_t finishStreamChecker(ST_streamChecker_t* checker, ST_streamResult_t* result);
+void freeStreamChecker(ST_streamChecker_t* checker);
+int8_t isBalancedBuffer(const uint8_t* buffer, size_t size, ST_streamResult_t* result);
+int8_t isBalancedFile(const char* fileName, ST_streamResult_t* result);
+
+#ifdef STREAM_SIMD_SSE2
+uint32_t streamBracketsMask(const uint8_t* block);
+uint32_t streamFirstBit(uint32_t mask);
+#endif
+
+/**************************************************************************************************************************/
+
+#endif /* STREAM_H_ */
\ No newline at end of file
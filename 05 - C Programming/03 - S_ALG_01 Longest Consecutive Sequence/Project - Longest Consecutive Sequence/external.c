@@ -0,0 +1,617 @@
+/*
+ * external.c
+ *
+ *     Created on: Oct 17, 2026
+ *         Author: Abdelrhman Walaa - https://github.com/AbdelrhmanWalaa
+ *    Description: This file contains all External LCS functions' implementation.
+ */
+
+ /* External */
+#include "external.h"
+
+/* Platform file mapping */
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/* Input file, mapped a view at a time */
+typedef struct externalMap {
+#ifdef _WIN32
+	HANDLE file;
+	HANDLE mapping;
+#else
+	int file;
+#endif
+	uint64_t size;
+	void* view;						// Mapped view, NULL if none
+	size_t viewSize;
+}ST_externalMap_t;
+
+/* Values of a range: the mapped file, or a bucket file */
+typedef struct externalSource {
+	ST_externalMap_t* map;			// NULL for a bucket file
+	FILE* bucket;
+	uint64_t count;					// Values of the source
+	uint64_t position;				// Values read so far
+}ST_externalSource_t;
+
+/* State of a run over a file */
+typedef struct external {
+	size_t budget;
+	int32_t* readBuffer;			// EXTERNAL_READ_COUNT values read from a bucket file
+	ST_externalStats_t* stats;
+	ST_lcsRun_t* run;				// Longest run so far
+	ST_lcsRun_t open;				// Run that ends the ranges solved so far
+	int8_t errorState;
+}ST_external_t;
+
+/**************************************************************************************************************************/
+/*
+ Name: externalUnmapView
+ Input: Pointer to map
+ Output: void
+ Description: Static Function to unmap the mapped view of a file, if any.
+*/
+static void externalUnmapView(ST_externalMap_t* map)
+{
+	if (map->view != NULL)
+	{
+#ifdef _WIN32
+		UnmapViewOfFile(map->view);
+#else
+		munmap(map->view, map->viewSize);
+#endif
+		map->view = NULL;
+	}
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: externalMapView
+ Input: Pointer to map, uint64 offset and size_t size
+ Output: Pointer int32 to values, NULL if the view can't be mapped
+ Description: Static Function to map size bytes of a file from offset, a multiple of EXTERNAL_VIEW_SIZE, in place of the view mapped before.
+*/
+static const int32_t* externalMapView(ST_externalMap_t* map, uint64_t offset, size_t size)
+{
+	externalUnmapView(map);
+
+#ifdef _WIN32
+	map->view = MapViewOfFile(map->mapping, FILE_MAP_READ, (DWORD)(offset >> 32), (DWORD)offset, size);
+#else
+	map->view = mmap(NULL, size, PROT_READ, MAP_PRIVATE, map->file, (off_t)offset);
+
+	if (map->view == MAP_FAILED)
+	{
+		map->view = NULL;
+	}
+	else
+	{
+		madvise(map->view, size, MADV_SEQUENTIAL);
+	}
+#endif
+
+	map->viewSize = size;
+
+	return map->view;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: externalOpen
+ Input: Pointer to map and Pointer to char path
+ Output: int8 errorState
+ Description: Static Function to open a file and get its size, then map it if it is not empty.
+*/
+static int8_t externalOpen(ST_externalMap_t* map, const char* path)
+{
+#ifdef _WIN32
+	LARGE_INTEGER size;
+#else
+	struct stat info;
+#endif
+
+	map->view = NULL;
+	map->viewSize = 0;
+
+#ifdef _WIN32
+	map->mapping = NULL;
+	map->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+
+	/* Check 1: File can't be opened */
+	if ((map->file == INVALID_HANDLE_VALUE) || (GetFileSizeEx(map->file, &size) == 0))
+	{
+		if (map->file != INVALID_HANDLE_VALUE)
+		{
+			CloseHandle(map->file);
+		}
+
+		return EXTERNAL_INT8_FILE_ERROR;
+	}
+
+	map->size = (uint64_t)size.QuadPart;
+
+	/* Check 2: File can't be mapped, an empty file is never mapped */
+	if (map->size != 0)
+	{
+		map->mapping = CreateFileMappingA(map->file, NULL, PAGE_READONLY, 0, 0, NULL);
+
+		if (map->mapping == NULL)
+		{
+			CloseHandle(map->file);
+			return EXTERNAL_INT8_FILE_ERROR;
+		}
+	}
+#else
+	map->file = open(path, O_RDONLY);
+
+	/* Check 1: File can't be opened */
+	if ((map->file < 0) || (fstat(map->file, &info) != 0))
+	{
+		if (map->file >= 0)
+		{
+			close(map->file);
+		}
+
+		return EXTERNAL_INT8_FILE_ERROR;
+	}
+
+	map->size = (uint64_t)info.st_size;
+#endif
+
+	return LCS_INT8_FOUND_LCS;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: externalClose
+ Input: Pointer to map
+ Output: void
+ Description: Static Function to unmap and close a file.
+*/
+static void externalClose(ST_externalMap_t* map)
+{
+	externalUnmapView(map);
+
+#ifdef _WIN32
+	if (map->mapping != NULL)
+	{
+		CloseHandle(map->mapping);
+	}
+
+	CloseHandle(map->file);
+#else
+	close(map->file);
+#endif
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: externalNext
+ Input: Pointer to external, Pointer to source and Pointer to Pointer int32 to values
+ Output: size_t number of values, 0 at the end of the source or if it can't be read
+ Description: Static Function to get the next block of values of a source: the next view of the mapped file, or the next values of a bucket file read in the read buffer.
+*/
+static size_t externalNext(ST_external_t* external, ST_externalSource_t* source, const int32_t** values)
+{
+	uint64_t remaining = source->count - source->position;
+	size_t count = 0;
+
+	/* Check 1: Source is the mapped file, or a bucket file */
+	if (source->map != NULL)
+	{
+		count = (remaining < (EXTERNAL_VIEW_SIZE / sizeof(int32_t))) ? (size_t)remaining : (EXTERNAL_VIEW_SIZE / sizeof(int32_t));
+
+		if (count != 0)
+		{
+			*values = externalMapView(source->map, source->position * sizeof(int32_t), count * sizeof(int32_t));
+		}
+	}
+	else
+	{
+		count = (remaining < EXTERNAL_READ_COUNT) ? (size_t)remaining : EXTERNAL_READ_COUNT;
+
+		if ((count != 0) && (fread(external->readBuffer, sizeof(int32_t), count, source->bucket) == count))
+		{
+			*values = external->readBuffer;
+		}
+		else
+		{
+			*values = NULL;
+		}
+	}
+
+	/* Check 2: Values can't be read */
+	if ((count != 0) && (*values == NULL))
+	{
+		external->errorState = EXTERNAL_INT8_FILE_ERROR;
+		return 0;
+	}
+
+	source->position += count;
+	external->stats->bytesRead += count * sizeof(int32_t);
+
+	return count;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: externalKey, externalValue
+ Input: int32 value, or uint32 key
+ Output: uint32 key, or int32 value
+ Description: Static Functions to flip the sign bit of a value, so keys are in the same order as unsigned integers, and back.
+*/
+static uint32_t externalKey(int32_t value)
+{
+	return (uint32_t)value ^ 0x80000000U;
+}
+
+static int32_t externalValue(uint32_t key)
+{
+	return (int32_t)(key ^ 0x80000000U);
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: externalSolveValues
+ Input: Pointer to external, Pointer to source, uint32 firstKey, uint32 lastKey and Pointer to LCS range
+ Output: void
+ Description: Static Function to solve a range with a hash set of its values, read in place from the mapped file, or from its bucket file in one read.
+*/
+static void externalSolveValues(ST_external_t* external, ST_externalSource_t* source, uint32_t firstKey, uint32_t lastKey, ST_lcsRange_t* range)
+{
+	const int32_t* values = NULL;
+	int32_t* buffer = NULL;
+	size_t count = (size_t)source->count;
+
+	memset(range, 0, sizeof(ST_lcsRange_t));
+
+	/* Check 1: Range has no values */
+	if (count == 0)
+	{
+		return;
+	}
+
+	/* Check 2: Source is the mapped file, or a bucket file */
+	if (source->map != NULL)
+	{
+		values = externalMapView(source->map, 0, count * sizeof(int32_t));
+	}
+	else
+	{
+		buffer = malloc(count * sizeof(int32_t));
+
+		if (buffer == NULL)
+		{
+			external->errorState = LCS_INT8_NO_MEMORY;
+			return;
+		}
+
+		values = (fread(buffer, sizeof(int32_t), count, source->bucket) == count) ? buffer : NULL;
+	}
+
+	if (values == NULL)
+	{
+		external->errorState = EXTERNAL_INT8_FILE_ERROR;
+	}
+	else
+	{
+		external->stats->bytesRead += count * sizeof(int32_t);
+
+		if (lcsGetRange(values, count, externalValue(firstKey), externalValue(lastKey), range) == LCS_INT8_NO_MEMORY)
+		{
+			external->errorState = LCS_INT8_NO_MEMORY;
+		}
+	}
+
+	free(buffer);
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: externalEndRun
+ Input: Pointer to LCS range, uint32 firstKey, uint64 width, uint64 runStart and uint64 runSize
+ Output: void
+ Description: Static Function to keep a run of set bits of a bitmap of the range [firstKey, firstKey + width), and keep it as the run from the first key, or to the last key, if it starts or ends the range.
+*/
+static void externalEndRun(ST_lcsRange_t* range, uint32_t firstKey, uint64_t width, uint64_t runStart, uint64_t runSize)
+{
+	int32_t start = externalValue(firstKey + (uint32_t)runStart);
+
+	/* Check 1: No run */
+	if (runSize == 0)
+	{
+		return;
+	}
+
+	lcsKeepRun(&range->best, start, (size_t)runSize);
+
+	if (runStart == 0)
+	{
+		range->prefixSize = (size_t)runSize;
+	}
+
+	if ((runStart + runSize) == width)
+	{
+		range->suffix.start = start;
+		range->suffix.size = (size_t)runSize;
+	}
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: externalSolveBitmap
+ Input: Pointer to external, Pointer to source, uint32 firstKey, uint32 lastKey and Pointer to LCS range
+ Output: void
+ Description: Static Function to solve a range with a bitmap of the range: a bit is set for each value, then the runs are the runs of set bits, so duplicates take no memory.
+*/
+static void externalSolveBitmap(ST_external_t* external, ST_externalSource_t* source, uint32_t firstKey, uint32_t lastKey, ST_lcsRange_t* range)
+{
+	uint64_t width = (uint64_t)lastKey - firstKey + 1;
+	uint64_t runStart = 0, runSize = 0;
+	uint64_t* bits = calloc((size_t)((width + 63) / 64), sizeof(uint64_t));
+	const int32_t* values = NULL;
+	size_t count = 0;
+
+	memset(range, 0, sizeof(ST_lcsRange_t));
+
+	/* Check 1: No memory for the bitmap */
+	if (bits == NULL)
+	{
+		external->errorState = LCS_INT8_NO_MEMORY;
+		return;
+	}
+
+	external->stats->bitmapBuckets++;
+
+	/* Step 1: Set the bit of each value */
+	while ((count = externalNext(external, source, &values)) != 0)
+	{
+		for (size_t index = 0; index < count; index++)
+		{
+			uint32_t bit = externalKey(values[index]) - firstKey;
+
+			bits[bit >> 6] |= (uint64_t)1 << (bit & 63);
+		}
+	}
+
+	/* Step 2: Runs of set bits, a whole word of set or clear bits at once */
+	for (uint64_t bit = 0; bit < width; bit++)
+	{
+		uint64_t word = bits[bit >> 6];
+
+		if (((bit & 63) == 0) && ((bit + 64) <= width) && (word == UINT64_MAX))
+		{
+			runStart = (runSize == 0) ? bit : runStart;
+			runSize += 64;
+			bit += 63;
+		}
+		else if ((word >> (bit & 63)) & 1)
+		{
+			runStart = (runSize == 0) ? bit : runStart;
+			runSize++;
+		}
+		else
+		{
+			externalEndRun(range, firstKey, width, runStart, runSize);
+			runSize = 0;
+			bit += (((bit & 63) == 0) && (word == 0)) ? 63 : 0;
+		}
+	}
+
+	externalEndRun(range, firstKey, width, runStart, runSize);
+
+	free(bits);
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: externalSolve
+ Input: Pointer to external, Pointer to source, uint32 firstKey and uint32 lastKey
+ Output: void
+ Description: Static Function to solve the range [firstKey, lastKey] of values of a source and stitch its runs with the ranges solved before it: with a bitmap of its width or a hash set of its values, the one that takes less memory and fits in the memory budget, else by splitting it in bucket files, each solved the same way in order.
+*/
+static void externalSolve(ST_external_t* external, ST_externalSource_t* source, uint32_t firstKey, uint32_t lastKey)
+{
+	FILE* buckets[EXTERNAL_BUCKETS] = { NULL };
+	uint64_t counts[EXTERNAL_BUCKETS] = { 0 };
+	size_t fills[EXTERNAL_BUCKETS] = { 0 };
+	int32_t* buffers = NULL;
+	size_t bucketsCount = 0, bufferCount = 0, count = 0;
+	const int32_t* values = NULL;
+	uint64_t bitmapBytes = ((uint64_t)(lastKey - firstKey) / 8) + 1;
+	uint64_t valuesBytes = source->count * EXTERNAL_BYTES_PER_VALUE;
+	uint8_t shift = 0;
+	ST_lcsRange_t range;
+
+	/* Check 1: Bitmap of the range fits in the memory budget, and takes less memory than the values, or they don't fit */
+	if ((bitmapBytes <= external->budget) && ((bitmapBytes <= valuesBytes) || (valuesBytes > external->budget)))
+	{
+		externalSolveBitmap(external, source, firstKey, lastKey, &range);
+		lcsStitchRange(external->run, &external->open, &range, externalValue(firstKey), externalValue(lastKey));
+		return;
+	}
+	else if (valuesBytes <= external->budget)
+	{
+		externalSolveValues(external, source, firstKey, lastKey, &range);
+		lcsStitchRange(external->run, &external->open, &range, externalValue(firstKey), externalValue(lastKey));
+		return;
+	}
+
+	/* Step 1: Split the range in buckets of 2^shift keys, each with a write buffer */
+	while (((lastKey - firstKey) >> shift) >= EXTERNAL_BUCKETS)
+	{
+		shift++;
+	}
+
+	bucketsCount = (size_t)((lastKey - firstKey) >> shift) + 1;
+	bufferCount = external->budget / (bucketsCount * sizeof(int32_t));
+	buffers = malloc(bucketsCount * bufferCount * sizeof(int32_t));
+
+	if (buffers == NULL)
+	{
+		external->errorState = LCS_INT8_NO_MEMORY;
+		return;
+	}
+
+	for (size_t bucket = 0; bucket < bucketsCount; bucket++)
+	{
+		buckets[bucket] = tmpfile();
+
+		if (buckets[bucket] == NULL)
+		{
+			external->errorState = EXTERNAL_INT8_FILE_ERROR;
+		}
+	}
+
+	/* Step 2: Write each value to the file of its bucket, through its buffer */
+	while ((external->errorState == LCS_INT8_FOUND_LCS) && ((count = externalNext(external, source, &values)) != 0))
+	{
+		for (size_t index = 0; index < count; index++)
+		{
+			size_t bucket = (externalKey(values[index]) - firstKey) >> shift;
+
+			buffers[(bucket * bufferCount) + fills[bucket]++] = values[index];
+
+			if (fills[bucket] == bufferCount)
+			{
+				if (fwrite(&buffers[bucket * bufferCount], sizeof(int32_t), bufferCount, buckets[bucket]) != bufferCount)
+				{
+					external->errorState = EXTERNAL_INT8_FILE_ERROR;
+				}
+
+				counts[bucket] += bufferCount;
+				fills[bucket] = 0;
+			}
+		}
+	}
+
+	for (size_t bucket = 0; (bucket < bucketsCount) && (external->errorState == LCS_INT8_FOUND_LCS); bucket++)
+	{
+		if ((fwrite(&buffers[bucket * bufferCount], sizeof(int32_t), fills[bucket], buckets[bucket]) != fills[bucket]) || (fflush(buckets[bucket]) != 0))
+		{
+			external->errorState = EXTERNAL_INT8_FILE_ERROR;
+		}
+
+		counts[bucket] += fills[bucket];
+		external->stats->bytesWritten += counts[bucket] * sizeof(int32_t);
+		external->stats->bucketFiles++;
+		rewind(buckets[bucket]);
+	}
+
+	free(buffers);
+
+	/* Step 3: Solve the buckets in order of values */
+	for (size_t bucket = 0; bucket < bucketsCount; bucket++)
+	{
+		if (external->errorState == LCS_INT8_FOUND_LCS)
+		{
+			ST_externalSource_t child = { NULL, buckets[bucket], counts[bucket], 0 };
+			uint32_t childFirstKey = firstKey + (uint32_t)(bucket << shift);
+			uint32_t childLastKey = ((bucket + 1) == bucketsCount) ? lastKey : (childFirstKey + (uint32_t)((((uint64_t)1) << shift) - 1));
+
+			externalSolve(external, &child, childFirstKey, childLastKey);
+		}
+
+		if (buckets[bucket] != NULL)
+		{
+			fclose(buckets[bucket]);
+		}
+	}
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: externalGetRun
+ Input: Pointer to char path, size_t memoryBudget, Pointer to LCS run and Pointer to stats
+ Output: int8 errorState
+ Description: Function to take the path of a binary file of int32 values, in the byte order of this machine, the memory it may use, at least EXTERNAL_MIN_BUDGET, and references to store the LCS and the I/O done. The file is mapped a view at a time, so it may be larger than the memory. Stores the same LCS as lcsGetRun.
+*/
+int8_t externalGetRun(const char* path, size_t memoryBudget, ST_lcsRun_t* run, ST_externalStats_t* stats)
+{
+	ST_externalMap_t map;
+	ST_externalSource_t source = { &map, NULL, 0, 0 };
+	ST_external_t external = { 0 };
+	const int32_t* values = NULL;
+	uint32_t minKey = UINT32_MAX, maxKey = 0;
+	size_t count = 0;
+
+	run->start = 0;
+	run->size = 0;
+	memset(stats, 0, sizeof(ST_externalStats_t));
+
+	/* Check 1: File can't be mapped */
+	if (externalOpen(&map, path) != LCS_INT8_FOUND_LCS)
+	{
+		return EXTERNAL_INT8_FILE_ERROR;
+	}
+
+	/* Check 2: File is not a whole number of values, or has no values */
+	if ((map.size % sizeof(int32_t)) != 0)
+	{
+		externalClose(&map);
+		return EXTERNAL_INT8_FILE_ERROR;
+	}
+	else if (map.size == 0)
+	{
+		externalClose(&map);
+		return LCS_INT8_EMPTY_ARRAY;
+	}
+
+	source.count = map.size / sizeof(int32_t);
+	stats->valuesCount = source.count;
+
+	external.budget = (memoryBudget < EXTERNAL_MIN_BUDGET) ? EXTERNAL_MIN_BUDGET : memoryBudget;
+	external.readBuffer = malloc(EXTERNAL_READ_COUNT * sizeof(int32_t));
+	external.stats = stats;
+	external.run = run;
+	external.errorState = LCS_INT8_FOUND_LCS;
+
+	/* Check 3: No memory for the read buffer */
+	if (external.readBuffer == NULL)
+	{
+		externalClose(&map);
+		return LCS_INT8_NO_MEMORY;
+	}
+
+	/* Step 1: Range of keys of the file */
+	while ((count = externalNext(&external, &source, &values)) != 0)
+	{
+		for (size_t index = 0; index < count; index++)
+		{
+			uint32_t key = externalKey(values[index]);
+
+			minKey = (key < minKey) ? key : minKey;
+			maxKey = (key > maxKey) ? key : maxKey;
+		}
+	}
+
+	/* Step 2: Solve the file, then keep the run that ends its range */
+	source.position = 0;
+
+	if (external.errorState == LCS_INT8_FOUND_LCS)
+	{
+		externalSolve(&external, &source, minKey, maxKey);
+		lcsKeepRun(run, external.open.start, external.open.size);
+	}
+
+	free(external.readBuffer);
+	externalClose(&map);
+
+	/* Check 4: File or memory error, or no LCS is found */
+	if (external.errorState != LCS_INT8_FOUND_LCS)
+	{
+		run->start = 0;
+		run->size = 0;
+		return external.errorState;
+	}
+
+	return (run->size == 1) ? LCS_INT8_NO_LCS : LCS_INT8_FOUND_LCS;
+}
+
+/**************************************************************************************************************************/
\ No newline at end of file
@@ -0,0 +1,58 @@
+/*
+ * external.h
+ *
+ *   Created on: Oct 17, 2026
+ *       Author: Abdelrhman Walaa - https://github.com/AbdelrhmanWalaa
+ *  Description: This file contains all External LCS functions' prototypes and definitions (Macros) to avoid magic numbers.
+ */
+
+#ifndef EXTERNAL_H_
+#define EXTERNAL_H_
+
+/**************************************************************************************************************************/
+/* External Includes */
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lcs.h"
+
+/**************************************************************************************************************************/
+/* External Macros */
+
+/* Number of bucket files the range of a file, or of a bucket that doesn't fit in the memory budget, is split in */
+#define EXTERNAL_BUCKETS			128
+/* Size of each view of the file mapped at once, a multiple of the mapping granularity of all platforms */
+#define EXTERNAL_VIEW_SIZE			((size_t)1 << 26)
+/* Number of values read from a bucket file at once */
+#define EXTERNAL_READ_COUNT			((size_t)1 << 16)
+/* Min. memory budget */
+#define EXTERNAL_MIN_BUDGET			((size_t)1 << 20)
+/* Memory a range takes per value to be solved in memory: the values, and a hash set of 2 to 4 times the values */
+#define EXTERNAL_BYTES_PER_VALUE	20
+
+/*
+ * External LCS of a binary file of int32 values, mapped a view at a time: the range of values of the file is split in
+ * buckets, each bucket is written to its own temporary file, then each bucket is solved in memory in order of values,
+ * and its runs are stitched with the runs of the buckets before it. A bucket is solved with a hash set of its values or
+ * a bitmap of its range, the one that takes less memory, and is split again if neither fits in the memory budget.
+ */
+typedef struct externalStats {
+	uint64_t valuesCount;			// Values in the file
+	uint64_t bytesRead;				// From the mapped file and the bucket files
+	uint64_t bytesWritten;			// To the bucket files
+	uint32_t bucketFiles;			// Bucket files written
+	uint32_t bitmapBuckets;			// Buckets solved with a bitmap
+}ST_externalStats_t;
+
+/* External Return Types, with the LCS ones */
+#define EXTERNAL_INT8_FILE_ERROR	 -5		// If the file can't be mapped, or a bucket file can't be written or read
+
+/**************************************************************************************************************************/
+/* External Functions' Prototypes */
+
+int8_t externalGetRun(const char* path, size_t memoryBudget, ST_lcsRun_t* run, ST_externalStats_t* stats);
+
+/**************************************************************************************************************************/
+
+#endif /* EXTERNAL_H_ */
\ No newline at end of file
@@ -0,0 +1,204 @@
+/*
+ * hashset.c
+ *
+ *     Created on: Oct 17, 2026
+ *         Author: Abdelrhman Walaa - https://github.com/AbdelrhmanWalaa
+ *    Description: This file contains all Hash Set functions' implementation.
+ */
+
+ /* Hash Set */
+#include "hashset.h"
+
+/**************************************************************************************************************************/
+/*
+ Name: hashSetSlot
+ Input: Pointer to set and int32 key
+ Output: size_t slot
+ Description: Static Function to get the first slot a key is looked for at, from the high bits of its Fibonacci hash.
+*/
+static size_t hashSetSlot(const ST_hashSet_t* set, int32_t key)
+{
+	return (size_t)(((uint64_t)(uint32_t)key * HASHSET_MULTIPLIER) >> set->shift);
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: hashSetAllocate
+ Input: Pointer to set and size_t capacity
+ Output: int8 errorState
+ Description: Static Function to allocate the empty slots of a set, capacity is a power of 2.
+*/
+static int8_t hashSetAllocate(ST_hashSet_t* set, size_t capacity)
+{
+	uint8_t bits = 0;
+
+	set->keys = malloc(capacity * sizeof(int32_t));
+
+	/* Check 1: Slots can't be allocated */
+	if (set->keys == NULL)
+	{
+		return HASHSET_INT8_NO_MEMORY;
+	}
+
+	/* Loop: Until all slots are empty */
+	for (size_t slot = 0; slot < capacity; slot++)
+	{
+		set->keys[slot] = HASHSET_EMPTY_KEY;
+	}
+
+	while (((size_t)1 << bits) < capacity)
+	{
+		bits++;
+	}
+
+	set->capacity = capacity;
+	set->shift = (uint8_t)(64 - bits);
+
+	return HASHSET_INT8_OK;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: hashSetPut
+ Input: Pointer to set and int32 key, not HASHSET_EMPTY_KEY
+ Output: void
+ Description: Static Function to put a key in its slot, or the first empty slot after it, if it is not already in the set.
+*/
+static void hashSetPut(ST_hashSet_t* set, int32_t key)
+{
+	size_t slot = hashSetSlot(set, key);
+
+	/* Loop: Until the key, or an empty slot */
+	while (set->keys[slot] != HASHSET_EMPTY_KEY)
+	{
+		if (set->keys[slot] == key)
+		{
+			return;
+		}
+
+		slot = (slot + 1) & (set->capacity - 1);
+	}
+
+	set->keys[slot] = key;
+	set->count++;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: hashSetCreate
+ Input: Pointer to set and size_t count
+ Output: int8 errorState
+ Description: Function to take a reference to a set, and create it empty with room for count values before it grows.
+*/
+int8_t hashSetCreate(ST_hashSet_t* set, size_t count)
+{
+	size_t capacity = HASHSET_MIN_CAPACITY;
+
+	/* Loop: Until at least twice the slots of the values */
+	while (capacity < (count * 2))
+	{
+		capacity *= 2;
+	}
+
+	set->count = 0;
+	set->hasEmptyKey = 0;
+
+	return hashSetAllocate(set, capacity);
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: hashSetInsert
+ Input: Pointer to set and int32 key
+ Output: int8 errorState
+ Description: Function to take a reference to a set and a key, then inserts the key if it is not already in the set. The set doubles its slots once half of them are used.
+*/
+int8_t hashSetInsert(ST_hashSet_t* set, int32_t key)
+{
+	/* Check 1: Key is the value of empty slots */
+	if (key == HASHSET_EMPTY_KEY)
+	{
+		set->count += (set->hasEmptyKey == 0);
+		set->hasEmptyKey = 1;
+		return HASHSET_INT8_OK;
+	}
+
+	/* Check 2: Half of the slots are used, move all keys to twice the slots */
+	if (((set->count + 1) * 2) > set->capacity)
+	{
+		ST_hashSet_t grown = *set;
+
+		if (hashSetAllocate(&grown, set->capacity * 2) == HASHSET_INT8_NO_MEMORY)
+		{
+			return HASHSET_INT8_NO_MEMORY;
+		}
+
+		grown.count = set->hasEmptyKey;
+
+		for (size_t slot = 0; slot < set->capacity; slot++)
+		{
+			if (set->keys[slot] != HASHSET_EMPTY_KEY)
+			{
+				hashSetPut(&grown, set->keys[slot]);
+			}
+		}
+
+		free(set->keys);
+		*set = grown;
+	}
+
+	hashSetPut(set, key);
+
+	return HASHSET_INT8_OK;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: hashSetContains
+ Input: Pointer to set and int32 key
+ Output: uint8 1 if the key is in the set, else 0
+ Description: Function to take a reference to a set and a key, then looks for the key from its slot up to the first empty slot.
+*/
+uint8_t hashSetContains(const ST_hashSet_t* set, int32_t key)
+{
+	size_t slot = 0;
+
+	/* Check 1: Key is the value of empty slots */
+	if (key == HASHSET_EMPTY_KEY)
+	{
+		return set->hasEmptyKey;
+	}
+
+	slot = hashSetSlot(set, key);
+
+	/* Loop: Until the key, or an empty slot */
+	while (set->keys[slot] != HASHSET_EMPTY_KEY)
+	{
+		if (set->keys[slot] == key)
+		{
+			return 1;
+		}
+
+		slot = (slot + 1) & (set->capacity - 1);
+	}
+
+	return 0;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: hashSetFree
+ Input: Pointer to set
+ Output: void
+ Description: Function to take a reference to a set, then frees its slots.
+*/
+void hashSetFree(ST_hashSet_t* set)
+{
+	free(set->keys);
+	set->keys = NULL;
+	set->capacity = 0;
+	set->count = 0;
+	set->hasEmptyKey = 0;
+}
+
+/**************************************************************************************************************************/
\ No newline at end of file
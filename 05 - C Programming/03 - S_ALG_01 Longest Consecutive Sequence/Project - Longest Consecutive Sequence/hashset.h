@@ -0,0 +1,53 @@
+/*
+ * hashset.h
+ *
+ *   Created on: Oct 17, 2026
+ *       Author: Abdelrhman Walaa - https://github.com/AbdelrhmanWalaa
+ *  Description: This file contains all Hash Set functions' prototypes and definitions (Macros) to avoid magic numbers.
+ */
+
+#ifndef HASHSET_H_
+#define HASHSET_H_
+
+/**************************************************************************************************************************/
+/* Hash Set Includes */
+#include <stdint.h>
+#include <stdlib.h>
+
+/**************************************************************************************************************************/
+/* Hash Set Macros */
+
+/* Value of an empty slot, the set keeps whether it holds this value itself apart */
+#define HASHSET_EMPTY_KEY				INT32_MIN
+/* Min. number of slots */
+#define HASHSET_MIN_CAPACITY			16
+/* Fibonacci hashing multiplier, 2^64 / golden ratio */
+#define HASHSET_MULTIPLIER				0x9E3779B97F4A7C15ULL
+
+/*
+ * Open addressing set of int32 values with linear probing: a value is looked for from the slot its hash points to, up
+ * to the first empty slot. The slots are a power of 2, at least twice the values, so probes stay short.
+ */
+typedef struct hashSet {
+	int32_t* keys;					// HASHSET_EMPTY_KEY in empty slots
+	size_t capacity;				// Number of slots, a power of 2
+	size_t count;					// Number of values, HASHSET_EMPTY_KEY included
+	uint8_t shift;					// 64 - log2(capacity), to keep the high bits of the hash
+	uint8_t hasEmptyKey;			// 1 if HASHSET_EMPTY_KEY itself is in the set
+}ST_hashSet_t;
+
+/* Hash Set Return Types */
+#define HASHSET_INT8_NO_MEMORY			 -1		// If the slots can't be allocated
+#define HASHSET_INT8_OK					  0		// Otherwise
+
+/**************************************************************************************************************************/
+/* Hash Set Functions' Prototypes */
+
+int8_t hashSetCreate(ST_hashSet_t* set, size_t count);
+int8_t hashSetInsert(ST_hashSet_t* set, int32_t key);
+uint8_t hashSetContains(const ST_hashSet_t* set, int32_t key);
+void hashSetFree(ST_hashSet_t* set);
+
+/**************************************************************************************************************************/
+
+#endif /* HASHSET_H_ */
\ No newline at end of file
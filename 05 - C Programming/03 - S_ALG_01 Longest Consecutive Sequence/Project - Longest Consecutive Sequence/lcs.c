@@ -65,4 +65,554 @@ int8_t lcsGetSize(int32_t* array, uint8_t arraySize, uint8_t* sizeofLCS)
 	return errorState;
 }
 
+/**************************************************************************************************************************/
+/*
+ Name: lcsRunFrom
+ Input: Pointer to set and int32 start
+ Output: size_t size of the run
+ Description: Static Function to count the consecutive values of the set from start up, with no overflow past INT32_MAX.
+*/
+static size_t lcsRunFrom(const ST_hashSet_t* set, int32_t start)
+{
+	size_t size = 1;
+
+	/* Loop: Until the next value is not in the set */
+	while ((((int64_t)start + (int64_t)size) <= INT32_MAX) && hashSetContains(set, (int32_t)((int64_t)start + (int64_t)size)))
+	{
+		size++;
+	}
+
+	return size;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: lcsKeepRun
+ Input: Pointer to LCS run, int32 start and size_t size
+ Output: void
+ Description: Function to keep a run if it is longer than the longest one so far, or as long with a smaller start.
+*/
+void lcsKeepRun(ST_lcsRun_t* run, int32_t start, size_t size)
+{
+	if ((size > run->size) || ((size == run->size) && (size != 0) && (start < run->start)))
+	{
+		run->start = start;
+		run->size = size;
+	}
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: lcsCheckStart
+ Input: Pointer to set, int32 value and Pointer to LCS run
+ Output: void
+ Description: Static Function to count the run from a value of the set only if it starts a run, i.e. its predecessor is not in the set, and keep it if it is the longest one so far.
+*/
+static void lcsCheckStart(const ST_hashSet_t* set, int32_t value, ST_lcsRun_t* run)
+{
+	/* Check 1: Value doesn't start a run */
+	if ((value != INT32_MIN) && hashSetContains(set, value - 1))
+	{
+		return;
+	}
+
+	lcsKeepRun(run, value, lcsRunFrom(set, value));
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: lcsGetRun
+ Input: Pointer int32 to array, size_t arraySize, and Pointer to LCS run
+ Output: int8 errorState
+ Description: Function to take a reference to an array of any size, not sorted, and reference to store the LCS, using a hash set of its values in O(n). A run is only counted from the values whose predecessor is missing, so each value is looked at a few times at most. Stores the first value and size of the LCS, the one with the smallest start if many are as long.
+*/
+int8_t lcsGetRun(const int32_t* array, size_t arraySize, ST_lcsRun_t* run)
+{
+	int8_t errorState = LCS_INT8_FOUND_LCS;
+	ST_hashSet_t set;
+
+	run->start = 0;
+	run->size = 0;
+
+	/* Check 1: array is empty */
+	if ((array == NULL) || (arraySize == 0))
+	{
+		return LCS_INT8_EMPTY_ARRAY;
+	}
+
+	/* Check 2: No memory for the hash set */
+	if (hashSetCreate(&set, arraySize) == HASHSET_INT8_NO_MEMORY)
+	{
+		return LCS_INT8_NO_MEMORY;
+	}
+
+	/* Loop: Until all array elements are in the set, duplicates are kept once */
+	for (size_t index = 0; index < arraySize; index++)
+	{
+		hashSetInsert(&set, array[index]);
+	}
+
+	/* Loop: Until all distinct values are checked, from the slots of the set */
+	for (size_t slot = 0; slot < set.capacity; slot++)
+	{
+		if (set.keys[slot] != HASHSET_EMPTY_KEY)
+		{
+			lcsCheckStart(&set, set.keys[slot], run);
+		}
+	}
+
+	if (set.hasEmptyKey)
+	{
+		lcsCheckStart(&set, HASHSET_EMPTY_KEY, run);
+	}
+
+	hashSetFree(&set);
+
+	/* Check 3: No LCS is found */
+	if (run->size == 1)
+	{
+		errorState = LCS_INT8_NO_LCS;
+	}
+
+	return errorState;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: lcsGetRunSorted
+ Input: Pointer int32 to array, size_t arraySize, and Pointer to LCS run
+ Output: int8 errorState
+ Description: Function to take a reference to an array of any size, not sorted, and reference to store the LCS, by sorting a copy of the array with the hybrid sort, then counting the runs of consecutive values in one pass, duplicates skipped. Stores the same LCS as lcsGetRun.
+*/
+int8_t lcsGetRunSorted(const int32_t* array, size_t arraySize, ST_lcsRun_t* run)
+{
+	int32_t* sorted = NULL;
+	int32_t start = 0;
+	size_t size = 1;
+
+	run->start = 0;
+	run->size = 0;
+
+	/* Check 1: array is empty */
+	if ((array == NULL) || (arraySize == 0))
+	{
+		return LCS_INT8_EMPTY_ARRAY;
+	}
+
+	sorted = malloc(arraySize * sizeof(int32_t));
+
+	/* Check 2: No memory for the sorted copy */
+	if (sorted == NULL)
+	{
+		return LCS_INT8_NO_MEMORY;
+	}
+
+	memcpy(sorted, array, arraySize * sizeof(int32_t));
+
+	if (hybridSort(sorted, arraySize) == SORT_INT8_NO_MEMORY)
+	{
+		free(sorted);
+		return LCS_INT8_NO_MEMORY;
+	}
+
+	start = sorted[0];
+	lcsKeepRun(run, start, size);
+
+	/* Loop: Until the end of the sorted array */
+	for (size_t index = 1; index < arraySize; index++)
+	{
+		/* Check 3: Same value, next value, or a new run */
+		if (sorted[index] == sorted[index - 1])
+		{
+			continue;
+		}
+		else if ((int64_t)sorted[index] == ((int64_t)sorted[index - 1] + 1))
+		{
+			size++;
+		}
+		else
+		{
+			start = sorted[index];
+			size = 1;
+		}
+
+		lcsKeepRun(run, start, size);
+	}
+
+	free(sorted);
+
+	return (run->size == 1) ? LCS_INT8_NO_LCS : LCS_INT8_FOUND_LCS;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: lcsGetRange
+ Input: Pointer int32 to values, size_t valuesCount, int32 first, int32 last, and Pointer to LCS range
+ Output: int8 errorState
+ Description: Function to take a reference to the values of a range [first, last], not sorted, and reference to store its runs, by a hash set of the values: the longest run of the range, the run from first, and the run that ends at last, the ones that may go on in the ranges before and after it.
+*/
+int8_t lcsGetRange(const int32_t* values, size_t valuesCount, int32_t first, int32_t last, ST_lcsRange_t* range)
+{
+	ST_hashSet_t set;
+
+	range->best.start = 0;
+	range->best.size = 0;
+	range->prefixSize = 0;
+	range->suffix.start = 0;
+	range->suffix.size = 0;
+
+	/* Check 1: Range has no values */
+	if (valuesCount == 0)
+	{
+		return LCS_INT8_FOUND_LCS;
+	}
+
+	/* Check 2: No memory for the hash set */
+	if (hashSetCreate(&set, valuesCount) == HASHSET_INT8_NO_MEMORY)
+	{
+		return LCS_INT8_NO_MEMORY;
+	}
+
+	for (size_t index = 0; index < valuesCount; index++)
+	{
+		if (hashSetInsert(&set, values[index]) == HASHSET_INT8_NO_MEMORY)
+		{
+			hashSetFree(&set);
+			return LCS_INT8_NO_MEMORY;
+		}
+	}
+
+	/* Step 1: Longest run of the range, as lcsGetRun */
+	for (size_t slot = 0; slot < set.capacity; slot++)
+	{
+		if (set.keys[slot] != HASHSET_EMPTY_KEY)
+		{
+			lcsCheckStart(&set, set.keys[slot], &range->best);
+		}
+	}
+
+	if (set.hasEmptyKey)
+	{
+		lcsCheckStart(&set, HASHSET_EMPTY_KEY, &range->best);
+	}
+
+	/* Step 2: Runs at both ends of the range */
+	if (hashSetContains(&set, first))
+	{
+		range->prefixSize = lcsRunFrom(&set, first);
+	}
+
+	if (hashSetContains(&set, last))
+	{
+		int32_t start = last;
+
+		while ((start != first) && hashSetContains(&set, start - 1))
+		{
+			start--;
+		}
+
+		range->suffix.start = start;
+		range->suffix.size = (size_t)((int64_t)last - (int64_t)start + 1);
+	}
+
+	hashSetFree(&set);
+
+	return LCS_INT8_FOUND_LCS;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: lcsStitchRange
+ Input: Pointer to LCS run, Pointer to open LCS run, Pointer to LCS range, int32 first and int32 last
+ Output: void
+ Description: Function to take the runs of the range [first, last] right after the ranges stitched so far, in order with no gaps, and keep the longest run. The open run, the one that ends the ranges so far, goes on with the run from first, and stays open if that run fills the whole range, else the run that ends at last is the new open run. Keep the open run once all ranges are stitched.
+*/
+void lcsStitchRange(ST_lcsRun_t* run, ST_lcsRun_t* open, const ST_lcsRange_t* range, int32_t first, int32_t last)
+{
+	lcsKeepRun(run, range->best.start, range->best.size);
+
+	/* Check 1: Open run goes on in this range */
+	if ((open->size != 0) && (range->prefixSize != 0))
+	{
+		open->size += range->prefixSize;
+
+		/* Check 1.1: Run goes on through the whole range */
+		if (range->prefixSize == (size_t)((int64_t)last - (int64_t)first + 1))
+		{
+			return;
+		}
+	}
+
+	lcsKeepRun(run, open->start, open->size);
+	*open = range->suffix;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: lcsKey, lcsValue
+ Input: int32 value, or uint32 key
+ Output: uint32 key, or int32 value
+ Description: Static Functions to flip the sign bit of a value, so keys are in the same order as unsigned integers, and back.
+*/
+static uint32_t lcsKey(int32_t value)
+{
+	return (uint32_t)value ^ 0x80000000U;
+}
+
+static int32_t lcsValue(uint32_t key)
+{
+	return (int32_t)(key ^ 0x80000000U);
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: lcsShardBounds
+ Input: Pointer to shard
+ Output: void
+ Description: Static Function run by each thread, to get the min. and max. keys of its slice of the array.
+*/
+static void lcsShardBounds(void* job)
+{
+	ST_lcsShard_t* shard = job;
+	uint32_t minKey = UINT32_MAX, maxKey = 0;
+
+	/* Loop: Until the end of slice */
+	for (size_t index = shard->first; index < shard->last; index++)
+	{
+		uint32_t key = lcsKey(shard->sharding->array[index]);
+
+		minKey = (key < minKey) ? key : minKey;
+		maxKey = (key > maxKey) ? key : maxKey;
+	}
+
+	shard->minKey = minKey;
+	shard->maxKey = maxKey;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: lcsShardCount
+ Input: Pointer to shard
+ Output: void
+ Description: Static Function run by each thread, to count the values of its slice of the array in each bucket.
+*/
+static void lcsShardCount(void* job)
+{
+	ST_lcsShard_t* shard = job;
+	const ST_lcsSharding_t* sharding = shard->sharding;
+
+	memset(shard->counts, 0, sizeof(shard->counts));
+
+	/* Loop: Until the end of slice */
+	for (size_t index = shard->first; index < shard->last; index++)
+	{
+		shard->counts[(lcsKey(sharding->array[index]) - sharding->minKey) >> sharding->shift]++;
+	}
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: lcsShardScatter
+ Input: Pointer to shard
+ Output: void
+ Description: Static Function run by each thread, to move the values of its slice of the array to their shard, at the places kept for this slice.
+*/
+static void lcsShardScatter(void* job)
+{
+	ST_lcsShard_t* shard = job;
+	const ST_lcsSharding_t* sharding = shard->sharding;
+
+	/* Loop: Until the end of slice */
+	for (size_t index = shard->first; index < shard->last; index++)
+	{
+		int32_t value = sharding->array[index];
+		uint8_t target = sharding->bucketShards[(lcsKey(value) - sharding->minKey) >> sharding->shift];
+
+		sharding->values[shard->cursors[target]++] = value;
+	}
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: lcsShardSolve
+ Input: Pointer to shard
+ Output: void
+ Description: Static Function run by each thread, to find the runs of the range of its shard.
+*/
+static void lcsShardSolve(void* job)
+{
+	ST_lcsShard_t* shard = job;
+
+	shard->errorState = lcsGetRange(&shard->sharding->values[shard->valuesFirst], (shard->hasRange != 0) ? shard->valuesCount : 0,
+		lcsValue(shard->firstKey), lcsValue(shard->lastKey), &shard->range);
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: lcsGetRunParallel
+ Input: Pointer int32 to array, size_t arraySize, uint32 threadsCount, and Pointer to LCS run
+ Output: int8 errorState
+ Description: Function to take a reference to an array of any size, not sorted, and reference to store the LCS, over threadsCount threads, or one per core if 0. The values are grouped in shards of contiguous ranges with about the same number of values each, each shard is solved on its own thread, then the runs that cross shards are stitched from their ends. Stores the same LCS as lcsGetRun.
+*/
+int8_t lcsGetRunParallel(const int32_t* array, size_t arraySize, uint32_t threadsCount, ST_lcsRun_t* run)
+{
+	int8_t errorState = LCS_INT8_FOUND_LCS;
+	ST_lcsSharding_t sharding;
+	ST_lcsShard_t* shards = NULL;
+	ST_lcsRun_t open = { 0, 0 };
+	size_t firstBuckets[PARALLEL_MAX_THREADS + 1];
+	size_t bucketsCount = 0, offset = 0;
+	uint64_t total = 0;
+	uint32_t maxKey = 0, shard = 0;
+
+	run->start = 0;
+	run->size = 0;
+
+	/* Check 1: array is empty */
+	if ((array == NULL) || (arraySize == 0))
+	{
+		return LCS_INT8_EMPTY_ARRAY;
+	}
+
+	/* Check 2: Number of threads, one per core if 0, at least one value per thread */
+	threadsCount = (threadsCount == 0) ? parallelCoresCount() : threadsCount;
+	threadsCount = (threadsCount > PARALLEL_MAX_THREADS) ? PARALLEL_MAX_THREADS : threadsCount;
+	threadsCount = (threadsCount > arraySize) ? (uint32_t)arraySize : threadsCount;
+
+	shards = malloc(threadsCount * sizeof(ST_lcsShard_t));
+	sharding.values = malloc(arraySize * sizeof(int32_t));
+
+	/* Check 3: No memory for the shards or the grouped values */
+	if ((shards == NULL) || (sharding.values == NULL))
+	{
+		free(shards);
+		free(sharding.values);
+		return LCS_INT8_NO_MEMORY;
+	}
+
+	sharding.array = array;
+	sharding.shards = shards;
+
+	/* Step 1: Split the array in slices, and get the range of keys */
+	for (uint32_t index = 0; index < threadsCount; index++)
+	{
+		shards[index].sharding = &sharding;
+		shards[index].first = ((arraySize / threadsCount) * index) + ((index < (arraySize % threadsCount)) ? index : (arraySize % threadsCount));
+		shards[index].last = ((arraySize / threadsCount) * (index + 1)) + (((index + 1) < (arraySize % threadsCount)) ? (index + 1) : (arraySize % threadsCount));
+	}
+
+	parallelRun(shards, sizeof(ST_lcsShard_t), threadsCount, lcsShardBounds);
+
+	sharding.minKey = UINT32_MAX;
+	sharding.shift = 0;
+
+	for (uint32_t index = 0; index < threadsCount; index++)
+	{
+		sharding.minKey = (shards[index].minKey < sharding.minKey) ? shards[index].minKey : sharding.minKey;
+		maxKey = (shards[index].maxKey > maxKey) ? shards[index].maxKey : maxKey;
+	}
+
+	while (((maxKey - sharding.minKey) >> sharding.shift) >= LCS_SHARD_BUCKETS)
+	{
+		sharding.shift++;
+	}
+
+	bucketsCount = (size_t)((maxKey - sharding.minKey) >> sharding.shift) + 1;
+
+	/* Step 2: Count the values in each bucket, and give each shard contiguous buckets of about arraySize / threadsCount values */
+	parallelRun(shards, sizeof(ST_lcsShard_t), threadsCount, lcsShardCount);
+
+	firstBuckets[0] = 0;
+
+	for (size_t bucket = 0; bucket < bucketsCount; bucket++)
+	{
+		sharding.bucketShards[bucket] = (uint8_t)shard;
+
+		for (uint32_t index = 0; index < threadsCount; index++)
+		{
+			total += shards[index].counts[bucket];
+		}
+
+		if (((shard + 1) < threadsCount) && (total >= (((uint64_t)arraySize * (shard + 1)) / threadsCount)))
+		{
+			firstBuckets[++shard] = bucket + 1;
+		}
+	}
+
+	while (shard < threadsCount)
+	{
+		firstBuckets[++shard] = bucketsCount;
+	}
+
+	for (uint32_t index = 0; index < threadsCount; index++)
+	{
+		shards[index].hasRange = (firstBuckets[index] < firstBuckets[index + 1]);
+		shards[index].firstKey = sharding.minKey + (uint32_t)(firstBuckets[index] << sharding.shift);
+		shards[index].lastKey = (firstBuckets[index + 1] == bucketsCount) ? maxKey : (sharding.minKey + (uint32_t)(firstBuckets[index + 1] << sharding.shift) - 1);
+	}
+
+	/* Step 3: Places of the values of each slice in each shard, then group them by shard */
+	for (uint32_t index = 0; index < threadsCount; index++)
+	{
+		memset(shards[index].cursors, 0, sizeof(shards[index].cursors));
+
+		for (size_t bucket = 0; bucket < bucketsCount; bucket++)
+		{
+			shards[index].cursors[sharding.bucketShards[bucket]] += shards[index].counts[bucket];
+		}
+	}
+
+	for (uint32_t target = 0; target < threadsCount; target++)
+	{
+		shards[target].valuesFirst = offset;
+
+		for (uint32_t index = 0; index < threadsCount; index++)
+		{
+			size_t count = shards[index].cursors[target];
+
+			shards[index].cursors[target] = offset;
+			offset += count;
+		}
+
+		shards[target].valuesCount = offset - shards[target].valuesFirst;
+	}
+
+	parallelRun(shards, sizeof(ST_lcsShard_t), threadsCount, lcsShardScatter);
+
+	/* Step 4: Solve each shard */
+	parallelRun(shards, sizeof(ST_lcsShard_t), threadsCount, lcsShardSolve);
+
+	/* Step 5: Stitch the runs that cross shards, a run goes on while the next shard has a run from its first key */
+	for (uint32_t index = 0; index < threadsCount; index++)
+	{
+		if (shards[index].errorState == LCS_INT8_NO_MEMORY)
+		{
+			errorState = LCS_INT8_NO_MEMORY;
+		}
+
+		if (shards[index].hasRange != 0)
+		{
+			lcsStitchRange(run, &open, &shards[index].range, lcsValue(shards[index].firstKey), lcsValue(shards[index].lastKey));
+		}
+	}
+
+	lcsKeepRun(run, open.start, open.size);
+
+	free(shards);
+	free(sharding.values);
+
+	/* Check 5: No memory for a shard, or no LCS is found */
+	if (errorState == LCS_INT8_NO_MEMORY)
+	{
+		run->start = 0;
+		run->size = 0;
+	}
+	else if (run->size == 1)
+	{
+		errorState = LCS_INT8_NO_LCS;
+	}
+
+	return errorState;
+}
+
 /**************************************************************************************************************************/
\ No newline at end of file
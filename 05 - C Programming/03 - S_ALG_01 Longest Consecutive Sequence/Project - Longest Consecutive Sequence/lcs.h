@@ -12,6 +12,10 @@
 /**************************************************************************************************************************/
 /* LCS Includes */
 #include <stdio.h>
+#include <stdlib.h>
+#include "hashset.h"
+#include "sort.h"
+#include "parallel.h"
 
 /**************************************************************************************************************************/
 /* LCS Macros */
@@ -20,16 +24,70 @@ typedef unsigned char uint8_t;
 typedef signed char int8_t;
 typedef signed int int32_t;
 
+typedef struct lcsRun {
+	int32_t start;					// First value of the run
+	size_t size;					// Number of consecutive values from start
+}ST_lcsRun_t;
+
+/* Runs of a range of values [first, last], to stitch them with the runs of the ranges next to it */
+typedef struct lcsRange {
+	ST_lcsRun_t best;				// Longest run of the range
+	size_t prefixSize;				// Size of the run from first, 0 if first is not a value
+	ST_lcsRun_t suffix;				// Run that ends at last, size 0 if last is not a value
+}ST_lcsRange_t;
+
+/* Number of buckets the range of values is split in, to pick the range of each shard */
+#define LCS_SHARD_BUCKETS			4096
+
+/*
+ * Parallel LCS: each thread reads a slice of the array, then the values are grouped in shards of contiguous ranges of
+ * values with about the same number of values each, and each thread solves a shard with its own hash set. A run that
+ * crosses shards is stitched from the run that ends the range of a shard and the one that starts the range of the next.
+ * Keys are the values with the sign bit flipped, so they are in the same order as unsigned integers.
+ */
+typedef struct lcsShard {
+	struct lcsSharding* sharding;
+	size_t first;					// Slice [first, last) of the array read by this thread
+	size_t last;
+	uint32_t minKey;				// Keys of the slice
+	uint32_t maxKey;
+	size_t counts[LCS_SHARD_BUCKETS];			// Values of the slice in each bucket
+	size_t cursors[PARALLEL_MAX_THREADS];		// Next place of the slice values of each shard
+	size_t valuesFirst;				// Values of the shard, in the grouped values
+	size_t valuesCount;
+	uint32_t firstKey;				// Range of keys of the shard
+	uint32_t lastKey;
+	uint8_t hasRange;				// 0 if the shard got no buckets
+	ST_lcsRange_t range;			// Runs of the range of the shard
+	int8_t errorState;
+}ST_lcsShard_t;
+
+typedef struct lcsSharding {
+	const int32_t* array;
+	int32_t* values;				// Values of the array grouped by shard
+	uint32_t minKey;				// Key of the first bucket
+	uint8_t shift;					// Keys in a bucket, as a power of 2
+	uint8_t bucketShards[LCS_SHARD_BUCKETS];	// Shard of each bucket
+	ST_lcsShard_t* shards;
+}ST_lcsSharding_t;
+
 /* LCS Return Types */
 #define LCS_INT8_EMPTY_ARRAY		 -1		// If the array is empty
 #define LCS_INT8_ARRAY_SIZE_LESS_10	 -2		// If the array size is 0 or >10
 #define LCS_INT8_NO_LCS				 -3		// If there is no LCS
+#define LCS_INT8_NO_MEMORY			 -4		// If the hash set can't be allocated
 #define LCS_INT8_FOUND_LCS	          0		// Otherwise
 
 /**************************************************************************************************************************/
 /* LCS Functions' Prototypes */
 
 int8_t lcsGetSize(int32_t* array, uint8_t arraySize, uint8_t* sizeofLCS);
+int8_t lcsGetRun(const int32_t* array, size_t arraySize, ST_lcsRun_t* run);
+int8_t lcsGetRunSorted(const int32_t* array, size_t arraySize, ST_lcsRun_t* run);
+int8_t lcsGetRunParallel(const int32_t* array, size_t arraySize, uint32_t threadsCount, ST_lcsRun_t* run);
+void lcsKeepRun(ST_lcsRun_t* run, int32_t start, size_t size);
+int8_t lcsGetRange(const int32_t* values, size_t valuesCount, int32_t first, int32_t last, ST_lcsRange_t* range);
+void lcsStitchRange(ST_lcsRun_t* run, ST_lcsRun_t* open, const ST_lcsRange_t* range, int32_t first, int32_t last);
 
 /**************************************************************************************************************************/
 
@@ -7,9 +7,32 @@
 /* Main */
 #include "main.h"
 
-int main(void)
+int main(int argc, char *argv[])
 {
-    startProgram();
+    /* Check: Benchmark is asked for, with an optional number of integers */
+    if ((argc >= 2) && (strcmp(argv[1], "--benchmark") == 0))
+    {
+        startBenchmarkProgram((argc >= 3) ? (size_t)strtoull(argv[2], NULL, 10) : MAIN_BENCHMARK_COUNT);
+    }
+    /* Check: Sort benchmark is asked for, with an optional largest array */
+    else if ((argc >= 2) && (strcmp(argv[1], "--sort-benchmark") == 0))
+    {
+        startSortBenchmarkProgram((argc >= 3) ? (size_t)strtoull(argv[2], NULL, 10) : MAIN_SORT_BENCHMARK_MAX);
+    }
+    /* Check: External LCS of a file is asked for, with an optional memory budget in MiB */
+    else if ((argc >= 3) && (strcmp(argv[1], "--file") == 0))
+    {
+        startFileProgram(argv[2], (argc >= 4) ? (size_t)strtoull(argv[3], NULL, 10) : MAIN_EXTERNAL_BUDGET_MB);
+    }
+    /* Check: File of random integers is asked for, with an optional number of integers */
+    else if ((argc >= 3) && (strcmp(argv[1], "--make-file") == 0))
+    {
+        startMakeFileProgram(argv[2], (argc >= 4) ? (size_t)strtoull(argv[3], NULL, 10) : MAIN_BENCHMARK_COUNT);
+    }
+    else
+    {
+        startProgram();
+    }
 
     return 0;
 }
@@ -25,6 +48,7 @@ void startProgram(void)
 {
     int8_t errorState = 0;
     uint32_t arraysize = 0, sizeofLCS = 1;
+    ST_lcsRun_t run;
     int32_t array[20] = { 0 };
 
     /* Step 1: Get array from user */
@@ -67,6 +91,367 @@ void startProgram(void)
         /* Case 3: errorState = LCS found */
         case LCS_INT8_FOUND_LCS:          printf("LCS size = %d\n", sizeofLCS );        break;
     }
+
+    /* Step 4: Get LCS using the hash set, of any array size, and get errorState */
+    errorState = lcsGetRun(&array[0], arraysize, &run);
+
+    /* Check 3: Required errorState */
+    switch (errorState)
+    {
+        /* Case 1: errorState = array is empty */
+        case LCS_INT8_EMPTY_ARRAY: printf("Array is empty!\n");                                                         break;
+        /* Case 2: errorState = no memory */
+        case LCS_INT8_NO_MEMORY:   printf("No memory!\n");                                                              break;
+        /* Case 3: errorState = No LCS */
+        case LCS_INT8_NO_LCS:      printf("No LCS is found!\n");                                                        break;
+        /* Case 4: errorState = LCS found */
+        case LCS_INT8_FOUND_LCS:   printf("LCS starts at %d, size = %llu\n", run.start, (unsigned long long)run.size); break;
+    }
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: mainNow
+ Input: void
+ Output: double time in seconds
+ Description: Static Function to read the wall clock, to time the benchmarks.
+*/
+static double mainNow(void)
+{
+    struct timespec time;
+
+    timespec_get(&time, TIME_UTC);
+
+    return (double)time.tv_sec + ((double)time.tv_nsec / 1e9);
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: mainPrintRun
+ Input: Pointer to char name, int8 errorState, Pointer to LCS run, Pointer to hash set LCS run, double seconds, double hashSeconds and size_t count
+ Output: void
+ Description: Static Function to print the result and speed of an LCS path, its speedup over the hash set path, and whether it found the same LCS.
+*/
+static void mainPrintRun(const char *name, int8_t errorState, const ST_lcsRun_t *run, const ST_lcsRun_t *hashRun, double seconds, double hashSeconds, size_t count)
+{
+    /* Check 1: LCS is found */
+    if ((errorState != LCS_INT8_FOUND_LCS) && (errorState != LCS_INT8_NO_LCS))
+    {
+        printf("%s: No memory!\n", name);
+        return;
+    }
+
+    printf("%s: LCS starts at %d, size = %llu, in %.3f s: %.1f M integers/s, %.2fx the hash set, %s\n", name, run->start, (unsigned long long)run->size,
+           seconds, (seconds > 0.0) ? ((double)count / seconds / 1e6) : 0.0, (seconds > 0.0) ? (hashSeconds / seconds) : 0.0,
+           ((run->start == hashRun->start) && (run->size == hashRun->size)) ? "same LCS" : "DIFFERENT LCS!");
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: startBenchmarkProgram
+ Input: size_t count
+ Output: void
+ Description: Function to time the hash set LCS engine on count random integers from 0 to 2 * count, so most values are distinct and the runs are short but many, against the sort-based path and the sharded path from 1 thread up to the number of cores.
+*/
+void startBenchmarkProgram(size_t count)
+{
+    int8_t errorState = 0;
+    uint32_t seed = 2463534242U;
+    uint32_t cores = parallelCoresCount();
+    int32_t* array = NULL;
+    ST_lcsRun_t run, hashRun;
+    double start = 0.0, hashSeconds = 0.0;
+
+    /* Check 1: Number of integers */
+    if ((count == 0) || (count > (INT32_MAX / 2)))
+    {
+        printf("Number of integers must be from 1 to %d!\n", INT32_MAX / 2);
+        return;
+    }
+
+    array = malloc(count * sizeof(int32_t));
+
+    if (array == NULL)
+    {
+        printf("No memory for %llu integers!\n", (unsigned long long)count);
+        return;
+    }
+
+    /* Loop: Until the array is filled with random integers */
+    for (size_t index = 0; index < count; index++)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        array[index] = (int32_t)(seed % (count * 2));
+    }
+
+    start = mainNow();
+    errorState = lcsGetRun(array, count, &hashRun);
+    hashSeconds = mainNow() - start;
+
+    /* Check 2: LCS is found */
+    if ((errorState != LCS_INT8_FOUND_LCS) && (errorState != LCS_INT8_NO_LCS))
+    {
+        printf("No memory for the hash set!\n");
+        free(array);
+        return;
+    }
+
+    printf("Hash set: %llu integers, LCS starts at %d, size = %llu, in %.3f s: %.1f M integers/s\n", (unsigned long long)count, hashRun.start,
+           (unsigned long long)hashRun.size, hashSeconds, (hashSeconds > 0.0) ? ((double)count / hashSeconds / 1e6) : 0.0);
+
+    /* Step 1: Sort-based path */
+    start = mainNow();
+    errorState = lcsGetRunSorted(array, count, &run);
+    mainPrintRun("Sorted", errorState, &run, &hashRun, mainNow() - start, hashSeconds, count);
+
+    /* Step 2: Sharded path, from 1 thread up to the number of cores, doubled each time */
+    for (uint32_t threads = 1; threads <= cores; threads = ((threads < cores) && ((threads * 2) > cores)) ? cores : (threads * 2))
+    {
+        char name[32];
+
+        snprintf(name, sizeof(name), "Sharded, %u threads", threads);
+
+        start = mainNow();
+        errorState = lcsGetRunParallel(array, count, threads, &run);
+        mainPrintRun(name, errorState, &run, &hashRun, mainNow() - start, hashSeconds, count);
+    }
+
+    free(array);
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: mainCompare
+ Input: Pointer to int32 a and Pointer to int32 b
+ Output: int -1, 0 or 1
+ Description: Static Function to compare two integers for qsort, the C library sort the backends are timed against.
+*/
+static int mainCompare(const void *a, const void *b)
+{
+    int32_t left = *(const int32_t *)a;
+    int32_t right = *(const int32_t *)b;
+
+    return (left > right) - (left < right);
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: mainSort
+ Input: uint8 backend, Pointer int32 to array, size_t arraySize
+ Output: int8 errorState
+ Description: Static Function to sort an array with one of the timed backends.
+*/
+static int8_t mainSort(uint8_t backend, int32_t *array, size_t arraySize)
+{
+    /* Check 1: Required backend */
+    switch (backend)
+    {
+        case 0:  return insertionSort(array, (uint8_t)arraySize);
+        case 1:  qsort(array, arraySize, sizeof(int32_t), mainCompare); return SORT_INT8_OK;
+        case 2:  return networkSort(array, arraySize);
+        case 3:  return radixSort(array, arraySize, SORT_RADIX_8_BITS);
+        case 4:  return radixSort(array, arraySize, SORT_RADIX_11_BITS);
+        default: return hybridSort(array, arraySize);
+    }
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: startSortBenchmarkProgram
+ Input: size_t maxCount
+ Output: void
+ Description: Function to time each sort backend on random arrays of 10 elements up to maxCount, 10 times more each time, and print millions of elements sorted per second. Small arrays are sorted many at a time, so each backend sorts at least MAIN_SORT_BENCHMARK_BATCH elements per size. The insertion sort is only timed up to 255 elements, the most its size takes.
+*/
+void startSortBenchmarkProgram(size_t maxCount)
+{
+    const char *names[MAIN_SORT_BACKENDS_COUNT] = { "insertion", "qsort", "network", "radix8", "radix11", "hybrid" };
+    uint32_t seed = 2463534242U;
+
+    printf("%-12s", "Elements");
+
+    for (uint8_t backend = 0; backend < MAIN_SORT_BACKENDS_COUNT; backend++)
+    {
+        printf("%12s", names[backend]);
+    }
+
+    printf("   (M elements/s)\n");
+
+    /* Loop: Until the largest array, 10 times more elements each time */
+    for (size_t count = 10; count <= maxCount; count *= 10)
+    {
+        size_t arraysCount = (count < MAIN_SORT_BENCHMARK_BATCH) ? (MAIN_SORT_BENCHMARK_BATCH / count) : 1;
+        size_t total = arraysCount * count;
+        int32_t *source = malloc(total * sizeof(int32_t));
+        int32_t *array = malloc(total * sizeof(int32_t));
+
+        /* Check 1: No memory for this size */
+        if ((source == NULL) || (array == NULL))
+        {
+            printf("%-12llu No memory!\n", (unsigned long long)count);
+            free(source);
+            free(array);
+            break;
+        }
+
+        for (size_t index = 0; index < total; index++)
+        {
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            source[index] = (int32_t)seed;
+        }
+
+        printf("%-12llu", (unsigned long long)count);
+
+        /* Loop: Until all backends are timed on the same arrays */
+        for (uint8_t backend = 0; backend < MAIN_SORT_BACKENDS_COUNT; backend++)
+        {
+            uint8_t sorted = 1;
+            double start = 0.0, seconds = 0.0;
+
+            if ((backend == 0) && (count > UINT8_MAX))
+            {
+                printf("%12s", "-");
+                continue;
+            }
+
+            memcpy(array, source, total * sizeof(int32_t));
+            start = mainNow();
+
+            for (size_t first = 0; first < total; first += count)
+            {
+                if (mainSort(backend, &array[first], count) != SORT_INT8_OK)
+                {
+                    sorted = 0;
+                }
+            }
+
+            seconds = mainNow() - start;
+
+            /* Check 2: All arrays are sorted */
+            for (size_t index = 1; index < total; index++)
+            {
+                if (((index % count) != 0) && (array[index - 1] > array[index]))
+                {
+                    sorted = 0;
+                    break;
+                }
+            }
+
+            (sorted == 0) ? printf("%12s", "failed") : printf("%12.1f", (seconds > 0.0) ? ((double)total / seconds / 1e6) : 0.0);
+        }
+
+        printf("\n");
+
+        free(source);
+        free(array);
+    }
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: startMakeFileProgram
+ Input: Pointer to char path and size_t count
+ Output: void
+ Description: Function to write a binary file of count random integers from 0 to 2 * count, the same ones the benchmark is timed on, to time the external LCS on.
+*/
+void startMakeFileProgram(const char *path, size_t count)
+{
+    uint32_t seed = 2463534242U;
+    int32_t *block = NULL;
+    FILE *file = NULL;
+    size_t written = 0;
+
+    /* Check 1: Number of integers */
+    if ((count == 0) || (count > (INT32_MAX / 2)))
+    {
+        printf("Number of integers must be from 1 to %d!\n", INT32_MAX / 2);
+        return;
+    }
+
+    block = malloc(EXTERNAL_READ_COUNT * sizeof(int32_t));
+    file = fopen(path, "wb");
+
+    if ((block == NULL) || (file == NULL))
+    {
+        printf("Can't write %s!\n", path);
+        free(block);
+
+        if (file != NULL)
+        {
+            fclose(file);
+        }
+
+        return;
+    }
+
+    /* Loop: Until count integers are written, a block at a time */
+    while (written < count)
+    {
+        size_t blockCount = ((count - written) < EXTERNAL_READ_COUNT) ? (count - written) : EXTERNAL_READ_COUNT;
+
+        for (size_t index = 0; index < blockCount; index++)
+        {
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            block[index] = (int32_t)(seed % (count * 2));
+        }
+
+        if (fwrite(block, sizeof(int32_t), blockCount, file) != blockCount)
+        {
+            printf("Can't write %s!\n", path);
+            break;
+        }
+
+        written += blockCount;
+    }
+
+    printf("%llu integers written to %s\n", (unsigned long long)written, path);
+
+    fclose(file);
+    free(block);
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: startFileProgram
+ Input: Pointer to char path and size_t budgetMB
+ Output: void
+ Description: Function to get the LCS of a binary file of integers with at most budgetMB MiB of memory, and print the I/O it took and its bandwidth.
+*/
+void startFileProgram(const char *path, size_t budgetMB)
+{
+    int8_t errorState = 0;
+    ST_lcsRun_t run;
+    ST_externalStats_t stats;
+    double start = mainNow(), seconds = 0.0;
+    double megabytes = 0.0;
+
+    errorState = externalGetRun(path, budgetMB << 20, &run, &stats);
+    seconds = mainNow() - start;
+    megabytes = (double)(stats.bytesRead + stats.bytesWritten) / (1024.0 * 1024.0);
+
+    /* Check 1: Required errorState */
+    switch (errorState)
+    {
+        /* Case 1: errorState = file can't be read */
+        case EXTERNAL_INT8_FILE_ERROR: printf("Can't read %s, or write its bucket files!\n", path); return;
+        /* Case 2: errorState = no memory */
+        case LCS_INT8_NO_MEMORY:       printf("No memory!\n");                                    return;
+        /* Case 3: errorState = file is empty */
+        case LCS_INT8_EMPTY_ARRAY:     printf("File is empty!\n");                                return;
+        /* Case 4: errorState = No LCS */
+        case LCS_INT8_NO_LCS:          printf("No LCS is found!\n");                              break;
+        /* Case 5: errorState = LCS found */
+        case LCS_INT8_FOUND_LCS:       printf("LCS starts at %d, size = %llu\n", run.start, (unsigned long long)run.size); break;
+    }
+
+    printf("%llu integers in %.3f s, budget %llu MiB: %.1f MiB read, %.1f MiB written, %u bucket files, %u solved with a bitmap, %.1f MiB/s\n",
+           (unsigned long long)stats.valuesCount, seconds, (unsigned long long)budgetMB, (double)stats.bytesRead / (1024.0 * 1024.0),
+           (double)stats.bytesWritten / (1024.0 * 1024.0), stats.bucketFiles, stats.bitmapBuckets, (seconds > 0.0) ? (megabytes / seconds) : 0.0);
 }
 
 /**************************************************************************************************************************/
\ No newline at end of file
@@ -13,12 +13,32 @@
 /* Main Includes */
 #include "sort.h"
 #include "lcs.h"
+#include "parallel.h"
+#include "external.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
 
 #pragma warning(disable : 4996)
 
+/* Number of integers the LCS engine is timed on by default, drawn from 0 to twice this number */
+#define MAIN_BENCHMARK_COUNT		100000000
+/* Largest array the sort backends are timed on by default, from 10 elements up by 10 times */
+#define MAIN_SORT_BENCHMARK_MAX		10000000
+/* Min. number of elements sorted per backend and size, as many arrays of that size as needed */
+#define MAIN_SORT_BENCHMARK_BATCH	(1 << 22)
+/* Memory budget of the external LCS of a file by default, in MiB */
+#define MAIN_EXTERNAL_BUDGET_MB		64
+/* Number of sort backends timed: insertion, qsort, network, radix 8-bit, radix 11-bit and hybrid */
+#define MAIN_SORT_BACKENDS_COUNT	6
+
 /**************************************************************************************************************************/
 /* Main Functions' Prototypes */
 void startProgram(void);
+void startBenchmarkProgram(size_t count);
+void startSortBenchmarkProgram(size_t maxCount);
+void startMakeFileProgram(const char *path, size_t count);
+void startFileProgram(const char *path, size_t budgetMB);
 
 /**************************************************************************************************************************/
 
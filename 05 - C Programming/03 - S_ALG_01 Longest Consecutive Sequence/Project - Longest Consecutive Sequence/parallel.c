@@ -0,0 +1,126 @@
+/*
+ * parallel.c
+ *
+ *     Created on: Oct 17, 2026
+ *         Author: Abdelrhman Walaa - https://github.com/AbdelrhmanWalaa
+ *    Description: This file contains all Parallel functions' implementation.
+ */
+
+ /* Parallel */
+#include "parallel.h"
+
+/* Platform threads and number of cores */
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+/* One job of a run, and the function to run it with */
+typedef struct parallelTask {
+	void* job;
+	void (*function)(void* job);
+}ST_parallelTask_t;
+
+/**************************************************************************************************************************/
+/*
+ Name: parallelCoresCount
+ Input: void
+ Output: uint32 number of cores
+ Description: Function to get the number of cores the OS runs threads on, at least 1.
+*/
+uint32_t parallelCoresCount(void)
+{
+#ifdef _WIN32
+	SYSTEM_INFO info;
+
+	GetSystemInfo(&info);
+
+	return (info.dwNumberOfProcessors != 0) ? (uint32_t)info.dwNumberOfProcessors : 1;
+#else
+	long cores = sysconf(_SC_NPROCESSORS_ONLN);
+
+	return (cores > 0) ? (uint32_t)cores : 1;
+#endif
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: parallelThread
+ Input: Pointer to task
+ Output: 0
+ Description: Static Function run by every thread, to run its job.
+*/
+#ifdef _WIN32
+static DWORD WINAPI parallelThread(LPVOID parameter)
+{
+	ST_parallelTask_t* task = parameter;
+
+	task->function(task->job);
+
+	return 0;
+}
+#else
+static void* parallelThread(void* parameter)
+{
+	ST_parallelTask_t* task = parameter;
+
+	task->function(task->job);
+
+	return NULL;
+}
+#endif
+
+/**************************************************************************************************************************/
+/*
+ Name: parallelRun
+ Input: Pointer to jobs, size_t jobSize, uint32 jobsCount and Pointer to function
+ Output: void
+ Description: Function to run a function on each job of an array of jobsCount jobs of jobSize bytes, up to PARALLEL_MAX_THREADS, the first one on the calling thread and each other one on its own thread, and wait for all of them. A job its thread can't be started for is run on the calling thread.
+*/
+void parallelRun(void* jobs, size_t jobSize, uint32_t jobsCount, void (*function)(void* job))
+{
+#ifdef _WIN32
+	HANDLE threads[PARALLEL_MAX_THREADS];
+#else
+	pthread_t threads[PARALLEL_MAX_THREADS];
+#endif
+	ST_parallelTask_t tasks[PARALLEL_MAX_THREADS];
+	uint8_t started[PARALLEL_MAX_THREADS];
+
+	/* Loop: Until a thread is started for each job but the first */
+	for (uint32_t index = 1; index < jobsCount; index++)
+	{
+		tasks[index].job = (uint8_t*)jobs + (index * jobSize);
+		tasks[index].function = function;
+#ifdef _WIN32
+		threads[index] = CreateThread(NULL, 0, parallelThread, &tasks[index], 0, NULL);
+		started[index] = (threads[index] != NULL);
+#else
+		started[index] = (pthread_create(&threads[index], NULL, parallelThread, &tasks[index]) == 0);
+#endif
+	}
+
+	function(jobs);
+
+	/* Loop: Until all threads are done */
+	for (uint32_t index = 1; index < jobsCount; index++)
+	{
+		if (started[index])
+		{
+#ifdef _WIN32
+			WaitForSingleObject(threads[index], INFINITE);
+			CloseHandle(threads[index]);
+#else
+			pthread_join(threads[index], NULL);
+#endif
+		}
+		else
+		{
+			function(tasks[index].job);
+		}
+	}
+}
+
+/**************************************************************************************************************************/
\ No newline at end of file
@@ -0,0 +1,31 @@
+/*
+ * parallel.h
+ *
+ *   Created on: Oct 17, 2026
+ *       Author: Abdelrhman Walaa - https://github.com/AbdelrhmanWalaa
+ *  Description: This file contains all Parallel functions' prototypes and definitions (Macros) to avoid magic numbers.
+ */
+
+#ifndef PARALLEL_H_
+#define PARALLEL_H_
+
+/**************************************************************************************************************************/
+/* Parallel Includes */
+#include <stdint.h>
+#include <stdlib.h>
+
+/**************************************************************************************************************************/
+/* Parallel Macros */
+
+/* Max. number of threads a job is split over */
+#define PARALLEL_MAX_THREADS			64
+
+/**************************************************************************************************************************/
+/* Parallel Functions' Prototypes */
+
+uint32_t parallelCoresCount(void);
+void parallelRun(void* jobs, size_t jobSize, uint32_t jobsCount, void (*function)(void* job));
+
+/**************************************************************************************************************************/
+
+#endif /* PARALLEL_H_ */
\ No newline at end of file
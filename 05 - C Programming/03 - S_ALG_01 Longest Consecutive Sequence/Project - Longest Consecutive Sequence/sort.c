@@ -54,6 +54,409 @@ int8_t insertionSort(int32_t* array, uint8_t arraySize)
 	return errorState;
 }
 
+#ifndef SORT_SIMD_SSE2
+/**************************************************************************************************************************/
+/*
+ Name: sortInsertion
+ Input: Pointer int32 to array, size_t arraySize
+ Output: void
+ Description: Static Function to sort a small array of any size in ascending order, using the insertion sort algorithm.
+*/
+static void sortInsertion(int32_t* array, size_t arraySize)
+{
+	/* Loop: Until the end of the array */
+	for (size_t index = 1; index < arraySize; index++)
+	{
+		int32_t current = array[index];
+		size_t index2 = index;
+
+		while ((index2 > 0) && (current < array[index2 - 1]))
+		{
+			array[index2] = array[index2 - 1];
+			index2--;
+		}
+		array[index2] = current;
+	}
+}
+#else
+/**************************************************************************************************************************/
+/*
+ Name: sortMin, sortMax
+ Input: 4 int32 a and 4 int32 b
+ Output: 4 int32
+ Description: Static Functions to get the min. and max. of each pair of lanes, SSE2 has no signed 32-bit min. and max.
+*/
+static __m128i sortMin(__m128i a, __m128i b)
+{
+	__m128i greater = _mm_cmpgt_epi32(a, b);
+
+	return _mm_or_si128(_mm_and_si128(greater, b), _mm_andnot_si128(greater, a));
+}
+
+static __m128i sortMax(__m128i a, __m128i b)
+{
+	__m128i greater = _mm_cmpgt_epi32(a, b);
+
+	return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: sortExchange
+ Input: Pointer to 4 int32 a and Pointer to 4 int32 b
+ Output: void
+ Description: Static Function to run one comparator of the network on 4 columns at once: a keeps the min. of each lane, b the max.
+*/
+static void sortExchange(__m128i* a, __m128i* b)
+{
+	__m128i low = sortMin(*a, *b);
+
+	*b = sortMax(*a, *b);
+	*a = low;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: sortClean4
+ Input: 4 int32 in bitonic order
+ Output: 4 int32 in ascending order
+ Description: Static Function to sort 4 lanes that go up then down, by comparing lanes 2 apart, then 1 apart.
+*/
+static __m128i sortClean4(__m128i lanes)
+{
+	__m128i swapped = _mm_shuffle_epi32(lanes, _MM_SHUFFLE(1, 0, 3, 2));
+	__m128i low = sortMin(lanes, swapped);
+	__m128i high = sortMax(lanes, swapped);
+
+	lanes = _mm_unpacklo_epi64(low, high);
+	swapped = _mm_shuffle_epi32(lanes, _MM_SHUFFLE(2, 3, 0, 1));
+	low = sortMin(lanes, swapped);
+	high = sortMax(lanes, swapped);
+
+	return _mm_unpacklo_epi64(_mm_unpacklo_epi32(low, high), _mm_unpackhi_epi32(low, high));
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: sortMerge4
+ Input: Pointer to 4 sorted int32 a and Pointer to 4 sorted int32 b
+ Output: void
+ Description: Static Function to merge two sorted registers, a keeps the 4 smallest and b the 4 largest, both sorted.
+*/
+static void sortMerge4(__m128i* a, __m128i* b)
+{
+	__m128i reversed = _mm_shuffle_epi32(*b, _MM_SHUFFLE(0, 1, 2, 3));
+
+	*b = sortClean4(sortMax(*a, reversed));
+	*a = sortClean4(sortMin(*a, reversed));
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: sortMerge8
+ Input: Pointers to 8 sorted int32 a0, a1 and 8 sorted int32 b0, b1
+ Output: void
+ Description: Static Function to merge two sorted pairs of registers, a0 and a1 keep the 8 smallest and b0 and b1 the 8 largest, all sorted.
+*/
+static void sortMerge8(__m128i* a0, __m128i* a1, __m128i* b0, __m128i* b1)
+{
+	__m128i reversed0 = _mm_shuffle_epi32(*b1, _MM_SHUFFLE(0, 1, 2, 3));
+	__m128i reversed1 = _mm_shuffle_epi32(*b0, _MM_SHUFFLE(0, 1, 2, 3));
+	__m128i low0 = sortMin(*a0, reversed0);
+	__m128i low1 = sortMin(*a1, reversed1);
+	__m128i high0 = sortMax(*a0, reversed0);
+	__m128i high1 = sortMax(*a1, reversed1);
+
+	sortExchange(&low0, &low1);
+	sortExchange(&high0, &high1);
+
+	*a0 = sortClean4(low0);
+	*a1 = sortClean4(low1);
+	*b0 = sortClean4(high0);
+	*b1 = sortClean4(high1);
+}
+#endif
+
+/**************************************************************************************************************************/
+/*
+ Name: sortNetwork16
+ Input: Pointer int32 to block of SORT_NETWORK_SIZE elements
+ Output: void
+ Description: Static Function to sort a block in registers: a 4-element sorting network sorts the 4 columns of 4 registers, a transpose makes each register a sorted run, then bitonic merges make one run of 16. Falls back to the insertion sort with no SSE2.
+*/
+static void sortNetwork16(int32_t* block)
+{
+#ifdef SORT_SIMD_SSE2
+	__m128i row0 = _mm_loadu_si128((const __m128i*)&block[0]);
+	__m128i row1 = _mm_loadu_si128((const __m128i*)&block[4]);
+	__m128i row2 = _mm_loadu_si128((const __m128i*)&block[8]);
+	__m128i row3 = _mm_loadu_si128((const __m128i*)&block[12]);
+	__m128i low0, low1, high0, high1;
+
+	/* Step 1: Sort the columns */
+	sortExchange(&row0, &row1);
+	sortExchange(&row2, &row3);
+	sortExchange(&row0, &row2);
+	sortExchange(&row1, &row3);
+	sortExchange(&row1, &row2);
+
+	/* Step 2: Transpose, so each register is a sorted column */
+	low0 = _mm_unpacklo_epi32(row0, row1);
+	low1 = _mm_unpacklo_epi32(row2, row3);
+	high0 = _mm_unpackhi_epi32(row0, row1);
+	high1 = _mm_unpackhi_epi32(row2, row3);
+
+	row0 = _mm_unpacklo_epi64(low0, low1);
+	row1 = _mm_unpackhi_epi64(low0, low1);
+	row2 = _mm_unpacklo_epi64(high0, high1);
+	row3 = _mm_unpackhi_epi64(high0, high1);
+
+	/* Step 3: Merge the 4 runs of 4 into 2 runs of 8, then 1 run of 16 */
+	sortMerge4(&row0, &row1);
+	sortMerge4(&row2, &row3);
+	sortMerge8(&row0, &row1, &row2, &row3);
+
+	_mm_storeu_si128((__m128i*)&block[0], row0);
+	_mm_storeu_si128((__m128i*)&block[4], row1);
+	_mm_storeu_si128((__m128i*)&block[8], row2);
+	_mm_storeu_si128((__m128i*)&block[12], row3);
+#else
+	sortInsertion(block, SORT_NETWORK_SIZE);
+#endif
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: sortNetworkTail
+ Input: Pointer int32 to array, size_t arraySize less than SORT_NETWORK_SIZE
+ Output: void
+ Description: Static Function to sort a block smaller than the network, padded with INT32_MAX up to its size.
+*/
+static void sortNetworkTail(int32_t* array, size_t arraySize)
+{
+	int32_t block[SORT_NETWORK_SIZE];
+
+	/* Loop: Until the block is full */
+	for (size_t index = 0; index < SORT_NETWORK_SIZE; index++)
+	{
+		block[index] = (index < arraySize) ? array[index] : INT32_MAX;
+	}
+
+	sortNetwork16(block);
+	memcpy(array, block, arraySize * sizeof(int32_t));
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: sortMergeRuns
+ Input: Pointer int32 to source, Pointer int32 to destination, size_t first, size_t middle, size_t last
+ Output: void
+ Description: Static Function to merge the sorted runs [first, middle) and [middle, last) of source into destination.
+*/
+static void sortMergeRuns(const int32_t* source, int32_t* destination, size_t first, size_t middle, size_t last)
+{
+	size_t left = first, right = middle, index = first;
+
+	/* Loop: Until one run is empty */
+	while ((left < middle) && (right < last))
+	{
+		destination[index++] = (source[right] < source[left]) ? source[right++] : source[left++];
+	}
+
+	memcpy(&destination[index], &source[left], (middle - left) * sizeof(int32_t));
+	index += middle - left;
+	memcpy(&destination[index], &source[right], (last - right) * sizeof(int32_t));
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: networkSort
+ Input: Pointer int32 to array, size_t arraySize
+ Output: int8 errorState
+ Description: Function to take a reference to an array of integers of any size, sorts the array in ascending order, using the sorting network kernel on each block of SORT_NETWORK_SIZE elements, then merging the blocks in passes of doubled runs.
+*/
+int8_t networkSort(int32_t* array, size_t arraySize)
+{
+	int32_t* scratch = NULL;
+	int32_t* source = array;
+	int32_t* destination = NULL;
+	size_t blocksSize = arraySize - (arraySize % SORT_NETWORK_SIZE);
+
+	/* Check 1: array is empty */
+	if ((array == NULL) || (arraySize == 0))
+	{
+		return SORT_INT8_EMPTY_ARRAY;
+	}
+
+	/* Check 2: Array is one block, no merges */
+	if (arraySize <= SORT_NETWORK_SIZE)
+	{
+		(arraySize == SORT_NETWORK_SIZE) ? sortNetwork16(array) : sortNetworkTail(array, arraySize);
+		return SORT_INT8_OK;
+	}
+
+	scratch = malloc(arraySize * sizeof(int32_t));
+
+	/* Check 3: No memory for the merges */
+	if (scratch == NULL)
+	{
+		return SORT_INT8_NO_MEMORY;
+	}
+
+	/* Step 1: Sort each block */
+	for (size_t index = 0; index < blocksSize; index += SORT_NETWORK_SIZE)
+	{
+		sortNetwork16(&array[index]);
+	}
+
+	if (blocksSize < arraySize)
+	{
+		sortNetworkTail(&array[blocksSize], arraySize - blocksSize);
+	}
+
+	/* Step 2: Merge runs twice as long on each pass, from source to destination */
+	destination = scratch;
+
+	for (size_t width = SORT_NETWORK_SIZE; width < arraySize; width *= 2)
+	{
+		int32_t* swap = source;
+
+		for (size_t first = 0; first < arraySize; first += 2 * width)
+		{
+			size_t middle = ((first + width) < arraySize) ? (first + width) : arraySize;
+			size_t last = ((first + (2 * width)) < arraySize) ? (first + (2 * width)) : arraySize;
+
+			sortMergeRuns(source, destination, first, middle, last);
+		}
+
+		source = destination;
+		destination = swap;
+	}
+
+	if (source != array)
+	{
+		memcpy(array, source, arraySize * sizeof(int32_t));
+	}
+
+	free(scratch);
+
+	return SORT_INT8_OK;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: radixSort
+ Input: Pointer int32 to array, size_t arraySize, uint8 digitBits
+ Output: int8 errorState
+ Description: Function to take a reference to an array of integers of any size, sorts the array in ascending order, using the LSD radix sort algorithm with digits of 8 bits (4 passes) or 11 bits (3 passes), any other digitBits is taken as 11. The sign bit of each key is flipped so negative integers come first. All digit counts are taken in one read of the array, and a pass is skipped if all keys have the same digit.
+*/
+int8_t radixSort(int32_t* array, size_t arraySize, uint8_t digitBits)
+{
+	uint32_t bits = (digitBits == SORT_RADIX_8_BITS) ? SORT_RADIX_8_BITS : SORT_RADIX_11_BITS;
+	uint32_t passesCount = (32 + bits - 1) / bits;
+	uint32_t mask = ((uint32_t)1 << bits) - 1;
+	size_t bucketsCount = (size_t)1 << bits;
+	uint32_t* source = (uint32_t*)array;
+	uint32_t* destination = NULL;
+	uint32_t* scratch = NULL;
+	size_t* counts = NULL;
+
+	/* Check 1: array is empty */
+	if ((array == NULL) || (arraySize == 0))
+	{
+		return SORT_INT8_EMPTY_ARRAY;
+	}
+
+	scratch = malloc(arraySize * sizeof(uint32_t));
+	counts = calloc(passesCount * bucketsCount, sizeof(size_t));
+
+	/* Check 2: No memory for the scratch buffer or the counts */
+	if ((scratch == NULL) || (counts == NULL))
+	{
+		free(scratch);
+		free(counts);
+		return SORT_INT8_NO_MEMORY;
+	}
+
+	/* Step 1: Count the digits of all passes */
+	for (size_t index = 0; index < arraySize; index++)
+	{
+		uint32_t key = source[index] ^ 0x80000000U;
+
+		for (uint32_t pass = 0; pass < passesCount; pass++)
+		{
+			counts[(pass * bucketsCount) + ((key >> (pass * bits)) & mask)]++;
+		}
+	}
+
+	/* Step 2: Move the keys to their bucket of each digit, from the lowest digit up */
+	destination = scratch;
+
+	for (uint32_t pass = 0; pass < passesCount; pass++)
+	{
+		size_t* count = &counts[pass * bucketsCount];
+		uint32_t shift = pass * bits;
+		size_t offset = 0;
+		uint32_t* swap = source;
+
+		/* Check 2.1: All keys have the same digit, pass changes nothing */
+		if (count[((source[0] ^ 0x80000000U) >> shift) & mask] == arraySize)
+		{
+			continue;
+		}
+
+		for (size_t bucket = 0; bucket < bucketsCount; bucket++)
+		{
+			size_t bucketSize = count[bucket];
+
+			count[bucket] = offset;
+			offset += bucketSize;
+		}
+
+		for (size_t index = 0; index < arraySize; index++)
+		{
+			destination[count[((source[index] ^ 0x80000000U) >> shift) & mask]++] = source[index];
+		}
+
+		source = destination;
+		destination = swap;
+	}
+
+	if (source != (uint32_t*)array)
+	{
+		memcpy(array, source, arraySize * sizeof(uint32_t));
+	}
+
+	free(scratch);
+	free(counts);
+
+	return SORT_INT8_OK;
+}
+
+/**************************************************************************************************************************/
+/*
+ Name: hybridSort
+ Input: Pointer int32 to array, size_t arraySize
+ Output: int8 errorState
+ Description: Function to take a reference to an array of integers of any size, sorts the array in ascending order, with the fastest backend for its size: the sorting network and merges for arrays smaller than SORT_RADIX_MIN_SIZE, else the radix sort with 8-bit digits, or 11-bit digits from SORT_RADIX_WIDE_MIN_SIZE elements.
+*/
+int8_t hybridSort(int32_t* array, size_t arraySize)
+{
+	/* Check 1: Required backend */
+	if (arraySize < SORT_RADIX_MIN_SIZE)
+	{
+		return networkSort(array, arraySize);
+	}
+	else if (arraySize < SORT_RADIX_WIDE_MIN_SIZE)
+	{
+		return radixSort(array, arraySize, SORT_RADIX_8_BITS);
+	}
+	else
+	{
+		return radixSort(array, arraySize, SORT_RADIX_11_BITS);
+	}
+}
+
 /**************************************************************************************************************************/
 /*
  Name: printArray
@@ -12,6 +12,15 @@
 /**************************************************************************************************************************/
 /* Sort Includes */
 #include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* SSE2 is always there on x64, and on x86 unless built with /arch:IA32 */
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define SORT_SIMD_SSE2
+#include <emmintrin.h>
+#endif
 
 /**************************************************************************************************************************/
 /* Sort Macros */
@@ -21,15 +30,29 @@ typedef signed char int8_t;
 typedef unsigned int uint32_t;
 typedef signed int int32_t;
 
+/* Number of elements the sorting network kernel sorts at once, 4 SIMD registers of 4 */
+#define SORT_NETWORK_SIZE				16
+/* Arrays smaller than this are sorted by the network kernel and merges, larger ones by the radix sort */
+#define SORT_RADIX_MIN_SIZE				256
+/* Radix sort digit widths: 8 bits is 4 passes over 256 buckets, 11 bits is 3 passes over 2048 buckets */
+#define SORT_RADIX_8_BITS				8
+#define SORT_RADIX_11_BITS				11
+/* Arrays smaller than this are radix sorted with 8-bit digits, their 256 buckets stay in L1. Larger ones don't fit in the caches, so the passes over memory cost most and 11-bit digits take one less */
+#define SORT_RADIX_WIDE_MIN_SIZE		(1 << 22)
+
 /* Sort Return Types */
 #define SORT_INT8_EMPTY_ARRAY			 -1		// If the array is empty
 #define SORT_INT8_ARRAY_SIZE_LESS_10	 -2		// If the array size is 0 or >10
+#define SORT_INT8_NO_MEMORY				 -3		// If the scratch buffer can't be allocated
 #define SORT_INT8_OK					  0		// If sorting is done without errors
 
 /**************************************************************************************************************************/
 /* Sort Functions' Prototypes */
 
 int8_t insertionSort(int32_t* array, uint8_t arraySize);
+int8_t networkSort(int32_t* array, size_t arraySize);
+int8_t radixSort(int32_t* array, size_t arraySize, uint8_t digitBits);
+int8_t hybridSort(int32_t* array, size_t arraySize);
 void printArray(int32_t* array, uint8_t arraySize);
 
 /**************************************************************************************************************************/
@@ -16,6 +16,30 @@
 /* Application */
 #include "app.h"
 
+/*
+ Name: appPrintSettlement
+ Input: void
+ Output: void
+ Description: Static Function to print out the settlement totals of today, per card network and for all of them.
+*/
+static void appPrintSettlement(void)
+{
+    ST_settlementTotals_t Loc_Totals;
+    uint8_t Loc_Today[DATE_TEXT_SIZE];
+    date_t Loc_Date = dateToday(Loc_Today);
+
+    printf("\n Settlement of %s\n", Loc_Today);
+
+    /* Loop: Until the totals of each network, and of all networks, are printed out */
+    for (uint32_t Loc_Network = 0; Loc_Network <= SETTLEMENT_ALL_NETWORKS; Loc_Network++)
+    {
+        if (serverSettlement(Loc_Date, (EN_settlementNetwork_t)Loc_Network, &Loc_Totals) == SERVER_OK)
+        {
+            settlementPrint(settlementNetworkName((EN_settlementNetwork_t)Loc_Network), &Loc_Totals);
+        }
+    }
+}
+
 /*
  Name: appStart
  Input: void
@@ -28,11 +52,21 @@ void appStart(void)
     ST_cardData_t     cardData;
     ST_terminalData_t terminalData;
     ST_transaction_t  currentTransaction;
+    ST_accountsDB_t  *accountReference = NULL;
+    char              amountText[MONEY_TEXT_SIZE];
 
     uint8_t Loc_UserInput;
 
+    /* Start the server, and map its accounts file */
+    if (serverInit(NULL) != SERVER_OK)
+    {
+        /* Print out error: Server failed to start */
+        systemPrintOut((uint8_t *)" Error! Server failed to start.");
+        return;
+    }
+
     /* Set Terminal max Amount */
-    setMaxAmount(&terminalData, 4000.0f);
+    setMaxAmount(&terminalData, MONEY_AMOUNT(4000, 0));
 
     /* Start of program */
 
@@ -48,6 +82,8 @@ void appStart(void)
         memset(cardData.primaryAccountNumber, '\0', 20);
         memset(cardData.cardExpirationDate, '\0', 6);
         memset(terminalData.transactionDate, '\0', 11);
+        cardData.packedExpirationDate     = DATE_NONE;
+        terminalData.packedTransactionDate = DATE_NONE;
 
         /* Clear Buffer */
         fflush(stdin);
@@ -96,7 +132,8 @@ void appStart(void)
             systemDeleteLine((uint8_t *)" Error! Wrong Transaction Date!");
         }
 
-        printf(" Max withdrawal amount:\t%0.2f\n", terminalData.maxTransAmount);
+        moneyFormat(terminalData.maxTransAmount, amountText);
+        printf(" Max withdrawal amount:\t%s\n", amountText);
 
         /* Get Terminal Data */
 
@@ -134,7 +171,20 @@ void appStart(void)
 
                 uint8_t currentState = recieveTransactionData(&currentTransaction);
 
-                /* Check 2.2.1: Current state of Transaction  */
+                /* Commit the transaction to the log before answering the card holder */
+                if (serverCommit() != SERVER_OK)
+                {
+                    currentState = INTERNAL_SERVER_ERROR;
+                }
+
+                /* Check 2.2.1: Transaction is approved, print out the new balance */
+                if ((currentState == APPROVED) && (findAccount(&currentTransaction.cardHolderData, &accountReference) == SERVER_OK))
+                {
+                    moneyFormat(accountReference->balance, amountText);
+                    printf(" New Balance is %s\n", amountText);
+                }
+
+                /* Check 2.2.2: Current state of Transaction  */
                 /*if(currentState == FRAUD_CARD || currentState == DECLINED_STOLEN_CARD
                 || currentState == DECLINED_INSUFFECIENT_FUND)
                 {
@@ -156,10 +206,13 @@ void appStart(void)
                         /* Print out message: Declined Insufficient Funds */
                         systemPrintOut((uint8_t *)" Declined Insufficient Funds!");
                         break;
+                    case DECLINED_VELOCITY:
+                        /* Print out message: Declined Too Many Transactions */
+                        systemPrintOut((uint8_t *)" Declined Too Many Transactions!");
+                        break;
                     case APPROVED:
                         /* Print out message: Approved */
                         systemPrintOut((uint8_t *)" Approved!");
-//                        printf("\n Your new balance is %.2f \n", accountsDB[Glb_AccountsDBIndex].balance);
                         break;
                     default:
                     case INTERNAL_SERVER_ERROR:
@@ -175,7 +228,7 @@ void appStart(void)
 
         /* Confirm continue or exit */
         printf("\n\n");
-        printf(" Press ANY KEY to continue or X to exit....  ");
+        printf(" Press ANY KEY to continue, L to list transactions, E to export them, S for today's settlement, or X to exit....  ");
         scanf("%c", &Loc_UserInput);
 
         /* Check 3: User pressed X */
@@ -184,11 +237,38 @@ void appStart(void)
             /* break while(1) */
             break;
         }
+        /* Check 4: User pressed L */
+        else if (Loc_UserInput == 'L' || Loc_UserInput == 'l')
+        {
+            listSavedTransactions();
+        }
+        /* Check 5: User pressed E */
+        else if (Loc_UserInput == 'E' || Loc_UserInput == 'e')
+        {
+            if (exportSavedTransactions(APP_EXPORT_FILE, REPORT_CSV) == SERVER_OK)
+            {
+                /* Print out message: Transactions exported */
+                systemPrintOut((uint8_t *)" Transactions exported to " APP_EXPORT_FILE);
+            }
+            else
+            {
+                /* Print out error: Export failed */
+                systemPrintOut((uint8_t *)" Error! Transactions can't be exported.");
+            }
+        }
+        /* Check 6: User pressed S */
+        else if (Loc_UserInput == 'S' || Loc_UserInput == 's')
+        {
+            appPrintSettlement();
+        }
 
         /* Print out message: Processing */
         systemPrintOut((uint8_t *)" Processing....");
     }
 
+    /* Stop the server, and write all balance changes back to its accounts file */
+    serverShutdown();
+
     /* Print out message: Goodbye */
     systemPrintOut((uint8_t *)"\t\tGoodbye!");
     /* Print out message: Exiting the program */
@@ -197,7 +277,298 @@ void appStart(void)
     /* End of program */
 }
 
-int main()
+/*
+ Name: appReplay
+ Input: Pointer to records file name, and uint32 passesCount
+ Output: int exit status, 0 if the run succeeded
+ Description: This function will replay the records of a file passesCount times through the card, terminal and
+              server validation chain, with no console I/O and no sleeps, then print out the throughput and the
+              latency percentiles.
+*/
+int appReplay(const char *fileName, uint32_t passesCount)
+{
+    ST_replayStats_t Loc_Stats;
+    EN_replayError_t Loc_ErrorState = replayRun(fileName, passesCount, &Loc_Stats);
+
+    switch (Loc_ErrorState)
+    {
+        case REPLAY_OK:
+            replayPrintStats(&Loc_Stats);
+            break;
+        case REPLAY_FILE_ERROR:
+            printf(" Error! Records file %s can't be opened.\n", fileName);
+            break;
+        case REPLAY_SERVER_ERROR:
+            printf(" Error! Server failed.\n");
+            break;
+        default:
+        case REPLAY_NO_MEMORY:
+            printf(" Error! Out of memory.\n");
+            break;
+    }
+
+    replayFreeStats(&Loc_Stats);
+
+    return (Loc_ErrorState == REPLAY_OK) ? 0 : 1;
+}
+
+/*
+ Name: appStopDaemon
+ Input: int signal number
+ Output: void
+ Description: Static Function called on Ctrl+C or a termination request, to stop the daemon after its current turn.
+*/
+static void appStopDaemon(int signalNumber)
+{
+    (void)signalNumber;
+    networkStop();
+}
+
+/*
+ Name: appDaemon
+ Input: Pointer to endpoint, and uint8 velocity
+ Output: int exit status, 0 if the daemon stopped cleanly
+ Description: This function will run the server as a standalone daemon, serving terminal clients on an endpoint until
+              Ctrl+C, then write all balance changes back to the accounts file. The velocity limits are only checked if
+              velocity is 1, as load runs send many transactions per account in a few seconds.
+*/
+int appDaemon(const char *endpoint, uint8_t velocity)
+{
+    ST_serverConfig_t Loc_Config;
+    ST_networkServeStats_t Loc_Stats;
+    EN_networkError_t Loc_ErrorState;
+    ST_filterStats_t Loc_KnownStats;
+    ST_filterStats_t Loc_BlockedStats;
+
+    /* Default server, with no velocity limits unless asked for */
+    memset(&Loc_Config, 0, sizeof(ST_serverConfig_t));
+
+    if (velocity)
+    {
+        serverDefaultVelocity(&Loc_Config.velocity);
+    }
+
+    /* Check 1: Server failed to start */
+    if (serverInit(&Loc_Config) != SERVER_OK)
+    {
+        printf(" Error! Server failed to start.\n");
+        return 1;
+    }
+
+    serverFilterStats(&Loc_KnownStats, &Loc_BlockedStats);
+    filterPrintStats("Known PANs", &Loc_KnownStats);
+    filterPrintStats("Blocked PANs", &Loc_BlockedStats);
+
+    signal(SIGINT, appStopDaemon);
+    signal(SIGTERM, appStopDaemon);
+
+    printf(" Serving on %s, press Ctrl+C to stop....\n", endpoint);
+    fflush(stdout);
+
+    Loc_ErrorState = networkServe(endpoint, &Loc_Stats);
+
+    serverShutdown();
+
+    switch (Loc_ErrorState)
+    {
+        case NETWORK_OK:
+            printf(" Served %llu requests on %llu connections, with %llu log commits.\n",
+                   (unsigned long long)Loc_Stats.requestsCount, (unsigned long long)Loc_Stats.connectionsCount,
+                   (unsigned long long)Loc_Stats.batchesCount);
+            break;
+        case NETWORK_UNSUPPORTED:
+            printf(" Error! The daemon runs on Linux only.\n");
+            break;
+        case NETWORK_NO_MEMORY:
+            printf(" Error! Out of memory.\n");
+            break;
+        default:
+            printf(" Error! Can't serve on %s.\n", endpoint);
+            break;
+    }
+
+    return (Loc_ErrorState == NETWORK_OK) ? 0 : 1;
+}
+
+/*
+ Name: appLoad
+ Input: Pointer to Load Config structure
+ Output: int exit status, 0 if all requests were answered
+ Description: This function will load a running daemon with concurrent connections, then print out the requests per
+              second and the round trip percentiles.
+*/
+int appLoad(const ST_networkLoadConfig_t *config)
+{
+    ST_networkLoadStats_t Loc_Stats;
+    EN_networkError_t Loc_ErrorState = networkLoad(config, &Loc_Stats);
+
+    switch (Loc_ErrorState)
+    {
+        case NETWORK_OK:
+            networkPrintLoadStats(&Loc_Stats);
+            break;
+        case NETWORK_SOCKET_ERROR:
+            /* Print out the requests answered before the connections failed, if any */
+            if (Loc_Stats.requestsCount != 0)
+            {
+                networkPrintLoadStats(&Loc_Stats);
+            }
+
+            printf(" Error! Connections to the daemon failed.\n");
+            break;
+        case NETWORK_WRONG_CONFIG:
+            printf(" Error! Wrong number of connections, requests or depth (1 to %d).\n", NETWORK_MAX_DEPTH);
+            break;
+        case NETWORK_UNSUPPORTED:
+            printf(" Error! The load client runs on Linux only.\n");
+            break;
+        default:
+        case NETWORK_NO_MEMORY:
+            printf(" Error! Out of memory.\n");
+            break;
+    }
+
+    networkFreeLoadStats(&Loc_Stats);
+
+    return (Loc_ErrorState == NETWORK_OK) ? 0 : 1;
+}
+
+/*
+ Name: appWorkload
+ Input: int optionsCount, and Pointer to options "name=value"
+ Output: int exit status, 0 if the run succeeded and its report is written
+ Description: This function will run a generated workload through the card, terminal and server validation chain,
+              print out the throughput, the latency percentiles of each stage and the heap allocations, then write
+              them to the report file.
+*/
+int appWorkload(int optionsCount, char *options[])
 {
+    ST_workloadConfig_t Loc_Config;
+    ST_workloadStats_t Loc_Stats;
+    EN_workloadError_t Loc_ErrorState = WORKLOAD_OK;
+
+    workloadDefaultConfig(&Loc_Config);
+
+    /* Loop: Until all options are set */
+    for (int Loc_Index = 0; Loc_Index < optionsCount; Loc_Index++)
+    {
+        if (workloadParseOption(&Loc_Config, options[Loc_Index]) != WORKLOAD_OK)
+        {
+            printf(" Error! Wrong option %s.\n", options[Loc_Index]);
+            return 1;
+        }
+    }
+
+    Loc_ErrorState = workloadRun(&Loc_Config, &Loc_Stats);
+
+    switch (Loc_ErrorState)
+    {
+        case WORKLOAD_OK:
+            workloadPrintStats(&Loc_Stats);
+
+            if (workloadWriteReport(&Loc_Config, &Loc_Stats, Loc_Config.reportFile) == WORKLOAD_OK)
+            {
+                printf(" Report:\t\t%s\n", Loc_Config.reportFile);
+            }
+            else
+            {
+                printf(" Error! Report file %s can't be written.\n", Loc_Config.reportFile);
+                Loc_ErrorState = WORKLOAD_FILE_ERROR;
+            }
+            break;
+        case WORKLOAD_WRONG_CONFIG:
+            printf(" Error! Wrong workload, the fraud and blocked ratios add up to more than 1.\n");
+            break;
+        case WORKLOAD_SERVER_ERROR:
+            printf(" Error! Server failed.\n");
+            break;
+        default:
+        case WORKLOAD_NO_MEMORY:
+            printf(" Error! Out of memory.\n");
+            break;
+    }
+
+    workloadFreeStats(&Loc_Stats);
+
+    return (Loc_ErrorState == WORKLOAD_OK) ? 0 : 1;
+}
+
+/*
+ Name: main
+ Input: int argc, and Pointer to arguments
+ Output: int exit status
+ Description: Starts the interactive program, or with arguments:
+              --replay file [passes]                          replays the records of a file.
+              --daemon [endpoint [velocity=0|1]]              serves terminal clients on a socket.
+              --load endpoint connections requests [depth]    loads a running daemon.
+              --workload [name=value ...]                     runs a generated workload, see workloadParseOption.
+              --benchmark                                     runs all the benchmarks.
+              An endpoint is a Unix-domain socket path, or a TCP port on 127.0.0.1.
+*/
+int main(int argc, char *argv[])
+{
+    /* Check 1: Replay mode */
+    if ((argc >= 3) && (argc <= 4) && (strcmp(argv[1], "--replay") == 0))
+    {
+        long Loc_Passes = (argc == 4) ? strtol(argv[3], NULL, 10) : 1;
+
+        if (Loc_Passes <= 0)
+        {
+            printf(" Error! Wrong number of passes.\n");
+            return 1;
+        }
+
+        return appReplay(argv[2], (uint32_t)Loc_Passes);
+    }
+    /* Check 2: Daemon mode */
+    else if ((argc >= 2) && (argc <= 4) && (strcmp(argv[1], "--daemon") == 0))
+    {
+        uint8_t Loc_Velocity = (argc == 4) && (strcmp(argv[3], "velocity=1") == 0);
+
+        if ((argc == 4) && !Loc_Velocity && (strcmp(argv[3], "velocity=0") != 0))
+        {
+            printf(" Error! Wrong velocity option.\n");
+            return 1;
+        }
+
+        return appDaemon((argc >= 3) ? argv[2] : NETWORK_DEFAULT_ENDPOINT, Loc_Velocity);
+    }
+    /* Check 3: Load client mode */
+    else if ((argc >= 5) && (argc <= 6) && (strcmp(argv[1], "--load") == 0))
+    {
+        ST_networkLoadConfig_t Loc_Config;
+
+        Loc_Config.endpoint         = argv[2];
+        Loc_Config.connectionsCount = (uint32_t)strtoul(argv[3], NULL, 10);
+        Loc_Config.requestsCount    = strtoull(argv[4], NULL, 10);
+        Loc_Config.depth            = (argc == 6) ? (uint32_t)strtoul(argv[5], NULL, 10) : 1;
+
+        return appLoad(&Loc_Config);
+    }
+    /* Check 4: Workload mode */
+    else if ((argc >= 2) && (strcmp(argv[1], "--workload") == 0))
+    {
+        return appWorkload(argc - 2, &argv[2]);
+    }
+    /* Check 5: Benchmark mode */
+    else if ((argc == 2) && (strcmp(argv[1], "--benchmark") == 0))
+    {
+        benchmarkAll();
+        return 0;
+    }
+    /* Check 6: Unknown arguments */
+    else if (argc != 1)
+    {
+        printf(" Usage: %s [--replay file [passes]]\n", argv[0]);
+        printf("        %s --daemon [endpoint [velocity=0|1]]\n", argv[0]);
+        printf("        %s --load endpoint connections requests [depth]\n", argv[0]);
+        printf("        %s --workload [transactions=N accounts=N zipf=S fraud=R blocked=R expired=R\n", argv[0]);
+        printf("                   amounts=fixed|uniform|lognormal amount=A balance=A velocity=0|1 seed=N report=file]\n");
+        printf("        %s --benchmark\n", argv[0]);
+        return 1;
+    }
+
     appStart();
+
+    return 0;
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <unistd.h>
+#include <signal.h>
 
 /* Console Module */
 #include "../Console/console.h"
@@ -18,10 +19,29 @@
 /* Server Module */
 #include "../Server/server.h"
 
+/* Replay Module */
+#include "../Replay/replay.h"
+
+/* Network Module */
+#include "../Network/network.h"
+
+/* Workload Module */
+#include "../Workload/workload.h"
+
 /* Test Module */
 #include "../Test/test.h"
 
+/* Benchmark Module */
+#include "../Benchmark/benchmark.h"
+
+/* File the transactions are exported to */
+#define APP_EXPORT_FILE "transactions.csv"
+
 /* Function Prototype */
 void appStart(void);
+int appReplay(const char *fileName, uint32_t passesCount);
+int appDaemon(const char *endpoint, uint8_t velocity);
+int appLoad(const ST_networkLoadConfig_t *config);
+int appWorkload(int optionsCount, char *options[]);
 
 #endif /* APP_H_ */
\ No newline at end of file
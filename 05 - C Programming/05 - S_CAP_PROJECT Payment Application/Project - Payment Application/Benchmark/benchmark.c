@@ -0,0 +1,1973 @@
+/**
+ * @Title      	: Benchmark Module
+ * @Filename   	: benchmark.c
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+
+/* Benchmark Module */
+#include "benchmark.h"
+
+/*
+ Name: benchmarkNow
+ Input: void
+ Output: uint64 time in nanoseconds
+ Description: Static Function to read a monotonic enough wall clock for timing benchmark loops.
+*/
+static uint64_t benchmarkNow(void)
+{
+    struct timespec Loc_Time;
+
+    timespec_get(&Loc_Time, TIME_UTC);
+
+    return ((uint64_t)Loc_Time.tv_sec * 1000000000ULL) + (uint64_t)Loc_Time.tv_nsec;
+}
+
+/*
+ Name: benchmarkRandom
+ Input: Pointer to uint64 state
+ Output: uint64 random number
+ Description: Static Function to generate pseudo random numbers (xorshift64*), cheap enough not to show up in timings.
+*/
+static uint64_t benchmarkRandom(uint64_t *state)
+{
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+
+    return *state * 0x2545F4914F6CDD1DULL;
+}
+
+/*
+ Name: benchmarkMakePAN
+ Input: uint8 first digit, uint64 account number, and Pointer to PAN string
+ Output: void
+ Description: Static Function to write a unique 16 digits PAN for an account number.
+              The 15 trailing digits are a bijection of the account number, so PANs never repeat and are not sequential.
+*/
+static void benchmarkMakePAN(uint8_t firstDigit, uint64_t accountNumber, uint8_t *primaryAccountNumber)
+{
+    uint64_t Loc_Digits = ((accountNumber * 982451653ULL) + 1442695040888963ULL) % 1000000000000000ULL;
+
+    primaryAccountNumber[0]  = firstDigit;
+    primaryAccountNumber[16] = '\0';
+
+    /* Loop: Until all 15 digits are written, from the last one */
+    for (int8_t Loc_Index = 15; Loc_Index > 0; Loc_Index--)
+    {
+        primaryAccountNumber[Loc_Index] = (uint8_t)('0' + (Loc_Digits % 10));
+        Loc_Digits /= 10;
+    }
+}
+
+/**
+ * Measures amounts parsed and formatted per second, and how fast moneySum adds up balances.
+ * The same amounts are added up as float too, to show how far a float total drifts from the exact one.
+ */
+void moneyBenchmark(void)
+{
+    money_t *Loc_Amounts = malloc(BENCHMARK_MONEY_AMOUNTS * sizeof(money_t));
+    float *Loc_Floats = malloc(BENCHMARK_MONEY_AMOUNTS * sizeof(float));
+    char Loc_Text[MONEY_TEXT_SIZE];
+    uint64_t Loc_Seed = 0x9E3779B97F4A7C15ULL;
+    uint64_t Loc_Check = 0;
+    money_t Loc_Total = 0;
+    float Loc_FloatTotal = 0.0f;
+    uint64_t Loc_Time[3];
+
+    printf("====================================\n");
+    printf("Benchmark:\tMoney Parse, Format and Sum\n");
+    printf("====================================\n");
+
+    /* Check 1: Not enough memory */
+    if ((Loc_Amounts == NULL) || (Loc_Floats == NULL))
+    {
+        printf(" not enough memory\n");
+        free(Loc_Amounts);
+        free(Loc_Floats);
+        return;
+    }
+
+    for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_MONEY_AMOUNTS; Loc_Index++)
+    {
+        Loc_Amounts[Loc_Index] = (money_t)(benchmarkRandom(&Loc_Seed) % 100000000ULL);
+        Loc_Floats[Loc_Index]  = (float)Loc_Amounts[Loc_Index] / MONEY_SCALE;
+    }
+
+    /* Step 1: Format then parse back every amount */
+    uint64_t Loc_Start = benchmarkNow();
+
+    for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_MONEY_TEXTS; Loc_Index++)
+    {
+        Loc_Check += moneyFormat(Loc_Amounts[Loc_Index], Loc_Text);
+    }
+
+    Loc_Time[0] = benchmarkNow() - Loc_Start;
+    Loc_Start = benchmarkNow();
+
+    for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_MONEY_TEXTS; Loc_Index++)
+    {
+        money_t Loc_Amount;
+
+        moneyFormat(Loc_Amounts[Loc_Index], Loc_Text);
+        Loc_Check += (moneyParse(Loc_Text, &Loc_Amount) == MONEY_OK) && (Loc_Amount == Loc_Amounts[Loc_Index]);
+    }
+
+    /* Parse time is the format + parse loop, less the format loop */
+    Loc_Time[1] = benchmarkNow() - Loc_Start - Loc_Time[0];
+
+    /* Step 2: Add up all amounts, BENCHMARK_MONEY_SUMS times */
+    Loc_Start = benchmarkNow();
+
+    for (uint32_t Loc_Sum = 0; Loc_Sum < BENCHMARK_MONEY_SUMS; Loc_Sum++)
+    {
+        Loc_Total += moneySum(Loc_Amounts, BENCHMARK_MONEY_AMOUNTS);
+    }
+
+    Loc_Time[2] = benchmarkNow() - Loc_Start;
+    Loc_Total /= BENCHMARK_MONEY_SUMS;
+
+    for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_MONEY_AMOUNTS; Loc_Index++)
+    {
+        Loc_FloatTotal += Loc_Floats[Loc_Index];
+    }
+
+    moneyFormat(Loc_Total, Loc_Text);
+    printf(" format %7.2f M/s | parse %7.2f M/s | checksum %llu\n",
+           BENCHMARK_MONEY_TEXTS * 1e3 / (double)Loc_Time[0], BENCHMARK_MONEY_TEXTS * 1e3 / (double)Loc_Time[1],
+           (unsigned long long)Loc_Check);
+    printf(" sum %u amounts | %7.2f GB/s | total %s | float total %.2f\n",
+           BENCHMARK_MONEY_AMOUNTS, (double)BENCHMARK_MONEY_SUMS * BENCHMARK_MONEY_AMOUNTS * sizeof(money_t) / (double)Loc_Time[2],
+           Loc_Text, Loc_FloatTotal);
+
+    free(Loc_Amounts);
+    free(Loc_Floats);
+}
+
+/**
+ * Measures the time each transaction spends on dates, as it was and as it is now:
+ * reading the clock into a "DD/MM/YYYY" date with time, localtime and sprintf, then parsing it back, versus the cached
+ * dateToday, and isCardExpired on dates only set as text (parsed on every call) versus packed dates (matched against
+ * their text, then one compare). Both expiry loops write the same card expiry text, the packed one its date too.
+ */
+void dateBenchmark(void)
+{
+    ST_cardData_t Loc_Card;
+    ST_terminalData_t Loc_Terminal;
+    uint8_t Loc_Text[DATE_TEXT_SIZE];
+    uint64_t Loc_Check = 0;
+    uint64_t Loc_Time[4];
+
+    printf("====================================\n");
+    printf("Benchmark:\tTransaction Date and Card Expiry\n");
+    printf("====================================\n");
+
+    memset(&Loc_Card, 0, sizeof(ST_cardData_t));
+    memset(&Loc_Terminal, 0, sizeof(ST_terminalData_t));
+
+    /* Step 1: Clock read into text, then parsed back, for every transaction */
+    uint64_t Loc_Start = benchmarkNow();
+
+    for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_DATE_CALLS; Loc_Index++)
+    {
+        time_t Loc_Now = time(NULL);
+        struct tm Loc_Tm = *localtime(&Loc_Now);
+        char Loc_Clock[3 * 12];     /* Room for any 3 int fields, as the compiler can't bound the struct tm ones */
+        date_t Loc_Date;
+
+        sprintf(Loc_Clock, "%02d/%02d/%04d", Loc_Tm.tm_mday, Loc_Tm.tm_mon + 1, Loc_Tm.tm_year + 1900);
+        Loc_Check += (dateParse((const uint8_t *)Loc_Clock, &Loc_Date) == DATE_OK);
+    }
+
+    Loc_Time[0] = benchmarkNow() - Loc_Start;
+
+    /* Step 2: Cached current day */
+    Loc_Start = benchmarkNow();
+
+    for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_DATE_CALLS; Loc_Index++)
+    {
+        Loc_Check += dateToday(Loc_Text) & 1;
+    }
+
+    Loc_Time[1] = benchmarkNow() - Loc_Start;
+
+    /* Step 3: Expiry check of dates set as text, card expiry walks through the months of 2020 to 2035 */
+    setTransactionDate(&Loc_Terminal, (const uint8_t *)"17/10/2026");
+    Loc_Terminal.packedTransactionDate = DATE_NONE;
+    Loc_Start = benchmarkNow();
+
+    for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_DATE_CALLS; Loc_Index++)
+    {
+        uint32_t Loc_Month = Loc_Index % 192;
+
+        Loc_Card.cardExpirationDate[0] = (uint8_t)('0' + (((Loc_Month % 12) + 1) / 10));
+        Loc_Card.cardExpirationDate[1] = (uint8_t)('0' + (((Loc_Month % 12) + 1) % 10));
+        Loc_Card.cardExpirationDate[2] = '/';
+        Loc_Card.cardExpirationDate[3] = (uint8_t)('0' + ((20 + (Loc_Month / 12)) / 10));
+        Loc_Card.cardExpirationDate[4] = (uint8_t)('0' + ((20 + (Loc_Month / 12)) % 10));
+        Loc_Check += isCardExpired(&Loc_Card, &Loc_Terminal);
+    }
+
+    Loc_Time[2] = benchmarkNow() - Loc_Start;
+
+    /* Step 4: Expiry check of packed dates, over the same card expiry dates, set with their text as getCardExpiryDate does */
+    setTransactionDate(&Loc_Terminal, (const uint8_t *)"17/10/2026");
+    Loc_Start = benchmarkNow();
+
+    for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_DATE_CALLS; Loc_Index++)
+    {
+        uint32_t Loc_Month = Loc_Index % 192;
+
+        Loc_Card.cardExpirationDate[0] = (uint8_t)('0' + (((Loc_Month % 12) + 1) / 10));
+        Loc_Card.cardExpirationDate[1] = (uint8_t)('0' + (((Loc_Month % 12) + 1) % 10));
+        Loc_Card.cardExpirationDate[2] = '/';
+        Loc_Card.cardExpirationDate[3] = (uint8_t)('0' + ((20 + (Loc_Month / 12)) / 10));
+        Loc_Card.cardExpirationDate[4] = (uint8_t)('0' + ((20 + (Loc_Month / 12)) % 10));
+        Loc_Card.packedExpirationDate = DATE_PACK(2020 + (Loc_Month / 12), (Loc_Month % 12) + 1, 31);
+        Loc_Check += isCardExpired(&Loc_Card, &Loc_Terminal);
+    }
+
+    Loc_Time[3] = benchmarkNow() - Loc_Start;
+
+    printf(" transaction date | clock + sprintf + parse %8.2f ns | cached day   %8.2f ns\n",
+           (double)Loc_Time[0] / BENCHMARK_DATE_CALLS, (double)Loc_Time[1] / BENCHMARK_DATE_CALLS);
+    printf(" card expiry      | text dates              %8.2f ns | packed dates %8.2f ns\n",
+           (double)Loc_Time[2] / BENCHMARK_DATE_CALLS, (double)Loc_Time[3] / BENCHMARK_DATE_CALLS);
+    printf(" per transaction  | before                  %8.2f ns | now          %8.2f ns | checksum %llu\n",
+           (double)(Loc_Time[0] + Loc_Time[2]) / BENCHMARK_DATE_CALLS, (double)(Loc_Time[1] + Loc_Time[3]) / BENCHMARK_DATE_CALLS,
+           (unsigned long long)Loc_Check);
+}
+
+/**
+ * Measures PANs checked per second, one isValidCardPAN call per card versus isValidCardPANBatch, then with every Luhn kernel
+ * this CPU supports. Cards have PANs of 13 to 19 digits, and half of them are Luhn numbers.
+ */
+void luhnBenchmark(void)
+{
+    ST_cardData_t *Loc_Cards = calloc(BENCHMARK_LUHN_CARDS, sizeof(ST_cardData_t));
+    EN_terminalError_t *Loc_Results = malloc(BENCHMARK_LUHN_CARDS * sizeof(EN_terminalError_t));
+    uint8_t *Loc_Valid = malloc(BENCHMARK_LUHN_CARDS);
+    uint64_t Loc_Seed = 0x9E3779B97F4A7C15ULL;
+    uint64_t Loc_Count;
+    uint64_t Loc_Start;
+    uint64_t Loc_Time;
+
+    printf("====================================\n");
+    printf("Benchmark:\tLuhn PAN Check\n");
+    printf("====================================\n");
+
+    /* Check 1: Not enough memory */
+    if ((Loc_Cards == NULL) || (Loc_Results == NULL) || (Loc_Valid == NULL))
+    {
+        printf(" not enough memory\n");
+        free(Loc_Cards);
+        free(Loc_Results);
+        free(Loc_Valid);
+        return;
+    }
+
+    /* Step 1: Random PANs, the check digit of every second one is fixed to make it a Luhn number */
+    for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_LUHN_CARDS; Loc_Index++)
+    {
+        uint8_t *Loc_Pan = Loc_Cards[Loc_Index].primaryAccountNumber;
+        uint8_t Loc_Length = (uint8_t)(13 + (benchmarkRandom(&Loc_Seed) % 7));
+        uint32_t Loc_Sum = 0;
+
+        for (uint8_t Loc_Digit = 0; Loc_Digit < Loc_Length; Loc_Digit++)
+        {
+            Loc_Pan[Loc_Digit] = (uint8_t)('0' + (benchmarkRandom(&Loc_Seed) % 10));
+        }
+
+        if (Loc_Index & 1)
+        {
+            for (uint8_t Loc_Digit = 1; Loc_Digit < Loc_Length; Loc_Digit++)
+            {
+                uint32_t Loc_Value = (uint32_t)(Loc_Pan[Loc_Length - 1 - Loc_Digit] - '0') << (Loc_Digit & 1);
+
+                Loc_Sum += (Loc_Value > 9) ? (Loc_Value - 9) : Loc_Value;
+            }
+
+            Loc_Pan[Loc_Length - 1] = (uint8_t)('0' + ((10 - (Loc_Sum % 10)) % 10));
+        }
+    }
+
+    /* Step 2: One call per card */
+    Loc_Count = 0;
+    Loc_Start = benchmarkNow();
+
+    for (uint32_t Loc_Round = 0; Loc_Round < BENCHMARK_LUHN_ROUNDS; Loc_Round++)
+    {
+        for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_LUHN_CARDS; Loc_Index++)
+        {
+            Loc_Count += (isValidCardPAN(&Loc_Cards[Loc_Index]) == TERMINAL_OK);
+        }
+    }
+
+    Loc_Time = benchmarkNow() - Loc_Start;
+    printf(" %-20s | %8.2f M PANs/s | valid %llu/%u\n", "isValidCardPAN",
+           (double)BENCHMARK_LUHN_ROUNDS * BENCHMARK_LUHN_CARDS * 1e3 / (double)Loc_Time,
+           (unsigned long long)(Loc_Count / BENCHMARK_LUHN_ROUNDS), BENCHMARK_LUHN_CARDS);
+
+    /* Step 3: Batch API, then every kernel on its own */
+    Loc_Count = 0;
+    Loc_Start = benchmarkNow();
+
+    for (uint32_t Loc_Round = 0; Loc_Round < BENCHMARK_LUHN_ROUNDS; Loc_Round++)
+    {
+        isValidCardPANBatch(Loc_Cards, BENCHMARK_LUHN_CARDS, Loc_Results);
+    }
+
+    Loc_Time = benchmarkNow() - Loc_Start;
+
+    for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_LUHN_CARDS; Loc_Index++)
+    {
+        Loc_Count += (Loc_Results[Loc_Index] == TERMINAL_OK);
+    }
+
+    printf(" %-20s | %8.2f M PANs/s | valid %llu/%u\n", "isValidCardPANBatch",
+           (double)BENCHMARK_LUHN_ROUNDS * BENCHMARK_LUHN_CARDS * 1e3 / (double)Loc_Time,
+           (unsigned long long)Loc_Count, BENCHMARK_LUHN_CARDS);
+
+    for (EN_luhnKernel_t Loc_Kernel = LUHN_SCALAR; Loc_Kernel < LUHN_KERNELS_COUNT; Loc_Kernel++)
+    {
+        if (!luhnKernelSupported(Loc_Kernel))
+        {
+            printf(" kernel %-13s | not supported by this CPU\n", luhnKernelName(Loc_Kernel));
+            continue;
+        }
+
+        Loc_Count = 0;
+        Loc_Start = benchmarkNow();
+
+        for (uint32_t Loc_Round = 0; Loc_Round < BENCHMARK_LUHN_ROUNDS; Loc_Round++)
+        {
+            luhnCheckBatchKernel(Loc_Kernel, Loc_Cards[0].primaryAccountNumber, sizeof(ST_cardData_t), BENCHMARK_LUHN_CARDS, Loc_Valid);
+        }
+
+        Loc_Time = benchmarkNow() - Loc_Start;
+
+        for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_LUHN_CARDS; Loc_Index++)
+        {
+            Loc_Count += Loc_Valid[Loc_Index];
+        }
+
+        printf(" kernel %-13s | %8.2f M PANs/s | valid %llu/%u\n", luhnKernelName(Loc_Kernel),
+               (double)BENCHMARK_LUHN_ROUNDS * BENCHMARK_LUHN_CARDS * 1e3 / (double)Loc_Time,
+               (unsigned long long)Loc_Count, BENCHMARK_LUHN_CARDS);
+    }
+
+    free(Loc_Cards);
+    free(Loc_Results);
+    free(Loc_Valid);
+}
+
+/*
+ Name: panIndexBenchmarkSize
+ Input: uint64 accountsCount
+ Output: void
+ Description: Static Function to build an index over accountsCount accounts, then time hits and misses against it.
+*/
+static void panIndexBenchmarkSize(uint64_t accountsCount)
+{
+    ST_panIndex_t Loc_Index;
+    uint8_t  (*Loc_Hits)[20]   = malloc(BENCHMARK_INDEX_SAMPLES * sizeof(*Loc_Hits));
+    uint8_t  (*Loc_Misses)[20] = malloc(BENCHMARK_INDEX_SAMPLES * sizeof(*Loc_Misses));
+    uint8_t  Loc_PAN[20];
+    uint64_t Loc_Seed = 0x9E3779B97F4A7C15ULL;
+    uint64_t Loc_Found = 0;
+    uint32_t Loc_Handle = 0;
+
+    /* Check 1: Not enough memory for this size */
+    if ((Loc_Hits == NULL) || (Loc_Misses == NULL) || (panIndexCreate(&Loc_Index, accountsCount) != INDEX_OK))
+    {
+        printf(" %12llu accounts: not enough memory\n", (unsigned long long)accountsCount);
+        free(Loc_Hits);
+        free(Loc_Misses);
+        return;
+    }
+
+    /* Step 1: Build the index, as the server does on start */
+    uint64_t Loc_Start = benchmarkNow();
+
+    for (uint64_t Loc_Account = 0; Loc_Account < accountsCount; Loc_Account++)
+    {
+        benchmarkMakePAN('4', Loc_Account, Loc_PAN);
+        panIndexInsert(&Loc_Index, Loc_PAN, (uint32_t)Loc_Account);
+    }
+
+    uint64_t Loc_BuildTime = benchmarkNow() - Loc_Start;
+
+    /* Step 2: Prepare random existing PANs, and PANs of another network that are never indexed */
+    for (uint32_t Loc_Sample = 0; Loc_Sample < BENCHMARK_INDEX_SAMPLES; Loc_Sample++)
+    {
+        benchmarkMakePAN('4', benchmarkRandom(&Loc_Seed) % accountsCount, Loc_Hits[Loc_Sample]);
+        benchmarkMakePAN('9', benchmarkRandom(&Loc_Seed) % accountsCount, Loc_Misses[Loc_Sample]);
+    }
+
+    /* Step 3: Time lookups of existing accounts */
+    Loc_Start = benchmarkNow();
+
+    for (uint32_t Loc_Lookup = 0; Loc_Lookup < BENCHMARK_INDEX_LOOKUPS; Loc_Lookup++)
+    {
+        Loc_Found += (panIndexFind(&Loc_Index, Loc_Hits[Loc_Lookup & (BENCHMARK_INDEX_SAMPLES - 1)], &Loc_Handle) == INDEX_OK);
+    }
+
+    uint64_t Loc_HitTime = benchmarkNow() - Loc_Start;
+
+    /* Step 4: Time lookups of unknown accounts */
+    Loc_Start = benchmarkNow();
+
+    for (uint32_t Loc_Lookup = 0; Loc_Lookup < BENCHMARK_INDEX_LOOKUPS; Loc_Lookup++)
+    {
+        Loc_Found += (panIndexFind(&Loc_Index, Loc_Misses[Loc_Lookup & (BENCHMARK_INDEX_SAMPLES - 1)], &Loc_Handle) == INDEX_OK);
+    }
+
+    uint64_t Loc_MissTime = benchmarkNow() - Loc_Start;
+
+    printf(" %12llu accounts | build %9.2f ms | hit %7.2f M/s (%6.1f ns) | miss %7.2f M/s (%6.1f ns) | found %llu/%u\n",
+           (unsigned long long)accountsCount,
+           Loc_BuildTime / 1e6,
+           BENCHMARK_INDEX_LOOKUPS * 1e3 / (double)Loc_HitTime,  (double)Loc_HitTime  / BENCHMARK_INDEX_LOOKUPS,
+           BENCHMARK_INDEX_LOOKUPS * 1e3 / (double)Loc_MissTime, (double)Loc_MissTime / BENCHMARK_INDEX_LOOKUPS,
+           (unsigned long long)Loc_Found, BENCHMARK_INDEX_LOOKUPS);
+
+    panIndexDestroy(&Loc_Index);
+    free(Loc_Hits);
+    free(Loc_Misses);
+}
+
+/**
+ * Measures PAN index build time and lookup throughput at 1K, 1M and 10M accounts
+ */
+void panIndexBenchmark(void)
+{
+    printf("====================================\n");
+    printf("Benchmark:\tPAN Index\n");
+    printf("====================================\n");
+
+    panIndexBenchmarkSize(1000ULL);
+    panIndexBenchmarkSize(1000000ULL);
+    panIndexBenchmarkSize(10000000ULL);
+}
+
+/*
+ Name: databaseBenchmarkSize
+ Input: uint64 accountsCount
+ Output: void
+ Description: Static Function to create an accounts file of accountsCount accounts, then time opening it,
+              and looking up and debiting accounts in place.
+*/
+static void databaseBenchmarkSize(uint64_t accountsCount)
+{
+    ST_database_t Loc_Database;
+    ST_accountsDB_t Loc_Account = { MONEY_AMOUNT(1000000, 0), RUNNING, "" };
+    ST_accountsDB_t *Loc_Reference = NULL;
+    uint8_t  (*Loc_Hits)[20] = malloc(BENCHMARK_INDEX_SAMPLES * sizeof(*Loc_Hits));
+    uint64_t Loc_Seed = 0x9E3779B97F4A7C15ULL;
+    uint64_t Loc_Found = 0;
+
+    /* Check 1: File can't be created */
+    if ((Loc_Hits == NULL) ||
+        (databaseCreate(BENCHMARK_DATABASE_FILE, accountsCount) != DATABASE_OK) ||
+        (databaseOpen(&Loc_Database, BENCHMARK_DATABASE_FILE) != DATABASE_OK))
+    {
+        printf(" %12llu accounts: accounts file can't be created\n", (unsigned long long)accountsCount);
+        free(Loc_Hits);
+        return;
+    }
+
+    /* Step 1: Fill the file, and write it to disk */
+    uint64_t Loc_Start = benchmarkNow();
+
+    for (uint64_t Loc_Index = 0; Loc_Index < accountsCount; Loc_Index++)
+    {
+        benchmarkMakePAN('4', Loc_Index, Loc_Account.primaryAccountNumber);
+        databaseAddAccount(&Loc_Database, &Loc_Account, NULL);
+    }
+
+    databaseSync(&Loc_Database);
+    databaseClose(&Loc_Database);
+
+    uint64_t Loc_FillTime = benchmarkNow() - Loc_Start;
+
+    /* Step 2: Time opening the file, as the server does on start */
+    Loc_Start = benchmarkNow();
+    databaseOpen(&Loc_Database, BENCHMARK_DATABASE_FILE);
+    uint64_t Loc_OpenTime = benchmarkNow() - Loc_Start;
+
+    for (uint32_t Loc_Sample = 0; Loc_Sample < BENCHMARK_INDEX_SAMPLES; Loc_Sample++)
+    {
+        benchmarkMakePAN('4', benchmarkRandom(&Loc_Seed) % accountsCount, Loc_Hits[Loc_Sample]);
+    }
+
+    /* Step 3: Time lookups with a debit of each account in place, first touches of the pages included */
+    Loc_Start = benchmarkNow();
+
+    for (uint32_t Loc_Lookup = 0; Loc_Lookup < BENCHMARK_INDEX_LOOKUPS; Loc_Lookup++)
+    {
+        if (databaseFindAccount(&Loc_Database, Loc_Hits[Loc_Lookup & (BENCHMARK_INDEX_SAMPLES - 1)], &Loc_Reference) == DATABASE_OK)
+        {
+            Loc_Reference->balance -= MONEY_AMOUNT(1, 0);
+            Loc_Found++;
+        }
+    }
+
+    uint64_t Loc_DebitTime = benchmarkNow() - Loc_Start;
+
+    /* Step 4: Time writing the debited pages back to disk */
+    Loc_Start = benchmarkNow();
+    databaseSync(&Loc_Database);
+    uint64_t Loc_SyncTime = benchmarkNow() - Loc_Start;
+
+    printf(" %12llu accounts | fill %9.2f ms | open %7.3f ms | debit %7.2f M/s (%6.1f ns) | sync %8.2f ms | found %llu/%u\n",
+           (unsigned long long)accountsCount,
+           Loc_FillTime / 1e6, Loc_OpenTime / 1e6,
+           BENCHMARK_INDEX_LOOKUPS * 1e3 / (double)Loc_DebitTime, (double)Loc_DebitTime / BENCHMARK_INDEX_LOOKUPS,
+           Loc_SyncTime / 1e6,
+           (unsigned long long)Loc_Found, BENCHMARK_INDEX_LOOKUPS);
+
+    databaseClose(&Loc_Database);
+    remove(BENCHMARK_DATABASE_FILE);
+    free(Loc_Hits);
+}
+
+/**
+ * Measures accounts file open time and in place debit throughput at 1K, 1M and 10M accounts
+ */
+void databaseBenchmark(void)
+{
+    printf("====================================\n");
+    printf("Benchmark:\tAccounts File\n");
+    printf("====================================\n");
+
+    databaseBenchmarkSize(1000ULL);
+    databaseBenchmarkSize(1000000ULL);
+    databaseBenchmarkSize(10000000ULL);
+}
+
+/*
+ Name: journalBenchmarkBatch
+ Input: uint32 batchSize
+ Output: void
+ Description: Static Function to append transactions to a new log with the given group commit batch size,
+              and time them until all of them are on disk.
+*/
+static void journalBenchmarkBatch(uint32_t batchSize)
+{
+    ST_journal_t Loc_Journal;
+    ST_journalConfig_t Loc_Config = { BENCHMARK_JOURNAL_FILE, batchSize, BENCHMARK_JOURNAL_LATENCY_US };
+    ST_transaction_t Loc_Transaction = { { "Benchmark Card Holder", "", "05/30", DATE_NONE }, { MONEY_AMOUNT(100, 0), MONEY_AMOUNT(4000, 0), "17/10/2026", DATE_NONE }, APPROVED, 0 };
+    uint64_t Loc_Seed = 0x9E3779B97F4A7C15ULL;
+    uint64_t Loc_Count = (uint64_t)batchSize * BENCHMARK_JOURNAL_COMMITS;
+
+    /* Check 1: Keep the large batches to a bounded number of transactions */
+    if (Loc_Count > BENCHMARK_JOURNAL_MAX_TRANSACTIONS)
+    {
+        Loc_Count = BENCHMARK_JOURNAL_MAX_TRANSACTIONS;
+    }
+
+    journalRemove(BENCHMARK_JOURNAL_FILE);
+
+    /* Check 2: Log can't be created */
+    if (journalOpen(&Loc_Journal, &Loc_Config) != JOURNAL_OK)
+    {
+        printf(" batch %5u: transactions log can't be created\n", batchSize);
+        return;
+    }
+
+    uint64_t Loc_Start = benchmarkNow();
+
+    for (uint64_t Loc_Index = 0; Loc_Index < Loc_Count; Loc_Index++)
+    {
+        benchmarkMakePAN('4', benchmarkRandom(&Loc_Seed) % 1000000ULL, Loc_Transaction.cardHolderData.primaryAccountNumber);
+        journalAppend(&Loc_Journal, &Loc_Transaction);
+    }
+
+    journalCommit(&Loc_Journal);
+
+    uint64_t Loc_Time = benchmarkNow() - Loc_Start;
+
+    printf(" batch %5u | %8llu transactions | %6llu commits | %10.0f tx/s | %8.1f us per commit\n",
+           batchSize, (unsigned long long)Loc_Count, (unsigned long long)Loc_Journal.commitsCount,
+           Loc_Count * 1e9 / (double)Loc_Time, (double)Loc_Time / 1e3 / (double)Loc_Journal.commitsCount);
+
+    journalClose(&Loc_Journal);
+    journalRemove(BENCHMARK_JOURNAL_FILE);
+}
+
+/*
+ Name: journalBenchmarkPacking
+ Input: void
+ Output: void
+ Description: Static Function to time packing transactions into log records and unpacking them back, against copying
+              whole transactions, and to print the bytes per transaction of both, names dictionary included.
+*/
+static void journalBenchmarkPacking(void)
+{
+    ST_journal_t Loc_Journal;
+    ST_journalConfig_t Loc_Config = { BENCHMARK_JOURNAL_FILE, 0, BENCHMARK_JOURNAL_LATENCY_US };
+    ST_transaction_t *Loc_Transactions = malloc(BENCHMARK_JOURNAL_PACK_TRANSACTIONS * sizeof(ST_transaction_t));
+    ST_transaction_t *Loc_Copies       = malloc(BENCHMARK_JOURNAL_PACK_TRANSACTIONS * sizeof(ST_transaction_t));
+    ST_journalRecord_t *Loc_Records    = malloc(BENCHMARK_JOURNAL_PACK_TRANSACTIONS * sizeof(ST_journalRecord_t));
+    uint64_t Loc_Seed = 0x9E3779B97F4A7C15ULL;
+    uint64_t Loc_Check = 0;
+    uint64_t Loc_Time[3];
+
+    journalRemove(BENCHMARK_JOURNAL_FILE);
+
+    /* Check 1: Not enough memory, or the log can't be created */
+    if ((Loc_Transactions == NULL) || (Loc_Copies == NULL) || (Loc_Records == NULL) ||
+        (journalOpen(&Loc_Journal, &Loc_Config) != JOURNAL_OK))
+    {
+        printf(" packing: not enough memory, or transactions log can't be created\n");
+        free(Loc_Transactions);
+        free(Loc_Copies);
+        free(Loc_Records);
+        return;
+    }
+
+    /* Step 1: Transactions of a few thousand card holders, over the days of 2026 */
+    memset(Loc_Transactions, 0, BENCHMARK_JOURNAL_PACK_TRANSACTIONS * sizeof(ST_transaction_t));
+
+    for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_JOURNAL_PACK_TRANSACTIONS; Loc_Index++)
+    {
+        ST_transaction_t *Loc_Transaction = &Loc_Transactions[Loc_Index];
+        uint64_t Loc_Random = benchmarkRandom(&Loc_Seed);
+        uint32_t Loc_Holder = (uint32_t)(Loc_Random % BENCHMARK_JOURNAL_PACK_HOLDERS);
+
+        sprintf((char *)Loc_Transaction->cardHolderData.cardHolderName, "Card Holder %u", Loc_Holder);
+        benchmarkMakePAN('4', Loc_Holder, Loc_Transaction->cardHolderData.primaryAccountNumber);
+        sprintf((char *)Loc_Transaction->cardHolderData.cardExpirationDate, "%02u/%02u", (Loc_Holder % 12) + 1, 26 + (Loc_Holder % 8));
+        dateParseExpiry(Loc_Transaction->cardHolderData.cardExpirationDate, &Loc_Transaction->cardHolderData.packedExpirationDate);
+        Loc_Transaction->terminalData.packedTransactionDate = dateFromDayNumber(dateToDayNumber(DATE_PACK(2026, 1, 1)) + ((Loc_Random >> 32) % 365));
+        dateFormat(Loc_Transaction->terminalData.packedTransactionDate, Loc_Transaction->terminalData.transactionDate);
+        Loc_Transaction->terminalData.transAmount    = (money_t)((Loc_Random >> 16) % MONEY_AMOUNT(5000, 0));
+        Loc_Transaction->terminalData.maxTransAmount = MONEY_AMOUNT(5000, 0);
+        Loc_Transaction->transState                  = (EN_transState_t)((Loc_Random >> 8) % 4);
+    }
+
+    /* Step 2: Whole transactions copied, as the records were before */
+    uint64_t Loc_Start = benchmarkNow();
+
+    for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_JOURNAL_PACK_TRANSACTIONS; Loc_Index++)
+    {
+        memcpy(&Loc_Copies[Loc_Index], &Loc_Transactions[Loc_Index], sizeof(ST_transaction_t));
+        Loc_Check += Loc_Copies[Loc_Index].terminalData.transAmount;
+    }
+
+    Loc_Time[0] = benchmarkNow() - Loc_Start;
+
+    /* Step 3: Pack */
+    Loc_Start = benchmarkNow();
+
+    for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_JOURNAL_PACK_TRANSACTIONS; Loc_Index++)
+    {
+        journalPack(&Loc_Journal, &Loc_Transactions[Loc_Index], &Loc_Records[Loc_Index]);
+        Loc_Check += Loc_Records[Loc_Index].checksum;
+    }
+
+    Loc_Time[1] = benchmarkNow() - Loc_Start;
+
+    /* Step 4: Unpack */
+    Loc_Start = benchmarkNow();
+
+    for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_JOURNAL_PACK_TRANSACTIONS; Loc_Index++)
+    {
+        journalUnpack(&Loc_Journal, &Loc_Records[Loc_Index], Loc_Index, &Loc_Copies[Loc_Index]);
+        Loc_Check += Loc_Copies[Loc_Index].terminalData.transAmount;
+    }
+
+    Loc_Time[2] = benchmarkNow() - Loc_Start;
+
+    /* Step 5: Every transaction unpacks to what was packed */
+    for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_JOURNAL_PACK_TRANSACTIONS; Loc_Index++)
+    {
+        Loc_Copies[Loc_Index].transactionSequenceNumber = 0;
+
+        if (memcmp(&Loc_Copies[Loc_Index], &Loc_Transactions[Loc_Index], sizeof(ST_transaction_t)) != 0)
+        {
+            printf(" packing: transaction %u does not unpack to what was packed\n", Loc_Index);
+            break;
+        }
+    }
+
+    double Loc_PackedBytes = sizeof(ST_journalRecord_t) +
+                             ((double)Loc_Journal.names.count * sizeof(ST_dictionaryEntry_t) / BENCHMARK_JOURNAL_PACK_TRANSACTIONS);
+
+    printf(" copy   %8.2f ns | pack %8.2f ns | unpack %8.2f ns | %10.0f packed tx/s | checksum %llu\n",
+           (double)Loc_Time[0] / BENCHMARK_JOURNAL_PACK_TRANSACTIONS, (double)Loc_Time[1] / BENCHMARK_JOURNAL_PACK_TRANSACTIONS,
+           (double)Loc_Time[2] / BENCHMARK_JOURNAL_PACK_TRANSACTIONS, BENCHMARK_JOURNAL_PACK_TRANSACTIONS * 1e9 / (double)Loc_Time[1],
+           (unsigned long long)Loc_Check);
+    printf(" bytes per transaction | whole %4u | record %4u + names %6.2f | %5.2fx smaller (%u names)\n",
+           (uint32_t)sizeof(ST_transaction_t), (uint32_t)sizeof(ST_journalRecord_t),
+           Loc_PackedBytes - sizeof(ST_journalRecord_t), sizeof(ST_transaction_t) / Loc_PackedBytes,
+           Loc_Journal.names.count);
+
+    journalClose(&Loc_Journal);
+    journalRemove(BENCHMARK_JOURNAL_FILE);
+    free(Loc_Transactions);
+    free(Loc_Copies);
+    free(Loc_Records);
+}
+
+/**
+ * Measures committed transactions per second of the transactions log at group commit batch sizes 1 to 4096, then the
+ * packing of transactions into log records
+ */
+void journalBenchmark(void)
+{
+    printf("====================================\n");
+    printf("Benchmark:\tTransactions Log\n");
+    printf("====================================\n");
+
+    journalBenchmarkBatch(1);
+    journalBenchmarkBatch(8);
+    journalBenchmarkBatch(64);
+    journalBenchmarkBatch(512);
+    journalBenchmarkBatch(4096);
+    journalBenchmarkPacking();
+}
+
+/*
+ Name: reportBenchmarkSize
+ Input: uint64 transactionsCount
+ Output: void
+ Description: Static Function to fill a log with transactionsCount transactions, then time exporting it to CSV and JSON.
+              The printf listing that saveTransaction used to do is timed too, on up to BENCHMARK_REPORT_LIST_MAX transactions.
+*/
+static void reportBenchmarkSize(uint64_t transactionsCount)
+{
+    ST_journal_t Loc_Journal;
+    ST_journalConfig_t Loc_Config = { BENCHMARK_JOURNAL_FILE, 4096, BENCHMARK_JOURNAL_LATENCY_US };
+    ST_transaction_t Loc_Transaction = { { "Benchmark Card Holder", "", "05/30", DATE_NONE }, { MONEY_AMOUNT(100, 0), MONEY_AMOUNT(4000, 0), "17/10/2026", DATE_NONE }, APPROVED, 0 };
+    ST_transaction_t Loc_Page[64];
+    char Loc_Amount[MONEY_TEXT_SIZE];
+    uint64_t Loc_Seed = 0x9E3779B97F4A7C15ULL;
+    uint64_t Loc_Listed = 0;
+    uint32_t Loc_Read;
+    FILE *Loc_File;
+
+    journalRemove(BENCHMARK_JOURNAL_FILE);
+
+    /* Check 1: Log can't be created */
+    if (journalOpen(&Loc_Journal, &Loc_Config) != JOURNAL_OK)
+    {
+        printf(" %12llu transactions: transactions log can't be created\n", (unsigned long long)transactionsCount);
+        return;
+    }
+
+    /* Step 1: Fill the log */
+    for (uint64_t Loc_Index = 0; Loc_Index < transactionsCount; Loc_Index++)
+    {
+        benchmarkMakePAN('4', benchmarkRandom(&Loc_Seed) % 1000000ULL, Loc_Transaction.cardHolderData.primaryAccountNumber);
+        Loc_Transaction.terminalData.transAmount = (money_t)(benchmarkRandom(&Loc_Seed) % 400000ULL);
+        Loc_Transaction.transState = (EN_transState_t)(benchmarkRandom(&Loc_Seed) % 4);
+        journalAppend(&Loc_Journal, &Loc_Transaction);
+    }
+
+    journalCommit(&Loc_Journal);
+
+    /* Step 2: Time the old listing, one printf per field */
+    Loc_File = fopen(BENCHMARK_REPORT_FILE, "wb");
+    uint64_t Loc_Start = benchmarkNow();
+
+    while ((Loc_File != NULL) && (Loc_Listed < transactionsCount) && (Loc_Listed < BENCHMARK_REPORT_LIST_MAX) &&
+           ((Loc_Read = journalRead(&Loc_Journal, Loc_Listed, Loc_Page, 64)) != 0))
+    {
+        for (uint32_t Loc_Index = 0; Loc_Index < Loc_Read; Loc_Index++)
+        {
+            fprintf(Loc_File, "\n");
+            fprintf(Loc_File, " ##########################\n");
+            fprintf(Loc_File, " Transaction Sequence Number: %d\n", Loc_Page[Loc_Index].transactionSequenceNumber);
+            fprintf(Loc_File, " Transaction Date: %s\n", Loc_Page[Loc_Index].terminalData.transactionDate);
+            moneyFormat(Loc_Page[Loc_Index].terminalData.transAmount, Loc_Amount);
+            fprintf(Loc_File, " Transaction Amount: %s\n", Loc_Amount);
+            fprintf(Loc_File, " Transaction State: %s\n", reportStateName(Loc_Page[Loc_Index].transState));
+            moneyFormat(Loc_Page[Loc_Index].terminalData.maxTransAmount, Loc_Amount);
+            fprintf(Loc_File, " Terminal Max Amount: %s\n", Loc_Amount);
+            fprintf(Loc_File, " Cardholder Name: %s\n", Loc_Page[Loc_Index].cardHolderData.cardHolderName);
+            fprintf(Loc_File, " PAN: %s\n", Loc_Page[Loc_Index].cardHolderData.primaryAccountNumber);
+            fprintf(Loc_File, " Card Expiration Date: %s\n", Loc_Page[Loc_Index].cardHolderData.cardExpirationDate);
+            fprintf(Loc_File, " ##########################\n");
+            fprintf(Loc_File, "\n");
+        }
+
+        Loc_Listed += Loc_Read;
+    }
+
+    uint64_t Loc_ListTime = benchmarkNow() - Loc_Start;
+
+    if (Loc_File != NULL)
+    {
+        fclose(Loc_File);
+    }
+
+    /* Step 3: Time the CSV export */
+    Loc_Start = benchmarkNow();
+    EN_reportError_t Loc_CsvError = reportExport(&Loc_Journal, 0, transactionsCount, REPORT_CSV, BENCHMARK_REPORT_FILE);
+    uint64_t Loc_CsvTime = benchmarkNow() - Loc_Start;
+
+    /* Step 4: Time the JSON export */
+    Loc_Start = benchmarkNow();
+    EN_reportError_t Loc_JsonError = reportExport(&Loc_Journal, 0, transactionsCount, REPORT_JSON, BENCHMARK_REPORT_FILE);
+    uint64_t Loc_JsonTime = benchmarkNow() - Loc_Start;
+
+    printf(" %12llu transactions | printf list %6.2f M/s | CSV %8.2f ms (%6.2f M/s) | JSON %8.2f ms (%6.2f M/s) | errors %d/%d\n",
+           (unsigned long long)transactionsCount,
+           Loc_Listed * 1e3 / (double)Loc_ListTime,
+           Loc_CsvTime / 1e6,  transactionsCount * 1e3 / (double)Loc_CsvTime,
+           Loc_JsonTime / 1e6, transactionsCount * 1e3 / (double)Loc_JsonTime,
+           Loc_CsvError, Loc_JsonError);
+
+    journalClose(&Loc_Journal);
+    journalRemove(BENCHMARK_JOURNAL_FILE);
+    remove(BENCHMARK_REPORT_FILE);
+}
+
+/**
+ * Measures exporting the transactions log to CSV and JSON at 1M and 10M transactions
+ */
+void reportBenchmark(void)
+{
+    printf("====================================\n");
+    printf("Benchmark:\tTransactions Export\n");
+    printf("====================================\n");
+
+    reportBenchmarkSize(1000000ULL);
+    reportBenchmarkSize(10000000ULL);
+}
+
+/*
+ Name: benchmarkServerConfig
+ Input: Pointer to server config
+ Output: void
+ Description: Static Function to set the server config the server benchmarks start from: the scratch files, and every other option off.
+*/
+static void benchmarkServerConfig(ST_serverConfig_t *config)
+{
+    memset(config, 0, sizeof(ST_serverConfig_t));
+
+    config->accountsFile = BENCHMARK_DATABASE_FILE;
+    config->journal.fileName = BENCHMARK_JOURNAL_FILE;
+    config->journal.batchSize = 4096;
+    config->journal.commitLatencyUs = BENCHMARK_JOURNAL_LATENCY_US;
+}
+
+/*
+ Name: serverBenchmarkFill
+ Input: uint64 accountsCount
+ Output: EN_databaseError_t Error or No Error
+ Description: Static Function to create the scratch accounts file with accountsCount running accounts.
+*/
+static EN_databaseError_t serverBenchmarkFill(uint64_t accountsCount)
+{
+    ST_database_t Loc_Database;
+    ST_accountsDB_t Loc_Account = { MONEY_AMOUNT(1000000000, 0), RUNNING, "" };
+    EN_databaseError_t Loc_ErrorState = databaseCreate(BENCHMARK_DATABASE_FILE, accountsCount);
+
+    if (Loc_ErrorState == DATABASE_OK)
+    {
+        Loc_ErrorState = databaseOpen(&Loc_Database, BENCHMARK_DATABASE_FILE);
+    }
+
+    if (Loc_ErrorState == DATABASE_OK)
+    {
+        for (uint64_t Loc_Index = 0; Loc_Index < accountsCount; Loc_Index++)
+        {
+            benchmarkMakePAN('4', Loc_Index, Loc_Account.primaryAccountNumber);
+            databaseAddAccount(&Loc_Database, &Loc_Account, NULL);
+        }
+
+        databaseClose(&Loc_Database);
+    }
+
+    return Loc_ErrorState;
+}
+
+/*
+ Name: serverBenchmarkTransactions
+ Input: Pointer to transactions array, and uint64 accountsCount
+ Output: void
+ Description: Static Function to make BENCHMARK_SERVER_TRANSACTIONS transactions on random accounts, the same ones
+              on every call. 1 in 16 transactions is for an unknown card.
+*/
+static void serverBenchmarkTransactions(ST_transaction_t *transactions, uint64_t accountsCount)
+{
+    ST_transaction_t Loc_Template = { { "Benchmark Card Holder", "", "05/30", DATE_NONE }, { MONEY_AMOUNT(10, 0), MONEY_AMOUNT(4000, 0), "17/10/2026", DATE_NONE }, APPROVED, 0 };
+    uint64_t Loc_Seed = 0x9E3779B97F4A7C15ULL;
+
+    for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_SERVER_TRANSACTIONS; Loc_Index++)
+    {
+        uint64_t Loc_Random = benchmarkRandom(&Loc_Seed);
+
+        transactions[Loc_Index] = Loc_Template;
+        benchmarkMakePAN(((Loc_Random & 15) == 0) ? '9' : '4', (Loc_Random >> 8) % accountsCount,
+                         transactions[Loc_Index].cardHolderData.primaryAccountNumber);
+    }
+}
+
+/*
+ Name: serverBenchmarkSize
+ Input: uint64 accountsCount
+ Output: void
+ Description: Static Function to time authorizing the same transactions one call at a time, then in batches,
+              against a server with accountsCount accounts.
+*/
+static void serverBenchmarkSize(uint64_t accountsCount)
+{
+    ST_serverConfig_t Loc_Config;
+    ST_transaction_t *Loc_Transactions = malloc(BENCHMARK_SERVER_TRANSACTIONS * sizeof(ST_transaction_t));
+    EN_transState_t *Loc_States = malloc(BENCHMARK_SERVER_TRANSACTIONS * sizeof(EN_transState_t));
+    uint64_t Loc_Approved[2] = { 0, 0 };
+    uint64_t Loc_Time[2];
+
+    benchmarkServerConfig(&Loc_Config);
+    serverShutdown();
+    serverRemoveFiles(&Loc_Config);
+
+    /* Check 1: Not enough memory, or the server can't be started */
+    if ((Loc_Transactions == NULL) || (Loc_States == NULL) ||
+        (serverBenchmarkFill(accountsCount) != DATABASE_OK))
+    {
+        printf(" %12llu accounts: server can't be started\n", (unsigned long long)accountsCount);
+        free(Loc_Transactions);
+        free(Loc_States);
+        return;
+    }
+
+    /* Loop: Run 0 is one call per transaction, run 1 is the batch API */
+    for (uint8_t Loc_Run = 0; Loc_Run < 2; Loc_Run++)
+    {
+        journalRemove(BENCHMARK_JOURNAL_FILE);
+        serverInit(&Loc_Config);
+        serverBenchmarkTransactions(Loc_Transactions, accountsCount);
+
+        uint64_t Loc_Start = benchmarkNow();
+
+        if (Loc_Run == 0)
+        {
+            for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_SERVER_TRANSACTIONS; Loc_Index++)
+            {
+                Loc_States[Loc_Index] = recieveTransactionData(&Loc_Transactions[Loc_Index]);
+            }
+        }
+        else
+        {
+            for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_SERVER_TRANSACTIONS; Loc_Index += BENCHMARK_SERVER_BATCH)
+            {
+                recieveTransactionDataBatch(&Loc_Transactions[Loc_Index], BENCHMARK_SERVER_BATCH, &Loc_States[Loc_Index]);
+            }
+        }
+
+        serverCommit();
+        Loc_Time[Loc_Run] = benchmarkNow() - Loc_Start;
+
+        for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_SERVER_TRANSACTIONS; Loc_Index++)
+        {
+            Loc_Approved[Loc_Run] += (Loc_States[Loc_Index] == APPROVED);
+        }
+
+        serverShutdown();
+    }
+
+    printf(" %12llu accounts | single %6.2f M tx/s | batch %6.2f M tx/s | speedup %5.2fx | approved %llu/%llu\n",
+           (unsigned long long)accountsCount,
+           BENCHMARK_SERVER_TRANSACTIONS * 1e3 / (double)Loc_Time[0],
+           BENCHMARK_SERVER_TRANSACTIONS * 1e3 / (double)Loc_Time[1],
+           (double)Loc_Time[0] / (double)Loc_Time[1],
+           (unsigned long long)Loc_Approved[0], (unsigned long long)Loc_Approved[1]);
+
+    serverRemoveFiles(&Loc_Config);
+    free(Loc_Transactions);
+    free(Loc_States);
+}
+
+/**
+ * Measures transactions authorized per second, one call at a time versus the batch API, at 1K and 1M accounts
+ */
+void serverBenchmark(void)
+{
+    printf("====================================\n");
+    printf("Benchmark:\tTransaction Authorization\n");
+    printf("====================================\n");
+
+    serverBenchmarkSize(1000ULL);
+    serverBenchmarkSize(1000000ULL);
+}
+
+/**
+ * Measures transactions authorized per second by the parallel API at 1M accounts, from 1 to
+ * BENCHMARK_PARALLEL_MAX_THREADS worker threads. Threads past the number of cores can't add any speed.
+ */
+void serverParallelBenchmark(void)
+{
+    uint64_t Loc_AccountsCount = 1000000ULL;
+    ST_serverConfig_t Loc_Config;
+    ST_transaction_t *Loc_Transactions = malloc(BENCHMARK_SERVER_TRANSACTIONS * sizeof(ST_transaction_t));
+    EN_transState_t *Loc_States = malloc(BENCHMARK_SERVER_TRANSACTIONS * sizeof(EN_transState_t));
+    uint64_t Loc_SingleThreadTime = 0;
+
+    printf("====================================\n");
+    printf("Benchmark:\tParallel Transaction Authorization (%u cores)\n", workerCoresCount());
+    printf("====================================\n");
+
+    benchmarkServerConfig(&Loc_Config);
+    serverShutdown();
+    serverRemoveFiles(&Loc_Config);
+
+    /* Check 1: Not enough memory, or the server can't be started */
+    if ((Loc_Transactions == NULL) || (Loc_States == NULL) ||
+        (serverBenchmarkFill(Loc_AccountsCount) != DATABASE_OK))
+    {
+        printf(" server can't be started\n");
+        free(Loc_Transactions);
+        free(Loc_States);
+        return;
+    }
+
+    /* Loop: Double the number of worker threads every run */
+    for (uint32_t Loc_Threads = 1; Loc_Threads <= BENCHMARK_PARALLEL_MAX_THREADS; Loc_Threads *= 2)
+    {
+        uint64_t Loc_Approved = 0;
+
+        journalRemove(BENCHMARK_JOURNAL_FILE);
+        Loc_Config.workersCount = Loc_Threads;
+
+        if (serverInit(&Loc_Config) != SERVER_OK)
+        {
+            printf(" %2u threads: server can't be started\n", Loc_Threads);
+            break;
+        }
+
+        serverBenchmarkTransactions(Loc_Transactions, Loc_AccountsCount);
+
+        uint64_t Loc_Start = benchmarkNow();
+
+        for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_SERVER_TRANSACTIONS; Loc_Index += BENCHMARK_PARALLEL_CALL)
+        {
+            recieveTransactionDataParallel(&Loc_Transactions[Loc_Index], BENCHMARK_PARALLEL_CALL, &Loc_States[Loc_Index]);
+        }
+
+        serverCommit();
+
+        uint64_t Loc_Time = benchmarkNow() - Loc_Start;
+
+        if (Loc_Threads == 1)
+        {
+            Loc_SingleThreadTime = Loc_Time;
+        }
+
+        for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_SERVER_TRANSACTIONS; Loc_Index++)
+        {
+            Loc_Approved += (Loc_States[Loc_Index] == APPROVED);
+        }
+
+        printf(" %2u threads | %6.2f M tx/s | speedup %5.2fx | approved %llu\n",
+               Loc_Threads, BENCHMARK_SERVER_TRANSACTIONS * 1e3 / (double)Loc_Time,
+               (double)Loc_SingleThreadTime / (double)Loc_Time, (unsigned long long)Loc_Approved);
+
+        serverShutdown();
+    }
+
+    serverRemoveFiles(&Loc_Config);
+    free(Loc_Transactions);
+    free(Loc_States);
+}
+
+/*
+ Name: filterBenchmarkRate
+ Input: double falsePositiveRate
+ Output: void
+ Description: Static Function to fill a filter with BENCHMARK_FILTER_PANS PANs at a false positive rate, then time
+              looking up known and unknown PANs, and count how many unknown PANs it lets through.
+*/
+static void filterBenchmarkRate(double falsePositiveRate)
+{
+    ST_filterConfig_t Loc_Config = { BENCHMARK_FILTER_PANS, falsePositiveRate };
+    ST_filter_t Loc_Filter;
+    ST_filterStats_t Loc_Stats;
+    uint8_t Loc_PAN[20];
+    ST_panKey_t Loc_Key;
+    uint64_t *Loc_Hashes = malloc(2 * BENCHMARK_FILTER_PANS * sizeof(uint64_t));
+    uint64_t Loc_Found[2] = { 0, 0 };
+    uint64_t Loc_Time[2];
+
+    /* Check 1: Not enough memory */
+    if ((Loc_Hashes == NULL) || (filterCreate(&Loc_Filter, &Loc_Config) != FILTER_OK))
+    {
+        printf(" rate %.4f%%: filter can't be created\n", falsePositiveRate * 100.0);
+        free(Loc_Hashes);
+        return;
+    }
+
+    /* Hashes of the known PANs first, then of as many unknown PANs */
+    for (uint64_t Loc_Index = 0; Loc_Index < (2 * BENCHMARK_FILTER_PANS); Loc_Index++)
+    {
+        benchmarkMakePAN((Loc_Index < BENCHMARK_FILTER_PANS) ? '4' : '9', Loc_Index % BENCHMARK_FILTER_PANS, Loc_PAN);
+        panIndexKey(Loc_PAN, &Loc_Key);
+        Loc_Hashes[Loc_Index] = panIndexHash(&Loc_Key);
+    }
+
+    for (uint64_t Loc_Index = 0; Loc_Index < BENCHMARK_FILTER_PANS; Loc_Index++)
+    {
+        filterInsert(&Loc_Filter, Loc_Hashes[Loc_Index]);
+    }
+
+    /* Loop: Run 0 looks up known PANs, run 1 unknown PANs */
+    for (uint8_t Loc_Run = 0; Loc_Run < 2; Loc_Run++)
+    {
+        const uint64_t *Loc_RunHashes = &Loc_Hashes[Loc_Run * BENCHMARK_FILTER_PANS];
+        uint64_t Loc_Start = benchmarkNow();
+
+        for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_FILTER_LOOKUPS; Loc_Index++)
+        {
+            Loc_Found[Loc_Run] += filterContains(&Loc_Filter, Loc_RunHashes[Loc_Index & (BENCHMARK_FILTER_PANS - 1)]);
+        }
+
+        Loc_Time[Loc_Run] = benchmarkNow() - Loc_Start;
+    }
+
+    filterStats(&Loc_Filter, &Loc_Stats);
+
+    printf(" rate %8.4f%% | %8.1f KiB | %2u-bit | load %5.1f%% | known %5.1f ns, found %6.2f%% | unknown %5.1f ns, "
+           "false positives %.4f%% (expected %.4f%%)\n",
+           falsePositiveRate * 100.0, Loc_Stats.memoryBytes / 1024.0, Loc_Stats.fingerprintBits, Loc_Stats.loadFactor * 100.0,
+           (double)Loc_Time[0] / BENCHMARK_FILTER_LOOKUPS, Loc_Found[0] * 100.0 / BENCHMARK_FILTER_LOOKUPS,
+           (double)Loc_Time[1] / BENCHMARK_FILTER_LOOKUPS, Loc_Found[1] * 100.0 / BENCHMARK_FILTER_LOOKUPS,
+           Loc_Stats.falsePositiveRate * 100.0);
+
+    filterDestroy(&Loc_Filter);
+    free(Loc_Hashes);
+}
+
+/*
+ Name: filterBenchmarkServer
+ Input: uint64 accountsCount
+ Output: void
+ Description: Static Function to time authorizing a fraud-heavy batch workload (BENCHMARK_FILTER_FRAUD_PERCENT of the
+              transactions are for unknown cards) with the known PANs filter, then with a filter of capacity 1, which
+              saturates at once and passes every PAN to the index, as if there were no filter.
+*/
+static void filterBenchmarkServer(uint64_t accountsCount)
+{
+    ST_serverConfig_t Loc_Config;
+    ST_transaction_t Loc_Template = { { "Benchmark Card Holder", "", "05/30", DATE_NONE }, { MONEY_AMOUNT(10, 0), MONEY_AMOUNT(4000, 0), "17/10/2026", DATE_NONE }, APPROVED, 0 };
+    ST_transaction_t *Loc_Transactions = malloc(BENCHMARK_SERVER_TRANSACTIONS * sizeof(ST_transaction_t));
+    EN_transState_t *Loc_States = malloc(BENCHMARK_SERVER_TRANSACTIONS * sizeof(EN_transState_t));
+    ST_filterStats_t Loc_KnownStats;
+    uint64_t Loc_Fraud[2] = { 0, 0 };
+    uint64_t Loc_Time[2];
+
+    benchmarkServerConfig(&Loc_Config);
+    serverShutdown();
+    serverRemoveFiles(&Loc_Config);
+
+    /* Check 1: Not enough memory, or the server can't be started */
+    if ((Loc_Transactions == NULL) || (Loc_States == NULL) ||
+        (serverBenchmarkFill(accountsCount) != DATABASE_OK))
+    {
+        printf(" %12llu accounts: server can't be started\n", (unsigned long long)accountsCount);
+        free(Loc_Transactions);
+        free(Loc_States);
+        return;
+    }
+
+    /* Loop: Run 0 is with the known PANs filter, run 1 without */
+    for (uint8_t Loc_Run = 0; Loc_Run < 2; Loc_Run++)
+    {
+        uint64_t Loc_Seed = 0x9E3779B97F4A7C15ULL;
+
+        journalRemove(BENCHMARK_JOURNAL_FILE);
+        Loc_Config.knownFilter.capacity = (Loc_Run == 0) ? 0 : 1;
+
+        if (serverInit(&Loc_Config) != SERVER_OK)
+        {
+            printf(" %12llu accounts: server can't be started\n", (unsigned long long)accountsCount);
+            break;
+        }
+
+        if (Loc_Run == 0)
+        {
+            serverFilterStats(&Loc_KnownStats, NULL);
+        }
+
+        for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_SERVER_TRANSACTIONS; Loc_Index++)
+        {
+            uint64_t Loc_Random = benchmarkRandom(&Loc_Seed);
+
+            Loc_Transactions[Loc_Index] = Loc_Template;
+            benchmarkMakePAN(((Loc_Random % 100) < BENCHMARK_FILTER_FRAUD_PERCENT) ? '9' : '4', (Loc_Random >> 8) % accountsCount,
+                             Loc_Transactions[Loc_Index].cardHolderData.primaryAccountNumber);
+        }
+
+        uint64_t Loc_Start = benchmarkNow();
+
+        for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_SERVER_TRANSACTIONS; Loc_Index += BENCHMARK_SERVER_BATCH)
+        {
+            recieveTransactionDataBatch(&Loc_Transactions[Loc_Index], BENCHMARK_SERVER_BATCH, &Loc_States[Loc_Index]);
+        }
+
+        serverCommit();
+        Loc_Time[Loc_Run] = benchmarkNow() - Loc_Start;
+
+        for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_SERVER_TRANSACTIONS; Loc_Index++)
+        {
+            Loc_Fraud[Loc_Run] += (Loc_States[Loc_Index] == FRAUD_CARD);
+        }
+
+        serverShutdown();
+    }
+
+    printf(" %12llu accounts | filter %6.2f M tx/s | no filter %6.2f M tx/s | speedup %5.2fx | fraud %llu/%llu | filter %.1f KiB\n",
+           (unsigned long long)accountsCount,
+           BENCHMARK_SERVER_TRANSACTIONS * 1e3 / (double)Loc_Time[0],
+           BENCHMARK_SERVER_TRANSACTIONS * 1e3 / (double)Loc_Time[1],
+           (double)Loc_Time[1] / (double)Loc_Time[0],
+           (unsigned long long)Loc_Fraud[0], (unsigned long long)Loc_Fraud[1], Loc_KnownStats.memoryBytes / 1024.0);
+
+    serverRemoveFiles(&Loc_Config);
+    free(Loc_Transactions);
+    free(Loc_States);
+}
+
+/**
+ * Measures the PAN filters: memory, lookup time and measured versus expected false positive rate at three target
+ * rates, then a fraud-heavy workload authorized with and without the known PANs filter, at 1K and 1M accounts
+ */
+void filterBenchmark(void)
+{
+    printf("====================================\n");
+    printf("Benchmark:\tPAN Filters\n");
+    printf("====================================\n");
+
+    filterBenchmarkRate(0.01);
+    filterBenchmarkRate(0.001);
+    filterBenchmarkRate(0.00001);
+
+    filterBenchmarkServer(1000ULL);
+    filterBenchmarkServer(1000000ULL);
+}
+
+/*
+ Name: checkpointBenchmarkCopy
+ Input: Pointer to source file name, and Pointer to destination file name
+ Output: uint8 1 if the file is copied, else 0
+ Description: Static Function to copy a file.
+*/
+static uint8_t checkpointBenchmarkCopy(const char *from, const char *to)
+{
+    static uint8_t Loc_Buffer[1 << 16];
+    FILE *Loc_From = fopen(from, "rb");
+    FILE *Loc_To   = (Loc_From != NULL) ? fopen(to, "wb") : NULL;
+    uint8_t Loc_Copied = (Loc_To != NULL);
+    size_t Loc_Read;
+
+    while (Loc_Copied && ((Loc_Read = fread(Loc_Buffer, 1, sizeof(Loc_Buffer), Loc_From)) != 0))
+    {
+        Loc_Copied = (fwrite(Loc_Buffer, 1, Loc_Read, Loc_To) == Loc_Read);
+    }
+
+    if (Loc_From != NULL)
+    {
+        fclose(Loc_From);
+    }
+
+    if ((Loc_To != NULL) && (fclose(Loc_To) != 0))
+    {
+        Loc_Copied = 0;
+    }
+
+    return Loc_Copied;
+}
+
+/*
+ Name: checkpointBenchmarkBalances
+ Input: void
+ Output: uint64 hash of all balances, 0 if the accounts file can't be opened
+ Description: Static Function to hash the balances of the benchmark accounts file, to compare them before and after a restart.
+*/
+static uint64_t checkpointBenchmarkBalances(void)
+{
+    ST_database_t Loc_Database;
+    uint64_t Loc_Hash = 14695981039346656037ULL;
+
+    if (databaseOpen(&Loc_Database, BENCHMARK_DATABASE_FILE) != DATABASE_OK)
+    {
+        return 0;
+    }
+
+    for (uint64_t Loc_Index = 0; Loc_Index < Loc_Database.header->accountsCount; Loc_Index++)
+    {
+        Loc_Hash ^= (uint64_t)Loc_Database.accounts[Loc_Index].balance;
+        Loc_Hash *= 1099511628211ULL;
+    }
+
+    databaseClose(&Loc_Database);
+
+    return Loc_Hash;
+}
+
+/*
+ Name: checkpointBenchmarkRestart
+ Input: Pointer to transactions array, Pointer to states array, uint32 historyCount, and uint64 checkpointInterval
+ Output: void
+ Description: Static Function to authorize historyCount transactions with a checkpoint every checkpointInterval of them,
+              then time a restart after a crash: the newest periodic checkpoint is put back in place of the one the
+              shutdown wrote, so the restart loads it and replays the log after it.
+              The balances after the restart must be the ones the shutdown wrote.
+*/
+static void checkpointBenchmarkRestart(ST_transaction_t *transactions, EN_transState_t *states, uint32_t historyCount, uint64_t checkpointInterval)
+{
+    ST_serverConfig_t Loc_Config;
+    ST_checkpoint_t Loc_Checkpoint = { 0, 0, NULL, NULL };
+    uint64_t Loc_Balances[2];
+
+    benchmarkServerConfig(&Loc_Config);
+    Loc_Config.checkpointInterval = checkpointInterval;
+
+    serverShutdown();
+    serverRemoveFiles(&Loc_Config);
+
+    /* Check 1: Server can't be started */
+    if ((serverBenchmarkFill(BENCHMARK_CHECKPOINT_ACCOUNTS) != DATABASE_OK) || (serverInit(&Loc_Config) != SERVER_OK))
+    {
+        printf(" %10u transactions: server can't be started\n", historyCount);
+        return;
+    }
+
+    /* Step 1: Transaction history, a checkpoint is written every checkpointInterval transactions */
+    serverBenchmarkTransactions(transactions, BENCHMARK_CHECKPOINT_ACCOUNTS);
+
+    for (uint32_t Loc_Index = 0; Loc_Index < historyCount; Loc_Index += BENCHMARK_SERVER_BATCH)
+    {
+        recieveTransactionDataBatch(&transactions[Loc_Index], BENCHMARK_SERVER_BATCH, &states[Loc_Index]);
+    }
+
+    /* Step 2: Keep the newest periodic checkpoint, shut down cleanly, then put it back as if the shutdown never ran */
+    checkpointBenchmarkCopy(BENCHMARK_CHECKPOINT_FILE, BENCHMARK_CHECKPOINT_SAVED);
+    serverShutdown();
+    Loc_Balances[0] = checkpointBenchmarkBalances();
+    checkpointRead(BENCHMARK_CHECKPOINT_SAVED, &Loc_Checkpoint);
+    checkpointBenchmarkCopy(BENCHMARK_CHECKPOINT_SAVED, BENCHMARK_CHECKPOINT_FILE);
+
+    /* Step 3: Restart */
+    uint64_t Loc_Start = benchmarkNow();
+    EN_serverError_t Loc_ErrorState = serverInit(&Loc_Config);
+    uint64_t Loc_Time = benchmarkNow() - Loc_Start;
+
+    serverShutdown();
+    Loc_Balances[1] = checkpointBenchmarkBalances();
+
+    printf(" %10u logged | checkpoint at %10llu | %10llu replayed | restart %9.2f ms | balances %s\n",
+           historyCount, (unsigned long long)Loc_Checkpoint.journalCount,
+           (unsigned long long)(historyCount - Loc_Checkpoint.journalCount), Loc_Time / 1e6,
+           ((Loc_ErrorState == SERVER_OK) && (Loc_Balances[0] == Loc_Balances[1])) ? "match" : "DIFFER");
+
+    checkpointFree(&Loc_Checkpoint);
+    remove(BENCHMARK_CHECKPOINT_SAVED);
+    serverRemoveFiles(&Loc_Config);
+}
+
+/**
+ * Measures server restart time after a crash against the number of transactions ever logged, with one checkpoint at
+ * the start only (the whole log is replayed), then with a checkpoint every BENCHMARK_CHECKPOINT_INTERVAL transactions
+ */
+void checkpointBenchmark(void)
+{
+    ST_transaction_t *Loc_Transactions = malloc(BENCHMARK_SERVER_TRANSACTIONS * sizeof(ST_transaction_t));
+    EN_transState_t *Loc_States = malloc(BENCHMARK_SERVER_TRANSACTIONS * sizeof(EN_transState_t));
+
+    printf("====================================\n");
+    printf("Benchmark:\tServer Restart from Checkpoint\n");
+    printf("====================================\n");
+
+    /* Check 1: Not enough memory */
+    if ((Loc_Transactions == NULL) || (Loc_States == NULL))
+    {
+        printf(" not enough memory\n");
+        free(Loc_Transactions);
+        free(Loc_States);
+        return;
+    }
+
+    printf(" no checkpoints after the start:\n");
+
+    for (uint32_t Loc_History = BENCHMARK_SERVER_TRANSACTIONS / 4; Loc_History <= BENCHMARK_SERVER_TRANSACTIONS; Loc_History *= 2)
+    {
+        checkpointBenchmarkRestart(Loc_Transactions, Loc_States, Loc_History, (uint64_t)Loc_History + 1);
+    }
+
+    printf(" checkpoint every %u transactions:\n", BENCHMARK_CHECKPOINT_INTERVAL);
+
+    for (uint32_t Loc_History = BENCHMARK_SERVER_TRANSACTIONS / 4; Loc_History <= BENCHMARK_SERVER_TRANSACTIONS; Loc_History *= 2)
+    {
+        checkpointBenchmarkRestart(Loc_Transactions, Loc_States, Loc_History, BENCHMARK_CHECKPOINT_INTERVAL);
+    }
+
+    free(Loc_Transactions);
+    free(Loc_States);
+}
+
+/*
+ Name: velocityBenchmarkTracker
+ Input: uint64 accountsCount
+ Output: void
+ Description: Static Function to time BENCHMARK_VELOCITY_CHECKS checks with the SERVER_VELOCITY_* limits on random
+              accounts out of accountsCount, on a clock that moves one second every BENCHMARK_VELOCITY_RATE checks.
+              Run 0 checks one account after the other, run 1 prefetches the account BENCHMARK_VELOCITY_AHEAD checks
+              ahead, as the server does for a batch.
+*/
+static void velocityBenchmarkTracker(uint64_t accountsCount)
+{
+    ST_velocityConfig_t Loc_Config = { accountsCount, { { SERVER_VELOCITY_SECONDS, SERVER_VELOCITY_SECONDS_MAX, 0 },
+                                                        { SERVER_VELOCITY_MINUTES, SERVER_VELOCITY_MINUTES_MAX, 0 },
+                                                        { SERVER_VELOCITY_HOURS, SERVER_VELOCITY_HOURS_MAX, SERVER_VELOCITY_AMOUNT_MAX } } };
+    uint64_t *Loc_Hashes = malloc((BENCHMARK_VELOCITY_CHECKS + BENCHMARK_VELOCITY_AHEAD) * sizeof(uint64_t));
+    uint64_t Loc_Seed = 0x9E3779B97F4A7C15ULL;
+    ST_velocityStats_t Loc_Stats;
+    ST_velocity_t Loc_Velocity;
+    uint8_t Loc_PAN[20];
+    ST_panKey_t Loc_Key;
+    uint64_t Loc_Time[2];
+
+    /* Check 1: Not enough memory */
+    if (Loc_Hashes == NULL)
+    {
+        printf(" %12llu accounts: not enough memory\n", (unsigned long long)accountsCount);
+        return;
+    }
+
+    /* Hashes of the accounts of all checks, the last BENCHMARK_VELOCITY_AHEAD are only prefetched */
+    for (uint32_t Loc_Index = 0; Loc_Index < (BENCHMARK_VELOCITY_CHECKS + BENCHMARK_VELOCITY_AHEAD); Loc_Index++)
+    {
+        benchmarkMakePAN('4', benchmarkRandom(&Loc_Seed) % accountsCount, Loc_PAN);
+        panIndexKey(Loc_PAN, &Loc_Key);
+        Loc_Hashes[Loc_Index] = panIndexHash(&Loc_Key);
+    }
+
+    /* Loop: Run 0 is one check after the other, run 1 prefetches ahead */
+    for (uint8_t Loc_Run = 0; Loc_Run < 2; Loc_Run++)
+    {
+        if (velocityCreate(&Loc_Velocity, &Loc_Config) != VELOCITY_OK)
+        {
+            printf(" %12llu accounts: tracker can't be created\n", (unsigned long long)accountsCount);
+            free(Loc_Hashes);
+            return;
+        }
+
+        uint64_t Loc_Start = benchmarkNow();
+
+        for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_VELOCITY_CHECKS; Loc_Index++)
+        {
+            if (Loc_Run == 1)
+            {
+                velocityPrefetch(&Loc_Velocity, Loc_Hashes[Loc_Index + BENCHMARK_VELOCITY_AHEAD]);
+            }
+
+            velocityCheck(&Loc_Velocity, Loc_Hashes[Loc_Index], MONEY_AMOUNT(10, 0), 1000000000UL + (Loc_Index / BENCHMARK_VELOCITY_RATE));
+        }
+
+        Loc_Time[Loc_Run] = benchmarkNow() - Loc_Start;
+        velocityStats(&Loc_Velocity, &Loc_Stats);
+        velocityDestroy(&Loc_Velocity);
+    }
+
+    printf(" %12llu accounts | %6.2f M checks/s, prefetched %6.2f M checks/s | declined %6.2f%% | untracked %llu | %10.1f KiB, %llu bytes/account\n",
+           (unsigned long long)accountsCount, BENCHMARK_VELOCITY_CHECKS * 1e3 / (double)Loc_Time[0],
+           BENCHMARK_VELOCITY_CHECKS * 1e3 / (double)Loc_Time[1], Loc_Stats.declinedCount * 100.0 / BENCHMARK_VELOCITY_CHECKS,
+           (unsigned long long)Loc_Stats.untrackedCount, Loc_Stats.memoryBytes / 1024.0,
+           (unsigned long long)(Loc_Stats.memoryBytes / accountsCount));
+
+    free(Loc_Hashes);
+}
+
+/*
+ Name: velocityBenchmarkServer
+ Input: uint64 accountsCount
+ Output: void
+ Description: Static Function to time authorizing the same batches with no velocity limits, then with the SERVER_VELOCITY_*
+              limits, against a server with accountsCount accounts.
+*/
+static void velocityBenchmarkServer(uint64_t accountsCount)
+{
+    ST_serverConfig_t Loc_Config;
+    ST_velocityConfig_t Loc_Limits = { 0, { { SERVER_VELOCITY_SECONDS, SERVER_VELOCITY_SECONDS_MAX, 0 },
+                                            { SERVER_VELOCITY_MINUTES, SERVER_VELOCITY_MINUTES_MAX, 0 },
+                                            { SERVER_VELOCITY_HOURS, SERVER_VELOCITY_HOURS_MAX, SERVER_VELOCITY_AMOUNT_MAX } } };
+    ST_transaction_t *Loc_Transactions = malloc(BENCHMARK_SERVER_TRANSACTIONS * sizeof(ST_transaction_t));
+    EN_transState_t *Loc_States = malloc(BENCHMARK_SERVER_TRANSACTIONS * sizeof(EN_transState_t));
+    ST_velocityStats_t Loc_Stats;
+    uint64_t Loc_Declined = 0;
+    uint64_t Loc_Time[2];
+
+    benchmarkServerConfig(&Loc_Config);
+    serverShutdown();
+    serverRemoveFiles(&Loc_Config);
+
+    /* Check 1: Not enough memory, or the server can't be started */
+    if ((Loc_Transactions == NULL) || (Loc_States == NULL) ||
+        (serverBenchmarkFill(accountsCount) != DATABASE_OK))
+    {
+        printf(" %12llu accounts: server can't be started\n", (unsigned long long)accountsCount);
+        free(Loc_Transactions);
+        free(Loc_States);
+        return;
+    }
+
+    /* Loop: Run 0 is with no limits, run 1 with the limits */
+    for (uint8_t Loc_Run = 0; Loc_Run < 2; Loc_Run++)
+    {
+        journalRemove(BENCHMARK_JOURNAL_FILE);
+        memset(&Loc_Config.velocity, 0, sizeof(ST_velocityConfig_t));
+
+        if (Loc_Run == 1)
+        {
+            Loc_Config.velocity = Loc_Limits;
+        }
+
+        if (serverInit(&Loc_Config) != SERVER_OK)
+        {
+            printf(" %12llu accounts: server can't be started\n", (unsigned long long)accountsCount);
+            break;
+        }
+
+        serverBenchmarkTransactions(Loc_Transactions, accountsCount);
+
+        uint64_t Loc_Start = benchmarkNow();
+
+        for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_SERVER_TRANSACTIONS; Loc_Index += BENCHMARK_SERVER_BATCH)
+        {
+            recieveTransactionDataBatch(&Loc_Transactions[Loc_Index], BENCHMARK_SERVER_BATCH, &Loc_States[Loc_Index]);
+        }
+
+        serverCommit();
+        Loc_Time[Loc_Run] = benchmarkNow() - Loc_Start;
+
+        if (Loc_Run == 1)
+        {
+            serverVelocityStats(&Loc_Stats);
+
+            for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_SERVER_TRANSACTIONS; Loc_Index++)
+            {
+                Loc_Declined += (Loc_States[Loc_Index] == DECLINED_VELOCITY);
+            }
+        }
+
+        serverShutdown();
+    }
+
+    printf(" %12llu accounts | no limits %6.2f M tx/s | limits %6.2f M tx/s | overhead %5.1f ns/tx | declined %llu | trackers %.1f KiB\n",
+           (unsigned long long)accountsCount,
+           BENCHMARK_SERVER_TRANSACTIONS * 1e3 / (double)Loc_Time[0],
+           BENCHMARK_SERVER_TRANSACTIONS * 1e3 / (double)Loc_Time[1],
+           ((double)Loc_Time[1] - (double)Loc_Time[0]) / BENCHMARK_SERVER_TRANSACTIONS,
+           (unsigned long long)Loc_Declined, Loc_Stats.memoryBytes / 1024.0);
+
+    serverRemoveFiles(&Loc_Config);
+    free(Loc_Transactions);
+    free(Loc_States);
+}
+
+/**
+ * Measures velocity checks per second and memory per account of the tracker alone, at 1K accounts (most checks are
+ * over a limit) and 1M accounts (few are), then the cost it adds to batch authorization
+ */
+void velocityBenchmark(void)
+{
+    printf("====================================\n");
+    printf("Benchmark:\tVelocity Limits\n");
+    printf("====================================\n");
+
+    velocityBenchmarkTracker(1000ULL);
+    velocityBenchmarkTracker(1000000ULL);
+
+    velocityBenchmarkServer(1000ULL);
+    velocityBenchmarkServer(1000000ULL);
+}
+
+/**
+ * Measures settlement totals: transactions added per second, then the end-of-day totals of one day and all networks
+ * from the running totals, against a scan of the same transactions in memory
+ */
+void settlementBenchmark(void)
+{
+    ST_transaction_t *Loc_Transactions = calloc(BENCHMARK_SETTLEMENT_TRANSACTIONS, sizeof(ST_transaction_t));
+    ST_settlement_t *Loc_Settlement = malloc(sizeof(ST_settlement_t));
+    ST_settlementTotals_t Loc_Totals;
+    ST_settlementTotals_t Loc_Scanned;
+    date_t Loc_Day = dateFromDayNumber(dateToDayNumber(DATE_PACK(2026, 1, 1)) + 290);
+    uint64_t Loc_Seed = 0x9E3779B97F4A7C15ULL;
+    uint64_t Loc_Check = 0;
+    uint64_t Loc_Time[3];
+
+    printf("====================================\n");
+    printf("Benchmark:\tSettlement Totals\n");
+    printf("====================================\n");
+
+    /* Check 1: Not enough memory */
+    if ((Loc_Transactions == NULL) || (Loc_Settlement == NULL))
+    {
+        printf(" settlement: not enough memory\n");
+        free(Loc_Transactions);
+        free(Loc_Settlement);
+        return;
+    }
+
+    /* Step 1: Transactions of Visa and MasterCard cards, over the days of 2026 */
+    for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_SETTLEMENT_TRANSACTIONS; Loc_Index++)
+    {
+        ST_transaction_t *Loc_Transaction = &Loc_Transactions[Loc_Index];
+        uint64_t Loc_Random = benchmarkRandom(&Loc_Seed);
+
+        benchmarkMakePAN((Loc_Random & 1) ? '4' : '5', Loc_Index, Loc_Transaction->cardHolderData.primaryAccountNumber);
+        Loc_Transaction->terminalData.packedTransactionDate = dateFromDayNumber(dateToDayNumber(DATE_PACK(2026, 1, 1)) + ((Loc_Random >> 32) % 365));
+        dateFormat(Loc_Transaction->terminalData.packedTransactionDate, Loc_Transaction->terminalData.transactionDate);
+        Loc_Transaction->terminalData.transAmount = (money_t)((Loc_Random >> 16) % MONEY_AMOUNT(5000, 0));
+        Loc_Transaction->transState               = (EN_transState_t)((Loc_Random >> 8) % SETTLEMENT_STATES_COUNT);
+    }
+
+    /* Step 2: Add all transactions, as saveTransaction does */
+    settlementReset(Loc_Settlement);
+    uint64_t Loc_Start = benchmarkNow();
+
+    for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_SETTLEMENT_TRANSACTIONS; Loc_Index++)
+    {
+        settlementAdd(Loc_Settlement, &Loc_Transactions[Loc_Index]);
+    }
+
+    Loc_Time[0] = benchmarkNow() - Loc_Start;
+
+    /* Step 3: End-of-day totals from the running totals */
+    Loc_Start = benchmarkNow();
+
+    for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_SETTLEMENT_QUERIES; Loc_Index++)
+    {
+        settlementQuery(Loc_Settlement, Loc_Day, SETTLEMENT_ALL_NETWORKS, &Loc_Totals);
+        Loc_Check += Loc_Totals.counts[APPROVED];
+    }
+
+    Loc_Time[1] = benchmarkNow() - Loc_Start;
+
+    /* Step 4: Same totals by a scan of all transactions, once */
+    Loc_Start = benchmarkNow();
+    memset(&Loc_Scanned, 0, sizeof(Loc_Scanned));
+
+    for (uint32_t Loc_Index = 0; Loc_Index < BENCHMARK_SETTLEMENT_TRANSACTIONS; Loc_Index++)
+    {
+        if (Loc_Transactions[Loc_Index].terminalData.packedTransactionDate == Loc_Day)
+        {
+            Loc_Scanned.counts[Loc_Transactions[Loc_Index].transState]++;
+            Loc_Scanned.amounts[Loc_Transactions[Loc_Index].transState] += Loc_Transactions[Loc_Index].terminalData.transAmount;
+        }
+    }
+
+    Loc_Time[2] = benchmarkNow() - Loc_Start;
+
+    printf(" add    %8.2f ns | %10.0f tx/s | totals %u bytes\n",
+           (double)Loc_Time[0] / BENCHMARK_SETTLEMENT_TRANSACTIONS, BENCHMARK_SETTLEMENT_TRANSACTIONS * 1e9 / (double)Loc_Time[0],
+           (uint32_t)sizeof(ST_settlement_t));
+    printf(" day query %8.2f ns | scan of %u tx %12.0f ns | %8.0fx faster | %s | checksum %llu\n",
+           (double)Loc_Time[1] / BENCHMARK_SETTLEMENT_QUERIES, BENCHMARK_SETTLEMENT_TRANSACTIONS, (double)Loc_Time[2],
+           (double)Loc_Time[2] * BENCHMARK_SETTLEMENT_QUERIES / (double)((Loc_Time[1] != 0) ? Loc_Time[1] : 1),
+           (memcmp(&Loc_Totals, &Loc_Scanned, sizeof(Loc_Totals)) == 0) ? "same totals" : "totals DIFFER",
+           (unsigned long long)Loc_Check);
+
+    free(Loc_Transactions);
+    free(Loc_Settlement);
+}
+
+/*
+ Name: rangeBenchmarkDay
+ Input: uint64 record, uint64 records count, and Pointer to uint64 random state
+ Output: uint32 day of the year of the record
+ Description: Static Function to get the day a record of a log over BENCHMARK_RANGE_DAYS days is dated: the day it is
+              logged on, or the day before for BENCHMARK_RANGE_LATE_PERCENT of the records.
+*/
+static uint32_t rangeBenchmarkDay(uint64_t record, uint64_t recordsCount, uint64_t *seed)
+{
+    uint32_t Loc_Day = (uint32_t)((record * BENCHMARK_RANGE_DAYS) / recordsCount);
+
+    if (((benchmarkRandom(seed) % 100) < BENCHMARK_RANGE_LATE_PERCENT) && (Loc_Day > 0))
+    {
+        Loc_Day--;
+    }
+
+    return Loc_Day;
+}
+
+/*
+ Name: rangeBenchmarkIndex
+ Input: void
+ Output: void
+ Description: Static Function to index BENCHMARK_RANGE_RECORDS records, then time queries of 1 and 7 days that find
+              all blocks of their range, against a scan of all block entries.
+*/
+static void rangeBenchmarkIndex(void)
+{
+    ST_rangeIndex_t Loc_Index;
+    uint64_t Loc_Seed = 0x9E3779B97F4A7C15ULL;
+    uint64_t Loc_Check = 0;
+    uint64_t Loc_Time[3];
+
+    /* Check 1: Index can't be made */
+    if (rangeOpen(&Loc_Index, NULL, 0) != RANGE_OK)
+    {
+        printf(" index: not enough memory\n");
+        return;
+    }
+
+    /* Step 1: Add the transaction day + 1 of all records */
+    uint64_t Loc_Start = benchmarkNow();
+
+    for (uint64_t Loc_Record = 0; Loc_Record < BENCHMARK_RANGE_RECORDS; Loc_Record++)
+    {
+        if (rangeAdd(&Loc_Index, rangeBenchmarkDay(Loc_Record, BENCHMARK_RANGE_RECORDS, &Loc_Seed) + 1) != RANGE_OK)
+        {
+            printf(" index: not enough memory\n");
+            rangeClose(&Loc_Index);
+            return;
+        }
+    }
+
+    Loc_Time[0] = benchmarkNow() - Loc_Start;
+
+    printf(" index  %llu records | add %6.2f ns | %llu blocks, %llu KB for all levels\n",
+           (unsigned long long)BENCHMARK_RANGE_RECORDS, (double)Loc_Time[0] / BENCHMARK_RANGE_RECORDS,
+           (unsigned long long)(Loc_Index.count >> RANGE_BLOCK_SHIFT),
+           (unsigned long long)(Loc_Index.capacity * sizeof(ST_rangeEntry_t) * RANGE_FANOUT / (RANGE_FANOUT - 1) / 1024));
+
+    /* Loop: Until 1 day and 7 days queries are timed */
+    for (uint32_t Loc_Days = 1; Loc_Days <= 7; Loc_Days += 6)
+    {
+        uint64_t Loc_Blocks = 0;
+        uint64_t Loc_Scanned = 0;
+
+        /* Step 2: Find all blocks of each range */
+        Loc_Start = benchmarkNow();
+
+        for (uint32_t Loc_Query = 0; Loc_Query < BENCHMARK_RANGE_QUERIES; Loc_Query++)
+        {
+            uint32_t Loc_From = (uint32_t)(benchmarkRandom(&Loc_Seed) % (BENCHMARK_RANGE_DAYS - Loc_Days)) + 1;
+            uint64_t Loc_Position = rangeFind(&Loc_Index, Loc_From, Loc_From + Loc_Days - 1, 0);
+
+            while (Loc_Position < Loc_Index.count)
+            {
+                Loc_Blocks++;
+                Loc_Position = rangeFind(&Loc_Index, Loc_From, Loc_From + Loc_Days - 1, (Loc_Position | (RANGE_BLOCK_RECORDS - 1)) + 1);
+            }
+        }
+
+        Loc_Time[1] = benchmarkNow() - Loc_Start;
+
+        /* Step 3: Same ranges by a scan of all block entries, a few of them */
+        Loc_Start = benchmarkNow();
+
+        for (uint32_t Loc_Query = 0; Loc_Query < (BENCHMARK_RANGE_QUERIES / 256); Loc_Query++)
+        {
+            uint32_t Loc_From = (uint32_t)(benchmarkRandom(&Loc_Seed) % (BENCHMARK_RANGE_DAYS - Loc_Days)) + 1;
+
+            for (uint64_t Loc_Block = 0; Loc_Block < (Loc_Index.count >> RANGE_BLOCK_SHIFT); Loc_Block++)
+            {
+                Loc_Scanned += (Loc_Index.levels[0][Loc_Block].minKey <= (Loc_From + Loc_Days - 1)) &&
+                               (Loc_Index.levels[0][Loc_Block].maxKey >= Loc_From);
+            }
+        }
+
+        Loc_Time[2] = benchmarkNow() - Loc_Start;
+        Loc_Check  += Loc_Blocks + Loc_Scanned;
+
+        printf(" %u day%s | %8.0f ns per query | %7.1f blocks (%9.0f records) | scan of all blocks %10.0f ns | %6.0fx faster\n",
+               Loc_Days, (Loc_Days > 1) ? "s" : " ", (double)Loc_Time[1] / BENCHMARK_RANGE_QUERIES,
+               (double)Loc_Blocks / BENCHMARK_RANGE_QUERIES, (double)Loc_Blocks * RANGE_BLOCK_RECORDS / BENCHMARK_RANGE_QUERIES,
+               (double)Loc_Time[2] / (BENCHMARK_RANGE_QUERIES / 256),
+               ((double)Loc_Time[2] / (BENCHMARK_RANGE_QUERIES / 256)) / ((double)Loc_Time[1] / BENCHMARK_RANGE_QUERIES));
+    }
+
+    printf(" checksum %llu\n", (unsigned long long)Loc_Check);
+    rangeClose(&Loc_Index);
+}
+
+/*
+ Name: rangeBenchmarkLog
+ Input: void
+ Output: void
+ Description: Static Function to log BENCHMARK_RANGE_LOG_RECORDS transactions, then time finding all transactions of a
+              day through the dates index, against a full pass over the log.
+*/
+static void rangeBenchmarkLog(void)
+{
+    ST_journal_t Loc_Journal;
+    ST_journalConfig_t Loc_Config = { BENCHMARK_JOURNAL_FILE, 4096, BENCHMARK_JOURNAL_LATENCY_US };
+    ST_transaction_t Loc_Transaction = { { "Benchmark Card Holder", "", "05/30", DATE_NONE }, { MONEY_AMOUNT(100, 0), MONEY_AMOUNT(4000, 0), "", DATE_NONE }, APPROVED, 0 };
+    ST_transaction_t *Loc_Page = malloc(SERVER_BATCH_SIZE * sizeof(ST_transaction_t));
+    uint32_t Loc_FirstDay = dateToDayNumber(DATE_PACK(2026, 1, 1));
+    uint64_t Loc_Seed = 0x9E3779B97F4A7C15ULL;
+    uint64_t Loc_Found[2] = { 0, 0 };
+    uint64_t Loc_Time[2];
+
+    journalRemove(BENCHMARK_JOURNAL_FILE);
+
+    /* Check 1: Not enough memory, or the log can't be created */
+    if ((Loc_Page == NULL) || (journalOpen(&Loc_Journal, &Loc_Config) != JOURNAL_OK))
+    {
+        printf(" log: not enough memory, or transactions log can't be created\n");
+        free(Loc_Page);
+        return;
+    }
+
+    /* Step 1: Log the transactions, dated over the days of 2026 */
+    for (uint64_t Loc_Record = 0; Loc_Record < BENCHMARK_RANGE_LOG_RECORDS; Loc_Record++)
+    {
+        benchmarkMakePAN('4', Loc_Record, Loc_Transaction.cardHolderData.primaryAccountNumber);
+        Loc_Transaction.terminalData.packedTransactionDate = dateFromDayNumber(Loc_FirstDay + rangeBenchmarkDay(Loc_Record, BENCHMARK_RANGE_LOG_RECORDS, &Loc_Seed));
+        dateFormat(Loc_Transaction.terminalData.packedTransactionDate, Loc_Transaction.terminalData.transactionDate);
+        journalAppend(&Loc_Journal, &Loc_Transaction);
+    }
+
+    journalCommit(&Loc_Journal);
+
+    /* Step 2: All transactions of a few days through the index, a page at a time */
+    uint64_t Loc_Start = benchmarkNow();
+
+    for (uint32_t Loc_Query = 0; Loc_Query < BENCHMARK_RANGE_LOG_QUERIES; Loc_Query++)
+    {
+        date_t Loc_Day = dateFromDayNumber(Loc_FirstDay + (uint32_t)(benchmarkRandom(&Loc_Seed) % BENCHMARK_RANGE_DAYS));
+        uint64_t Loc_Cursor = 0;
+        uint32_t Loc_Count;
+
+        do
+        {
+            Loc_Count = journalFindDates(&Loc_Journal, Loc_Day, Loc_Day, &Loc_Cursor, Loc_Page, SERVER_BATCH_SIZE);
+            Loc_Found[0] += Loc_Count;
+        } while (Loc_Count == SERVER_BATCH_SIZE);
+    }
+
+    Loc_Time[0] = benchmarkNow() - Loc_Start;
+
+    /* Step 3: Same days by a full pass over the log */
+    Loc_Seed  = 0x9E3779B97F4A7C15ULL;
+    for (uint64_t Loc_Record = 0; Loc_Record < BENCHMARK_RANGE_LOG_RECORDS; Loc_Record++)
+    {
+        rangeBenchmarkDay(Loc_Record, BENCHMARK_RANGE_LOG_RECORDS, &Loc_Seed);
+    }
+
+    Loc_Start = benchmarkNow();
+
+    for (uint32_t Loc_Query = 0; Loc_Query < BENCHMARK_RANGE_LOG_QUERIES; Loc_Query++)
+    {
+        date_t Loc_Day = dateFromDayNumber(Loc_FirstDay + (uint32_t)(benchmarkRandom(&Loc_Seed) % BENCHMARK_RANGE_DAYS));
+        uint64_t Loc_Position = 0;
+        uint32_t Loc_Count;
+
+        while ((Loc_Count = journalRead(&Loc_Journal, Loc_Position, Loc_Page, SERVER_BATCH_SIZE)) != 0)
+        {
+            for (uint32_t Loc_Index = 0; Loc_Index < Loc_Count; Loc_Index++)
+            {
+                Loc_Found[1] += (Loc_Page[Loc_Index].terminalData.packedTransactionDate == Loc_Day);
+            }
+
+            Loc_Position += Loc_Count;
+        }
+    }
+
+    Loc_Time[1] = benchmarkNow() - Loc_Start;
+
+    printf(" log    %u records | 1 day: index %10.0f ns | full pass %12.0f ns | %6.0fx faster | %s (%llu found)\n",
+           BENCHMARK_RANGE_LOG_RECORDS, (double)Loc_Time[0] / BENCHMARK_RANGE_LOG_QUERIES, (double)Loc_Time[1] / BENCHMARK_RANGE_LOG_QUERIES,
+           (double)Loc_Time[1] / (double)Loc_Time[0], (Loc_Found[0] == Loc_Found[1]) ? "same transactions" : "transactions DIFFER",
+           (unsigned long long)Loc_Found[0]);
+
+    journalClose(&Loc_Journal);
+    journalRemove(BENCHMARK_JOURNAL_FILE);
+    free(Loc_Page);
+}
+
+/**
+ * Measures range queries on transaction dates: the range index alone over 100M records, then whole queries on a log
+ * of 2M transactions against a full pass over it
+ */
+void rangeBenchmark(void)
+{
+    printf("====================================\n");
+    printf("Benchmark:\tDate Range Index\n");
+    printf("====================================\n");
+
+    rangeBenchmarkIndex();
+    rangeBenchmarkLog();
+}
+
+/**
+ * Measures the whole validation chain on generated workloads of 1M accounts, from uniform popularity to a few hot
+ * accounts, with the default fraud, blocked and expired ratios. Hot accounts run out of balance first, so more of their
+ * transactions are declined. Allocations are only counted in builds with WORKLOAD_COUNT_ALLOCATIONS defined.
+ */
+void workloadBenchmark(void)
+{
+    const double Loc_Exponents[] = { 0.0, 0.8, 1.0, 1.2 };
+    ST_workloadConfig_t Loc_Config;
+    ST_workloadStats_t Loc_Stats;
+
+    printf("====================================\n");
+    printf("Benchmark:\tGenerated Workloads (%llu accounts)\n", (unsigned long long)BENCHMARK_WORKLOAD_ACCOUNTS);
+    printf("====================================\n");
+
+    workloadDefaultConfig(&Loc_Config);
+    Loc_Config.accountsCount     = BENCHMARK_WORKLOAD_ACCOUNTS;
+    Loc_Config.transactionsCount = BENCHMARK_WORKLOAD_TRANSACTIONS;
+
+    /* Loop: Until a run of each exponent is done */
+    for (uint32_t Loc_Run = 0; Loc_Run < (sizeof(Loc_Exponents) / sizeof(Loc_Exponents[0])); Loc_Run++)
+    {
+        Loc_Config.zipfExponent = Loc_Exponents[Loc_Run];
+
+        if (workloadRun(&Loc_Config, &Loc_Stats) != WORKLOAD_OK)
+        {
+            printf(" zipf %.1f: workload can't be run\n", Loc_Exponents[Loc_Run]);
+            workloadFreeStats(&Loc_Stats);
+            break;
+        }
+
+        printf(" zipf %.1f | %6.3f M tx/s | server p50 %5.2f us, p99 %6.2f us | approved %6.2f%% | allocations/tx %.4f\n",
+               Loc_Exponents[Loc_Run], (double)Loc_Stats.transactions * 1e3 / (double)Loc_Stats.elapsedNs,
+               workloadPercentile(&Loc_Stats, WORKLOAD_SERVER_STAGE, 50.0) / 1e3,
+               workloadPercentile(&Loc_Stats, WORKLOAD_SERVER_STAGE, 99.0) / 1e3,
+               100.0 * (double)Loc_Stats.states[APPROVED] / (double)Loc_Stats.transactions,
+               Loc_Stats.allocationsCounted ? ((double)Loc_Stats.allocationsCount / (double)Loc_Stats.transactions) : 0.0);
+
+        workloadFreeStats(&Loc_Stats);
+    }
+}
+
+/**
+ * Call this from main.c to benchmark all project modules
+ */
+void benchmarkAll(void)
+{
+    printf("\n\n");
+    printf("/**********************************************************************\\\n");
+    printf("\t\t\tBENCHMARKING SERVER MODULE\t\t\t\n");
+    printf("/**********************************************************************\\\n");
+    printf("\n\n");
+    moneyBenchmark();
+    dateBenchmark();
+    luhnBenchmark();
+    panIndexBenchmark();
+    databaseBenchmark();
+    journalBenchmark();
+    reportBenchmark();
+    serverBenchmark();
+    serverParallelBenchmark();
+    filterBenchmark();
+    checkpointBenchmark();
+    velocityBenchmark();
+    settlementBenchmark();
+    rangeBenchmark();
+    workloadBenchmark();
+}
@@ -0,0 +1,151 @@
+/**
+ * @Title      	: Benchmark Module
+ * @Filename   	: benchmark.h
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../Money/money.h"
+#include "../Date/date.h"
+#include "../Terminal/terminal.h"
+#include "../Luhn/luhn.h"
+#include "../Index/index.h"
+#include "../Database/database.h"
+#include "../Journal/journal.h"
+#include "../Report/report.h"
+#include "../Filter/filter.h"
+#include "../Velocity/velocity.h"
+#include "../Settlement/settlement.h"
+#include "../Range/range.h"
+#include "../Server/server.h"
+#include "../Workload/workload.h"
+
+/* Number of amounts parsed and formatted, and added up per sum */
+#define BENCHMARK_MONEY_TEXTS		(1 << 20)
+#define BENCHMARK_MONEY_AMOUNTS		(1 << 22)
+#define BENCHMARK_MONEY_SUMS		32
+/* Number of transaction dates read from the clock, and of expiry checks, per run */
+#define BENCHMARK_DATE_CALLS		(1 << 21)
+/* Number of cards checked per Luhn run, and runs per kernel */
+#define BENCHMARK_LUHN_CARDS		(1 << 20)
+#define BENCHMARK_LUHN_ROUNDS		8
+/* Number of lookups timed per index size */
+#define BENCHMARK_INDEX_LOOKUPS		4000000
+/* Number of distinct PANs the lookups cycle through */
+#define BENCHMARK_INDEX_SAMPLES		(1 << 20)
+/* Scratch accounts file, removed after each run */
+#define BENCHMARK_DATABASE_FILE		"benchmark_accounts.db"
+/* Scratch transactions log, removed after each run */
+#define BENCHMARK_JOURNAL_FILE		"benchmark_transactions.log"
+/* Number of commits timed per batch size, and max. number of transactions */
+#define BENCHMARK_JOURNAL_COMMITS			256
+#define BENCHMARK_JOURNAL_MAX_TRANSACTIONS	(1 << 20)
+/* Commit latency long enough that only full batches trigger a commit */
+#define BENCHMARK_JOURNAL_LATENCY_US		10000000
+/* Number of transactions packed and unpacked, and number of distinct card holders among them */
+#define BENCHMARK_JOURNAL_PACK_TRANSACTIONS	(1 << 18)
+#define BENCHMARK_JOURNAL_PACK_HOLDERS		4096
+/* Scratch export file, removed after each run */
+#define BENCHMARK_REPORT_FILE		"benchmark_transactions.csv"
+/* Max. number of transactions listed with printf, it is too slow for the larger sizes */
+#define BENCHMARK_REPORT_LIST_MAX	1000000
+/* Number of transactions authorized per run, and per batch call */
+#define BENCHMARK_SERVER_TRANSACTIONS	(1 << 21)
+#define BENCHMARK_SERVER_BATCH			4096
+/* Number of transactions per parallel call, and max. number of worker threads tried */
+#define BENCHMARK_PARALLEL_CALL			65536
+#define BENCHMARK_PARALLEL_MAX_THREADS	8
+/* Number of PANs in each filter, and of unknown PANs looked up to count the false positives */
+#define BENCHMARK_FILTER_PANS			(1 << 20)
+#define BENCHMARK_FILTER_LOOKUPS		(1 << 22)
+/* Percent of the transactions of the fraud-heavy run that are for unknown cards, as in a card testing attack */
+#define BENCHMARK_FILTER_FRAUD_PERCENT	90
+/* Checkpoint of the benchmark accounts file, and the copy of it a restart after a crash would find */
+#define BENCHMARK_CHECKPOINT_FILE		BENCHMARK_DATABASE_FILE SERVER_CHECKPOINT_SUFFIX
+#define BENCHMARK_CHECKPOINT_SAVED		BENCHMARK_CHECKPOINT_FILE ".saved"
+/* Number of accounts, and transactions logged between checkpoints, of the restart runs */
+#define BENCHMARK_CHECKPOINT_ACCOUNTS	1000000ULL
+#define BENCHMARK_CHECKPOINT_INTERVAL	100000
+/* Number of velocity checks timed per tracker size, checks per second of the simulated clock, and checks an account
+   is prefetched ahead of its check */
+#define BENCHMARK_VELOCITY_CHECKS		(1 << 22)
+#define BENCHMARK_VELOCITY_RATE			(1 << 20)
+#define BENCHMARK_VELOCITY_AHEAD		16
+/* Number of transactions added to the settlement totals, and of end-of-day queries timed on them */
+#define BENCHMARK_SETTLEMENT_TRANSACTIONS	(1 << 20)
+#define BENCHMARK_SETTLEMENT_QUERIES		(1 << 16)
+/* Number of records of the range index runs, and of the log the date queries run on, over the days of a year */
+#define BENCHMARK_RANGE_RECORDS				100000000ULL
+#define BENCHMARK_RANGE_LOG_RECORDS			(1 << 21)
+#define BENCHMARK_RANGE_DAYS				365
+/* Number of range queries timed on the index, and on the log, and percent of records logged the day after their date,
+   as a terminal that sends its transactions after midnight */
+#define BENCHMARK_RANGE_QUERIES				(1 << 14)
+#define BENCHMARK_RANGE_LOG_QUERIES			16
+#define BENCHMARK_RANGE_LATE_PERCENT		1
+/* Number of accounts and transactions of the workload runs, one run per Zipf exponent */
+#define BENCHMARK_WORKLOAD_ACCOUNTS			1000000ULL
+#define BENCHMARK_WORKLOAD_TRANSACTIONS		1000000ULL
+
+/******************** MONEY MODULE ********************/
+void moneyBenchmark(void);
+
+/******************** DATE MODULE ********************/
+void dateBenchmark(void);
+
+/******************** LUHN MODULE ********************/
+void luhnBenchmark(void);
+
+/******************** INDEX MODULE ********************/
+void panIndexBenchmark(void);
+
+/******************** DATABASE MODULE ********************/
+void databaseBenchmark(void);
+
+/******************** JOURNAL MODULE ********************/
+void journalBenchmark(void);
+
+/******************** REPORT MODULE ********************/
+void reportBenchmark(void);
+
+/******************** SERVER MODULE ********************/
+void serverBenchmark(void);
+void serverParallelBenchmark(void);
+
+/******************** FILTER MODULE ********************/
+void filterBenchmark(void);
+
+/******************** CHECKPOINT MODULE ********************/
+void checkpointBenchmark(void);
+
+/******************** VELOCITY MODULE ********************/
+void velocityBenchmark(void);
+
+/******************** SETTLEMENT MODULE ********************/
+void settlementBenchmark(void);
+
+/******************** RANGE MODULE ********************/
+void rangeBenchmark(void);
+
+/******************** WORKLOAD MODULE ********************/
+void workloadBenchmark(void);
+
+/******************** RUN ALL BENCHMARKS ********************/
+void benchmarkAll(void);
+
+#endif /* BENCHMARK_H_ */
@@ -42,8 +42,6 @@
 
 EN_cardError_t getCardHolderName(ST_cardData_t* cardData)
 {
-	uint8_t i = 0, NonAlphabetic = 0;
-
 	printf(" Enter Your Name: \t\t");
 	fflush(stdin);
 	fflush(stdout);
@@ -52,14 +50,30 @@ EN_cardError_t getCardHolderName(ST_cardData_t* cardData)
     char* ptr = strchr((char *)cardData->cardHolderName, '\n');
     if (ptr) *ptr = '\0';
 
-	while (cardData->cardHolderName[i] != 0)
+	return isValidCardHolderName(cardData->cardHolderName);
+}
+
+/*
+ * Description:
+ *  This function will check a card holder name without asking for it, so it can be used on names read from anywhere.
+ *  Name is 20 to 24 characters, alphabetic characters and spaces only.
+ *
+ * @param cardHolderName [in] NUL terminated name
+ * @return WRONG_NAME if name is less than 20 or more than 24 characters, or has a non alphabetic character
+ * @return CARD_OK otherwise
+ */
+EN_cardError_t isValidCardHolderName(const uint8_t* cardHolderName)
+{
+	uint8_t i = 0, NonAlphabetic = 0;
+
+	while (cardHolderName[i] != 0)
 	{
 		/*
-		* if the entered name has a non alphabetic characters assign the NonAlphabetic variable.
+		* if the name has a non alphabetic characters assign the NonAlphabetic variable.
 		*/
-		if (((cardData->cardHolderName[i] >= 65) && (cardData->cardHolderName[i] <= 90)) ||
-			((cardData->cardHolderName[i] >= 97) && (cardData->cardHolderName[i] <= 122)) ||
-			((cardData->cardHolderName[i] == ' ')))
+		if (((cardHolderName[i] >= 65) && (cardHolderName[i] <= 90)) ||
+			((cardHolderName[i] >= 97) && (cardHolderName[i] <= 122)) ||
+			((cardHolderName[i] == ' ')))
 		{
 			NonAlphabetic = 0;
 		}
@@ -71,14 +85,11 @@ EN_cardError_t getCardHolderName(ST_cardData_t* cardData)
 		i++;
 	}
 	/*
-	 * Check if the entered name is greater than 20 and less than 24 characters or not.
-	 * Check if the entered name is empty or not.
-	 * Check if the entered name is greater than 20 and less than 24 characters.
-	 * Check if the entered name has a non alphabetic characters or not.
+	 * Check if the name is empty or not.
+	 * Check if the name is greater than 20 and less than 24 characters.
+	 * Check if the name has a non alphabetic characters or not.
 	 * */
-	int size = 0;
-
-	size = strlen((char *)cardData->cardHolderName);
+	size_t size = strlen((const char *)cardHolderName);
 
 	if ((size < 20) || (size> 24) || (NonAlphabetic == 1))
 	{
@@ -114,28 +125,43 @@ EN_cardError_t getCardPAN(ST_cardData_t* cardData) {
 	if (ptr) *ptr = '\0';
 
 	// Format Check
-	// less than 16 or more than 19
-	if (strlen(panStr) < 16 || strlen(panStr) > 19)
+	if (isValidCardPANFormat((uint8_t *)panStr) == WRONG_PAN)
 	{
 		return WRONG_PAN;
 	}
 
-	// clear data if any
-	for (int j = 0; j < sizeof(cardData->primaryAccountNumber); ++j) {
-		cardData->primaryAccountNumber[j] = 0;
-	}
+	// clear data if any, and store PAN in `cardData`
+	memset(cardData->primaryAccountNumber, 0, sizeof(cardData->primaryAccountNumber));
+	memcpy(cardData->primaryAccountNumber, panStr, strlen(panStr));
 
-	// loop over all characters
-	for (int i = 0; i < strlen(panStr); i++) {
+	return CARD_OK;
+}
+
+/**
+ * Description:
+ *  This function will check a Primary Account Number (PAN) format without asking for it.
+ *  PAN is 16 to 19 numeric characters, whether it is a Luhn number is checked by the terminal.
+ *
+ * @param pan [in] NUL terminated PAN
+ * @return WRONG_PAN if PAN is less than 16 or more than 19 characters, or has a non numeric character
+ * @return CARD_OK otherwise
+ */
+EN_cardError_t isValidCardPANFormat(const uint8_t* pan)
+{
+	size_t length = strlen((const char *)pan);
 
-        // check if any character isn't a digit
-        if (!isdigit(panStr[i]))
-        {
-            return WRONG_PAN;
-        }
+	// less than 16 or more than 19
+	if (length < 16 || length > 19)
+	{
+		return WRONG_PAN;
+	}
 
-		// store PAN in `cardData`
-		cardData->primaryAccountNumber[i] = (uint8_t)(panStr[i]);
+	// check if any character isn't a digit
+	for (size_t i = 0; i < length; i++) {
+		if (!isdigit(pan[i]))
+		{
+			return WRONG_PAN;
+		}
 	}
 
 	return CARD_OK;
@@ -154,66 +180,54 @@ EN_cardError_t getCardPAN(ST_cardData_t* cardData) {
 /*****************************************************************************************/
 EN_cardError_t getCardExpiryDate(ST_cardData_t* cardData)
 {
-	uint8_t expiry_date[10];
-	uint8_t month;
-	uint8_t yearIsNotNumber;
-
-	time_t t = time(NULL);
-	struct tm tm = *localtime(&t);
-	uint8_t Year = tm.tm_year - 100;
-
-	for (char counter = 0; counter <= EXPIRY_DATE_MAX_SIZE; counter++)
-	{
-		expiry_date[counter] = 0;
-	}
+	uint8_t expiry_date[10] = { 0 };
 
 	printf(" Enter card expiry (MM/YY):\t");
 	fflush(stdin);
 	fflush(stdout);
     fgets((char *)expiry_date, sizeof(expiry_date), stdin);
-	uint8_t YearDigit_1 = expiry_date[3] - 48, YearDigit_2 = expiry_date[4] - 48;
-	uint8_t EnteredYear = (YearDigit_1 * 10 + YearDigit_2);
-//	printf("EnteredYear year %d\n:", EnteredYear);
-	if (EnteredYear > (Year + 5))
-	{
-        return WRONG_EXP_DATE;
-	}
 
     // remove trailing newline from string
     char* ptr = strchr((char *)expiry_date, '\n');
     if (ptr) *ptr = '\0';
 
-	// Check the length of the date entered
-	if ((strlen((char *) expiry_date) > EXPIRY_DATE_MAX_SIZE) || (strlen((char *) expiry_date) == 0) || (strlen((char *) expiry_date) < EXPIRY_DATE_MAX_SIZE))
+	if (isValidCardExpiryDate(expiry_date) == WRONG_EXP_DATE)
 		return WRONG_EXP_DATE;
-	else
+
+	for (char counter = 0; counter < EXPIRY_DATE_MAX_SIZE; counter++)
 	{
-		// Calculate the value of months entered in the date
-		month = ((expiry_date[0] - 48) * 10) + (expiry_date[1] - 48);
+		cardData->cardExpirationDate[counter] = expiry_date[counter];
+	}
 
-		// Check all indexes of year entered is numbers only
-		if (expiry_date[3] >= '0' && expiry_date[3] <= '9')
-			yearIsNotNumber = 0;
-		else
-			yearIsNotNumber = 1;
-		
-		if (expiry_date[4] >= '0' && expiry_date[4] <= '9')
-			yearIsNotNumber = 0;
-		else
-			yearIsNotNumber = 1;
+	// keep it packed too, so the terminal compares it with one integer compare
+	dateParseExpiry(expiry_date, &cardData->packedExpirationDate);
 
+	return CARD_OK;
+}
+
+/*****************************************************************************************/
+/*    Function Description    : This function will check a card expiry date without asking for it.
+*								Card expiry date is 5 characters string in the format "MM/YY", e.g "05/25".*/
+/*    Parameter in            : const uint8_t* expiryDate, NUL terminated */
+/*    Parameter inout         : None */
+/*    Parameter out           :	None */
+/*    Return value            : return the WRONG_EXP_DATE If the card expiry date is empty,
+*								less or more than 5 characters, has the wrong format,
+*								or is more than 5 years after the current year.
+*								return CARD_OK otherwise */
+/*    Requirment              : */
+/*****************************************************************************************/
+EN_cardError_t isValidCardExpiryDate(const uint8_t* expiryDate)
+{
+	date_t expiry;
+
+	// Check the length and format of the date, and the month number is valid
+	if (dateParseExpiry(expiryDate, &expiry) != DATE_OK)
+		return WRONG_EXP_DATE;
+
+	// Check the card doesn't expire more than 5 years from now
+	if (DATE_YEAR(expiry) > (DATE_YEAR(dateToday(NULL)) + 5))
+		return WRONG_EXP_DATE;
 
-		// Check if the month number is valid and year num is only number and there is '/' in the entered date
-		if (month == 0 || month > 12 || yearIsNotNumber || expiry_date[2] != '/')
-			return WRONG_EXP_DATE;
-		else
-		{
-			for (char counter = 0; counter < EXPIRY_DATE_MAX_SIZE; counter++)
-			{
-				cardData->cardExpirationDate[counter] = expiry_date[counter];
-			}
-		}
-	}
-	
 	return CARD_OK;
 }
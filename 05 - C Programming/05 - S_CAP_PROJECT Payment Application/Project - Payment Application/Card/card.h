@@ -21,6 +21,8 @@
 #include <string.h>
 #include <ctype.h>
 #include <time.h>
+
+#include "../Date/date.h"
 /**************************************************************************************************************************************/
 /*
 * Defines three members which specify the card structure. 
@@ -31,6 +33,7 @@ typedef struct ST_cardData_t
 	uint8_t cardHolderName[25];
 	uint8_t primaryAccountNumber[20];
 	uint8_t cardExpirationDate[6];
+	date_t packedExpirationDate;		/* cardExpirationDate packed, DATE_NONE if it is only set as text */
 }ST_cardData_t;
 
 /***************************************************************************************************************************************/
@@ -51,6 +54,9 @@ typedef enum EN_cardError_t
  EN_cardError_t getCardHolderName(ST_cardData_t *cardData);
  EN_cardError_t getCardExpiryDate(ST_cardData_t *cardData);
  EN_cardError_t getCardPAN(ST_cardData_t *cardData);
+ EN_cardError_t isValidCardHolderName(const uint8_t *cardHolderName);
+ EN_cardError_t isValidCardExpiryDate(const uint8_t *expiryDate);
+ EN_cardError_t isValidCardPANFormat(const uint8_t *pan);
 
 
 #endif /* CARD_H_ */
@@ -0,0 +1,244 @@
+/**
+ * @Title      	: Checkpoint Module
+ * @Filename   	: checkpoint.c
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+
+/* Checkpoint Module */
+#include "checkpoint.h"
+
+/* Platform flush to disk, and replace of a file by another one */
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#define checkpointFileSync(STREAM)			_commit(_fileno(STREAM))
+#define checkpointFileReplace(FROM, TO)		(MoveFileExA((FROM), (TO), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) ? 0 : -1)
+#else
+#include <unistd.h>
+#define checkpointFileSync(STREAM)			fsync(fileno(STREAM))
+#define checkpointFileReplace(FROM, TO)		rename((FROM), (TO))
+#endif
+
+/*
+ Name: checkpointChecksum
+ Input: uint32 hash so far, Pointer to balances array, and uint64 count
+ Output: uint32 hash
+ Description: Static Function to add balances to an FNV-1a hash of 4-byte words, so the balances can be hashed a chunk
+              at a time as they are written or read.
+*/
+static uint32_t checkpointChecksum(uint32_t hash, const money_t *balances, uint64_t count)
+{
+    /* Loop: Until the end of the balances */
+    for (uint64_t Loc_Index = 0; Loc_Index < count; Loc_Index++)
+    {
+        uint64_t Loc_Balance = (uint64_t)balances[Loc_Index];
+
+        hash ^= (uint32_t)Loc_Balance;
+        hash *= 16777619UL;
+        hash ^= (uint32_t)(Loc_Balance >> 32);
+        hash *= 16777619UL;
+    }
+
+    return hash;
+}
+
+/*
+ Name: checkpointChecksumWords
+ Input: uint32 hash so far, Pointer to data, and size_t size, a multiple of 4 bytes
+ Output: uint32 hash
+ Description: Static Function to add any data to an FNV-1a hash of 4-byte words, as checkpointChecksum does for balances.
+*/
+static uint32_t checkpointChecksumWords(uint32_t hash, const void *data, size_t size)
+{
+    const uint8_t *Loc_Data = (const uint8_t *)data;
+
+    /* Loop: Until the end of the data */
+    for (size_t Loc_Offset = 0; (Loc_Offset + sizeof(uint32_t)) <= size; Loc_Offset += sizeof(uint32_t))
+    {
+        uint32_t Loc_Word;
+
+        memcpy(&Loc_Word, &Loc_Data[Loc_Offset], sizeof(uint32_t));
+        hash ^= Loc_Word;
+        hash *= 16777619UL;
+    }
+
+    return hash;
+}
+
+/*
+ Name: checkpointWrite
+ Input: Pointer to file name, uint64 journalCount, Pointer to accounts array, uint64 accountsCount, and Pointer to
+        settlement totals
+ Output: EN_checkpointError_t Error or No Error
+ Description: Function to write the balances of accountsCount accounts, and the settlement totals, as the checkpoint of
+              the first journalCount transactions of the log.
+              1. The checkpoint is written and flushed to disk in fileName + CHECKPOINT_TEMP_SUFFIX, which then replaces
+                 fileName, so fileName is always a whole checkpoint, the new one or the last one.
+              2. If it can't be written returns CHECKPOINT_FILE_ERROR, and the last checkpoint is kept.
+*/
+EN_checkpointError_t checkpointWrite(const char *fileName, uint64_t journalCount, const ST_accountsDB_t *accounts, uint64_t accountsCount,
+                                     const ST_settlement_t *settlement)
+{
+    ST_checkpointHeader_t Loc_Header = { CHECKPOINT_MAGIC, CHECKPOINT_VERSION, sizeof(money_t), 2166136261UL, journalCount, accountsCount,
+                                         sizeof(ST_settlement_t), 0 };
+    money_t Loc_Balances[CHECKPOINT_WRITE_CHUNK];
+    char Loc_TempFile[FILENAME_MAX];
+    uint8_t Loc_Written;
+    FILE *Loc_File;
+
+    /* Check 1: Temporary file can't be created */
+    if ((snprintf(Loc_TempFile, sizeof(Loc_TempFile), "%s%s", fileName, CHECKPOINT_TEMP_SUFFIX) >= (int)sizeof(Loc_TempFile)) ||
+        ((Loc_File = fopen(Loc_TempFile, "wb")) == NULL))
+    {
+        return CHECKPOINT_FILE_ERROR;
+    }
+
+    /* Header goes first with no checksum yet, it is written again at the end */
+    Loc_Written = (fwrite(&Loc_Header, sizeof(Loc_Header), 1, Loc_File) == 1);
+
+    /* Loop: Until all balances are written, a chunk at a time */
+    for (uint64_t Loc_First = 0; Loc_Written && (Loc_First < accountsCount); Loc_First += CHECKPOINT_WRITE_CHUNK)
+    {
+        uint64_t Loc_Chunk = accountsCount - Loc_First;
+
+        if (Loc_Chunk > CHECKPOINT_WRITE_CHUNK)
+        {
+            Loc_Chunk = CHECKPOINT_WRITE_CHUNK;
+        }
+
+        for (uint64_t Loc_Index = 0; Loc_Index < Loc_Chunk; Loc_Index++)
+        {
+            Loc_Balances[Loc_Index] = accounts[Loc_First + Loc_Index].balance;
+        }
+
+        Loc_Header.checksum = checkpointChecksum(Loc_Header.checksum, Loc_Balances, Loc_Chunk);
+        Loc_Written = (fwrite(Loc_Balances, sizeof(money_t), (size_t)Loc_Chunk, Loc_File) == Loc_Chunk);
+    }
+
+    /* Settlement totals go after the balances */
+    if (Loc_Written)
+    {
+        Loc_Header.checksum = checkpointChecksumWords(Loc_Header.checksum, settlement, sizeof(ST_settlement_t));
+        Loc_Written = (fwrite(settlement, sizeof(ST_settlement_t), 1, Loc_File) == 1);
+    }
+
+    /* Check 2: Checkpoint can't be written, or flushed to disk */
+    if (!Loc_Written || (fseek(Loc_File, 0, SEEK_SET) != 0) || (fwrite(&Loc_Header, sizeof(Loc_Header), 1, Loc_File) != 1) ||
+        (fflush(Loc_File) != 0) || (checkpointFileSync(Loc_File) != 0))
+    {
+        fclose(Loc_File);
+        remove(Loc_TempFile);
+        return CHECKPOINT_FILE_ERROR;
+    }
+
+    fclose(Loc_File);
+
+    /* Check 3: Last checkpoint can't be replaced */
+    if (checkpointFileReplace(Loc_TempFile, fileName) != 0)
+    {
+        remove(Loc_TempFile);
+        return CHECKPOINT_FILE_ERROR;
+    }
+
+    return CHECKPOINT_OK;
+}
+
+/*
+ Name: checkpointRead
+ Input: Pointer to file name, and Pointer to checkpoint
+ Output: EN_checkpointError_t Error or No Error
+ Description: Function to read a checkpoint file, its balances and settlement totals are allocated and must be released
+              with checkpointFree.
+              1. A version 1 checkpoint is read too, it has no settlement totals (settlement is NULL).
+              2. If the file doesn't exist returns CHECKPOINT_FILE_ERROR.
+              3. If it isn't a checkpoint, or its balances and totals fail their checksum returns CHECKPOINT_WRONG_FORMAT.
+*/
+EN_checkpointError_t checkpointRead(const char *fileName, ST_checkpoint_t *checkpoint)
+{
+    EN_checkpointError_t Loc_ErrorState = CHECKPOINT_OK;
+    ST_checkpointHeader_t Loc_Header = { 0 };
+    FILE *Loc_File = fopen(fileName, "rb");
+    uint32_t Loc_Checksum;
+
+    memset(checkpoint, 0, sizeof(ST_checkpoint_t));
+
+    /* Check 1: File doesn't exist */
+    if (Loc_File == NULL)
+    {
+        return CHECKPOINT_FILE_ERROR;
+    }
+
+    /* Check 2: Not a checkpoint file, a version 1 header ends before settlementSize */
+    if ((fread(&Loc_Header, offsetof(ST_checkpointHeader_t, settlementSize), 1, Loc_File) != 1) ||
+        (Loc_Header.magic       != CHECKPOINT_MAGIC)   ||
+        ((Loc_Header.version    != CHECKPOINT_VERSION) && (Loc_Header.version != CHECKPOINT_VERSION_BALANCES)) ||
+        ((Loc_Header.version    == CHECKPOINT_VERSION) &&
+         ((fread(&Loc_Header.settlementSize, sizeof(Loc_Header) - offsetof(ST_checkpointHeader_t, settlementSize), 1, Loc_File) != 1) ||
+          (Loc_Header.settlementSize != sizeof(ST_settlement_t)))) ||
+        (Loc_Header.balanceSize != sizeof(money_t))    ||
+        (Loc_Header.accountsCount > (SIZE_MAX / sizeof(money_t))))
+    {
+        Loc_ErrorState = CHECKPOINT_WRONG_FORMAT;
+    }
+    /* Check 3: Balances or settlement totals can't be allocated */
+    else if (((checkpoint->balances = malloc((size_t)((Loc_Header.accountsCount != 0) ? Loc_Header.accountsCount : 1) * sizeof(money_t))) == NULL) ||
+             ((Loc_Header.version == CHECKPOINT_VERSION) && ((checkpoint->settlement = malloc(sizeof(ST_settlement_t))) == NULL)))
+    {
+        Loc_ErrorState = CHECKPOINT_NO_MEMORY;
+    }
+    /* Check 4: Balances or settlement totals are cut short */
+    else if ((fread(checkpoint->balances, sizeof(money_t), (size_t)Loc_Header.accountsCount, Loc_File) != Loc_Header.accountsCount) ||
+             ((checkpoint->settlement != NULL) && (fread(checkpoint->settlement, sizeof(ST_settlement_t), 1, Loc_File) != 1)))
+    {
+        Loc_ErrorState = CHECKPOINT_WRONG_FORMAT;
+    }
+    /* Check 5: Balances and settlement totals fail their checksum */
+    else
+    {
+        Loc_Checksum = checkpointChecksum(2166136261UL, checkpoint->balances, Loc_Header.accountsCount);
+
+        if (checkpoint->settlement != NULL)
+        {
+            Loc_Checksum = checkpointChecksumWords(Loc_Checksum, checkpoint->settlement, sizeof(ST_settlement_t));
+        }
+
+        if (Loc_Checksum != Loc_Header.checksum)
+        {
+            Loc_ErrorState = CHECKPOINT_WRONG_FORMAT;
+        }
+    }
+
+    fclose(Loc_File);
+
+    if (Loc_ErrorState != CHECKPOINT_OK)
+    {
+        checkpointFree(checkpoint);
+        return Loc_ErrorState;
+    }
+
+    checkpoint->journalCount  = Loc_Header.journalCount;
+    checkpoint->accountsCount = Loc_Header.accountsCount;
+
+    return CHECKPOINT_OK;
+}
+
+/*
+ Name: checkpointFree
+ Input: Pointer to checkpoint
+ Output: void
+ Description: Function to release the balances and settlement totals of a checkpoint that was read.
+*/
+void checkpointFree(ST_checkpoint_t *checkpoint)
+{
+    free(checkpoint->balances);
+    free(checkpoint->settlement);
+    memset(checkpoint, 0, sizeof(ST_checkpoint_t));
+}
@@ -0,0 +1,83 @@
+/**
+ * @Title      	: Checkpoint Module
+ * @Filename   	: checkpoint.h
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+#ifndef CHECKPOINT_H_
+#define CHECKPOINT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../Database/database.h"
+#include "../Money/money.h"
+#include "../Settlement/settlement.h"
+
+/* Checkpoint file signature "CKPT", and format version */
+#define CHECKPOINT_MAGIC			0x54504B43UL
+#define CHECKPOINT_VERSION			2
+/* Format version of checkpoints with no settlement totals, still read */
+#define CHECKPOINT_VERSION_BALANCES	1
+/* Suffix of the file a checkpoint is written to before it replaces the last one */
+#define CHECKPOINT_TEMP_SUFFIX		".tmp"
+/* Number of balances written to the file at once */
+#define CHECKPOINT_WRITE_CHUNK		1024
+
+/**************************************************************************************************************************************/
+/*
+* Checkpoint file layout, the balances are in the order of the accounts in the accounts file:
+*	| ST_checkpointHeader_t | money_t[accountsCount] | ST_settlement_t |
+* A checkpoint is the balances of all accounts, and the settlement totals, once the first journalCount transactions of
+* the log are applied, so only the transactions after them have to be applied again after a restart.
+* A version 1 checkpoint has the balances only.
+* It is written to a temporary file that then replaces the last checkpoint, so a crash while writing leaves the last
+* checkpoint as it was.
+*/
+/**************************************************************************************************************************************/
+typedef struct ST_checkpointHeader_t
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t balanceSize;		/* sizeof(money_t) the file was written with */
+    uint32_t checksum;			/* FNV-1a of the balances and settlement totals */
+    uint64_t journalCount;		/* Transactions of the log the balances include */
+    uint64_t accountsCount;
+    uint32_t settlementSize;	/* sizeof(ST_settlement_t) the file was written with, not in version 1 */
+    uint32_t reserved;
+}ST_checkpointHeader_t;
+
+typedef struct ST_checkpoint_t
+{
+    uint64_t journalCount;
+    uint64_t accountsCount;
+    money_t *balances;
+    ST_settlement_t *settlement;	/* NULL for a version 1 checkpoint */
+}ST_checkpoint_t;
+
+typedef enum EN_checkpointError_t
+{
+    CHECKPOINT_OK, CHECKPOINT_FILE_ERROR, CHECKPOINT_WRONG_FORMAT, CHECKPOINT_NO_MEMORY
+}EN_checkpointError_t;
+
+/**************************************************************************************************************************************/
+/*
+*							Prototypes for all used functions inside the checkpoint module.
+*/
+/**************************************************************************************************************************************/
+EN_checkpointError_t checkpointWrite(const char *fileName, uint64_t journalCount, const ST_accountsDB_t *accounts, uint64_t accountsCount,
+                                     const ST_settlement_t *settlement);
+EN_checkpointError_t checkpointRead(const char *fileName, ST_checkpoint_t *checkpoint);
+void checkpointFree(ST_checkpoint_t *checkpoint);
+
+#endif /* CHECKPOINT_H_ */
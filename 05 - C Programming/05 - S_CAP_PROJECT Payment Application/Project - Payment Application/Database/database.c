@@ -0,0 +1,377 @@
+/**
+ * @Title      	: Database Module
+ * @Filename   	: database.c
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+
+/* Database Module */
+#include "database.h"
+
+/* Platform file mapping */
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/* Hint the CPU to start loading a record early, a no-op on compilers without it */
+#ifdef __GNUC__
+#define databasePrefetch(ADDRESS)	__builtin_prefetch((ADDRESS), 1)
+#else
+#define databasePrefetch(ADDRESS)	((void)(ADDRESS))
+#endif
+
+/*
+ Name: databaseFileSize
+ Input: uint64 accountsCapacity, and uint64 indexCapacity
+ Output: uint64 size in bytes
+ Description: Static Function to get the size of an accounts file with the given capacities.
+*/
+static uint64_t databaseFileSize(uint64_t accountsCapacity, uint64_t indexCapacity)
+{
+    return sizeof(ST_databaseHeader_t) + (indexCapacity * sizeof(ST_panIndexSlot_t)) + (accountsCapacity * sizeof(ST_accountsDB_t));
+}
+
+/*
+ Name: databaseMapFile
+ Input: Pointer to database, Pointer to file name, and uint64 size
+ Output: EN_databaseError_t Error or No Error
+ Description: Static Function to map a whole file for reading and writing.
+              If size is not 0, the file is created (or truncated) with this size first, else it is opened as it is.
+*/
+static EN_databaseError_t databaseMapFile(ST_database_t *database, const char *fileName, uint64_t size)
+{
+    memset(database, 0, sizeof(ST_database_t));
+    database->fileDescriptor = -1;
+
+#ifdef _WIN32
+    HANDLE Loc_File = CreateFileA(fileName, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL,
+                                  (size != 0) ? CREATE_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+    /* Check 1: File can't be opened */
+    if (Loc_File == INVALID_HANDLE_VALUE)
+    {
+        return DATABASE_FILE_ERROR;
+    }
+
+    /* Check 2: Opening an existing file, map all of it */
+    if (size == 0)
+    {
+        LARGE_INTEGER Loc_Size;
+
+        if (!GetFileSizeEx(Loc_File, &Loc_Size) || (Loc_Size.QuadPart == 0))
+        {
+            CloseHandle(Loc_File);
+            return DATABASE_FILE_ERROR;
+        }
+
+        size = (uint64_t)Loc_Size.QuadPart;
+    }
+
+    /* A mapping larger than the file extends the file */
+    HANDLE Loc_Mapping = CreateFileMappingA(Loc_File, NULL, PAGE_READWRITE, (DWORD)(size >> 32), (DWORD)size, NULL);
+    void  *Loc_View    = (Loc_Mapping != NULL) ? MapViewOfFile(Loc_Mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0) : NULL;
+
+    /* Check 3: File can't be mapped */
+    if (Loc_View == NULL)
+    {
+        if (Loc_Mapping != NULL)
+        {
+            CloseHandle(Loc_Mapping);
+        }
+        CloseHandle(Loc_File);
+        return DATABASE_MAP_ERROR;
+    }
+
+    database->fileHandle    = Loc_File;
+    database->mappingHandle = Loc_Mapping;
+    database->mapping       = Loc_View;
+#else
+    int Loc_File = open(fileName, (size != 0) ? (O_RDWR | O_CREAT | O_TRUNC) : O_RDWR, 0644);
+
+    /* Check 1: File can't be opened */
+    if (Loc_File < 0)
+    {
+        return DATABASE_FILE_ERROR;
+    }
+
+    /* Check 2: Creating a file, give it its full size (sparse, so pages are only allocated when written) */
+    if ((size != 0) && (ftruncate(Loc_File, (off_t)size) != 0))
+    {
+        close(Loc_File);
+        return DATABASE_FILE_ERROR;
+    }
+
+    /* Check 3: Opening an existing file, map all of it */
+    if (size == 0)
+    {
+        struct stat Loc_Stat;
+
+        if ((fstat(Loc_File, &Loc_Stat) != 0) || (Loc_Stat.st_size == 0))
+        {
+            close(Loc_File);
+            return DATABASE_FILE_ERROR;
+        }
+
+        size = (uint64_t)Loc_Stat.st_size;
+    }
+
+    void *Loc_View = mmap(NULL, (size_t)size, PROT_READ | PROT_WRITE, MAP_SHARED, Loc_File, 0);
+
+    /* Check 4: File can't be mapped */
+    if (Loc_View == MAP_FAILED)
+    {
+        close(Loc_File);
+        return DATABASE_MAP_ERROR;
+    }
+
+    database->fileDescriptor = Loc_File;
+    database->mapping        = Loc_View;
+#endif
+
+    database->mappingSize = size;
+    database->header      = (ST_databaseHeader_t *)database->mapping;
+
+    return DATABASE_OK;
+}
+
+/*
+ Name: databaseAttach
+ Input: Pointer to database
+ Output: void
+ Description: Static Function to point the index and the accounts array at their parts of the mapping.
+*/
+static void databaseAttach(ST_database_t *database)
+{
+    ST_panIndexSlot_t *Loc_Slots = (ST_panIndexSlot_t *)(database->mapping + sizeof(ST_databaseHeader_t));
+
+    panIndexAttach(&database->index, Loc_Slots, database->header->indexCapacity, database->header->accountsCount);
+    database->accounts = (ST_accountsDB_t *)(Loc_Slots + database->header->indexCapacity);
+}
+
+/*
+ Name: databaseCreate
+ Input: Pointer to file name, and uint64 accountsCapacity
+ Output: EN_databaseError_t Error or No Error
+ Description: Function to create an empty accounts file that can hold up to accountsCapacity accounts.
+              An existing file with the same name is replaced.
+*/
+EN_databaseError_t databaseCreate(const char *fileName, uint64_t accountsCapacity)
+{
+    ST_database_t Loc_Database;
+    uint64_t Loc_IndexCapacity = panIndexCapacityFor(accountsCapacity);
+    EN_databaseError_t Loc_ErrorState = databaseMapFile(&Loc_Database, fileName, databaseFileSize(accountsCapacity, Loc_IndexCapacity));
+
+    /* Check 1: File is mapped, write its header. Index slots and records are already zeros, i.e. empty */
+    if (Loc_ErrorState == DATABASE_OK)
+    {
+        Loc_Database.header->magic            = DATABASE_MAGIC;
+        Loc_Database.header->version          = DATABASE_VERSION;
+        Loc_Database.header->recordSize       = sizeof(ST_accountsDB_t);
+        Loc_Database.header->slotSize         = sizeof(ST_panIndexSlot_t);
+        Loc_Database.header->accountsCount    = 0;
+        Loc_Database.header->accountsCapacity = accountsCapacity;
+        Loc_Database.header->indexCapacity    = Loc_IndexCapacity;
+
+        Loc_ErrorState = databaseSync(&Loc_Database);
+        databaseClose(&Loc_Database);
+    }
+
+    return Loc_ErrorState;
+}
+
+/*
+ Name: databaseOpen
+ Input: Pointer to database, and Pointer to file name
+ Output: EN_databaseError_t Error or No Error
+ Description: Function to map an accounts file, and validate its header.
+              No account is read, so the time to open does not depend on the number of accounts.
+*/
+EN_databaseError_t databaseOpen(ST_database_t *database, const char *fileName)
+{
+    EN_databaseError_t Loc_ErrorState = databaseMapFile(database, fileName, 0);
+
+    /* Check 1: File is mapped, validate its header */
+    if (Loc_ErrorState == DATABASE_OK)
+    {
+        ST_databaseHeader_t *Loc_Header = database->header;
+
+        if ((database->mappingSize < sizeof(ST_databaseHeader_t))   ||
+            (Loc_Header->magic      != DATABASE_MAGIC)               ||
+            (Loc_Header->version    != DATABASE_VERSION)             ||
+            (Loc_Header->recordSize != sizeof(ST_accountsDB_t))      ||
+            (Loc_Header->slotSize   != sizeof(ST_panIndexSlot_t))    ||
+            (Loc_Header->accountsCount > Loc_Header->accountsCapacity) ||
+            (Loc_Header->indexCapacity == 0) || ((Loc_Header->indexCapacity & (Loc_Header->indexCapacity - 1)) != 0) ||
+            (database->mappingSize < databaseFileSize(Loc_Header->accountsCapacity, Loc_Header->indexCapacity)))
+        {
+            /* Update error state, Not an accounts file! */
+            Loc_ErrorState = DATABASE_WRONG_FORMAT;
+            databaseClose(database);
+        }
+        else
+        {
+            databaseAttach(database);
+        }
+    }
+
+    return Loc_ErrorState;
+}
+
+/*
+ Name: databaseSync
+ Input: Pointer to database
+ Output: EN_databaseError_t Error or No Error
+ Description: Function to write all changed pages of the mapping back to the file, and wait until they are on disk.
+*/
+EN_databaseError_t databaseSync(ST_database_t *database)
+{
+#ifdef _WIN32
+    if (!FlushViewOfFile(database->mapping, 0) || !FlushFileBuffers(database->fileHandle))
+    {
+        return DATABASE_FILE_ERROR;
+    }
+#else
+    if (msync(database->mapping, (size_t)database->mappingSize, MS_SYNC) != 0)
+    {
+        return DATABASE_FILE_ERROR;
+    }
+#endif
+
+    return DATABASE_OK;
+}
+
+/*
+ Name: databaseClose
+ Input: Pointer to database
+ Output: void
+ Description: Function to unmap the accounts file. Changed pages are still written back by the OS.
+*/
+void databaseClose(ST_database_t *database)
+{
+    /* Check 1: Database is not open */
+    if (database->mapping == NULL)
+    {
+        return;
+    }
+
+#ifdef _WIN32
+    UnmapViewOfFile(database->mapping);
+    CloseHandle(database->mappingHandle);
+    CloseHandle(database->fileHandle);
+#else
+    munmap(database->mapping, (size_t)database->mappingSize);
+    close(database->fileDescriptor);
+#endif
+
+    memset(database, 0, sizeof(ST_database_t));
+    database->fileDescriptor = -1;
+}
+
+/*
+ Name: databaseAddAccount
+ Input: Pointer to database, Pointer to account, and Pointer to uint32 handle
+ Output: EN_databaseError_t Error or No Error
+ Description: Function to append an account to the file, and index its PAN.
+              Returns DATABASE_FULL if the file is at its capacity, and DATABASE_DUPLICATE if the PAN already exists.
+*/
+EN_databaseError_t databaseAddAccount(ST_database_t *database, const ST_accountsDB_t *account, uint32_t *handle)
+{
+    uint64_t Loc_Handle = database->header->accountsCount;
+
+    /* Check 1: File is full */
+    if (Loc_Handle >= database->header->accountsCapacity)
+    {
+        return DATABASE_FULL;
+    }
+
+    /* Write the record first, so the index never points to an unwritten record */
+    database->accounts[Loc_Handle] = *account;
+
+    EN_indexError_t Loc_IndexError = panIndexInsert(&database->index, account->primaryAccountNumber, (uint32_t)Loc_Handle);
+
+    /* Check 2: PAN can't be indexed, drop the record again */
+    if (Loc_IndexError != INDEX_OK)
+    {
+        memset(&database->accounts[Loc_Handle], 0, sizeof(ST_accountsDB_t));
+
+        return (Loc_IndexError == INDEX_DUPLICATE) ? DATABASE_DUPLICATE :
+               (Loc_IndexError == INDEX_WRONG_PAN) ? DATABASE_WRONG_PAN : DATABASE_FULL;
+    }
+
+    database->header->accountsCount++;
+
+    if (handle != NULL)
+    {
+        *handle = (uint32_t)Loc_Handle;
+    }
+
+    return DATABASE_OK;
+}
+
+/*
+ Name: databaseFindAccount
+ Input: Pointer to database, Pointer to PAN string, and Pointer to Pointer to account
+ Output: EN_databaseError_t Error or No Error
+ Description: Function to look up an account by PAN, and return a reference to its record inside the mapping.
+              Changes through this reference go straight to the mapped file.
+*/
+EN_databaseError_t databaseFindAccount(ST_database_t *database, const uint8_t *primaryAccountNumber, ST_accountsDB_t **account)
+{
+    uint32_t Loc_Handle = 0;
+
+    /* Check 1: PAN is not indexed */
+    if (panIndexFind(&database->index, primaryAccountNumber, &Loc_Handle) != INDEX_OK)
+    {
+        return DATABASE_NOT_FOUND;
+    }
+
+    *account = &database->accounts[Loc_Handle];
+
+    return DATABASE_OK;
+}
+
+/*
+ Name: databaseFindAccountBatch
+ Input: Pointer to database, Pointer to PAN keys array, uint32 count, and Pointer to accounts references array
+ Output: void
+ Description: Function to look up count accounts by PAN key at once, and return references to their records inside
+              the mapping (NULL if not found). The records are prefetched for writing, so the debits that follow
+              don't wait for them one by one.
+*/
+void databaseFindAccountBatch(ST_database_t *database, const ST_panKey_t *panKeys, uint32_t count, ST_accountsDB_t **accounts)
+{
+    uint32_t Loc_Handles[DATABASE_BATCH_SIZE];
+
+    /* Loop: Until all keys are resolved, DATABASE_BATCH_SIZE at a time */
+    for (uint32_t Loc_First = 0; Loc_First < count; Loc_First += DATABASE_BATCH_SIZE)
+    {
+        uint32_t Loc_Count = ((count - Loc_First) < DATABASE_BATCH_SIZE) ? (count - Loc_First) : DATABASE_BATCH_SIZE;
+
+        panIndexFindBatch(&database->index, &panKeys[Loc_First], Loc_Count, Loc_Handles);
+
+        for (uint32_t Loc_Index = 0; Loc_Index < Loc_Count; Loc_Index++)
+        {
+            if (Loc_Handles[Loc_Index] == PAN_INDEX_NO_HANDLE)
+            {
+                accounts[Loc_First + Loc_Index] = NULL;
+            }
+            else
+            {
+                accounts[Loc_First + Loc_Index] = &database->accounts[Loc_Handles[Loc_Index]];
+                databasePrefetch(accounts[Loc_First + Loc_Index]);
+            }
+        }
+    }
+}
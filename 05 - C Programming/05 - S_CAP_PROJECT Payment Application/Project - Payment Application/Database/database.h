@@ -0,0 +1,94 @@
+/**
+ * @Title      	: Database Module
+ * @Filename   	: database.h
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+#ifndef DATABASE_H_
+#define DATABASE_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../Index/index.h"
+#include "../Money/money.h"
+
+/* Accounts file signature "ACDB", and format version */
+#define DATABASE_MAGIC				0x42444341UL
+#define DATABASE_VERSION			2
+/* Number of accounts resolved per index batch lookup */
+#define DATABASE_BATCH_SIZE			256
+
+typedef enum EN_accountState_t
+{
+    RUNNING,
+    BLOCKED
+}EN_accountState_t;
+
+typedef struct ST_accountsDB_t
+{
+    money_t balance;			/* Minor units */
+    EN_accountState_t state;
+    uint8_t primaryAccountNumber[20];
+}ST_accountsDB_t;
+
+/**************************************************************************************************************************************/
+/*
+* Accounts file layout, every part is used in place once the file is mapped:
+*	| ST_databaseHeader_t | ST_panIndexSlot_t[indexCapacity] | ST_accountsDB_t[accountsCapacity] |
+* The PAN index is stored in the file, so opening a file of any size is a single map with no parse or rebuild step.
+*/
+/**************************************************************************************************************************************/
+typedef struct ST_databaseHeader_t
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t recordSize;		/* sizeof(ST_accountsDB_t) the file was written with */
+    uint32_t slotSize;			/* sizeof(ST_panIndexSlot_t) the file was written with */
+    uint64_t accountsCount;
+    uint64_t accountsCapacity;
+    uint64_t indexCapacity;
+    uint64_t reserved[3];
+}ST_databaseHeader_t;
+
+typedef struct ST_database_t
+{
+    uint8_t *mapping;
+    uint64_t mappingSize;
+    ST_databaseHeader_t *header;
+    ST_panIndex_t index;
+    ST_accountsDB_t *accounts;
+    void *fileHandle;			/* Windows file and mapping handles */
+    void *mappingHandle;
+    int fileDescriptor;			/* POSIX file descriptor */
+}ST_database_t;
+
+typedef enum EN_databaseError_t
+{
+    DATABASE_OK, DATABASE_FILE_ERROR, DATABASE_MAP_ERROR, DATABASE_WRONG_FORMAT, DATABASE_FULL, DATABASE_DUPLICATE,
+    DATABASE_WRONG_PAN, DATABASE_NOT_FOUND
+}EN_databaseError_t;
+
+/**************************************************************************************************************************************/
+/*
+*							Prototypes for all used functions inside the database module.
+*/
+/**************************************************************************************************************************************/
+EN_databaseError_t databaseCreate(const char *fileName, uint64_t accountsCapacity);
+EN_databaseError_t databaseOpen(ST_database_t *database, const char *fileName);
+EN_databaseError_t databaseSync(ST_database_t *database);
+void databaseClose(ST_database_t *database);
+EN_databaseError_t databaseAddAccount(ST_database_t *database, const ST_accountsDB_t *account, uint32_t *handle);
+EN_databaseError_t databaseFindAccount(ST_database_t *database, const uint8_t *primaryAccountNumber, ST_accountsDB_t **account);
+void databaseFindAccountBatch(ST_database_t *database, const ST_panKey_t *panKeys, uint32_t count, ST_accountsDB_t **accounts);
+
+#endif /* DATABASE_H_ */
@@ -0,0 +1,274 @@
+/**
+ * @Title      	: Date Module
+ * @Filename   	: date.c
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+
+/* Date Module */
+#include "date.h"
+
+/* Current day, and the local times it starts and ends at, refreshed by dateToday once the day changes */
+static date_t Glb_Today = DATE_NONE;
+static uint8_t Glb_TodayText[DATE_TEXT_SIZE] = { 0 };
+static time_t Glb_TodayStart = 0;
+static time_t Glb_TodayEnd = 0;
+
+/*
+ Name: dateDigits
+ Input: Pointer to text, and uint8 count
+ Output: int32 value of count digits, or -1 if any of them is not a digit
+ Description: Static Function to read a fixed number of decimal digits.
+*/
+static int32_t dateDigits(const uint8_t *text, uint8_t count)
+{
+    int32_t Loc_Value = 0;
+
+    /* Loop: Until all digits are read */
+    for (uint8_t Loc_Index = 0; Loc_Index < count; Loc_Index++)
+    {
+        if ((text[Loc_Index] < '0') || (text[Loc_Index] > '9'))
+        {
+            return -1;
+        }
+
+        Loc_Value = (Loc_Value * 10) + (text[Loc_Index] - '0');
+    }
+
+    return Loc_Value;
+}
+
+/*
+ Name: dateParse
+ Input: Pointer to text, and Pointer to date
+ Output: EN_dateError_t Error or No Error
+ Description: Function to read a "DD/MM/YYYY" date into a packed date.
+              1. Day is 1 to 31, and 1 to 29 in February, month is 1 to 12, and year is 1900 to 2100.
+              2. Any other text returns DATE_WRONG_FORMAT, and date is set to DATE_NONE.
+*/
+EN_dateError_t dateParse(const uint8_t *text, date_t *date)
+{
+    int32_t Loc_Day;
+    int32_t Loc_Month;
+    int32_t Loc_Year;
+
+    *date = DATE_NONE;
+
+    /* Check 1: Wrong length or format */
+    if ((strlen((const char *)text) != (DATE_TEXT_SIZE - 1)) || (text[2] != '/') || (text[5] != '/'))
+    {
+        return DATE_WRONG_FORMAT;
+    }
+
+    Loc_Day   = dateDigits(text, 2);
+    Loc_Month = dateDigits(text + 3, 2);
+    Loc_Year  = dateDigits(text + 6, 4);
+
+    /* Check 2: Wrong day, month or year */
+    if ((Loc_Day < 1) || (Loc_Day > 31) || (Loc_Month < 1) || (Loc_Month > 12) ||
+        ((Loc_Month == 2) && (Loc_Day > 29)) || (Loc_Year < 1900) || (Loc_Year > 2100))
+    {
+        return DATE_WRONG_FORMAT;
+    }
+
+    *date = DATE_PACK(Loc_Year, Loc_Month, Loc_Day);
+
+    return DATE_OK;
+}
+
+/*
+ Name: dateParseExpiry
+ Input: Pointer to text, and Pointer to date
+ Output: EN_dateError_t Error or No Error
+ Description: Function to read a card expiry date "MM/YY" into a packed date, on the last day of its month, year 20YY.
+              1. Month is 1 to 12.
+              2. Any other text returns DATE_WRONG_FORMAT, and date is set to DATE_NONE.
+*/
+EN_dateError_t dateParseExpiry(const uint8_t *text, date_t *date)
+{
+    int32_t Loc_Month;
+    int32_t Loc_Year;
+
+    *date = DATE_NONE;
+
+    /* Check 1: Wrong length or format */
+    if ((strlen((const char *)text) != 5) || (text[2] != '/'))
+    {
+        return DATE_WRONG_FORMAT;
+    }
+
+    Loc_Month = dateDigits(text, 2);
+    Loc_Year  = dateDigits(text + 3, 2);
+
+    /* Check 2: Wrong month or year */
+    if ((Loc_Month < 1) || (Loc_Month > 12) || (Loc_Year < 0))
+    {
+        return DATE_WRONG_FORMAT;
+    }
+
+    *date = DATE_PACK(2000 + Loc_Year, Loc_Month, 31);
+
+    return DATE_OK;
+}
+
+/*
+ Name: dateFormat
+ Input: date_t date, and Pointer to text of DATE_TEXT_SIZE characters at least
+ Output: void
+ Description: Function to write a packed date as a NUL terminated "DD/MM/YYYY" date.
+*/
+void dateFormat(date_t date, uint8_t *text)
+{
+    uint16_t Loc_Year = DATE_YEAR(date);
+
+    text[0]  = (uint8_t)('0' + (DATE_DAY(date) / 10));
+    text[1]  = (uint8_t)('0' + (DATE_DAY(date) % 10));
+    text[2]  = '/';
+    text[3]  = (uint8_t)('0' + (DATE_MONTH(date) / 10));
+    text[4]  = (uint8_t)('0' + (DATE_MONTH(date) % 10));
+    text[5]  = '/';
+    text[6]  = (uint8_t)('0' + ((Loc_Year / 1000) % 10));
+    text[7]  = (uint8_t)('0' + ((Loc_Year / 100) % 10));
+    text[8]  = (uint8_t)('0' + ((Loc_Year / 10) % 10));
+    text[9]  = (uint8_t)('0' + (Loc_Year % 10));
+    text[10] = '\0';
+}
+
+/*
+ Name: dateMatches
+ Input: date_t date, and Pointer to text of DATE_TEXT_SIZE characters at least
+ Output: uint8 1 if the text is the "DD/MM/YYYY" form of date, else 0
+ Description: Function to check a packed date against the text it was packed from, so a text changed after it was
+              packed isn't hidden by a stale packed date. DATE_NONE matches no text.
+              The text is only read up to its first character that doesn't match.
+*/
+uint8_t dateMatches(date_t date, const uint8_t *text)
+{
+    uint32_t Loc_Day   = DATE_DAY(date);
+    uint32_t Loc_Month = DATE_MONTH(date);
+    uint32_t Loc_Year  = DATE_YEAR(date);
+
+    return (date != DATE_NONE) && (Loc_Year < 10000) &&
+           (text[0] == ('0' + (Loc_Day / 10))) && (text[1] == ('0' + (Loc_Day % 10))) && (text[2] == '/') &&
+           (text[3] == ('0' + (Loc_Month / 10))) && (text[4] == ('0' + (Loc_Month % 10))) && (text[5] == '/') &&
+           (text[6] == ('0' + (Loc_Year / 1000))) && (text[7] == ('0' + ((Loc_Year / 100) % 10))) &&
+           (text[8] == ('0' + ((Loc_Year / 10) % 10))) && (text[9] == ('0' + (Loc_Year % 10))) && (text[10] == '\0');
+}
+
+/*
+ Name: dateMatchesExpiry
+ Input: date_t date, and Pointer to text
+ Output: uint8 1 if the text is the "MM/YY" card expiry date that packs to date, else 0
+ Description: Function to check a packed expiry date against the text it was packed from, as dateMatches does.
+*/
+uint8_t dateMatchesExpiry(date_t date, const uint8_t *text)
+{
+    uint32_t Loc_Month = DATE_MONTH(date);
+    uint32_t Loc_Year  = DATE_YEAR(date) - 2000U;
+
+    return (DATE_DAY(date) == 31) && (Loc_Year < 100) &&
+           (text[0] == ('0' + (Loc_Month / 10))) && (text[1] == ('0' + (Loc_Month % 10))) && (text[2] == '/') &&
+           (text[3] == ('0' + (Loc_Year / 10))) && (text[4] == ('0' + (Loc_Year % 10))) && (text[5] == '\0');
+}
+
+/*
+ Name: dateToday
+ Input: Pointer to text of DATE_TEXT_SIZE characters at least, or NULL
+ Output: date_t current local date
+ Description: Function to get the current local date, packed, and as "DD/MM/YYYY" text if text isn't NULL.
+              1. The date is cached with the times its day starts and ends at, so it costs one time() call and a
+                 compare, and localtime() only runs again once the day changes (or the clock is set back).
+              2. The cache is not locked, call it from one thread, as the terminal does.
+*/
+date_t dateToday(uint8_t *text)
+{
+    time_t Loc_Now = time(NULL);
+
+    /* Check 1: Day changed, refresh the cache */
+    if ((Loc_Now < Glb_TodayStart) || (Loc_Now >= Glb_TodayEnd))
+    {
+        struct tm Loc_Time = *localtime(&Loc_Now);
+
+        Glb_Today = DATE_PACK(Loc_Time.tm_year + 1900, Loc_Time.tm_mon + 1, Loc_Time.tm_mday);
+        dateFormat(Glb_Today, Glb_TodayText);
+
+        /* Local midnight today, and tomorrow, mktime handles the end of a month and the DST changes */
+        Loc_Time.tm_hour  = 0;
+        Loc_Time.tm_min   = 0;
+        Loc_Time.tm_sec   = 0;
+        Loc_Time.tm_isdst = -1;
+        Glb_TodayStart = mktime(&Loc_Time);
+
+        Loc_Time.tm_mday++;
+        Loc_Time.tm_hour  = 0;
+        Loc_Time.tm_min   = 0;
+        Loc_Time.tm_sec   = 0;
+        Loc_Time.tm_isdst = -1;
+        Glb_TodayEnd = mktime(&Loc_Time);
+
+        /* Check 1.1: Midnight can't be found, look at the clock again in a second */
+        if ((Glb_TodayStart == (time_t)-1) || (Glb_TodayEnd == (time_t)-1) || (Glb_TodayEnd <= Loc_Now))
+        {
+            Glb_TodayStart = Loc_Now;
+            Glb_TodayEnd   = Loc_Now + 1;
+        }
+    }
+
+    if (text != NULL)
+    {
+        memcpy(text, Glb_TodayText, DATE_TEXT_SIZE);
+    }
+
+    return Glb_Today;
+}
+
+/*
+ Name: dateToDayNumber
+ Input: date_t date
+ Output: uint32 number of days since DATE_EPOCH
+ Description: Function to get the day number of a packed date on or after DATE_EPOCH, in the Gregorian calendar.
+              A day past the end of its month (e.g. 31/04) counts on into the next month.
+*/
+uint32_t dateToDayNumber(date_t date)
+{
+    /* Years start in March, so the leap day is the last day of the year before */
+    uint32_t Loc_Year  = DATE_YEAR(date) - ((DATE_MONTH(date) <= 2) ? 1 : 0);
+    uint32_t Loc_Month = (DATE_MONTH(date) > 2) ? (DATE_MONTH(date) - 3U) : (DATE_MONTH(date) + 9U);
+    uint32_t Loc_Era   = Loc_Year / 400;
+    uint32_t Loc_YearOfEra = Loc_Year - (Loc_Era * 400);
+    uint32_t Loc_DayOfYear = (((153 * Loc_Month) + 2) / 5) + DATE_DAY(date) - 1;
+    uint32_t Loc_DayOfEra  = (Loc_YearOfEra * 365) + (Loc_YearOfEra / 4) - (Loc_YearOfEra / 100) + Loc_DayOfYear;
+
+    /* 693901 is the day of 01/01/1900 counted from 01/03/0000 */
+    return (Loc_Era * 146097) + Loc_DayOfEra - 693901;
+}
+
+/*
+ Name: dateFromDayNumber
+ Input: uint32 day number
+ Output: date_t packed date
+ Description: Function to get the packed date of a number of days since DATE_EPOCH, the inverse of dateToDayNumber.
+*/
+date_t dateFromDayNumber(uint32_t dayNumber)
+{
+    uint32_t Loc_Days      = dayNumber + 693901;
+    uint32_t Loc_Era       = Loc_Days / 146097;
+    uint32_t Loc_DayOfEra  = Loc_Days - (Loc_Era * 146097);
+    uint32_t Loc_YearOfEra = (Loc_DayOfEra - (Loc_DayOfEra / 1460) + (Loc_DayOfEra / 36524) - (Loc_DayOfEra / 146096)) / 365;
+    uint32_t Loc_DayOfYear = Loc_DayOfEra - ((365 * Loc_YearOfEra) + (Loc_YearOfEra / 4) - (Loc_YearOfEra / 100));
+    uint32_t Loc_Month     = ((5 * Loc_DayOfYear) + 2) / 153;
+    uint32_t Loc_Day       = Loc_DayOfYear - (((153 * Loc_Month) + 2) / 5) + 1;
+    uint32_t Loc_Year      = Loc_YearOfEra + (Loc_Era * 400);
+
+    /* Back from years that start in March */
+    Loc_Month = (Loc_Month < 10) ? (Loc_Month + 3) : (Loc_Month - 9);
+
+    return DATE_PACK(Loc_Year + ((Loc_Month <= 2) ? 1 : 0), Loc_Month, Loc_Day);
+}
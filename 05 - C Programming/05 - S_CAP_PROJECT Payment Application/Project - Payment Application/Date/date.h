@@ -0,0 +1,63 @@
+/**
+ * @Title      	: Date Module
+ * @Filename   	: date.h
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+#ifndef DATE_H_
+#define DATE_H_
+
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+/* Size of a "DD/MM/YYYY" date and its NUL */
+#define DATE_TEXT_SIZE				11
+/* No date, it is before any packed date */
+#define DATE_NONE					((date_t)0)
+
+/* Packed date, later dates are larger numbers */
+#define DATE_PACK(year, month, day)	((date_t)(((uint32_t)(year) << 9) | ((uint32_t)(month) << 5) | (uint32_t)(day)))
+#define DATE_YEAR(date)				((uint16_t)((date) >> 9))
+#define DATE_MONTH(date)			((uint8_t)(((date) >> 5) & 0x0F))
+#define DATE_DAY(date)				((uint8_t)((date) & 0x1F))
+/* Day number 0, the first day a day number counts from */
+#define DATE_EPOCH					DATE_PACK(1900, 1, 1)
+
+/**************************************************************************************************************************************/
+/*
+* A date packed in one integer | year: 23 bits | month: 4 bits | day: 5 bits |, so dates compare with one integer compare.
+* A card expiry date "MM/YY" is packed as the last day of its month (day 31), so a card is expired on a date if its
+* packed expiry is less than that date.
+* A day number counts the days since DATE_EPOCH, so the number of days between two dates is one subtraction.
+*/
+/**************************************************************************************************************************************/
+typedef uint32_t date_t;
+
+typedef enum EN_dateError_t
+{
+    DATE_OK, DATE_WRONG_FORMAT
+}EN_dateError_t;
+
+/**************************************************************************************************************************************/
+/*
+*							Prototypes for all used functions inside the date module.
+*/
+/**************************************************************************************************************************************/
+EN_dateError_t dateParse(const uint8_t *text, date_t *date);
+EN_dateError_t dateParseExpiry(const uint8_t *text, date_t *date);
+void dateFormat(date_t date, uint8_t *text);
+uint8_t dateMatches(date_t date, const uint8_t *text);
+uint8_t dateMatchesExpiry(date_t date, const uint8_t *text);
+date_t dateToday(uint8_t *text);
+uint32_t dateToDayNumber(date_t date);
+date_t dateFromDayNumber(uint32_t dayNumber);
+
+#endif /* DATE_H_ */
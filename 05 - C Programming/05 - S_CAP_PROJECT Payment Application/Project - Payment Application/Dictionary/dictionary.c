@@ -0,0 +1,352 @@
+/**
+ * @Title      	: Dictionary Module
+ * @Filename   	: dictionary.c
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+
+/* Dictionary Module */
+#include "dictionary.h"
+
+/* Platform flush to disk, and 64-bit file offsets */
+#ifdef _WIN32
+#include <io.h>
+#define dictionaryFileSeek(STREAM, OFFSET)		_fseeki64((STREAM), (__int64)(OFFSET), SEEK_SET)
+#define dictionaryFileSync(STREAM)				_commit(_fileno(STREAM))
+#define dictionaryFileTruncate(STREAM, SIZE)	_chsize_s(_fileno(STREAM), (__int64)(SIZE))
+#else
+#include <sys/types.h>
+#include <unistd.h>
+#define dictionaryFileSeek(STREAM, OFFSET)		fseeko((STREAM), (off_t)(OFFSET), SEEK_SET)
+#define dictionaryFileSync(STREAM)				fsync(fileno(STREAM))
+#define dictionaryFileTruncate(STREAM, SIZE)	ftruncate(fileno(STREAM), (off_t)(SIZE))
+#endif
+
+/*
+ Name: dictionaryChecksum
+ Input: Pointer to NUL padded text of DICTIONARY_TEXT_SIZE bytes
+ Output: uint32 checksum
+ Description: Static Function to get the FNV-1a hash of a text's 4-byte words, it is the entry checksum and the hash
+              table key. Words instead of bytes take a quarter of the multiplies, a final mix spreads every word into the
+              low bits the table slot is taken from.
+*/
+static uint32_t dictionaryChecksum(const uint8_t *text)
+{
+    uint32_t Loc_Hash = 2166136261UL;
+
+    /* Loop: Until the end of the text */
+    for (uint32_t Loc_Index = 0; Loc_Index < DICTIONARY_TEXT_SIZE; Loc_Index += sizeof(uint32_t))
+    {
+        uint32_t Loc_Word;
+
+        memcpy(&Loc_Word, text + Loc_Index, sizeof(uint32_t));
+        Loc_Hash ^= Loc_Word;
+        Loc_Hash *= 16777619UL;
+    }
+
+    Loc_Hash ^= Loc_Hash >> 15;
+    Loc_Hash *= 0x2C1B3C6DUL;
+    Loc_Hash ^= Loc_Hash >> 12;
+
+    return Loc_Hash;
+}
+
+/*
+ Name: dictionaryOffset
+ Input: uint32 id
+ Output: uint64 offset in bytes
+ Description: Static Function to get the file offset of an entry.
+*/
+static uint64_t dictionaryOffset(uint32_t id)
+{
+    return sizeof(ST_dictionaryHeader_t) + ((uint64_t)id * sizeof(ST_dictionaryEntry_t));
+}
+
+/*
+ Name: dictionaryLink
+ Input: Pointer to dictionary, and uint32 id
+ Output: void
+ Description: Static Function to add an entry to the hash table, the table always has an empty slot.
+*/
+static void dictionaryLink(ST_dictionary_t *dictionary, uint32_t id)
+{
+    uint32_t Loc_Slot = dictionary->entries[id].checksum & dictionary->slotsMask;
+
+    /* Loop: Until an empty slot is found */
+    while (dictionary->slots[Loc_Slot] != 0)
+    {
+        Loc_Slot = (Loc_Slot + 1) & dictionary->slotsMask;
+    }
+
+    dictionary->slots[Loc_Slot] = id + 1;
+}
+
+/*
+ Name: dictionaryGrow
+ Input: Pointer to dictionary
+ Output: EN_dictionaryError_t Error or No Error
+ Description: Static Function to double the room for texts, and rebuild the hash table at twice that many slots.
+*/
+static EN_dictionaryError_t dictionaryGrow(ST_dictionary_t *dictionary)
+{
+    uint32_t Loc_Capacity = (dictionary->capacity != 0) ? (dictionary->capacity * 2) : DICTIONARY_MIN_CAPACITY;
+    ST_dictionaryEntry_t *Loc_Entries;
+    uint32_t *Loc_Slots;
+
+    /* Check 1: Ids would not fit in 32 bits */
+    if (Loc_Capacity > 0x40000000UL)
+    {
+        return DICTIONARY_NO_MEMORY;
+    }
+
+    Loc_Entries = realloc(dictionary->entries, Loc_Capacity * sizeof(ST_dictionaryEntry_t));
+    Loc_Slots   = (Loc_Entries != NULL) ? calloc((size_t)Loc_Capacity * 2, sizeof(uint32_t)) : NULL;
+
+    if (Loc_Entries != NULL)
+    {
+        dictionary->entries = Loc_Entries;
+    }
+
+    /* Check 2: Not enough memory */
+    if (Loc_Slots == NULL)
+    {
+        return DICTIONARY_NO_MEMORY;
+    }
+
+    free(dictionary->slots);
+    dictionary->slots     = Loc_Slots;
+    dictionary->slotsMask = (Loc_Capacity * 2) - 1;
+    dictionary->capacity  = Loc_Capacity;
+
+    for (uint32_t Loc_Id = 0; Loc_Id < dictionary->count; Loc_Id++)
+    {
+        dictionaryLink(dictionary, Loc_Id);
+    }
+
+    return DICTIONARY_OK;
+}
+
+/*
+ Name: dictionaryLoad
+ Input: Pointer to dictionary
+ Output: EN_dictionaryError_t Error or No Error
+ Description: Static Function to validate an existing dictionary file, and load all its entries.
+              Entries at the end that were torn by a crash (partial, or failing their checksum) are cut off.
+*/
+static EN_dictionaryError_t dictionaryLoad(ST_dictionary_t *dictionary)
+{
+    ST_dictionaryHeader_t Loc_Header;
+    ST_dictionaryEntry_t Loc_Entry;
+
+    /* Check 1: Not a dictionary file */
+    if ((fread(&Loc_Header, sizeof(Loc_Header), 1, dictionary->file) != 1) ||
+        (Loc_Header.magic     != DICTIONARY_MAGIC)   ||
+        (Loc_Header.version   != DICTIONARY_VERSION) ||
+        (Loc_Header.entrySize != sizeof(ST_dictionaryEntry_t)))
+    {
+        return DICTIONARY_WRONG_FORMAT;
+    }
+
+    /* Loop: Until the end of the file, or the first torn entry */
+    while ((fread(&Loc_Entry, sizeof(Loc_Entry), 1, dictionary->file) == 1) &&
+           (Loc_Entry.checksum == dictionaryChecksum(Loc_Entry.text)))
+    {
+        if ((dictionary->count == dictionary->capacity) && (dictionaryGrow(dictionary) != DICTIONARY_OK))
+        {
+            return DICTIONARY_NO_MEMORY;
+        }
+
+        dictionary->entries[dictionary->count] = Loc_Entry;
+        dictionaryLink(dictionary, dictionary->count);
+        dictionary->count++;
+    }
+
+    dictionary->syncedCount = dictionary->count;
+
+    /* Check 2: Cut off what follows the last good entry */
+    if ((fflush(dictionary->file) != 0) ||
+        (dictionaryFileTruncate(dictionary->file, dictionaryOffset(dictionary->count)) != 0))
+    {
+        return DICTIONARY_FILE_ERROR;
+    }
+
+    return DICTIONARY_OK;
+}
+
+/*
+ Name: dictionaryOpen
+ Input: Pointer to dictionary, Pointer to file name, and uint8 truncate
+ Output: EN_dictionaryError_t Error or No Error
+ Description: Function to open a dictionary file and load its texts, it is created empty if it doesn't exist or
+              truncate isn't 0.
+*/
+EN_dictionaryError_t dictionaryOpen(ST_dictionary_t *dictionary, const char *fileName, uint8_t truncate)
+{
+    EN_dictionaryError_t Loc_ErrorState;
+
+    memset(dictionary, 0, sizeof(ST_dictionary_t));
+
+    Loc_ErrorState = dictionaryGrow(dictionary);
+    dictionary->file = (truncate == 0) ? fopen(fileName, "r+b") : NULL;
+
+    /* Check 1: File exists, load it */
+    if ((Loc_ErrorState == DICTIONARY_OK) && (dictionary->file != NULL))
+    {
+        Loc_ErrorState = dictionaryLoad(dictionary);
+    }
+    /* Check 2: File doesn't exist, create it with its header */
+    else if (Loc_ErrorState == DICTIONARY_OK)
+    {
+        ST_dictionaryHeader_t Loc_Header = { DICTIONARY_MAGIC, DICTIONARY_VERSION, sizeof(ST_dictionaryEntry_t), 0 };
+
+        dictionary->file = fopen(fileName, "w+b");
+
+        if ((dictionary->file == NULL) || (fwrite(&Loc_Header, sizeof(Loc_Header), 1, dictionary->file) != 1) ||
+            (fflush(dictionary->file) != 0) || (dictionaryFileSync(dictionary->file) != 0))
+        {
+            Loc_ErrorState = DICTIONARY_FILE_ERROR;
+        }
+    }
+
+    /* Check 3: Dictionary can't be used, release it */
+    if (Loc_ErrorState != DICTIONARY_OK)
+    {
+        if (dictionary->file != NULL)
+        {
+            fclose(dictionary->file);
+        }
+
+        free(dictionary->entries);
+        free(dictionary->slots);
+        memset(dictionary, 0, sizeof(ST_dictionary_t));
+    }
+
+    return Loc_ErrorState;
+}
+
+/*
+ Name: dictionaryIntern
+ Input: Pointer to dictionary, Pointer to text, uint32 length, and Pointer to id
+ Output: EN_dictionaryError_t Error or No Error
+ Description: Function to get the id of a text of length bytes, it is added if the dictionary doesn't have it yet.
+              1. A new text is only in memory until the next dictionarySync.
+              2. If the text is longer than DICTIONARY_TEXT_SIZE - 1 returns DICTIONARY_WRONG_FORMAT, or
+                 DICTIONARY_NO_MEMORY if it can't be added, else will return DICTIONARY_OK.
+*/
+EN_dictionaryError_t dictionaryIntern(ST_dictionary_t *dictionary, const uint8_t *text, uint32_t length, uint32_t *id)
+{
+    uint8_t Loc_Text[DICTIONARY_TEXT_SIZE] = { 0 };
+    uint32_t Loc_Checksum;
+    uint32_t Loc_Slot;
+
+    /* Check 1: Text is too long */
+    if (length >= DICTIONARY_TEXT_SIZE)
+    {
+        return DICTIONARY_WRONG_FORMAT;
+    }
+
+    memcpy(Loc_Text, text, length);
+    Loc_Checksum = dictionaryChecksum(Loc_Text);
+    Loc_Slot     = Loc_Checksum & dictionary->slotsMask;
+
+    /* Loop: Until the text or an empty slot is found */
+    while (dictionary->slots[Loc_Slot] != 0)
+    {
+        const ST_dictionaryEntry_t *Loc_Entry = &dictionary->entries[dictionary->slots[Loc_Slot] - 1];
+
+        if ((Loc_Entry->checksum == Loc_Checksum) && (memcmp(Loc_Entry->text, Loc_Text, DICTIONARY_TEXT_SIZE) == 0))
+        {
+            *id = dictionary->slots[Loc_Slot] - 1;
+            return DICTIONARY_OK;
+        }
+
+        Loc_Slot = (Loc_Slot + 1) & dictionary->slotsMask;
+    }
+
+    /* Check 2: No room for one more text */
+    if ((dictionary->count == dictionary->capacity) && (dictionaryGrow(dictionary) != DICTIONARY_OK))
+    {
+        return DICTIONARY_NO_MEMORY;
+    }
+
+    memcpy(dictionary->entries[dictionary->count].text, Loc_Text, DICTIONARY_TEXT_SIZE);
+    dictionary->entries[dictionary->count].checksum = Loc_Checksum;
+    dictionaryLink(dictionary, dictionary->count);
+    *id = dictionary->count++;
+
+    return DICTIONARY_OK;
+}
+
+/*
+ Name: dictionaryText
+ Input: Pointer to dictionary, and uint32 id
+ Output: Pointer to the NUL terminated text of id, or NULL if there is no such id
+ Description: Function to get a text back from its id.
+*/
+const uint8_t *dictionaryText(const ST_dictionary_t *dictionary, uint32_t id)
+{
+    return (id < dictionary->count) ? dictionary->entries[id].text : NULL;
+}
+
+/*
+ Name: dictionarySync
+ Input: Pointer to dictionary
+ Output: EN_dictionaryError_t Error or No Error
+ Description: Function to write the texts added since the last sync to the end of the file with one write, and one
+              flush to disk. It does nothing if no text was added, so calling it before every log commit is cheap.
+*/
+EN_dictionaryError_t dictionarySync(ST_dictionary_t *dictionary)
+{
+    uint32_t Loc_Pending = dictionary->count - dictionary->syncedCount;
+
+    /* Check 1: Nothing to write */
+    if (Loc_Pending == 0)
+    {
+        return DICTIONARY_OK;
+    }
+
+    /* Check 2: Entries can't be written */
+    if ((dictionaryFileSeek(dictionary->file, dictionaryOffset(dictionary->syncedCount)) != 0) ||
+        (fwrite(&dictionary->entries[dictionary->syncedCount], sizeof(ST_dictionaryEntry_t), Loc_Pending, dictionary->file) != Loc_Pending) ||
+        (fflush(dictionary->file) != 0) || (dictionaryFileSync(dictionary->file) != 0))
+    {
+        return DICTIONARY_FILE_ERROR;
+    }
+
+    dictionary->syncedCount = dictionary->count;
+
+    return DICTIONARY_OK;
+}
+
+/*
+ Name: dictionaryClose
+ Input: Pointer to dictionary
+ Output: EN_dictionaryError_t Error or No Error
+ Description: Function to write the texts added since the last sync, and close the dictionary.
+*/
+EN_dictionaryError_t dictionaryClose(ST_dictionary_t *dictionary)
+{
+    EN_dictionaryError_t Loc_ErrorState;
+
+    /* Check 1: Dictionary is not open */
+    if (dictionary->file == NULL)
+    {
+        return DICTIONARY_OK;
+    }
+
+    Loc_ErrorState = dictionarySync(dictionary);
+
+    fclose(dictionary->file);
+    free(dictionary->entries);
+    free(dictionary->slots);
+    memset(dictionary, 0, sizeof(ST_dictionary_t));
+
+    return Loc_ErrorState;
+}
@@ -0,0 +1,78 @@
+/**
+ * @Title      	: Dictionary Module
+ * @Filename   	: dictionary.h
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+#ifndef DICTIONARY_H_
+#define DICTIONARY_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Dictionary file signature "DICT", and format version */
+#define DICTIONARY_MAGIC			0x54434944UL
+#define DICTIONARY_VERSION			1
+/* Max. size of a text and its NUL */
+#define DICTIONARY_TEXT_SIZE		28
+/* Min. number of texts a dictionary has room for before it grows */
+#define DICTIONARY_MIN_CAPACITY		64
+
+/**************************************************************************************************************************************/
+/*
+* Dictionary file layout, entries are only ever appended, the id of a text is the position of its entry:
+*	| ST_dictionaryHeader_t | ST_dictionaryEntry_t | ST_dictionaryEntry_t | ...
+* All entries are loaded when the file is opened, with a hash table from text to id, so both ways are one lookup.
+*/
+/**************************************************************************************************************************************/
+typedef struct ST_dictionaryHeader_t
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t entrySize;			/* sizeof(ST_dictionaryEntry_t) the file was written with */
+    uint32_t reserved;
+}ST_dictionaryHeader_t;
+
+typedef struct ST_dictionaryEntry_t
+{
+    uint8_t text[DICTIONARY_TEXT_SIZE];	/* NUL padded */
+    uint32_t checksum;					/* FNV-1a of the text words */
+}ST_dictionaryEntry_t;
+
+typedef struct ST_dictionary_t
+{
+    FILE *file;
+    ST_dictionaryEntry_t *entries;		/* All texts, by id */
+    uint32_t count;
+    uint32_t capacity;
+    uint32_t syncedCount;				/* Texts on disk, the rest are written by the next dictionarySync */
+    uint32_t *slots;					/* Open-addressing table of id + 1, 0 is an empty slot */
+    uint32_t slotsMask;					/* Number of slots - 1, twice the capacity */
+}ST_dictionary_t;
+
+typedef enum EN_dictionaryError_t
+{
+    DICTIONARY_OK, DICTIONARY_FILE_ERROR, DICTIONARY_WRONG_FORMAT, DICTIONARY_NO_MEMORY
+}EN_dictionaryError_t;
+
+/**************************************************************************************************************************************/
+/*
+*							Prototypes for all used functions inside the dictionary module.
+*/
+/**************************************************************************************************************************************/
+EN_dictionaryError_t dictionaryOpen(ST_dictionary_t *dictionary, const char *fileName, uint8_t truncate);
+EN_dictionaryError_t dictionaryIntern(ST_dictionary_t *dictionary, const uint8_t *text, uint32_t length, uint32_t *id);
+const uint8_t *dictionaryText(const ST_dictionary_t *dictionary, uint32_t id);
+EN_dictionaryError_t dictionarySync(ST_dictionary_t *dictionary);
+EN_dictionaryError_t dictionaryClose(ST_dictionary_t *dictionary);
+
+#endif /* DICTIONARY_H_ */
@@ -0,0 +1,466 @@
+/**
+ * @Title      	: Filter Module
+ * @Filename   	: filter.c
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+
+/* Filter Module */
+#include "filter.h"
+
+/* Start loading a cache line early, a no-op for compilers without the builtin */
+#if defined(__GNUC__) || defined(__clang__)
+#define filterPrefetch(ADDRESS)		__builtin_prefetch((ADDRESS))
+#else
+#define filterPrefetch(ADDRESS)		((void)(ADDRESS))
+#endif
+
+/*
+ Name: filterGet
+ Input: Pointer to filter, and uint64 slot
+ Output: uint32 fingerprint of the slot, 0 if it is empty
+ Description: Static Function to read one table entry of the filter's fingerprint width.
+*/
+static inline uint32_t filterGet(const ST_filter_t *filter, uint64_t slot)
+{
+    switch (filter->fingerprintBytes)
+    {
+        case 1:  return filter->table[slot];
+        case 2:  return ((const uint16_t *)filter->table)[slot];
+        default: return ((const uint32_t *)filter->table)[slot];
+    }
+}
+
+/*
+ Name: filterSet
+ Input: Pointer to filter, uint64 slot, and uint32 fingerprint
+ Output: void
+ Description: Static Function to write one table entry of the filter's fingerprint width.
+*/
+static inline void filterSet(ST_filter_t *filter, uint64_t slot, uint32_t fingerprint)
+{
+    switch (filter->fingerprintBytes)
+    {
+        case 1:  filter->table[slot] = (uint8_t)fingerprint; break;
+        case 2:  ((uint16_t *)filter->table)[slot] = (uint16_t)fingerprint; break;
+        default: ((uint32_t *)filter->table)[slot] = fingerprint; break;
+    }
+}
+
+/*
+ Name: filterFingerprint
+ Input: Pointer to filter, and uint64 hash
+ Output: uint32 fingerprint, never 0
+ Description: Static Function to get the fingerprint of a hash from its high half, the bucket comes from the low half.
+*/
+static inline uint32_t filterFingerprint(const ST_filter_t *filter, uint64_t hash)
+{
+    uint32_t Loc_Fingerprint = (uint32_t)(hash >> 32) & filter->fingerprintMask;
+
+    return (Loc_Fingerprint != 0) ? Loc_Fingerprint : 1;
+}
+
+/*
+ Name: filterBucket
+ Input: Pointer to filter, and uint64 hash
+ Output: uint64 own bucket of the hash
+ Description: Static Function to map the low half of a hash onto the buckets with a multiply and a shift, so the number
+              of buckets doesn't have to be a power of two.
+*/
+static inline uint64_t filterBucket(const ST_filter_t *filter, uint64_t hash)
+{
+    return ((hash & 0xFFFFFFFFULL) * filter->bucketsCount) >> 32;
+}
+
+/*
+ Name: filterOtherBucket
+ Input: Pointer to filter, uint64 bucket, and uint32 fingerprint
+ Output: uint64 other bucket of the fingerprint
+ Description: Static Function to get the other candidate bucket of a fingerprint from either of its buckets:
+              other = (mix(fingerprint) - bucket) mod buckets, which gives back the first bucket from the other one.
+*/
+static inline uint64_t filterOtherBucket(const ST_filter_t *filter, uint64_t bucket, uint32_t fingerprint)
+{
+    uint64_t Loc_Mix = ((((fingerprint * 0xC6A4A7935BD1E995ULL) >> 32) & 0xFFFFFFFFULL) * filter->bucketsCount) >> 32;
+
+    return (Loc_Mix >= bucket) ? (Loc_Mix - bucket) : (Loc_Mix + filter->bucketsCount - bucket);
+}
+
+/*
+ Name: filterBucketHas
+ Input: Pointer to filter, uint64 bucket, and uint32 fingerprint
+ Output: uint8 1 if the bucket holds the fingerprint, else 0
+ Description: Static Function to look for a fingerprint in the entries of one bucket. A bucket of 1 or 2 byte entries
+              is one 32 or 64-bit word, all its entries are compared at once (FILTER_BUCKET_SIZE is 4), with the "has a zero lane" bit trick on the
+              word XOR the fingerprint repeated in every lane.
+*/
+static inline uint8_t filterBucketHas(const ST_filter_t *filter, uint64_t bucket, uint32_t fingerprint)
+{
+    switch (filter->fingerprintBytes)
+    {
+        case 1:
+        {
+            uint32_t Loc_Word;
+
+            memcpy(&Loc_Word, &filter->table[bucket * FILTER_BUCKET_SIZE], sizeof(Loc_Word));
+            Loc_Word ^= fingerprint * 0x01010101UL;
+
+            return ((Loc_Word - 0x01010101UL) & ~Loc_Word & 0x80808080UL) != 0;
+        }
+        case 2:
+        {
+            uint64_t Loc_Word;
+
+            memcpy(&Loc_Word, &filter->table[bucket * FILTER_BUCKET_SIZE * 2], sizeof(Loc_Word));
+            Loc_Word ^= fingerprint * 0x0001000100010001ULL;
+
+            return ((Loc_Word - 0x0001000100010001ULL) & ~Loc_Word & 0x8000800080008000ULL) != 0;
+        }
+        default:
+        {
+            const uint32_t *Loc_Entries = &((const uint32_t *)filter->table)[bucket * FILTER_BUCKET_SIZE];
+
+            return (Loc_Entries[0] == fingerprint) | (Loc_Entries[1] == fingerprint) |
+                   (Loc_Entries[2] == fingerprint) | (Loc_Entries[3] == fingerprint);
+        }
+    }
+}
+
+/*
+ Name: filterBucketPut
+ Input: Pointer to filter, uint64 bucket, and uint32 fingerprint
+ Output: uint8 1 if the fingerprint is stored, 0 if the bucket is full
+ Description: Static Function to store a fingerprint in the first empty entry of one bucket.
+*/
+static uint8_t filterBucketPut(ST_filter_t *filter, uint64_t bucket, uint32_t fingerprint)
+{
+    uint64_t Loc_Slot = bucket * FILTER_BUCKET_SIZE;
+
+    for (uint32_t Loc_Index = 0; Loc_Index < FILTER_BUCKET_SIZE; Loc_Index++)
+    {
+        if (filterGet(filter, Loc_Slot + Loc_Index) == 0)
+        {
+            filterSet(filter, Loc_Slot + Loc_Index, fingerprint);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ Name: filterPlace
+ Input: Pointer to filter, uint64 bucket, and uint32 fingerprint
+ Output: void
+ Description: Static Function to store a fingerprint in one of its two buckets. If both are full, it moves a random
+              entry of a full bucket to that entry's other bucket, and so on, up to FILTER_MAX_KICKS times. The
+              fingerprint left over after that is parked in the victim slot, which must be empty.
+*/
+static void filterPlace(ST_filter_t *filter, uint64_t bucket, uint32_t fingerprint)
+{
+    uint64_t Loc_Other = filterOtherBucket(filter, bucket, fingerprint);
+
+    /* Check 1: One of the two buckets has an empty entry */
+    if (filterBucketPut(filter, bucket, fingerprint) || filterBucketPut(filter, Loc_Other, fingerprint))
+    {
+        return;
+    }
+
+    /* Loop: Until an evicted fingerprint finds an empty entry, or too many are moved */
+    for (uint32_t Loc_Kick = 0; Loc_Kick < FILTER_MAX_KICKS; Loc_Kick++)
+    {
+        uint64_t Loc_Slot;
+        uint32_t Loc_Evicted;
+
+        filter->randomState ^= filter->randomState << 13;
+        filter->randomState ^= filter->randomState >> 7;
+        filter->randomState ^= filter->randomState << 17;
+
+        Loc_Slot    = (Loc_Other * FILTER_BUCKET_SIZE) + (filter->randomState % FILTER_BUCKET_SIZE);
+        Loc_Evicted = filterGet(filter, Loc_Slot);
+        filterSet(filter, Loc_Slot, fingerprint);
+
+        fingerprint = Loc_Evicted;
+        Loc_Other   = filterOtherBucket(filter, Loc_Other, fingerprint);
+
+        if (filterBucketPut(filter, Loc_Other, fingerprint))
+        {
+            return;
+        }
+    }
+
+    filter->victimBucket      = Loc_Other;
+    filter->victimFingerprint = fingerprint;
+}
+
+/*
+ Name: filterCreate
+ Input: Pointer to filter, and Pointer to Filter Config structure
+ Output: EN_filterError_t Error or No Error
+ Description: Function to create an empty filter for up to capacity hashes, at about the configured false positive rate.
+              1. The number of buckets is the smallest that holds capacity at FILTER_MAX_LOAD, FILTER_MIN_BUCKETS at least.
+              2. The fingerprint is the smallest of 8, 16 or 32 bits with 2 * FILTER_BUCKET_SIZE / 2^bits at or below
+                 the false positive rate, since a lookup compares against the two buckets' entries.
+              3. A capacity of 0 or a rate outside (0, 1) returns FILTER_WRONG_CONFIG.
+*/
+EN_filterError_t filterCreate(ST_filter_t *filter, const ST_filterConfig_t *config)
+{
+    double Loc_Rate = (config->falsePositiveRate != 0) ? config->falsePositiveRate : FILTER_DEFAULT_FALSE_POSITIVE_RATE;
+    uint64_t Loc_Buckets = FILTER_MIN_BUCKETS;
+    uint32_t Loc_Bits = 8;
+
+    memset(filter, 0, sizeof(ST_filter_t));
+
+    /* Check 1: Wrong capacity or rate */
+    if ((config->capacity == 0) || (Loc_Rate <= 0) || (Loc_Rate >= 1))
+    {
+        return FILTER_WRONG_CONFIG;
+    }
+
+    /* Check 2: More buckets needed than the minimum, the bucket of a hash is found from 32 bits of it */
+    if ((double)Loc_Buckets * FILTER_BUCKET_SIZE * FILTER_MAX_LOAD < (double)config->capacity)
+    {
+        Loc_Buckets = (uint64_t)((double)config->capacity / (FILTER_BUCKET_SIZE * FILTER_MAX_LOAD)) + 1;
+
+        if (Loc_Buckets > 0xFFFFFFFFULL)
+        {
+            return FILTER_WRONG_CONFIG;
+        }
+    }
+
+    /* Loop: Until the fingerprint is wide enough for the rate, 32 bits at most */
+    while ((Loc_Bits < 32) && ((2.0 * FILTER_BUCKET_SIZE) / (double)(1ULL << Loc_Bits) > Loc_Rate))
+    {
+        Loc_Bits *= 2;
+    }
+
+    filter->table = calloc(Loc_Buckets * FILTER_BUCKET_SIZE, Loc_Bits / 8);
+
+    /* Check 3: Not enough memory */
+    if (filter->table == NULL)
+    {
+        return FILTER_NO_MEMORY;
+    }
+
+    filter->bucketsCount     = Loc_Buckets;
+    filter->fingerprintBytes = Loc_Bits / 8;
+    filter->fingerprintMask  = (Loc_Bits == 32) ? 0xFFFFFFFFUL : (uint32_t)((1UL << Loc_Bits) - 1);
+    filter->randomState      = 0x9E3779B97F4A7C15ULL;
+
+    return FILTER_OK;
+}
+
+/*
+ Name: filterDestroy
+ Input: Pointer to filter
+ Output: void
+ Description: Function to free the table of a filter, it is then an empty filter that answers "not found".
+*/
+void filterDestroy(ST_filter_t *filter)
+{
+    free(filter->table);
+    memset(filter, 0, sizeof(ST_filter_t));
+}
+
+/*
+ Name: filterInsert
+ Input: Pointer to filter, and uint64 hash
+ Output: EN_filterError_t Error or No Error
+ Description: Function to add a hash to a filter, a hash inserted twice has to be deleted twice.
+              1. If the table is too full to take it (the victim slot is taken), the filter becomes saturated and
+                 returns FILTER_FULL. A saturated filter answers "found" for every hash, so it is still never wrong
+                 about a hash that is in it, it just doesn't screen anything out any more.
+*/
+EN_filterError_t filterInsert(ST_filter_t *filter, uint64_t hash)
+{
+    /* Check 1: No room left for an insert that doesn't find an empty entry */
+    if ((filter->victimFingerprint != 0) || (filter->table == NULL))
+    {
+        filter->saturated = 1;
+        return FILTER_FULL;
+    }
+
+    filterPlace(filter, filterBucket(filter, hash), filterFingerprint(filter, hash));
+    filter->count++;
+
+    return FILTER_OK;
+}
+
+/*
+ Name: filterDelete
+ Input: Pointer to filter, and uint64 hash
+ Output: EN_filterError_t Error or No Error
+ Description: Function to remove a hash that was inserted before. Deleting a hash that wasn't inserted can remove
+              another hash with the same fingerprint and buckets, so only delete what was inserted.
+              1. If no entry matches returns FILTER_NOT_FOUND, else will return FILTER_OK.
+              2. The parked victim, if any, is moved back into the table once an entry is free.
+*/
+EN_filterError_t filterDelete(ST_filter_t *filter, uint64_t hash)
+{
+    uint32_t Loc_Fingerprint;
+    uint64_t Loc_Buckets[2];
+
+    /* Check 1: Empty filter */
+    if (filter->table == NULL)
+    {
+        return FILTER_NOT_FOUND;
+    }
+
+    Loc_Fingerprint = filterFingerprint(filter, hash);
+    Loc_Buckets[0]  = filterBucket(filter, hash);
+    Loc_Buckets[1]  = filterOtherBucket(filter, Loc_Buckets[0], Loc_Fingerprint);
+
+    /* Check 2: Fingerprint is the parked victim */
+    if ((filter->victimFingerprint == Loc_Fingerprint) &&
+        ((filter->victimBucket == Loc_Buckets[0]) || (filter->victimBucket == Loc_Buckets[1])))
+    {
+        filter->victimFingerprint = 0;
+        filter->count--;
+        return FILTER_OK;
+    }
+
+    /* Loop: Until the end of the two buckets */
+    for (uint32_t Loc_Index = 0; Loc_Index < (2 * FILTER_BUCKET_SIZE); Loc_Index++)
+    {
+        uint64_t Loc_Slot = (Loc_Buckets[Loc_Index / FILTER_BUCKET_SIZE] * FILTER_BUCKET_SIZE) + (Loc_Index % FILTER_BUCKET_SIZE);
+
+        if (filterGet(filter, Loc_Slot) == Loc_Fingerprint)
+        {
+            filterSet(filter, Loc_Slot, 0);
+            filter->count--;
+
+            /* Check 2.1: Victim is parked, it fits in the table again */
+            if (filter->victimFingerprint != 0)
+            {
+                uint32_t Loc_Victim = filter->victimFingerprint;
+
+                filter->victimFingerprint = 0;
+                filterPlace(filter, filter->victimBucket, Loc_Victim);
+            }
+
+            return FILTER_OK;
+        }
+    }
+
+    return FILTER_NOT_FOUND;
+}
+
+/*
+ Name: filterContains
+ Input: Pointer to filter, and uint64 hash
+ Output: uint8 1 if the hash may have been inserted, 0 if it surely was not
+ Description: Function to look up a hash: two buckets of FILTER_BUCKET_SIZE entries and the victim slot, no matter
+              how many hashes the filter holds. It reads the filter only, so many threads can call it at once as long
+              as none of them inserts or deletes.
+*/
+uint8_t filterContains(const ST_filter_t *filter, uint64_t hash)
+{
+    uint32_t Loc_Fingerprint;
+    uint64_t Loc_Bucket;
+
+    /* Check 1: Saturated filter can't screen anything out */
+    if (filter->saturated)
+    {
+        return 1;
+    }
+
+    /* Check 2: Empty filter */
+    if (filter->table == NULL)
+    {
+        return 0;
+    }
+
+    Loc_Fingerprint = filterFingerprint(filter, hash);
+    Loc_Bucket      = filterBucket(filter, hash);
+
+    if (filterBucketHas(filter, Loc_Bucket, Loc_Fingerprint))
+    {
+        return 1;
+    }
+
+    Loc_Bucket = filterOtherBucket(filter, Loc_Bucket, Loc_Fingerprint);
+
+    return filterBucketHas(filter, Loc_Bucket, Loc_Fingerprint) ||
+           ((filter->victimFingerprint == Loc_Fingerprint) &&
+            ((filter->victimBucket == Loc_Bucket) || (filter->victimBucket == filterOtherBucket(filter, Loc_Bucket, Loc_Fingerprint))));
+}
+
+/*
+ Name: filterContainsBatch
+ Input: Pointer to filter, Pointer to hashes array, uint32 count, and Pointer to found array
+ Output: void
+ Description: Function to look up count hashes at once, found gets filterContains of each hash.
+              Both buckets of every hash are prefetched first, then probed, so the cache misses of the batch overlap
+              instead of being paid one after the other.
+*/
+void filterContainsBatch(const ST_filter_t *filter, const uint64_t *hashes, uint32_t count, uint8_t *found)
+{
+    /* Check 1: Saturated or empty filter, no table to look at */
+    if (filter->saturated || (filter->table == NULL))
+    {
+        memset(found, filter->saturated, count);
+        return;
+    }
+
+    /* Loop: Until the loads of all buckets are started */
+    for (uint32_t Loc_Index = 0; Loc_Index < count; Loc_Index++)
+    {
+        uint64_t Loc_Bucket = filterBucket(filter, hashes[Loc_Index]);
+
+        filterPrefetch(&filter->table[Loc_Bucket * FILTER_BUCKET_SIZE * filter->fingerprintBytes]);
+        filterPrefetch(&filter->table[filterOtherBucket(filter, Loc_Bucket, filterFingerprint(filter, hashes[Loc_Index])) *
+                                      FILTER_BUCKET_SIZE * filter->fingerprintBytes]);
+    }
+
+    /* Loop: Until all hashes are looked up */
+    for (uint32_t Loc_Index = 0; Loc_Index < count; Loc_Index++)
+    {
+        found[Loc_Index] = filterContains(filter, hashes[Loc_Index]);
+    }
+}
+
+/*
+ Name: filterStats
+ Input: Pointer to filter, and Pointer to Filter Stats structure
+ Output: void
+ Description: Function to get the size, memory use, and expected false positive rate of a filter at its current load.
+*/
+void filterStats(const ST_filter_t *filter, ST_filterStats_t *stats)
+{
+    memset(stats, 0, sizeof(ST_filterStats_t));
+
+    /* Check 1: Empty filter */
+    if (filter->table == NULL)
+    {
+        return;
+    }
+
+    stats->count             = filter->count;
+    stats->slotsCount        = filter->bucketsCount * FILTER_BUCKET_SIZE;
+    stats->memoryBytes       = stats->slotsCount * filter->fingerprintBytes;
+    stats->fingerprintBits   = filter->fingerprintBytes * 8;
+    stats->loadFactor        = (double)stats->count / (double)stats->slotsCount;
+    stats->falsePositiveRate = filter->saturated ? 1.0 :
+                               (2.0 * FILTER_BUCKET_SIZE * stats->loadFactor) / (double)filter->fingerprintMask;
+    stats->saturated         = filter->saturated;
+}
+
+/*
+ Name: filterPrintStats
+ Input: Pointer to name, and Pointer to Filter Stats structure
+ Output: void
+ Description: Function to print out the stats of a filter on one line.
+*/
+void filterPrintStats(const char *name, const ST_filterStats_t *stats)
+{
+    printf(" %-16s %10llu hashes | %10.1f KiB | %2u-bit fingerprints | load %5.1f%% | false positives %.4f%%%s\n",
+           name, (unsigned long long)stats->count, stats->memoryBytes / 1024.0, stats->fingerprintBits,
+           stats->loadFactor * 100.0, stats->falsePositiveRate * 100.0, stats->saturated ? " | SATURATED" : "");
+}
@@ -0,0 +1,92 @@
+/**
+ * @Title      	: Filter Module
+ * @Filename   	: filter.h
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+#ifndef FILTER_H_
+#define FILTER_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Number of fingerprints per bucket */
+#define FILTER_BUCKET_SIZE			4
+/* Min. number of buckets in a filter */
+#define FILTER_MIN_BUCKETS			16
+/* Max. load factor a filter is sized for, a 4-way cuckoo table still inserts reliably up to about 95% */
+#define FILTER_MAX_LOAD				0.95
+/* Max. number of fingerprints moved by one insert before the last one is parked in the victim slot */
+#define FILTER_MAX_KICKS			500
+/* False positive rate of a config that leaves it 0 */
+#define FILTER_DEFAULT_FALSE_POSITIVE_RATE	0.001
+
+/**************************************************************************************************************************************/
+/*
+* Cuckoo filter over 64-bit hashes: a table of buckets of FILTER_BUCKET_SIZE fingerprints, 1, 2 or 4 bytes each.
+* A hash has two candidate buckets, its own (from the low half of the hash) and the other one (from its own bucket and the
+* fingerprint only), so a fingerprint can be moved to its other bucket, and deleted, without the hash it came from.
+* A fingerprint 0 is an empty entry, so a zeroed table is an empty filter.
+* It never answers "not found" for a hash that was inserted and not deleted (no false negatives), and answers "found"
+* for a hash that wasn't at about the configured false positive rate.
+*/
+/**************************************************************************************************************************************/
+typedef struct ST_filterConfig_t
+{
+    uint64_t capacity;					/* Max. number of hashes expected */
+    double falsePositiveRate;			/* Target rate at full capacity, 0 for FILTER_DEFAULT_FALSE_POSITIVE_RATE */
+}ST_filterConfig_t;
+
+typedef struct ST_filter_t
+{
+    uint8_t *table;
+    uint64_t bucketsCount;
+    uint32_t fingerprintBytes;			/* 1, 2 or 4 */
+    uint32_t fingerprintMask;
+    uint64_t count;						/* Fingerprints in the table and the victim slot */
+    uint64_t victimBucket;
+    uint32_t victimFingerprint;			/* 0 if the victim slot is empty */
+    uint8_t saturated;					/* A fingerprint was lost, every lookup answers "found" from now on */
+    uint64_t randomState;				/* Picks the entry an insert moves out of a full bucket */
+}ST_filter_t;
+
+typedef struct ST_filterStats_t
+{
+    uint64_t count;						/* Hashes inserted and not deleted */
+    uint64_t slotsCount;				/* Fingerprint entries in the table */
+    uint64_t memoryBytes;				/* Size of the table */
+    uint32_t fingerprintBits;
+    double loadFactor;					/* count / slotsCount */
+    double falsePositiveRate;			/* Expected rate at the current load factor */
+    uint8_t saturated;
+}ST_filterStats_t;
+
+typedef enum EN_filterError_t
+{
+    FILTER_OK, FILTER_WRONG_CONFIG, FILTER_NO_MEMORY, FILTER_FULL, FILTER_NOT_FOUND
+}EN_filterError_t;
+
+/**************************************************************************************************************************************/
+/*
+*							Prototypes for all used functions inside the filter module.
+*/
+/**************************************************************************************************************************************/
+EN_filterError_t filterCreate(ST_filter_t *filter, const ST_filterConfig_t *config);
+void filterDestroy(ST_filter_t *filter);
+EN_filterError_t filterInsert(ST_filter_t *filter, uint64_t hash);
+EN_filterError_t filterDelete(ST_filter_t *filter, uint64_t hash);
+uint8_t filterContains(const ST_filter_t *filter, uint64_t hash);
+void filterContainsBatch(const ST_filter_t *filter, const uint64_t *hashes, uint32_t count, uint8_t *found);
+void filterStats(const ST_filter_t *filter, ST_filterStats_t *stats);
+void filterPrintStats(const char *name, const ST_filterStats_t *stats);
+
+#endif /* FILTER_H_ */
@@ -0,0 +1,328 @@
+/**
+ * @Title      	: Index Module
+ * @Filename   	: index.c
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+
+/* Index Module */
+#include "index.h"
+
+/* Hint the CPU to start loading a slot early, a no-op on compilers without it */
+#ifdef __GNUC__
+#define panIndexPrefetch(ADDRESS)	__builtin_prefetch((ADDRESS))
+#else
+#define panIndexPrefetch(ADDRESS)	((void)(ADDRESS))
+#endif
+
+/*
+ Name: panIndexHash
+ Input: Pointer to PAN key
+ Output: uint64 hash
+ Description: Function to mix the PAN digits and length into a well spread 64-bit hash (MurmurHash3 finalizer).
+*/
+uint64_t panIndexHash(const ST_panKey_t *panKey)
+{
+    uint64_t Loc_Hash = panKey->key + (panKey->length * 0x9E3779B97F4A7C15ULL);
+
+    Loc_Hash ^= Loc_Hash >> 33;
+    Loc_Hash *= 0xFF51AFD7ED558CCDULL;
+    Loc_Hash ^= Loc_Hash >> 33;
+    Loc_Hash *= 0xC4CEB9FE1A85EC53ULL;
+    Loc_Hash ^= Loc_Hash >> 33;
+
+    return Loc_Hash;
+}
+
+/*
+ Name: panIndexCapacityFor
+ Input: uint64 expectedCount
+ Output: uint64 capacity
+ Description: Function to get the smallest power of two capacity that keeps the load factor at or below 3/4.
+*/
+uint64_t panIndexCapacityFor(uint64_t expectedCount)
+{
+    uint64_t Loc_Capacity = PAN_INDEX_MIN_CAPACITY;
+
+    /* Loop: Until count fits in 3/4 of the capacity */
+    while ((Loc_Capacity / 4) * 3 < expectedCount)
+    {
+        Loc_Capacity <<= 1;
+    }
+
+    return Loc_Capacity;
+}
+
+/*
+ Name: panIndexPlace
+ Input: Pointer to slots, uint64 capacity, Pointer to PAN key, and uint32 handle
+ Output: EN_indexError_t Error or No Error
+ Description: Static Function to place a key in the first free slot of its probe sequence (linear probing).
+*/
+static EN_indexError_t panIndexPlace(ST_panIndexSlot_t *slots, uint64_t capacity, const ST_panKey_t *panKey, uint32_t handle)
+{
+    uint64_t Loc_Mask = capacity - 1;
+    uint64_t Loc_Slot = panIndexHash(panKey) & Loc_Mask;
+
+    /* Loop: Until an empty slot is found */
+    while (slots[Loc_Slot].length != 0)
+    {
+        /* Check 1: Same PAN is already indexed */
+        if ((slots[Loc_Slot].key == panKey->key) && (slots[Loc_Slot].length == panKey->length))
+        {
+            return INDEX_DUPLICATE;
+        }
+
+        Loc_Slot = (Loc_Slot + 1) & Loc_Mask;
+    }
+
+    slots[Loc_Slot].key    = panKey->key;
+    slots[Loc_Slot].handle = handle;
+    slots[Loc_Slot].length = panKey->length;
+
+    return INDEX_OK;
+}
+
+/*
+ Name: panIndexGrow
+ Input: Pointer to index
+ Output: EN_indexError_t Error or No Error
+ Description: Static Function to double the index capacity and re-place all keys.
+*/
+static EN_indexError_t panIndexGrow(ST_panIndex_t *index)
+{
+    uint64_t Loc_Capacity = index->capacity << 1;
+    ST_panIndexSlot_t *Loc_Slots = calloc(Loc_Capacity, sizeof(ST_panIndexSlot_t));
+
+    /* Check 1: Allocation failed */
+    if (Loc_Slots == NULL)
+    {
+        return INDEX_NO_MEMORY;
+    }
+
+    /* Loop: Until the end of the old slots */
+    for (uint64_t Loc_Index = 0; Loc_Index < index->capacity; Loc_Index++)
+    {
+        if (index->slots[Loc_Index].length != 0)
+        {
+            ST_panKey_t Loc_Key = { index->slots[Loc_Index].key, index->slots[Loc_Index].length };
+            panIndexPlace(Loc_Slots, Loc_Capacity, &Loc_Key, index->slots[Loc_Index].handle);
+        }
+    }
+
+    free(index->slots);
+    index->slots    = Loc_Slots;
+    index->capacity = Loc_Capacity;
+
+    return INDEX_OK;
+}
+
+/*
+ Name: panIndexCreate
+ Input: Pointer to index, and uint64 expectedCount
+ Output: EN_indexError_t Error or No Error
+ Description: Function to create an empty index sized to hold expectedCount accounts without growing.
+*/
+EN_indexError_t panIndexCreate(ST_panIndex_t *index, uint64_t expectedCount)
+{
+    index->capacity  = panIndexCapacityFor(expectedCount);
+    index->count     = 0;
+    index->ownsSlots = 1;
+    index->slots     = calloc(index->capacity, sizeof(ST_panIndexSlot_t));
+
+    /* Check 1: Allocation failed */
+    if (index->slots == NULL)
+    {
+        index->capacity = 0;
+        return INDEX_NO_MEMORY;
+    }
+
+    return INDEX_OK;
+}
+
+/*
+ Name: panIndexAttach
+ Input: Pointer to index, Pointer to slots, uint64 capacity, and uint64 count
+ Output: void
+ Description: Function to use slots that were built earlier and live in memory the index does not own (e.g. a mapped file).
+              An attached index never reallocates its slots, an insert into a full one returns INDEX_FULL.
+*/
+void panIndexAttach(ST_panIndex_t *index, ST_panIndexSlot_t *slots, uint64_t capacity, uint64_t count)
+{
+    index->slots     = slots;
+    index->capacity  = capacity;
+    index->count     = count;
+    index->ownsSlots = 0;
+}
+
+/*
+ Name: panIndexDestroy
+ Input: Pointer to index
+ Output: void
+ Description: Function to release the index slots, if the index owns them.
+*/
+void panIndexDestroy(ST_panIndex_t *index)
+{
+    if (index->ownsSlots)
+    {
+        free(index->slots);
+    }
+
+    index->slots    = NULL;
+    index->capacity = 0;
+    index->count    = 0;
+}
+
+/*
+ Name: panIndexKey
+ Input: Pointer to PAN string, and Pointer to PAN key
+ Output: EN_indexError_t Error or No Error
+ Description: Function to convert a NUL terminated PAN of 1 to 19 digits into its integer key.
+*/
+EN_indexError_t panIndexKey(const uint8_t *primaryAccountNumber, ST_panKey_t *panKey)
+{
+    uint64_t Loc_Key = 0;
+    uint8_t  Loc_Length = 0;
+
+    /* Loop: Until the end of PAN */
+    while (primaryAccountNumber[Loc_Length] != '\0')
+    {
+        uint8_t Loc_Digit = primaryAccountNumber[Loc_Length] - '0';
+
+        /* Check 1: Not a digit, or too many digits */
+        if ((Loc_Digit > 9) || (Loc_Length == PAN_INDEX_MAX_DIGITS))
+        {
+            return INDEX_WRONG_PAN;
+        }
+
+        Loc_Key = (Loc_Key * 10) + Loc_Digit;
+        Loc_Length++;
+    }
+
+    /* Check 2: Empty PAN */
+    if (Loc_Length == 0)
+    {
+        return INDEX_WRONG_PAN;
+    }
+
+    panKey->key    = Loc_Key;
+    panKey->length = Loc_Length;
+
+    return INDEX_OK;
+}
+
+/*
+ Name: panIndexInsert
+ Input: Pointer to index, Pointer to PAN string, and uint32 handle
+ Output: EN_indexError_t Error or No Error
+ Description: Function to map a PAN to the position of its account in the account store.
+*/
+EN_indexError_t panIndexInsert(ST_panIndex_t *index, const uint8_t *primaryAccountNumber, uint32_t handle)
+{
+    ST_panKey_t Loc_Key;
+    EN_indexError_t Loc_ErrorState = panIndexKey(primaryAccountNumber, &Loc_Key);
+
+    /* Check 1: Index is at its max. load factor, grow it if it owns its slots */
+    if ((Loc_ErrorState == INDEX_OK) && ((index->count + 1) > (index->capacity / 4) * 3))
+    {
+        Loc_ErrorState = (index->ownsSlots) ? panIndexGrow(index) : INDEX_FULL;
+    }
+
+    if (Loc_ErrorState == INDEX_OK)
+    {
+        Loc_ErrorState = panIndexPlace(index->slots, index->capacity, &Loc_Key, handle);
+    }
+
+    if (Loc_ErrorState == INDEX_OK)
+    {
+        index->count++;
+    }
+
+    return Loc_ErrorState;
+}
+
+/*
+ Name: panIndexFind
+ Input: Pointer to index, Pointer to PAN string, and Pointer to uint32 handle
+ Output: EN_indexError_t Error or No Error
+ Description: Function to look up a PAN, and return the position of its account in the account store.
+*/
+EN_indexError_t panIndexFind(const ST_panIndex_t *index, const uint8_t *primaryAccountNumber, uint32_t *handle)
+{
+    ST_panKey_t Loc_Key;
+
+    /* Check 1: Not a valid PAN, so it can't be indexed */
+    if (panIndexKey(primaryAccountNumber, &Loc_Key) != INDEX_OK)
+    {
+        return INDEX_NOT_FOUND;
+    }
+
+    uint64_t Loc_Mask = index->capacity - 1;
+    uint64_t Loc_Slot = panIndexHash(&Loc_Key) & Loc_Mask;
+
+    /* Loop: Until the key or an empty slot is found */
+    while (index->slots[Loc_Slot].length != 0)
+    {
+        if ((index->slots[Loc_Slot].key == Loc_Key.key) && (index->slots[Loc_Slot].length == Loc_Key.length))
+        {
+            *handle = index->slots[Loc_Slot].handle;
+            return INDEX_OK;
+        }
+
+        Loc_Slot = (Loc_Slot + 1) & Loc_Mask;
+    }
+
+    return INDEX_NOT_FOUND;
+}
+
+/*
+ Name: panIndexFindBatch
+ Input: Pointer to index, Pointer to PAN keys array, uint32 count, and Pointer to handles array
+ Output: void
+ Description: Function to look up count PAN keys at once, a key with length 0 is never found.
+              All home slots are prefetched first, then probed, so the cache misses of the batch overlap
+              instead of being paid one after the other. A key that is not found gets PAN_INDEX_NO_HANDLE.
+*/
+void panIndexFindBatch(const ST_panIndex_t *index, const ST_panKey_t *panKeys, uint32_t count, uint32_t *handles)
+{
+    uint64_t Loc_Mask = index->capacity - 1;
+
+    /* Loop: Until the loads of all home slots are started */
+    for (uint32_t Loc_Index = 0; Loc_Index < count; Loc_Index++)
+    {
+        panIndexPrefetch(&index->slots[panIndexHash(&panKeys[Loc_Index]) & Loc_Mask]);
+    }
+
+    /* Loop: Until all keys are probed, rehashing is cheaper than the cache miss it follows */
+    for (uint32_t Loc_Index = 0; Loc_Index < count; Loc_Index++)
+    {
+        uint64_t Loc_Slot = panIndexHash(&panKeys[Loc_Index]) & Loc_Mask;
+
+        handles[Loc_Index] = PAN_INDEX_NO_HANDLE;
+
+        /* Check 1: Not a valid PAN key */
+        if (panKeys[Loc_Index].length == 0)
+        {
+            continue;
+        }
+
+        /* Loop: Until the key or an empty slot is found */
+        while (index->slots[Loc_Slot].length != 0)
+        {
+            if ((index->slots[Loc_Slot].key == panKeys[Loc_Index].key) && (index->slots[Loc_Slot].length == panKeys[Loc_Index].length))
+            {
+                handles[Loc_Index] = index->slots[Loc_Slot].handle;
+                break;
+            }
+
+            Loc_Slot = (Loc_Slot + 1) & Loc_Mask;
+        }
+    }
+}
@@ -0,0 +1,76 @@
+/**
+ * @Title      	: Index Module
+ * @Filename   	: index.h
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+#ifndef INDEX_H_
+#define INDEX_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Max. number of PAN digits that fit in the 64-bit key */
+#define PAN_INDEX_MAX_DIGITS		19
+/* Min. number of slots in an index */
+#define PAN_INDEX_MIN_CAPACITY		16
+/* Handle of a PAN that is not found by a batch lookup */
+#define PAN_INDEX_NO_HANDLE			0xFFFFFFFFUL
+
+/**************************************************************************************************************************************/
+/*
+* One slot of the open-addressing table, 16 bytes so four slots share a cache line.
+* A slot with length 0 is empty, so a zeroed table is an empty table.
+*/
+/**************************************************************************************************************************************/
+typedef struct ST_panIndexSlot_t
+{
+	uint64_t key;			/* PAN digits as an integer */
+	uint32_t handle;		/* Position of the account in the account store */
+	uint8_t  length;		/* Number of PAN digits, keeps "0123..." and "123..." apart */
+	uint8_t  reserved[3];
+}ST_panIndexSlot_t;
+
+typedef struct ST_panIndex_t
+{
+	ST_panIndexSlot_t *slots;
+	uint64_t capacity;		/* Always a power of two */
+	uint64_t count;
+	uint8_t  ownsSlots;		/* 0 if slots live in memory owned by someone else, e.g. a mapped file */
+}ST_panIndex_t;
+
+typedef struct ST_panKey_t
+{
+	uint64_t key;
+	uint8_t  length;
+}ST_panKey_t;
+
+typedef enum EN_indexError_t
+{
+	INDEX_OK, INDEX_WRONG_PAN, INDEX_NOT_FOUND, INDEX_DUPLICATE, INDEX_NO_MEMORY, INDEX_FULL
+}EN_indexError_t;
+
+/**************************************************************************************************************************************/
+/*
+*							Prototypes for all used functions inside the index module.
+*/
+/**************************************************************************************************************************************/
+uint64_t panIndexHash(const ST_panKey_t *panKey);
+uint64_t panIndexCapacityFor(uint64_t expectedCount);
+EN_indexError_t panIndexCreate(ST_panIndex_t *index, uint64_t expectedCount);
+void panIndexAttach(ST_panIndex_t *index, ST_panIndexSlot_t *slots, uint64_t capacity, uint64_t count);
+void panIndexDestroy(ST_panIndex_t *index);
+EN_indexError_t panIndexKey(const uint8_t *primaryAccountNumber, ST_panKey_t *panKey);
+EN_indexError_t panIndexInsert(ST_panIndex_t *index, const uint8_t *primaryAccountNumber, uint32_t handle);
+EN_indexError_t panIndexFind(const ST_panIndex_t *index, const uint8_t *primaryAccountNumber, uint32_t *handle);
+void panIndexFindBatch(const ST_panIndex_t *index, const ST_panKey_t *panKeys, uint32_t count, uint32_t *handles);
+
+#endif /* INDEX_H_ */
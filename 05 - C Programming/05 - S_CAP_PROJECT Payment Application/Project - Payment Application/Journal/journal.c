@@ -0,0 +1,869 @@
+/**
+ * @Title      	: Journal Module
+ * @Filename   	: journal.c
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+
+/* Journal Module */
+#include "journal.h"
+
+#include <stddef.h>
+
+/* Platform flush to disk, and 64-bit file offsets */
+#ifdef _WIN32
+#include <io.h>
+#define journalFileSeek(STREAM, OFFSET)	_fseeki64((STREAM), (__int64)(OFFSET), SEEK_SET)
+#define journalFileSeekEnd(STREAM)		_fseeki64((STREAM), 0, SEEK_END)
+#define journalFileTell(STREAM)			((uint64_t)_ftelli64(STREAM))
+#define journalFileSync(STREAM)			_commit(_fileno(STREAM))
+#define journalFileTruncate(STREAM, SIZE)	_chsize_s(_fileno(STREAM), (__int64)(SIZE))
+#else
+#include <sys/types.h>
+#include <unistd.h>
+#define journalFileSeek(STREAM, OFFSET)	fseeko((STREAM), (off_t)(OFFSET), SEEK_SET)
+#define journalFileSeekEnd(STREAM)		fseeko((STREAM), 0, SEEK_END)
+#define journalFileTell(STREAM)			((uint64_t)ftello(STREAM))
+#define journalFileSync(STREAM)			fsync(fileno(STREAM))
+#define journalFileTruncate(STREAM, SIZE)	ftruncate(fileno(STREAM), (off_t)(SIZE))
+#endif
+
+/* Max. number of records read from the file at once */
+#define JOURNAL_READ_CHUNK		64
+
+/*
+ Name: journalNow
+ Input: void
+ Output: uint64 time in nanoseconds
+ Description: Static Function to read the wall clock for the commit latency.
+*/
+static uint64_t journalNow(void)
+{
+    struct timespec Loc_Time;
+
+    timespec_get(&Loc_Time, TIME_UTC);
+
+    return ((uint64_t)Loc_Time.tv_sec * 1000000000ULL) + (uint64_t)Loc_Time.tv_nsec;
+}
+
+/*
+ Name: journalChecksum
+ Input: Pointer to record
+ Output: uint32 checksum
+ Description: Static Function to get the FNV-1a hash of the 4-byte words of a record before its checksum.
+*/
+static uint32_t journalChecksum(const ST_journalRecord_t *record)
+{
+    const uint8_t *Loc_Bytes = (const uint8_t *)record;
+    uint32_t Loc_Hash = 2166136261UL;
+
+    /* Loop: Until the checksum of the record */
+    for (uint32_t Loc_Index = 0; Loc_Index < offsetof(ST_journalRecord_t, checksum); Loc_Index += sizeof(uint32_t))
+    {
+        uint32_t Loc_Word;
+
+        memcpy(&Loc_Word, Loc_Bytes + Loc_Index, sizeof(uint32_t));
+        Loc_Hash ^= Loc_Word;
+        Loc_Hash *= 16777619UL;
+    }
+
+    return Loc_Hash;
+}
+
+/*
+ Name: journalOffset
+ Input: uint64 record
+ Output: uint64 offset in bytes
+ Description: Static Function to get the file offset of a record.
+*/
+static uint64_t journalOffset(uint64_t record)
+{
+    return sizeof(ST_journalHeader_t) + (record * sizeof(ST_journalRecord_t));
+}
+
+/*
+ Name: journalTextLength
+ Input: Pointer to text, and uint32 size
+ Output: uint32 length
+ Description: Static Function to get the length of a text in a field of size bytes, the whole field if it has no NUL.
+*/
+static uint32_t journalTextLength(const uint8_t *text, uint32_t size)
+{
+    const uint8_t *Loc_End = memchr(text, '\0', size);
+
+    return (Loc_End != NULL) ? (uint32_t)(Loc_End - text) : size;
+}
+
+/*
+ Name: journalDictionaryError
+ Input: EN_dictionaryError_t dictionary error
+ Output: EN_journalError_t journal error
+ Description: Static Function to report an error of the names dictionary as a journal error.
+*/
+static EN_journalError_t journalDictionaryError(EN_dictionaryError_t errorState)
+{
+    switch (errorState)
+    {
+    case DICTIONARY_OK:				return JOURNAL_OK;
+    case DICTIONARY_WRONG_FORMAT:	return JOURNAL_WRONG_FORMAT;
+    case DICTIONARY_NO_MEMORY:		return JOURNAL_NO_MEMORY;
+    default:						return JOURNAL_FILE_ERROR;
+    }
+}
+
+/*
+ Name: journalPackDates
+ Input: Pointer to transaction, and Pointer to dates
+ Output: uint8 1 if both dates have a packed form, else 0
+ Description: Static Function to pack the transaction date as its day number + 1 (high half), and the card expiry date
+              as its month number since 01/2000 + 1 (low half), an empty text is 0.
+              A text only has a packed form if it is read back as the same text, so e.g. "31/04/2024", or a year past
+              what 16 bits of day numbers reach, is kept as text instead.
+*/
+static uint8_t journalPackDates(const ST_transaction_t *transData, uint32_t *dates)
+{
+    const uint8_t *Loc_TransactionDate = transData->terminalData.transactionDate;
+    const uint8_t *Loc_ExpiryDate      = transData->cardHolderData.cardExpirationDate;
+    uint32_t Loc_DayNumber = 0;
+    uint32_t Loc_MonthNumber = 0;
+    date_t Loc_Date;
+
+    /* Check 1: Transaction date has no packed form */
+    if (Loc_TransactionDate[0] != '\0')
+    {
+        if ((journalTextLength(Loc_TransactionDate, sizeof(transData->terminalData.transactionDate)) ==
+             sizeof(transData->terminalData.transactionDate)) || (dateParse(Loc_TransactionDate, &Loc_Date) != DATE_OK))
+        {
+            return 0;
+        }
+
+        Loc_DayNumber = dateToDayNumber(Loc_Date);
+
+        if ((Loc_DayNumber >= 0xFFFF) || (dateFromDayNumber(Loc_DayNumber) != Loc_Date))
+        {
+            return 0;
+        }
+
+        Loc_DayNumber++;
+    }
+
+    /* Check 2: Expiry date has no packed form */
+    if (Loc_ExpiryDate[0] != '\0')
+    {
+        if ((journalTextLength(Loc_ExpiryDate, sizeof(transData->cardHolderData.cardExpirationDate)) ==
+             sizeof(transData->cardHolderData.cardExpirationDate)) || (dateParseExpiry(Loc_ExpiryDate, &Loc_Date) != DATE_OK))
+        {
+            return 0;
+        }
+
+        Loc_MonthNumber = ((DATE_YEAR(Loc_Date) - 2000U) * 12) + DATE_MONTH(Loc_Date);
+    }
+
+    *dates = (Loc_DayNumber << 16) | Loc_MonthNumber;
+
+    return 1;
+}
+
+/*
+ Name: journalUnpackText
+ Input: Pointer to journal, uint32 id, Pointer to text, and uint32 size
+ Output: void
+ Description: Static Function to copy the dictionary text of id into a NUL terminated field of size bytes.
+              An unknown id (a names file that was lost) leaves the field empty.
+*/
+static void journalUnpackText(const ST_journal_t *journal, uint32_t id, uint8_t *text, uint32_t size)
+{
+    const uint8_t *Loc_Text = dictionaryText(&journal->names, id);
+
+    if (Loc_Text != NULL)
+    {
+        memcpy(text, Loc_Text, (size < DICTIONARY_TEXT_SIZE) ? size : DICTIONARY_TEXT_SIZE);
+        text[size - 1] = '\0';
+    }
+}
+
+/*
+ Name: journalRecordDay
+ Input: Pointer to record
+ Output: uint32 transaction day number + 1, or 0 if the record has no packed transaction date
+ Description: Static Function to get the key of a record in the dates range index.
+*/
+static inline uint32_t journalRecordDay(const ST_journalRecord_t *record)
+{
+    return (record->flags & JOURNAL_DATES_IN_DICTIONARY) ? 0 : (record->dates >> 16);
+}
+
+/*
+ Name: journalReadRecords
+ Input: Pointer to journal, uint64 first, Pointer to records array, and uint32 count
+ Output: uint32 number of records read
+ Description: Static Function to read up to count packed records starting at position first, committed ones from the
+              file with one read, then pending ones from the buffer.
+*/
+static uint32_t journalReadRecords(ST_journal_t *journal, uint64_t first, ST_journalRecord_t *records, uint32_t count)
+{
+    uint32_t Loc_Read = 0;
+
+    /* Check 1: Some of the records are committed, read them from the file */
+    if (first < journal->committedCount)
+    {
+        Loc_Read = ((journal->committedCount - first) < count) ? (uint32_t)(journal->committedCount - first) : count;
+
+        if ((journalFileSeek(journal->file, journalOffset(first)) != 0) ||
+            (fread(records, sizeof(ST_journalRecord_t), Loc_Read, journal->file) != Loc_Read))
+        {
+            return 0;
+        }
+    }
+
+    /* Loop: Until all wanted pending records are copied from the buffer */
+    while ((Loc_Read < count) && ((first + Loc_Read) < journalCount(journal)))
+    {
+        records[Loc_Read] = journal->buffer[(first + Loc_Read) - journal->committedCount];
+        Loc_Read++;
+    }
+
+    return Loc_Read;
+}
+
+/*
+ Name: journalIndexDates
+ Input: Pointer to journal, and Pointer to dates file name
+ Output: EN_journalError_t Error or No Error
+ Description: Static Function to open the dates range index of a recovered log, and catch it up with the log.
+              1. Blocks of records the log lost with a torn tail are cut off the index.
+              2. The records after the last full block in the index file are read from the log and added again, so an
+                 index that is behind (or missing, as for a log written before it existed) is only built once.
+*/
+static EN_journalError_t journalIndexDates(ST_journal_t *journal, const char *datesFile)
+{
+    ST_journalRecord_t Loc_Records[JOURNAL_READ_CHUNK];
+    EN_rangeError_t Loc_RangeError = rangeOpen(&journal->dates, datesFile, 0);
+
+    /* Check 1: Index can't be opened, or is for another log, start it over */
+    if (Loc_RangeError == RANGE_WRONG_FORMAT)
+    {
+        Loc_RangeError = rangeOpen(&journal->dates, datesFile, 1);
+    }
+
+    if ((Loc_RangeError != RANGE_OK) || (rangeTruncate(&journal->dates, journal->committedCount) != RANGE_OK))
+    {
+        return (Loc_RangeError == RANGE_NO_MEMORY) ? JOURNAL_NO_MEMORY : JOURNAL_FILE_ERROR;
+    }
+
+    /* Loop: Until all records of the log are in the index */
+    while (journal->dates.count < journal->committedCount)
+    {
+        uint32_t Loc_Read = journalReadRecords(journal, journal->dates.count, Loc_Records, JOURNAL_READ_CHUNK);
+
+        if (Loc_Read == 0)
+        {
+            return JOURNAL_FILE_ERROR;
+        }
+
+        for (uint32_t Loc_Index = 0; Loc_Index < Loc_Read; Loc_Index++)
+        {
+            if (rangeAdd(&journal->dates, journalRecordDay(&Loc_Records[Loc_Index])) != RANGE_OK)
+            {
+                return JOURNAL_NO_MEMORY;
+            }
+        }
+    }
+
+    rangeSync(&journal->dates, journal->committedCount);
+
+    return JOURNAL_OK;
+}
+
+/*
+ Name: journalFlush
+ Input: Pointer to file
+ Output: EN_journalError_t Error or No Error
+ Description: Static Function to push the stdio buffer to the OS, then wait until the OS has written the file to disk.
+*/
+static EN_journalError_t journalFlush(FILE *file)
+{
+    if ((fflush(file) != 0) || (journalFileSync(file) != 0))
+    {
+        return JOURNAL_FILE_ERROR;
+    }
+
+    return JOURNAL_OK;
+}
+
+/*
+ Name: journalRecover
+ Input: Pointer to journal
+ Output: EN_journalError_t Error or No Error
+ Description: Static Function to validate an existing log, and find its last committed record.
+              Records at the end that were torn by a crash during a commit (partial, or failing their checksum) are cut off.
+              Only the end of the log is read, so opening does not depend on the number of records.
+*/
+static EN_journalError_t journalRecover(ST_journal_t *journal)
+{
+    ST_journalHeader_t Loc_Header;
+    ST_journalRecord_t Loc_Record;
+    uint64_t Loc_Size;
+    uint64_t Loc_Count;
+
+    /* Check 1: Not a transactions log */
+    if ((fread(&Loc_Header, sizeof(Loc_Header), 1, journal->file) != 1) ||
+        (Loc_Header.magic      != JOURNAL_MAGIC)   ||
+        (Loc_Header.version    != JOURNAL_VERSION) ||
+        (Loc_Header.recordSize != sizeof(ST_journalRecord_t)))
+    {
+        return JOURNAL_WRONG_FORMAT;
+    }
+
+    journalFileSeekEnd(journal->file);
+    Loc_Size  = journalFileTell(journal->file);
+    Loc_Count = (Loc_Size - sizeof(ST_journalHeader_t)) / sizeof(ST_journalRecord_t);
+
+    /* Loop: Until the last record passes its checksum */
+    while (Loc_Count > 0)
+    {
+        journalFileSeek(journal->file, journalOffset(Loc_Count - 1));
+
+        if ((fread(&Loc_Record, sizeof(Loc_Record), 1, journal->file) == 1) &&
+            (Loc_Record.checksum == journalChecksum(&Loc_Record)))
+        {
+            break;
+        }
+
+        Loc_Count--;
+    }
+
+    /* Check 2: Log has a torn tail, cut it off */
+    if ((journalOffset(Loc_Count) != Loc_Size) &&
+        ((fflush(journal->file) != 0) || (journalFileTruncate(journal->file, journalOffset(Loc_Count)) != 0)))
+    {
+        return JOURNAL_FILE_ERROR;
+    }
+
+    journal->committedCount     = Loc_Count;
+    journal->nextSequenceNumber = TRANSACTION_SEQ_START + (uint32_t)Loc_Count;
+
+    return JOURNAL_OK;
+}
+
+/*
+ Name: journalOpen
+ Input: Pointer to journal, and Pointer to journal config
+ Output: EN_journalError_t Error or No Error
+ Description: Function to open a transactions log, its names file and its dates index for appending, they are
+              created if the log doesn't exist.
+              Sequence numbers continue from the last committed record, or start at TRANSACTION_SEQ_START in a new log.
+*/
+EN_journalError_t journalOpen(ST_journal_t *journal, const ST_journalConfig_t *config)
+{
+    EN_journalError_t Loc_ErrorState = JOURNAL_OK;
+    char Loc_NamesFile[FILENAME_MAX];
+    char Loc_DatesFile[FILENAME_MAX];
+
+    memset(journal, 0, sizeof(ST_journal_t));
+    journal->batchSize          = (config->batchSize != 0) ? config->batchSize : JOURNAL_DEFAULT_BATCH_SIZE;
+    journal->commitLatencyNs    = 1000ULL * ((config->commitLatencyUs != 0) ? config->commitLatencyUs : JOURNAL_DEFAULT_COMMIT_LATENCY_US);
+    journal->nextSequenceNumber = TRANSACTION_SEQ_START;
+    journal->buffer             = malloc(journal->batchSize * sizeof(ST_journalRecord_t));
+
+    /* Check 1: Buffer can't be allocated, or the names or dates file name is too long */
+    if (journal->buffer == NULL)
+    {
+        return JOURNAL_NO_MEMORY;
+    }
+
+    if ((snprintf(Loc_NamesFile, sizeof(Loc_NamesFile), "%s%s", config->fileName, JOURNAL_NAMES_SUFFIX) >= (int)sizeof(Loc_NamesFile)) ||
+        (snprintf(Loc_DatesFile, sizeof(Loc_DatesFile), "%s%s", config->fileName, JOURNAL_DATES_SUFFIX) >= (int)sizeof(Loc_DatesFile)))
+    {
+        free(journal->buffer);
+        memset(journal, 0, sizeof(ST_journal_t));
+        return JOURNAL_FILE_ERROR;
+    }
+
+    journal->file = fopen(config->fileName, "r+b");
+
+    /* Check 2: Log exists, recover it, load its names and catch its dates index up */
+    if (journal->file != NULL)
+    {
+        Loc_ErrorState = journalRecover(journal);
+
+        if (Loc_ErrorState == JOURNAL_OK)
+        {
+            Loc_ErrorState = journalDictionaryError(dictionaryOpen(&journal->names, Loc_NamesFile, 0));
+        }
+
+        if (Loc_ErrorState == JOURNAL_OK)
+        {
+            Loc_ErrorState = journalIndexDates(journal, Loc_DatesFile);
+        }
+    }
+    /* Check 3: Log doesn't exist, create it with its header */
+    else
+    {
+        ST_journalHeader_t Loc_Header = { JOURNAL_MAGIC, JOURNAL_VERSION, sizeof(ST_journalRecord_t), 0 };
+
+        journal->file = fopen(config->fileName, "w+b");
+
+        if ((journal->file == NULL) || (fwrite(&Loc_Header, sizeof(Loc_Header), 1, journal->file) != 1))
+        {
+            Loc_ErrorState = JOURNAL_FILE_ERROR;
+        }
+        else
+        {
+            Loc_ErrorState = journalFlush(journal->file);
+        }
+
+        /* Names and dates of an older log with the same name are not used by this one */
+        if (Loc_ErrorState == JOURNAL_OK)
+        {
+            Loc_ErrorState = journalDictionaryError(dictionaryOpen(&journal->names, Loc_NamesFile, 1));
+        }
+
+        if ((Loc_ErrorState == JOURNAL_OK) && (rangeOpen(&journal->dates, Loc_DatesFile, 1) != RANGE_OK))
+        {
+            Loc_ErrorState = JOURNAL_FILE_ERROR;
+        }
+    }
+
+    /* Check 4: Log can't be used, release it */
+    if (Loc_ErrorState != JOURNAL_OK)
+    {
+        if (journal->file != NULL)
+        {
+            fclose(journal->file);
+        }
+
+        dictionaryClose(&journal->names);
+        rangeClose(&journal->dates);
+
+        free(journal->buffer);
+        memset(journal, 0, sizeof(ST_journal_t));
+    }
+
+    return Loc_ErrorState;
+}
+
+/*
+ Name: journalAppend
+ Input: Pointer to journal, and Pointer to transaction
+ Output: EN_journalError_t Error or No Error
+ Description: Function to give a transaction the next sequence number, and add it packed to the pending records.
+              The pending records are committed once there are batchSize of them, or the oldest is commitLatencyUs old.
+              The transaction is only on disk after that commit, or an explicit journalCommit().
+              If a triggered commit fails its records stay pending and are retried by the next append, poll or commit,
+              only a full buffer that still can't be committed returns JOURNAL_FILE_ERROR without appending.
+              A transaction whose texts can't be added to the names dictionary, or its date to the dates index,
+              returns JOURNAL_NO_MEMORY.
+*/
+EN_journalError_t journalAppend(ST_journal_t *journal, ST_transaction_t *transData)
+{
+    /* Check 1: Buffer is still full from a failed commit, retry it first */
+    if ((journal->pendingCount == journal->batchSize) && (journalCommit(journal) != JOURNAL_OK))
+    {
+        return JOURNAL_FILE_ERROR;
+    }
+
+    /* Check 2: First pending record, the commit latency starts now */
+    if (journal->pendingCount == 0)
+    {
+        journal->oldestPendingTime = journalNow();
+    }
+
+    /* Check 3: Transaction can't be packed, or indexed */
+    if ((journalPack(journal, transData, &journal->buffer[journal->pendingCount]) != JOURNAL_OK) ||
+        (rangeAdd(&journal->dates, journalRecordDay(&journal->buffer[journal->pendingCount])) != RANGE_OK))
+    {
+        return JOURNAL_NO_MEMORY;
+    }
+
+    transData->transactionSequenceNumber = journal->nextSequenceNumber++;
+    journal->pendingCount++;
+
+    /* Check 4: Batch is full, or the oldest pending record has waited long enough */
+    if (journal->pendingCount == journal->batchSize)
+    {
+        journalCommit(journal);
+    }
+    else
+    {
+        journalPoll(journal);
+    }
+
+    return JOURNAL_OK;
+}
+
+/*
+ Name: journalPoll
+ Input: Pointer to journal
+ Output: EN_journalError_t Error or No Error
+ Description: Function to commit the pending records if the oldest of them has waited for the commit latency.
+              Call it while no transactions arrive, so a partial batch doesn't wait for the next one.
+*/
+EN_journalError_t journalPoll(ST_journal_t *journal)
+{
+    /* Check 1: Oldest pending record has waited long enough */
+    if ((journal->pendingCount != 0) && ((journalNow() - journal->oldestPendingTime) >= journal->commitLatencyNs))
+    {
+        return journalCommit(journal);
+    }
+
+    return JOURNAL_OK;
+}
+
+/*
+ Name: journalCommit
+ Input: Pointer to journal
+ Output: EN_journalError_t Error or No Error
+ Description: Function to write all pending records to the end of the log with one write, and one flush to disk.
+              New names are written to the names file first, so a committed record never has a name that is lost.
+              The dates index blocks they fill are written after, with no flush of their own.
+              If it fails the records stay pending, and the next commit writes them again at the same place.
+*/
+EN_journalError_t journalCommit(ST_journal_t *journal)
+{
+    /* Check 1: Nothing to commit */
+    if (journal->pendingCount == 0)
+    {
+        return JOURNAL_OK;
+    }
+
+    /* Check 2: Names or records can't be written */
+    if ((dictionarySync(&journal->names) != DICTIONARY_OK) ||
+        (journalFileSeek(journal->file, journalOffset(journal->committedCount)) != 0) ||
+        (fwrite(journal->buffer, sizeof(ST_journalRecord_t), journal->pendingCount, journal->file) != journal->pendingCount) ||
+        (journalFlush(journal->file) != JOURNAL_OK))
+    {
+        return JOURNAL_FILE_ERROR;
+    }
+
+    journal->committedCount += journal->pendingCount;
+    journal->pendingCount    = 0;
+    journal->commitsCount++;
+
+    /* Index is rebuilt from the log if this write is lost */
+    rangeSync(&journal->dates, journal->committedCount);
+
+    return JOURNAL_OK;
+}
+
+/*
+ Name: journalClose
+ Input: Pointer to journal
+ Output: EN_journalError_t Error or No Error
+ Description: Function to commit the pending records, and close the log, its names file and its dates index.
+*/
+EN_journalError_t journalClose(ST_journal_t *journal)
+{
+    EN_journalError_t Loc_ErrorState;
+
+    /* Check 1: Journal is not open */
+    if (journal->file == NULL)
+    {
+        return JOURNAL_OK;
+    }
+
+    Loc_ErrorState = journalCommit(journal);
+
+    fclose(journal->file);
+    dictionaryClose(&journal->names);
+    rangeClose(&journal->dates);
+    free(journal->buffer);
+    memset(journal, 0, sizeof(ST_journal_t));
+
+    return Loc_ErrorState;
+}
+
+/*
+ Name: journalCount
+ Input: Pointer to journal
+ Output: uint64 count
+ Description: Function to get the number of transactions in the log, pending ones included.
+*/
+uint64_t journalCount(const ST_journal_t *journal)
+{
+    return journal->committedCount + journal->pendingCount;
+}
+
+/*
+ Name: journalRead
+ Input: Pointer to journal, uint64 first, Pointer to transactions array, and uint32 count
+ Output: uint32 number of transactions read
+ Description: Function to read up to count transactions starting at position first, pending ones included.
+*/
+uint32_t journalRead(ST_journal_t *journal, uint64_t first, ST_transaction_t *transactions, uint32_t count)
+{
+    ST_journalRecord_t Loc_Records[JOURNAL_READ_CHUNK];
+    uint32_t Loc_Read = 0;
+
+    /* Loop: Until all wanted records are read, a chunk at a time */
+    while (Loc_Read < count)
+    {
+        uint32_t Loc_Chunk = ((count - Loc_Read) < JOURNAL_READ_CHUNK) ? (count - Loc_Read) : JOURNAL_READ_CHUNK;
+        uint32_t Loc_Got   = journalReadRecords(journal, first + Loc_Read, Loc_Records, Loc_Chunk);
+
+        for (uint32_t Loc_Index = 0; Loc_Index < Loc_Got; Loc_Index++, Loc_Read++)
+        {
+            journalUnpack(journal, &Loc_Records[Loc_Index], first + Loc_Read, &transactions[Loc_Read]);
+        }
+
+        /* End of the log, or it can't be read */
+        if (Loc_Got != Loc_Chunk)
+        {
+            break;
+        }
+    }
+
+    return Loc_Read;
+}
+
+/*
+ Name: journalFindDates
+ Input: Pointer to journal, date_t fromDate, date_t toDate, Pointer to uint64 cursor, Pointer to transactions array,
+        and uint32 count
+ Output: uint32 number of transactions found
+ Description: Function to find one page of transactions with a transaction date from fromDate to toDate (both
+              included), pending ones included, in log order.
+              1. The search starts at position *cursor (0 for the first page), and *cursor is set to where the next
+                 page starts, journalCount() once there are no more.
+              2. Only the blocks of records the dates index has in the range are read, so a page costs O(log n) plus
+                 the transactions found, not a pass over the log.
+              3. A transaction date that has no packed form (kept as text) is never found.
+              4. A fromDate before DATE_EPOCH (DATE_NONE included) has no day number, and a toDate before fromDate is
+                 an empty range, both find nothing and set *cursor to journalCount().
+*/
+uint32_t journalFindDates(ST_journal_t *journal, date_t fromDate, date_t toDate, uint64_t *cursor, ST_transaction_t *transactions, uint32_t count)
+{
+    ST_journalRecord_t Loc_Records[JOURNAL_READ_CHUNK];
+    uint32_t Loc_FromKey;
+    uint32_t Loc_ToKey;
+    uint64_t Loc_Position = *cursor;
+    uint32_t Loc_Found = 0;
+
+    /* Check 1: Range starts before the first day number, or ends before it starts */
+    if ((fromDate < DATE_EPOCH) || (toDate < fromDate))
+    {
+        *cursor = journalCount(journal);
+        return 0;
+    }
+
+    Loc_FromKey = dateToDayNumber(fromDate) + 1;
+    Loc_ToKey   = dateToDayNumber(toDate) + 1;
+
+    /* Loop: Until the page is full, or no block is left in the range */
+    while ((Loc_Found < count) &&
+           ((Loc_Position = rangeFind(&journal->dates, Loc_FromKey, Loc_ToKey, Loc_Position)) < journalCount(journal)))
+    {
+        uint64_t Loc_BlockEnd = (Loc_Position | (RANGE_BLOCK_RECORDS - 1)) + 1;
+
+        if (Loc_BlockEnd > journalCount(journal))
+        {
+            Loc_BlockEnd = journalCount(journal);
+        }
+
+        /* Loop: Until the end of the block, a chunk at a time */
+        while ((Loc_Found < count) && (Loc_Position < Loc_BlockEnd))
+        {
+            uint32_t Loc_Chunk = ((Loc_BlockEnd - Loc_Position) < JOURNAL_READ_CHUNK) ? (uint32_t)(Loc_BlockEnd - Loc_Position) : JOURNAL_READ_CHUNK;
+
+            /* Check 2: Log can't be read, the page ends here */
+            if (journalReadRecords(journal, Loc_Position, Loc_Records, Loc_Chunk) != Loc_Chunk)
+            {
+                *cursor = Loc_Position;
+                return Loc_Found;
+            }
+
+            for (uint32_t Loc_Index = 0; (Loc_Index < Loc_Chunk) && (Loc_Found < count); Loc_Index++, Loc_Position++)
+            {
+                uint32_t Loc_Key = journalRecordDay(&Loc_Records[Loc_Index]);
+
+                if ((Loc_Key >= Loc_FromKey) && (Loc_Key <= Loc_ToKey))
+                {
+                    journalUnpack(journal, &Loc_Records[Loc_Index], Loc_Position, &transactions[Loc_Found++]);
+                }
+            }
+        }
+    }
+
+    *cursor = (Loc_Position < journalCount(journal)) ? Loc_Position : journalCount(journal);
+
+    return Loc_Found;
+}
+
+/*
+ Name: journalPack
+ Input: Pointer to journal, Pointer to transaction, and Pointer to record
+ Output: EN_journalError_t Error or No Error
+ Description: Function to pack a transaction into a record, with its checksum.
+              1. The card holder name is added to the names dictionary if it is new, as are a PAN that isn't 1 to 19
+                 digits, and dates that have no packed form.
+              2. The sequence number is not packed, journalUnpack gets it from the position of the record.
+              3. If a text can't be added returns JOURNAL_NO_MEMORY, else will return JOURNAL_OK.
+*/
+EN_journalError_t journalPack(ST_journal_t *journal, const ST_transaction_t *transData, ST_journalRecord_t *record)
+{
+    const uint8_t *Loc_Name = transData->cardHolderData.cardHolderName;
+    const uint8_t *Loc_Pan  = transData->cardHolderData.primaryAccountNumber;
+    uint32_t Loc_PanLength  = journalTextLength(Loc_Pan, sizeof(transData->cardHolderData.primaryAccountNumber));
+    ST_panKey_t Loc_PanKey;
+
+    memset(record, 0, sizeof(ST_journalRecord_t));
+    record->transAmount    = transData->terminalData.transAmount;
+    record->maxTransAmount = transData->terminalData.maxTransAmount;
+    record->transState     = (uint8_t)transData->transState;
+
+    /* Stage 1: Card holder name */
+    if (dictionaryIntern(&journal->names, Loc_Name, journalTextLength(Loc_Name, sizeof(transData->cardHolderData.cardHolderName)),
+                         &record->cardHolderName) != DICTIONARY_OK)
+    {
+        return JOURNAL_NO_MEMORY;
+    }
+
+    /* Stage 2: PAN, as its digits if it is only digits */
+    if ((Loc_PanLength < sizeof(transData->cardHolderData.primaryAccountNumber)) && (panIndexKey(Loc_Pan, &Loc_PanKey) == INDEX_OK))
+    {
+        record->primaryAccountNumber       = Loc_PanKey.key;
+        record->primaryAccountNumberLength = Loc_PanKey.length;
+    }
+    else if (Loc_PanLength != 0)
+    {
+        uint32_t Loc_Id;
+
+        if (dictionaryIntern(&journal->names, Loc_Pan, Loc_PanLength, &Loc_Id) != DICTIONARY_OK)
+        {
+            return JOURNAL_NO_MEMORY;
+        }
+
+        record->primaryAccountNumber = Loc_Id;
+        record->flags |= JOURNAL_PAN_IN_DICTIONARY;
+    }
+
+    /* Stage 3: Dates, both texts side by side in one dictionary entry if either has no packed form */
+    if (journalPackDates(transData, &record->dates) == 0)
+    {
+        uint8_t Loc_Texts[sizeof(transData->terminalData.transactionDate) + sizeof(transData->cardHolderData.cardExpirationDate)] = { 0 };
+
+        memcpy(Loc_Texts, transData->terminalData.transactionDate, sizeof(transData->terminalData.transactionDate));
+        memcpy(Loc_Texts + sizeof(transData->terminalData.transactionDate), transData->cardHolderData.cardExpirationDate,
+               sizeof(transData->cardHolderData.cardExpirationDate));
+
+        if (dictionaryIntern(&journal->names, Loc_Texts, sizeof(Loc_Texts) - 1, &record->dates) != DICTIONARY_OK)
+        {
+            return JOURNAL_NO_MEMORY;
+        }
+
+        record->flags |= JOURNAL_DATES_IN_DICTIONARY;
+    }
+
+    record->checksum = journalChecksum(record);
+
+    return JOURNAL_OK;
+}
+
+/*
+ Name: journalUnpack
+ Input: Pointer to journal, Pointer to record, uint64 position, and Pointer to transaction
+ Output: void
+ Description: Function to unpack the record at a position of the log into a transaction, texts and packed dates both.
+*/
+void journalUnpack(const ST_journal_t *journal, const ST_journalRecord_t *record, uint64_t position, ST_transaction_t *transData)
+{
+    ST_cardData_t *Loc_Card         = &transData->cardHolderData;
+    ST_terminalData_t *Loc_Terminal = &transData->terminalData;
+
+    memset(transData, 0, sizeof(ST_transaction_t));
+    Loc_Terminal->transAmount            = record->transAmount;
+    Loc_Terminal->maxTransAmount         = record->maxTransAmount;
+    transData->transState                = (EN_transState_t)record->transState;
+    transData->transactionSequenceNumber = TRANSACTION_SEQ_START + (uint32_t)position;
+
+    journalUnpackText(journal, record->cardHolderName, Loc_Card->cardHolderName, sizeof(Loc_Card->cardHolderName));
+
+    /* Check 1: PAN is a dictionary text, or its digits with leading zeros */
+    if (record->flags & JOURNAL_PAN_IN_DICTIONARY)
+    {
+        journalUnpackText(journal, (uint32_t)record->primaryAccountNumber, Loc_Card->primaryAccountNumber, sizeof(Loc_Card->primaryAccountNumber));
+    }
+    else
+    {
+        uint64_t Loc_Key = record->primaryAccountNumber;
+
+        /* Loop: Until all digits are written, from the last one */
+        for (uint8_t Loc_Index = record->primaryAccountNumberLength; Loc_Index > 0; Loc_Index--)
+        {
+            Loc_Card->primaryAccountNumber[Loc_Index - 1] = (uint8_t)('0' + (Loc_Key % 10));
+            Loc_Key /= 10;
+        }
+    }
+
+    /* Check 2: Dates are dictionary texts, or day and month numbers */
+    if (record->flags & JOURNAL_DATES_IN_DICTIONARY)
+    {
+        const uint8_t *Loc_Texts = dictionaryText(&journal->names, record->dates);
+
+        if (Loc_Texts != NULL)
+        {
+            memcpy(Loc_Terminal->transactionDate, Loc_Texts, sizeof(Loc_Terminal->transactionDate));
+            memcpy(Loc_Card->cardExpirationDate, Loc_Texts + sizeof(Loc_Terminal->transactionDate), sizeof(Loc_Card->cardExpirationDate));
+            Loc_Terminal->transactionDate[sizeof(Loc_Terminal->transactionDate) - 1] = '\0';
+            Loc_Card->cardExpirationDate[sizeof(Loc_Card->cardExpirationDate) - 1]   = '\0';
+        }
+
+        dateParse(Loc_Terminal->transactionDate, &Loc_Terminal->packedTransactionDate);
+        dateParseExpiry(Loc_Card->cardExpirationDate, &Loc_Card->packedExpirationDate);
+    }
+    else
+    {
+        uint32_t Loc_DayNumber   = record->dates >> 16;
+        uint32_t Loc_MonthNumber = record->dates & 0xFFFF;
+
+        if (Loc_DayNumber != 0)
+        {
+            Loc_Terminal->packedTransactionDate = dateFromDayNumber(Loc_DayNumber - 1);
+            dateFormat(Loc_Terminal->packedTransactionDate, Loc_Terminal->transactionDate);
+        }
+
+        if (Loc_MonthNumber != 0)
+        {
+            uint32_t Loc_Month = ((Loc_MonthNumber - 1) % 12) + 1;
+            uint32_t Loc_Year  = (Loc_MonthNumber - 1) / 12;
+
+            Loc_Card->cardExpirationDate[0] = (uint8_t)('0' + (Loc_Month / 10));
+            Loc_Card->cardExpirationDate[1] = (uint8_t)('0' + (Loc_Month % 10));
+            Loc_Card->cardExpirationDate[2] = '/';
+            Loc_Card->cardExpirationDate[3] = (uint8_t)('0' + (Loc_Year / 10));
+            Loc_Card->cardExpirationDate[4] = (uint8_t)('0' + (Loc_Year % 10));
+            Loc_Card->packedExpirationDate  = DATE_PACK(2000 + Loc_Year, Loc_Month, 31);
+        }
+    }
+}
+
+/*
+ Name: journalRemove
+ Input: Pointer to file name
+ Output: EN_journalError_t Error or No Error
+ Description: Function to delete a closed transactions log, its names file and its dates index.
+              Returns JOURNAL_FILE_ERROR if the log can't be deleted (e.g. it doesn't exist).
+*/
+EN_journalError_t journalRemove(const char *fileName)
+{
+    char Loc_NamesFile[FILENAME_MAX];
+
+    if (snprintf(Loc_NamesFile, sizeof(Loc_NamesFile), "%s%s", fileName, JOURNAL_NAMES_SUFFIX) < (int)sizeof(Loc_NamesFile))
+    {
+        remove(Loc_NamesFile);
+    }
+
+    if (snprintf(Loc_NamesFile, sizeof(Loc_NamesFile), "%s%s", fileName, JOURNAL_DATES_SUFFIX) < (int)sizeof(Loc_NamesFile))
+    {
+        remove(Loc_NamesFile);
+    }
+
+    return (remove(fileName) == 0) ? JOURNAL_OK : JOURNAL_FILE_ERROR;
+}
@@ -0,0 +1,146 @@
+/**
+ * @Title      	: Journal Module
+ * @Filename   	: journal.h
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+#ifndef JOURNAL_H_
+#define JOURNAL_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../Card/card.h"
+#include "../Terminal/terminal.h"
+#include "../Date/date.h"
+#include "../Index/index.h"
+#include "../Dictionary/dictionary.h"
+#include "../Range/range.h"
+
+/* Transactions log signature "JRNL", and format version */
+#define JOURNAL_MAGIC						0x4C4E524AUL
+#define JOURNAL_VERSION						4
+/* Sequence number of the first transaction in a new log */
+#define TRANSACTION_SEQ_START				32500
+/* Default number of pending transactions that triggers a commit */
+#define JOURNAL_DEFAULT_BATCH_SIZE			64
+/* Default max. time a transaction waits in the buffer before it is committed */
+#define JOURNAL_DEFAULT_COMMIT_LATENCY_US	2000
+/* Suffix of the file of card holder names (and other texts) next to a log */
+#define JOURNAL_NAMES_SUFFIX				".names"
+/* Suffix of the file of the range index of transaction dates next to a log */
+#define JOURNAL_DATES_SUFFIX				".dates"
+/* Record flags, a text that has no packed form is kept in the names dictionary */
+#define JOURNAL_PAN_IN_DICTIONARY			0x01
+#define JOURNAL_DATES_IN_DICTIONARY			0x02
+
+typedef enum EN_transState_t
+{
+    APPROVED, DECLINED_INSUFFECIENT_FUND, DECLINED_STOLEN_CARD, FRAUD_CARD, INTERNAL_SERVER_ERROR, DECLINED_VELOCITY
+}EN_transState_t;
+
+typedef struct ST_transaction_t
+{
+    ST_cardData_t cardHolderData;
+    ST_terminalData_t terminalData;
+    EN_transState_t transState;
+    uint32_t transactionSequenceNumber;
+}ST_transaction_t;
+
+/**************************************************************************************************************************************/
+/*
+* Transactions log layout, records are only ever appended:
+*	| ST_journalHeader_t | ST_journalRecord_t | ST_journalRecord_t | ...
+* A record is on disk once the commit that wrote it returns. A torn record at the end of the log (crash during a commit)
+* fails its checksum, and is cut off when the log is opened again.
+* A record is a transaction packed to 40 bytes: the PAN digits as an integer, dates as day and month numbers, and the
+* card holder name as an id in the names dictionary (file "<log>.names"), which keeps each name once.
+* The sequence number is not stored, it is TRANSACTION_SEQ_START + the position of the record, so a range of sequence
+* numbers is a range of positions. Transaction dates are found through a range index of the transaction day of the
+* records (file "<log>.dates", see range.h), a record with no packed transaction date has key 0.
+*/
+/**************************************************************************************************************************************/
+typedef struct ST_journalHeader_t
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t recordSize;		/* sizeof(ST_journalRecord_t) the log was written with */
+    uint32_t reserved;
+}ST_journalHeader_t;
+
+typedef struct ST_journalRecord_t
+{
+    uint64_t primaryAccountNumber;		/* PAN digits as an integer, or its dictionary id if JOURNAL_PAN_IN_DICTIONARY */
+    money_t transAmount;
+    money_t maxTransAmount;
+    uint32_t cardHolderName;			/* Dictionary id */
+    uint32_t dates;						/* Transaction day number + 1 << 16 | expiry month number + 1, 0 for no text,
+										   or the dictionary id of both texts if JOURNAL_DATES_IN_DICTIONARY */
+    uint8_t primaryAccountNumberLength;	/* Number of PAN digits, keeps "0123..." and "123..." apart */
+    uint8_t transState;
+    uint8_t flags;
+    uint8_t reserved;
+    uint32_t checksum;					/* FNV-1a of the record words before it */
+}ST_journalRecord_t;
+
+typedef struct ST_journalConfig_t
+{
+    const char *fileName;
+    uint32_t batchSize;			/* Commit once this many transactions are pending, 0 for JOURNAL_DEFAULT_BATCH_SIZE */
+    uint32_t commitLatencyUs;	/* Commit once the oldest pending transaction is this old, 0 for JOURNAL_DEFAULT_COMMIT_LATENCY_US */
+}ST_journalConfig_t;
+
+/**************************************************************************************************************************************/
+/*
+* Buffered log writer, owned by a single thread.
+* Appended records wait in the buffer, and a commit writes all of them with one write and one flush to disk (group commit).
+*/
+/**************************************************************************************************************************************/
+typedef struct ST_journal_t
+{
+    FILE *file;
+    ST_journalRecord_t *buffer;			/* Pending records, batchSize of them at most */
+    uint32_t pendingCount;
+    uint32_t batchSize;
+    uint64_t commitLatencyNs;
+    uint64_t oldestPendingTime;			/* Time the first pending record was appended, in nanoseconds */
+    uint64_t committedCount;			/* Records on disk */
+    uint64_t commitsCount;				/* Flushes to disk so far */
+    uint32_t nextSequenceNumber;
+    ST_dictionary_t names;				/* Texts of the records, synced before the records that use them */
+    ST_rangeIndex_t dates;				/* Transaction day number + 1 of the records, synced after them */
+}ST_journal_t;
+
+typedef enum EN_journalError_t
+{
+    JOURNAL_OK, JOURNAL_FILE_ERROR, JOURNAL_WRONG_FORMAT, JOURNAL_NO_MEMORY
+}EN_journalError_t;
+
+/**************************************************************************************************************************************/
+/*
+*							Prototypes for all used functions inside the journal module.
+*/
+/**************************************************************************************************************************************/
+EN_journalError_t journalOpen(ST_journal_t *journal, const ST_journalConfig_t *config);
+EN_journalError_t journalAppend(ST_journal_t *journal, ST_transaction_t *transData);
+EN_journalError_t journalPoll(ST_journal_t *journal);
+EN_journalError_t journalCommit(ST_journal_t *journal);
+EN_journalError_t journalClose(ST_journal_t *journal);
+uint64_t journalCount(const ST_journal_t *journal);
+uint32_t journalRead(ST_journal_t *journal, uint64_t first, ST_transaction_t *transactions, uint32_t count);
+uint32_t journalFindDates(ST_journal_t *journal, date_t fromDate, date_t toDate, uint64_t *cursor, ST_transaction_t *transactions, uint32_t count);
+EN_journalError_t journalPack(ST_journal_t *journal, const ST_transaction_t *transData, ST_journalRecord_t *record);
+void journalUnpack(const ST_journal_t *journal, const ST_journalRecord_t *record, uint64_t position, ST_transaction_t *transData);
+EN_journalError_t journalRemove(const char *fileName);
+
+#endif /* JOURNAL_H_ */
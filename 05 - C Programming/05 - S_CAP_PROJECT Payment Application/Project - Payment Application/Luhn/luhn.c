@@ -0,0 +1,335 @@
+/**
+ * @Title      	: Luhn Module
+ * @Filename   	: luhn.c
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+
+/* Luhn Module */
+#include "luhn.h"
+
+/* SIMD kernels, x86 with GCC only. They are compiled for their instruction set, and only run if the CPU has it */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define LUHN_X86					1
+#else
+#define LUHN_X86					0
+#endif
+
+/* Doubled digit with its two digits added (7 -> 14 -> 5), for digits 0 to 9 */
+static const uint8_t Glb_DoubledDigits[16] = { 0, 2, 4, 6, 8, 1, 3, 5, 7, 9, 0, 0, 0, 0, 0, 0 };
+
+/* Kernel names, in EN_luhnKernel_t order */
+static const char *Glb_KernelNames[LUHN_KERNELS_COUNT] = { "scalar", "SSSE3", "AVX2" };
+
+/* Best kernel of this CPU, LUHN_KERNELS_COUNT until it is found */
+static EN_luhnKernel_t Glb_BestKernel = LUHN_KERNELS_COUNT;
+
+/* Kernels this CPU can run, bit n for kernel n, 0 until they are found */
+static uint32_t Glb_SupportedKernels = 0;
+
+/*
+ Name: luhnCheckScalar
+ Input: Pointer to PAN
+ Output: uint8 1 if the PAN is a Luhn number, else 0
+ Description: Static Function to check one PAN a digit at a time, from its last digit.
+              A PAN with no digits, or with a non digit before its NUL is not a Luhn number.
+*/
+static uint8_t luhnCheckScalar(const uint8_t *pan)
+{
+    uint32_t Loc_Length = 0;
+    uint32_t Loc_Sum = 0;
+
+    /* Loop: Until the first NUL */
+    while ((Loc_Length < LUHN_PAN_SIZE) && (pan[Loc_Length] != '\0'))
+    {
+        Loc_Length++;
+    }
+
+    /* Loop: Until the first digit, every second digit from the last one is doubled */
+    for (uint32_t Loc_Index = 0; Loc_Index < Loc_Length; Loc_Index++)
+    {
+        uint8_t Loc_Digit = (uint8_t)(pan[Loc_Length - 1 - Loc_Index] - '0');
+
+        if (Loc_Digit > 9)
+        {
+            return 0;
+        }
+
+        Loc_Sum += (Loc_Index & 1) ? Glb_DoubledDigits[Loc_Digit] : Loc_Digit;
+    }
+
+    return (Loc_Length != 0) && ((Loc_Sum % 10) == 0);
+}
+
+#if LUHN_X86
+/*
+ Name: luhnCheckSsse3
+ Input: Pointer to PAN
+ Output: uint8 1 if the PAN is a Luhn number, else 0
+ Description: Static Function to check one PAN with 16-byte vectors, no branch per digit.
+              1. The PAN is loaded as a head of bytes 0 to 15, and a tail of bytes 16 to 19.
+              2. Its length is the first NUL, and every byte past it is masked out.
+              3. The digits doubled are the ones with an index of the same parity as the length, they are looked up in
+                 Glb_DoubledDigits with one shuffle.
+              4. The digits are added with one sum of absolute differences.
+*/
+__attribute__((target("ssse3")))
+static inline uint8_t luhnCheckSsse3(const uint8_t *pan)
+{
+    const __m128i Loc_Zero       = _mm_setzero_si128();
+    const __m128i Loc_HeadIndex  = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m128i Loc_TailIndex  = _mm_setr_epi8(16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31);
+    uint32_t Loc_TailBytes;
+    uint32_t Loc_Nul;
+    uint32_t Loc_Length;
+
+    memcpy(&Loc_TailBytes, pan + 16, sizeof(Loc_TailBytes));
+
+    __m128i Loc_Head = _mm_loadu_si128((const __m128i *)pan);
+    __m128i Loc_Tail = _mm_cvtsi32_si128((int)Loc_TailBytes);
+
+    /* Step 1: Length, the padding past the tail is zero so a 20 digits PAN stops at 20 */
+    Loc_Nul = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(Loc_Head, Loc_Zero)) |
+              ((uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(Loc_Tail, Loc_Zero)) << 16);
+    Loc_Length = (uint32_t)__builtin_ctz(Loc_Nul);
+
+    __m128i Loc_Length8  = _mm_set1_epi8((char)Loc_Length);
+    __m128i Loc_InHead   = _mm_cmpgt_epi8(Loc_Length8, Loc_HeadIndex);
+    __m128i Loc_InTail   = _mm_cmpgt_epi8(Loc_Length8, Loc_TailIndex);
+    __m128i Loc_HeadDigits = _mm_sub_epi8(Loc_Head, _mm_set1_epi8('0'));
+    __m128i Loc_TailDigits = _mm_sub_epi8(Loc_Tail, _mm_set1_epi8('0'));
+
+    /* Step 2: Non digits inside the PAN, a digit is unchanged by min(digit, 9) */
+    __m128i Loc_Bad = _mm_or_si128(
+            _mm_andnot_si128(_mm_cmpeq_epi8(_mm_min_epu8(Loc_HeadDigits, _mm_set1_epi8(9)), Loc_HeadDigits), Loc_InHead),
+            _mm_andnot_si128(_mm_cmpeq_epi8(_mm_min_epu8(Loc_TailDigits, _mm_set1_epi8(9)), Loc_TailDigits), Loc_InTail));
+
+    /* Step 3: Double every second digit from the last one */
+    __m128i Loc_Table   = _mm_loadu_si128((const __m128i *)Glb_DoubledDigits);
+    __m128i Loc_Doubled = _mm_set1_epi16((Loc_Length & 1) ? (short)0xFF00 : (short)0x00FF);
+
+    Loc_HeadDigits = _mm_or_si128(_mm_andnot_si128(Loc_Doubled, Loc_HeadDigits),
+                                  _mm_and_si128(Loc_Doubled, _mm_shuffle_epi8(Loc_Table, Loc_HeadDigits)));
+    Loc_TailDigits = _mm_or_si128(_mm_andnot_si128(Loc_Doubled, Loc_TailDigits),
+                                  _mm_and_si128(Loc_Doubled, _mm_shuffle_epi8(Loc_Table, Loc_TailDigits)));
+
+    /* Step 4: Add up the digits inside the PAN, each byte is 18 at most so head + tail doesn't overflow */
+    __m128i Loc_Sums = _mm_sad_epu8(_mm_add_epi8(_mm_and_si128(Loc_HeadDigits, Loc_InHead),
+                                                 _mm_and_si128(Loc_TailDigits, Loc_InTail)), Loc_Zero);
+    uint32_t Loc_Sum = (uint32_t)_mm_cvtsi128_si32(Loc_Sums) + (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(Loc_Sums, 8));
+
+    return (Loc_Length != 0) && (_mm_movemask_epi8(Loc_Bad) == 0) && ((Loc_Sum % 10) == 0);
+}
+
+/*
+ Name: luhnCheckBatchSsse3
+ Input: Pointer to first PAN, uint32 stride, uint32 count, and Pointer to valid array
+ Output: void
+ Description: Static Function to run the SSSE3 kernel over count PANs.
+*/
+__attribute__((target("ssse3")))
+static void luhnCheckBatchSsse3(const uint8_t *pans, uint32_t stride, uint32_t count, uint8_t *valid)
+{
+    for (uint32_t Loc_Index = 0; Loc_Index < count; Loc_Index++)
+    {
+        valid[Loc_Index] = luhnCheckSsse3(pans + ((uint64_t)Loc_Index * stride));
+    }
+}
+
+/*
+ Name: luhnCheckBatchAvx2
+ Input: Pointer to first PAN, uint32 stride, uint32 count, and Pointer to valid array
+ Output: void
+ Description: Static Function to check two PANs per 32-byte vector, one in each 16-byte lane, with the same steps as
+              luhnCheckSsse3. Lane shuffles and sums of absolute differences stay inside their lane, so the two PANs
+              never mix. The last odd PAN is checked with the SSSE3 kernel.
+*/
+__attribute__((target("avx2")))
+static void luhnCheckBatchAvx2(const uint8_t *pans, uint32_t stride, uint32_t count, uint8_t *valid)
+{
+    const __m256i Loc_Zero      = _mm256_setzero_si256();
+    const __m256i Loc_CharZero  = _mm256_set1_epi8('0');
+    const __m256i Loc_Nine      = _mm256_set1_epi8(9);
+    const __m256i Loc_Table     = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)Glb_DoubledDigits));
+    const __m256i Loc_HeadIndex = _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+                                                   0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m256i Loc_TailIndex = _mm256_setr_epi8(16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+                                                   16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31);
+    uint32_t Loc_Index = 0;
+
+    /* Loop: Until less than two PANs are left */
+    for (; (Loc_Index + 2) <= count; Loc_Index += 2)
+    {
+        const uint8_t *Loc_First  = pans + ((uint64_t)Loc_Index * stride);
+        const uint8_t *Loc_Second = Loc_First + stride;
+        uint32_t Loc_FirstTail;
+        uint32_t Loc_SecondTail;
+
+        memcpy(&Loc_FirstTail, Loc_First + 16, sizeof(Loc_FirstTail));
+        memcpy(&Loc_SecondTail, Loc_Second + 16, sizeof(Loc_SecondTail));
+
+        __m256i Loc_Head = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)Loc_First)),
+                                                   _mm_loadu_si128((const __m128i *)Loc_Second), 1);
+        __m256i Loc_Tail = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_cvtsi32_si128((int)Loc_FirstTail)),
+                                                   _mm_cvtsi32_si128((int)Loc_SecondTail), 1);
+
+        /* Step 1: Lengths, bits 0 to 15 of each mask are the first PAN, bits 16 to 31 the second one */
+        uint32_t Loc_HeadNul   = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(Loc_Head, Loc_Zero));
+        uint32_t Loc_TailNul   = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(Loc_Tail, Loc_Zero));
+        uint32_t Loc_FirstLength  = (uint32_t)__builtin_ctz((Loc_HeadNul & 0xFFFFUL) | (Loc_TailNul << 16));
+        uint32_t Loc_SecondLength = (uint32_t)__builtin_ctz((Loc_HeadNul >> 16) | (Loc_TailNul & 0xFFFF0000UL));
+
+        __m256i Loc_Length8 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_set1_epi8((char)Loc_FirstLength)),
+                                                      _mm_set1_epi8((char)Loc_SecondLength), 1);
+        __m256i Loc_InHead  = _mm256_cmpgt_epi8(Loc_Length8, Loc_HeadIndex);
+        __m256i Loc_InTail  = _mm256_cmpgt_epi8(Loc_Length8, Loc_TailIndex);
+        __m256i Loc_HeadDigits = _mm256_sub_epi8(Loc_Head, Loc_CharZero);
+        __m256i Loc_TailDigits = _mm256_sub_epi8(Loc_Tail, Loc_CharZero);
+
+        /* Step 2: Non digits inside the PANs */
+        uint32_t Loc_Bad = (uint32_t)_mm256_movemask_epi8(_mm256_or_si256(
+                _mm256_andnot_si256(_mm256_cmpeq_epi8(_mm256_min_epu8(Loc_HeadDigits, Loc_Nine), Loc_HeadDigits), Loc_InHead),
+                _mm256_andnot_si256(_mm256_cmpeq_epi8(_mm256_min_epu8(Loc_TailDigits, Loc_Nine), Loc_TailDigits), Loc_InTail)));
+
+        /* Step 3: Double every second digit from the last one, by the parity of each PAN's length */
+        __m256i Loc_Doubled = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_set1_epi16((Loc_FirstLength & 1) ? (short)0xFF00 : (short)0x00FF)),
+                _mm_set1_epi16((Loc_SecondLength & 1) ? (short)0xFF00 : (short)0x00FF), 1);
+
+        Loc_HeadDigits = _mm256_blendv_epi8(Loc_HeadDigits, _mm256_shuffle_epi8(Loc_Table, Loc_HeadDigits), Loc_Doubled);
+        Loc_TailDigits = _mm256_blendv_epi8(Loc_TailDigits, _mm256_shuffle_epi8(Loc_Table, Loc_TailDigits), Loc_Doubled);
+
+        /* Step 4: Add up the digits, 64-bit sums 0 and 1 are the first PAN, 2 and 3 the second one */
+        __m256i Loc_Sums = _mm256_sad_epu8(_mm256_add_epi8(_mm256_and_si256(Loc_HeadDigits, Loc_InHead),
+                                                           _mm256_and_si256(Loc_TailDigits, Loc_InTail)), Loc_Zero);
+        __m128i Loc_FirstSums  = _mm256_castsi256_si128(Loc_Sums);
+        __m128i Loc_SecondSums = _mm256_extracti128_si256(Loc_Sums, 1);
+        uint32_t Loc_FirstSum  = (uint32_t)_mm_cvtsi128_si32(Loc_FirstSums) + (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(Loc_FirstSums, 8));
+        uint32_t Loc_SecondSum = (uint32_t)_mm_cvtsi128_si32(Loc_SecondSums) + (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(Loc_SecondSums, 8));
+
+        valid[Loc_Index]     = (Loc_FirstLength != 0) && ((Loc_Bad & 0xFFFFUL) == 0) && ((Loc_FirstSum % 10) == 0);
+        valid[Loc_Index + 1] = (Loc_SecondLength != 0) && ((Loc_Bad >> 16) == 0) && ((Loc_SecondSum % 10) == 0);
+    }
+
+    /* Check 1: Last odd PAN */
+    if (Loc_Index < count)
+    {
+        valid[Loc_Index] = luhnCheckSsse3(pans + ((uint64_t)Loc_Index * stride));
+    }
+}
+#endif
+
+/*
+ Name: luhnKernelName
+ Input: EN_luhnKernel_t kernel
+ Output: Pointer to kernel name
+ Description: Function to get the name of a kernel, "unknown" if it is out of range.
+*/
+const char *luhnKernelName(EN_luhnKernel_t kernel)
+{
+    return ((uint32_t)kernel < LUHN_KERNELS_COUNT) ? Glb_KernelNames[kernel] : "unknown";
+}
+
+/*
+ Name: luhnKernelSupported
+ Input: EN_luhnKernel_t kernel
+ Output: uint8 1 if the kernel can run on this CPU, else 0
+ Description: Function to check if this build has a kernel, and the CPU has its instruction set.
+              The CPU is only asked on the first call, every batch checks its kernel with one bit test after that.
+*/
+uint8_t luhnKernelSupported(EN_luhnKernel_t kernel)
+{
+    /* Check 1: Not found yet, the scalar kernel runs everywhere */
+    if (Glb_SupportedKernels == 0)
+    {
+        uint32_t Loc_Supported = 1U << LUHN_SCALAR;
+
+#if LUHN_X86
+        __builtin_cpu_init();
+        Loc_Supported |= __builtin_cpu_supports("ssse3") ? (1U << LUHN_SSSE3) : 0;
+        Loc_Supported |= __builtin_cpu_supports("avx2") ? (1U << LUHN_AVX2) : 0;
+#endif
+
+        Glb_SupportedKernels = Loc_Supported;
+    }
+
+    return ((uint32_t)kernel < LUHN_KERNELS_COUNT) ? (uint8_t)((Glb_SupportedKernels >> kernel) & 1) : 0;
+}
+
+/*
+ Name: luhnBestKernel
+ Input: void
+ Output: EN_luhnKernel_t kernel
+ Description: Function to get the fastest kernel this CPU can run, found on the first call.
+*/
+EN_luhnKernel_t luhnBestKernel(void)
+{
+    /* Check 1: Not found yet, try the widest kernel first */
+    if (Glb_BestKernel == LUHN_KERNELS_COUNT)
+    {
+        EN_luhnKernel_t Loc_Kernel = LUHN_AVX2;
+
+        while ((Loc_Kernel != LUHN_SCALAR) && !luhnKernelSupported(Loc_Kernel))
+        {
+            Loc_Kernel--;
+        }
+
+        Glb_BestKernel = Loc_Kernel;
+    }
+
+    return Glb_BestKernel;
+}
+
+/*
+ Name: luhnCheckBatchKernel
+ Input: EN_luhnKernel_t kernel, Pointer to first PAN, uint32 stride, uint32 count, and Pointer to valid array
+ Output: void
+ Description: Function to check count PANs with one kernel, the scalar one if the CPU doesn't support it.
+              PAN n starts stride * n bytes after the first one, so the PANs of an array of structures are checked
+              in place. Every PAN must have LUHN_PAN_SIZE readable bytes.
+              valid[n] is set to 1 if PAN n is a Luhn number, else 0.
+*/
+void luhnCheckBatchKernel(EN_luhnKernel_t kernel, const uint8_t *pans, uint32_t stride, uint32_t count, uint8_t *valid)
+{
+    if (!luhnKernelSupported(kernel))
+    {
+        kernel = LUHN_SCALAR;
+    }
+
+    switch (kernel)
+    {
+#if LUHN_X86
+        case LUHN_SSSE3:
+            luhnCheckBatchSsse3(pans, stride, count, valid);
+            break;
+        case LUHN_AVX2:
+            luhnCheckBatchAvx2(pans, stride, count, valid);
+            break;
+#endif
+        default:
+            for (uint32_t Loc_Index = 0; Loc_Index < count; Loc_Index++)
+            {
+                valid[Loc_Index] = luhnCheckScalar(pans + ((uint64_t)Loc_Index * stride));
+            }
+            break;
+    }
+}
+
+/*
+ Name: luhnCheckBatch
+ Input: Pointer to first PAN, uint32 stride, uint32 count, and Pointer to valid array
+ Output: void
+ Description: Function to check count PANs as luhnCheckBatchKernel does, with the best kernel of this CPU.
+*/
+void luhnCheckBatch(const uint8_t *pans, uint32_t stride, uint32_t count, uint8_t *valid)
+{
+    luhnCheckBatchKernel(luhnBestKernel(), pans, stride, count, valid);
+}
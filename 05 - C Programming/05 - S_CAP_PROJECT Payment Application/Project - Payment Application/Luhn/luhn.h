@@ -0,0 +1,40 @@
+/**
+ * @Title      	: Luhn Module
+ * @Filename   	: luhn.h
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+#ifndef LUHN_H_
+#define LUHN_H_
+
+#include <stdint.h>
+#include <string.h>
+
+/* Bytes of a PAN buffer, the PAN is its digits up to the first NUL */
+#define LUHN_PAN_SIZE				20
+
+/* Luhn kernels, each one checks the same PANs with the same result */
+typedef enum EN_luhnKernel_t
+{
+    LUHN_SCALAR, LUHN_SSSE3, LUHN_AVX2, LUHN_KERNELS_COUNT
+}EN_luhnKernel_t;
+
+/**************************************************************************************************************************************/
+/*
+*							Prototypes for all used functions inside the luhn module.
+*/
+/**************************************************************************************************************************************/
+const char *luhnKernelName(EN_luhnKernel_t kernel);
+uint8_t luhnKernelSupported(EN_luhnKernel_t kernel);
+EN_luhnKernel_t luhnBestKernel(void);
+void luhnCheckBatchKernel(EN_luhnKernel_t kernel, const uint8_t *pans, uint32_t stride, uint32_t count, uint8_t *valid);
+void luhnCheckBatch(const uint8_t *pans, uint32_t stride, uint32_t count, uint8_t *valid);
+
+#endif /* LUHN_H_ */
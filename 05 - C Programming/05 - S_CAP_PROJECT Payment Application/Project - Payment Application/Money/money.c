@@ -0,0 +1,207 @@
+/**
+ * @Title      	: Money Module
+ * @Filename   	: money.c
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+
+/* Money Module */
+#include "money.h"
+
+/* Max. number of major units an amount can hold */
+#define MONEY_MAX_UNITS				(INT64_MAX / MONEY_SCALE)
+
+/*
+ Name: moneyIsSpace
+ Input: char character
+ Output: uint8 1 if it is a space, else 0
+ Description: Static Function to check for the spaces allowed around an amount.
+*/
+static uint8_t moneyIsSpace(char character)
+{
+    return (character == ' ') || (character == '\t') || (character == '\r') || (character == '\n');
+}
+
+/*
+ Name: moneyParse
+ Input: Pointer to text, and Pointer to amount
+ Output: EN_moneyError_t Error or No Error
+ Description: Function to read a decimal amount such as "2500", "-20", "10.5" or "0.01" into minor units.
+              1. Spaces around the amount, and a leading sign are allowed.
+              2. It takes up to MONEY_MINOR_DIGITS decimals, an amount with more can't be held exactly,
+                 so it returns MONEY_WRONG_FORMAT as for any other text that isn't an amount.
+              3. An amount too large for money_t returns MONEY_OVERFLOW.
+              4. amount is set to 0 on any error.
+*/
+EN_moneyError_t moneyParse(const char *text, money_t *amount)
+{
+    int64_t Loc_Units = 0;
+    int64_t Loc_Minor = 0;
+    uint8_t Loc_Negative = 0;
+    uint8_t Loc_Digits = 0;
+
+    *amount = 0;
+
+    /* Loop: Until the first non space character */
+    while (moneyIsSpace(*text))
+    {
+        text++;
+    }
+
+    /* Check 1: Sign */
+    if ((*text == '-') || (*text == '+'))
+    {
+        Loc_Negative = (*text == '-');
+        text++;
+    }
+
+    /* Loop: Until the end of the major units */
+    while ((*text >= '0') && (*text <= '9'))
+    {
+        /* Check 2: Too many major units */
+        if (Loc_Units > ((MONEY_MAX_UNITS - (*text - '0')) / 10))
+        {
+            return MONEY_OVERFLOW;
+        }
+
+        Loc_Units = (Loc_Units * 10) + (*text - '0');
+        Loc_Digits++;
+        text++;
+    }
+
+    /* Check 3: Minor units */
+    if (*text == '.')
+    {
+        uint8_t Loc_MinorDigits = 0;
+
+        text++;
+
+        /* Loop: Until the end of the minor units */
+        while ((*text >= '0') && (*text <= '9'))
+        {
+            if (Loc_MinorDigits == MONEY_MINOR_DIGITS)
+            {
+                return MONEY_WRONG_FORMAT;
+            }
+
+            Loc_Minor = (Loc_Minor * 10) + (*text - '0');
+            Loc_MinorDigits++;
+            Loc_Digits++;
+            text++;
+        }
+
+        /* Loop: Until the minor units are scaled, "10.5" is 50 minor units */
+        for (; Loc_MinorDigits < MONEY_MINOR_DIGITS; Loc_MinorDigits++)
+        {
+            Loc_Minor *= 10;
+        }
+    }
+
+    /* Loop: Until the first non space character */
+    while (moneyIsSpace(*text))
+    {
+        text++;
+    }
+
+    /* Check 4: No digits, or more text after the amount */
+    if ((Loc_Digits == 0) || (*text != '\0'))
+    {
+        return MONEY_WRONG_FORMAT;
+    }
+
+    /* Check 5: Minor units don't fit on top of the max. number of major units */
+    if ((Loc_Units == MONEY_MAX_UNITS) && (Loc_Minor > (INT64_MAX % MONEY_SCALE)))
+    {
+        return MONEY_OVERFLOW;
+    }
+
+    *amount = (Loc_Units * MONEY_SCALE) + Loc_Minor;
+
+    if (Loc_Negative)
+    {
+        *amount = -*amount;
+    }
+
+    return MONEY_OK;
+}
+
+/*
+ Name: moneyFormat
+ Input: money_t amount, and Pointer to text of MONEY_TEXT_SIZE characters at least
+ Output: uint32 length of text
+ Description: Function to write an amount as a NUL terminated decimal with MONEY_MINOR_DIGITS decimals, "-20.00" or "10.50".
+*/
+uint32_t moneyFormat(money_t amount, char *text)
+{
+    char Loc_Digits[MONEY_TEXT_SIZE];
+    uint8_t Loc_Count = 0;
+    uint32_t Loc_Length = 0;
+    /* Magnitude as unsigned, so the most negative amount doesn't overflow */
+    uint64_t Loc_Magnitude = (amount < 0) ? (0 - (uint64_t)amount) : (uint64_t)amount;
+
+    /* Loop: Until all digits are found from the last one, at least one major unit digit */
+    do
+    {
+        if (Loc_Count == MONEY_MINOR_DIGITS)
+        {
+            Loc_Digits[Loc_Count++] = '.';
+        }
+
+        Loc_Digits[Loc_Count++] = (char)('0' + (Loc_Magnitude % 10));
+        Loc_Magnitude /= 10;
+    } while ((Loc_Magnitude != 0) || (Loc_Count <= (MONEY_MINOR_DIGITS + 1)));
+
+    if (amount < 0)
+    {
+        text[Loc_Length++] = '-';
+    }
+
+    /* Loop: Until all digits are written, from the first one */
+    while (Loc_Count != 0)
+    {
+        text[Loc_Length++] = Loc_Digits[--Loc_Count];
+    }
+
+    text[Loc_Length] = '\0';
+
+    return Loc_Length;
+}
+
+/*
+ Name: moneySum
+ Input: Pointer to amounts array, and uint32 count
+ Output: money_t total
+ Description: Function to add up count amounts, to reconcile balances against the transactions log.
+              The sum is kept in four independent unsigned lanes, so the loop has no carried dependency the compiler
+              can't split, and vectorizes into SIMD adds. Unsigned adds wrap instead of being undefined on overflow,
+              and give the same total as signed ones when it fits.
+*/
+money_t moneySum(const money_t *amounts, uint32_t count)
+{
+    uint64_t Loc_Lanes[4] = { 0, 0, 0, 0 };
+    uint32_t Loc_Index = 0;
+
+    /* Loop: Until less than four amounts are left */
+    for (; (Loc_Index + 4) <= count; Loc_Index += 4)
+    {
+        Loc_Lanes[0] += (uint64_t)amounts[Loc_Index];
+        Loc_Lanes[1] += (uint64_t)amounts[Loc_Index + 1];
+        Loc_Lanes[2] += (uint64_t)amounts[Loc_Index + 2];
+        Loc_Lanes[3] += (uint64_t)amounts[Loc_Index + 3];
+    }
+
+    /* Loop: Until the end of the amounts */
+    for (; Loc_Index < count; Loc_Index++)
+    {
+        Loc_Lanes[0] += (uint64_t)amounts[Loc_Index];
+    }
+
+    return (money_t)(Loc_Lanes[0] + Loc_Lanes[1] + Loc_Lanes[2] + Loc_Lanes[3]);
+}
@@ -0,0 +1,49 @@
+/**
+ * @Title      	: Money Module
+ * @Filename   	: money.h
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+#ifndef MONEY_H_
+#define MONEY_H_
+
+#include <stdint.h>
+
+/* Number of minor unit digits, and minor units in one major unit (cents in a pound) */
+#define MONEY_MINOR_DIGITS			2
+#define MONEY_SCALE					100
+/* Size of a buffer that fits any formatted amount, "-92233720368547758.08" and its NUL */
+#define MONEY_TEXT_SIZE				24
+
+/* Amount of units major units and minor minor units, MONEY_AMOUNT(68600, 30) is 68600.30 */
+#define MONEY_AMOUNT(units, minor)	(((money_t)(units) * MONEY_SCALE) + (minor))
+
+/**************************************************************************************************************************************/
+/*
+* All amounts are whole numbers of minor units, so they add, subtract and compare exactly at any size.
+*/
+/**************************************************************************************************************************************/
+typedef int64_t money_t;
+
+typedef enum EN_moneyError_t
+{
+    MONEY_OK, MONEY_WRONG_FORMAT, MONEY_OVERFLOW
+}EN_moneyError_t;
+
+/**************************************************************************************************************************************/
+/*
+*							Prototypes for all used functions inside the money module.
+*/
+/**************************************************************************************************************************************/
+EN_moneyError_t moneyParse(const char *text, money_t *amount);
+uint32_t moneyFormat(money_t amount, char *text);
+money_t moneySum(const money_t *amounts, uint32_t count);
+
+#endif /* MONEY_H_ */
@@ -0,0 +1,1124 @@
+/**
+ * @Title      	: Network Module
+ * @Filename   	: network.c
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+
+/* accept4, defined before any system header is included */
+#ifdef __linux__
+#define _GNU_SOURCE
+#endif
+
+/* Network Module */
+#include "network.h"
+
+#include <signal.h>
+
+/* Sockets and epoll, the daemon and the load client run on Linux only */
+#ifdef __linux__
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
+
+/* Set by networkStop, the event loop checks it every turn */
+static volatile sig_atomic_t Glb_NetworkStopping = 0;
+
+/*
+ Name: networkStop
+ Input: void
+ Output: void
+ Description: Function to stop networkServe after its current event loop turn, safe to call from a signal handler.
+*/
+void networkStop(void)
+{
+    Glb_NetworkStopping = 1;
+}
+
+/*
+ Name: networkPercentile
+ Input: Pointer to Load Stats structure, and double percentile from 0 to 100
+ Output: uint64 latency in nanoseconds
+ Description: Function to get the round trip percentile of a load run (nearest rank), 0 if no request was answered.
+*/
+uint64_t networkPercentile(const ST_networkLoadStats_t *stats, double percentile)
+{
+    uint64_t Loc_Rank;
+
+    if (stats->requestsCount == 0)
+    {
+        return 0;
+    }
+
+    /* Rank of the percentile, from 1 to requestsCount */
+    Loc_Rank = (uint64_t)((percentile / 100.0) * (double)stats->requestsCount + 0.999999);
+
+    if (Loc_Rank == 0)
+    {
+        Loc_Rank = 1;
+    }
+    else if (Loc_Rank > stats->requestsCount)
+    {
+        Loc_Rank = stats->requestsCount;
+    }
+
+    return stats->latenciesNs[Loc_Rank - 1];
+}
+
+/*
+ Name: networkPrintLoadStats
+ Input: Pointer to Load Stats structure
+ Output: void
+ Description: Function to print out the requests per second, the outcome of each request, and the round trip
+              percentiles of a load run.
+*/
+void networkPrintLoadStats(const ST_networkLoadStats_t *stats)
+{
+    double Loc_Seconds = (double)stats->elapsedNs / 1e9;
+
+    printf(" Connections:\t\t%u\n", stats->connectionsCount);
+    printf(" Requests:\t\t%llu in %.3f s, %.0f requests/s\n", (unsigned long long)stats->requestsCount, Loc_Seconds,
+           (Loc_Seconds > 0) ? ((double)stats->requestsCount / Loc_Seconds) : 0.0);
+
+    /* Loop: Until all transaction states are printed out */
+    for (uint8_t Loc_State = APPROVED; Loc_State <= DECLINED_VELOCITY; Loc_State++)
+    {
+        printf(" %-28s%llu\n", reportStateName((EN_transState_t)Loc_State), (unsigned long long)stats->states[Loc_State]);
+    }
+
+    printf(" Latency (us):\t\tp50 %.2f, p90 %.2f, p99 %.2f, p999 %.2f, max %.2f\n",
+           networkPercentile(stats, 50.0) / 1e3, networkPercentile(stats, 90.0) / 1e3,
+           networkPercentile(stats, 99.0) / 1e3, networkPercentile(stats, 99.9) / 1e3,
+           networkPercentile(stats, 100.0) / 1e3);
+}
+
+/*
+ Name: networkFreeLoadStats
+ Input: Pointer to Load Stats structure
+ Output: void
+ Description: Function to free the latencies of a load run.
+*/
+void networkFreeLoadStats(ST_networkLoadStats_t *stats)
+{
+    free(stats->latenciesNs);
+    stats->latenciesNs = NULL;
+    stats->requestsCount = 0;
+}
+
+#ifdef __linux__
+
+/* Accounts the load client sends its requests for, running accounts with the largest balances */
+static const char *const Glb_LoadPANs[] = { "5424438206113309", "5335847432506029", "4946069587908256", "5116136307216426",
+                                            "5191786640828580", "5419558003040483", "4946099683908835", "4834699064563433" };
+
+/**************************************************************************************************************************************/
+/*
+* Server side of one connection. Requests are read into in, and taken into the current batch only while out has room
+* for their responses, so a client that doesn't read its responses stops being read (back pressure).
+*/
+/**************************************************************************************************************************************/
+typedef struct ST_networkConnection_t
+{
+    int fd;
+    uint32_t events;									/* Events the connection is registered for */
+    uint32_t inUsed;
+    uint32_t outUsed;
+    uint32_t pendingCount;								/* Requests in the current batch */
+    uint8_t ended;										/* Client sent all it will send, closed once its requests are answered */
+    uint8_t closing;									/* Failed, or sent a wrong request, closed at the end of the turn */
+    uint8_t touched;									/* In the touched list of the current turn */
+    struct ST_networkConnection_t *nextTouched;
+    struct ST_networkConnection_t *previous;			/* All open connections */
+    struct ST_networkConnection_t *next;
+    uint8_t in[NETWORK_IN_REQUESTS * sizeof(ST_networkRequest_t)];
+    uint8_t out[NETWORK_OUT_RESPONSES * sizeof(ST_networkResponse_t)];
+}ST_networkConnection_t;
+
+/* Requests of all connections, authorized together */
+typedef struct ST_networkBatch_t
+{
+    uint32_t count;
+    uint8_t authorized;									/* Authorized, but not committed yet: no request is added, no response sent */
+    ST_transaction_t *transactions;
+    EN_transState_t *states;
+    ST_networkConnection_t **owners;
+    uint32_t *requestIds;
+    ST_networkServeStats_t *stats;
+}ST_networkBatch_t;
+
+/* Load client side of one connection, requests in flight are answered in order, oldest at head */
+typedef struct ST_networkClient_t
+{
+    int fd;
+    uint32_t events;
+    uint32_t inFlight;
+    uint32_t head;
+    uint32_t inUsed;
+    uint32_t outUsed;
+    uint8_t failed;
+    uint64_t sentAt[NETWORK_MAX_DEPTH];
+    uint8_t in[NETWORK_MAX_DEPTH * sizeof(ST_networkResponse_t)];
+    uint8_t out[NETWORK_MAX_DEPTH * sizeof(ST_networkRequest_t)];
+}ST_networkClient_t;
+
+/*
+ Name: networkNow
+ Input: void
+ Output: uint64 time in nanoseconds
+ Description: Static Function to read the monotonic clock for timing round trips.
+*/
+static uint64_t networkNow(void)
+{
+    struct timespec Loc_Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Loc_Time);
+
+    return ((uint64_t)Loc_Time.tv_sec * 1000000000ULL) + (uint64_t)Loc_Time.tv_nsec;
+}
+
+/*
+ Name: networkCompare
+ Input: Pointer to first latency, and Pointer to second latency
+ Output: int order of the two latencies
+ Description: Static Function to sort latencies in ascending order with qsort.
+*/
+static int networkCompare(const void *first, const void *second)
+{
+    uint64_t Loc_First  = *(const uint64_t *)first;
+    uint64_t Loc_Second = *(const uint64_t *)second;
+
+    return (Loc_First > Loc_Second) - (Loc_First < Loc_Second);
+}
+
+/*
+ Name: networkRaiseFilesLimit
+ Input: void
+ Output: void
+ Description: Static Function to raise the open files limit of the process to its hard limit, one file per connection.
+*/
+static void networkRaiseFilesLimit(void)
+{
+    struct rlimit Loc_Limit;
+
+    if ((getrlimit(RLIMIT_NOFILE, &Loc_Limit) == 0) && (Loc_Limit.rlim_cur < Loc_Limit.rlim_max))
+    {
+        Loc_Limit.rlim_cur = Loc_Limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &Loc_Limit);
+    }
+}
+
+/*
+ Name: networkAddress
+ Input: Pointer to endpoint, Pointer to address, and Pointer to address length
+ Output: int address family, or -1 if the endpoint is wrong
+ Description: Static Function to turn an endpoint into a socket address: a TCP port on 127.0.0.1 if it is all digits,
+              else a Unix-domain socket path.
+*/
+static int networkAddress(const char *endpoint, struct sockaddr_storage *address, socklen_t *length)
+{
+    size_t Loc_Length = strlen(endpoint);
+    size_t Loc_Digits = strspn(endpoint, "0123456789");
+
+    memset(address, 0, sizeof(struct sockaddr_storage));
+
+    /* Check 1: TCP port */
+    if ((Loc_Length != 0) && (Loc_Digits == Loc_Length))
+    {
+        struct sockaddr_in *Loc_Inet = (struct sockaddr_in *)address;
+        long Loc_Port = strtol(endpoint, NULL, 10);
+
+        if ((Loc_Port <= 0) || (Loc_Port > 65535))
+        {
+            return -1;
+        }
+
+        Loc_Inet->sin_family      = AF_INET;
+        Loc_Inet->sin_port        = htons((uint16_t)Loc_Port);
+        Loc_Inet->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        *length = sizeof(struct sockaddr_in);
+
+        return AF_INET;
+    }
+    /* Check 2: Unix-domain socket path */
+    else
+    {
+        struct sockaddr_un *Loc_Unix = (struct sockaddr_un *)address;
+
+        if ((Loc_Length == 0) || (Loc_Length >= sizeof(Loc_Unix->sun_path)))
+        {
+            return -1;
+        }
+
+        Loc_Unix->sun_family = AF_UNIX;
+        memcpy(Loc_Unix->sun_path, endpoint, Loc_Length + 1);
+        *length = sizeof(struct sockaddr_un);
+
+        return AF_UNIX;
+    }
+}
+
+/*
+ Name: networkSetEvents
+ Input: int epoll, int fd, Pointer to registered events, uint32 events, and Pointer to event data
+ Output: void
+ Description: Static Function to change the events a socket is registered for, only if they changed.
+*/
+static void networkSetEvents(int epoll, int fd, uint32_t *registered, uint32_t events, void *data)
+{
+    struct epoll_event Loc_Event;
+
+    if (*registered != events)
+    {
+        Loc_Event.events   = events;
+        Loc_Event.data.ptr = data;
+        epoll_ctl(epoll, EPOLL_CTL_MOD, fd, &Loc_Event);
+        *registered = events;
+    }
+}
+
+/*
+ Name: networkFlushBatch
+ Input: Pointer to batch
+ Output: void
+ Description: Static Function to authorize all requests of the batch together, commit them to the transactions log
+              with one commit, then queue each response on its connection.
+              If the commit fails the batch is kept authorized and unanswered, its transactions stay pending in the log,
+              and the next call only retries the commit. So a client is never told a charged transaction failed, nor
+              answered before its transaction is on disk.
+*/
+static void networkFlushBatch(ST_networkBatch_t *batch)
+{
+    if (batch->count == 0)
+    {
+        return;
+    }
+
+    if (!batch->authorized)
+    {
+        recieveTransactionDataParallel(batch->transactions, batch->count, batch->states);
+        batch->authorized = 1;
+    }
+
+    /* Check: Log can't be committed, keep the batch for the next call */
+    if (serverCommit() != SERVER_OK)
+    {
+        return;
+    }
+
+    /* Loop: Until all responses are queued */
+    for (uint32_t Loc_Index = 0; Loc_Index < batch->count; Loc_Index++)
+    {
+        ST_networkConnection_t *Loc_Connection = batch->owners[Loc_Index];
+        ST_networkResponse_t Loc_Response;
+
+        Loc_Response.requestId  = batch->requestIds[Loc_Index];
+        Loc_Response.transState = (uint32_t)batch->states[Loc_Index];
+        Loc_Response.transactionSequenceNumber = batch->transactions[Loc_Index].transactionSequenceNumber;
+        Loc_Response.reserved   = 0;
+
+        memcpy(Loc_Connection->out + Loc_Connection->outUsed, &Loc_Response, sizeof(ST_networkResponse_t));
+        Loc_Connection->outUsed += sizeof(ST_networkResponse_t);
+        Loc_Connection->pendingCount--;
+    }
+
+    batch->stats->requestsCount += batch->count;
+    batch->stats->batchesCount++;
+    batch->count      = 0;
+    batch->authorized = 0;
+}
+
+/*
+ Name: networkTakeRequests
+ Input: Pointer to batch, and Pointer to connection
+ Output: void
+ Description: Static Function to take the whole requests read on a connection into the batch, while its out buffer has
+              room for their responses. The batch is flushed whenever it is full, and takes none while it waits for its commit.
+              A request of another version, or with an amount less than or equal zero, closes the connection.
+*/
+static void networkTakeRequests(ST_networkBatch_t *batch, ST_networkConnection_t *connection)
+{
+    uint32_t Loc_Offset = 0;
+
+    /* Loop: Until no whole request is left, or no room is left for its response */
+    while (!connection->closing && !batch->authorized &&
+           ((connection->inUsed - Loc_Offset) >= sizeof(ST_networkRequest_t)) &&
+           ((connection->outUsed + ((connection->pendingCount + 1) * sizeof(ST_networkResponse_t))) <= sizeof(connection->out)))
+    {
+        ST_networkRequest_t Loc_Request;
+        ST_transaction_t *Loc_Transaction;
+
+        if (batch->count == NETWORK_MAX_BATCH)
+        {
+            networkFlushBatch(batch);
+            continue;
+        }
+
+        memcpy(&Loc_Request, connection->in + Loc_Offset, sizeof(ST_networkRequest_t));
+        Loc_Offset += sizeof(ST_networkRequest_t);
+
+        /* Check 1: Wrong request */
+        if ((Loc_Request.version != NETWORK_PROTOCOL_VERSION) || (Loc_Request.transAmount <= 0))
+        {
+            connection->closing = 1;
+            break;
+        }
+
+        Loc_Transaction = &batch->transactions[batch->count];
+        memset(Loc_Transaction, 0, sizeof(ST_transaction_t));
+
+        /* Copy the text fields, each one is cut at its last byte if it isn't NUL terminated */
+        memcpy(Loc_Transaction->cardHolderData.cardHolderName, Loc_Request.cardHolderName, sizeof(Loc_Request.cardHolderName) - 1);
+        memcpy(Loc_Transaction->cardHolderData.primaryAccountNumber, Loc_Request.primaryAccountNumber, sizeof(Loc_Request.primaryAccountNumber) - 1);
+        memcpy(Loc_Transaction->cardHolderData.cardExpirationDate, Loc_Request.cardExpirationDate, sizeof(Loc_Request.cardExpirationDate) - 1);
+        memcpy(Loc_Transaction->terminalData.transactionDate, Loc_Request.transactionDate, sizeof(Loc_Request.transactionDate) - 1);
+        dateParseExpiry(Loc_Transaction->cardHolderData.cardExpirationDate, &Loc_Transaction->cardHolderData.packedExpirationDate);
+        dateParse(Loc_Transaction->terminalData.transactionDate, &Loc_Transaction->terminalData.packedTransactionDate);
+        Loc_Transaction->terminalData.transAmount    = Loc_Request.transAmount;
+        Loc_Transaction->terminalData.maxTransAmount = Loc_Request.maxTransAmount;
+
+        batch->owners[batch->count]     = connection;
+        batch->requestIds[batch->count] = Loc_Request.requestId;
+        batch->count++;
+        connection->pendingCount++;
+    }
+
+    connection->inUsed -= Loc_Offset;
+    memmove(connection->in, connection->in + Loc_Offset, connection->inUsed);
+}
+
+/*
+ Name: networkWrite
+ Input: Pointer to connection
+ Output: void
+ Description: Static Function to send as many queued responses of a connection as the socket takes without blocking.
+*/
+static void networkWrite(ST_networkConnection_t *connection)
+{
+    uint32_t Loc_Sent = 0;
+
+    /* Loop: Until all responses are sent, or the socket is full */
+    while (!connection->closing && (Loc_Sent < connection->outUsed))
+    {
+        ssize_t Loc_Count = send(connection->fd, connection->out + Loc_Sent, connection->outUsed - Loc_Sent, MSG_NOSIGNAL);
+
+        if (Loc_Count > 0)
+        {
+            Loc_Sent += (uint32_t)Loc_Count;
+        }
+        else if ((Loc_Count < 0) && (errno == EINTR))
+        {
+            continue;
+        }
+        else if ((Loc_Count < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK)))
+        {
+            break;
+        }
+        else
+        {
+            connection->closing = 1;
+        }
+    }
+
+    connection->outUsed -= Loc_Sent;
+    memmove(connection->out, connection->out + Loc_Sent, connection->outUsed);
+}
+
+/*
+ Name: networkListen
+ Input: Pointer to endpoint
+ Output: int listening socket, or -1 on error
+ Description: Static Function to open a non-blocking listening socket on an endpoint, a Unix-domain socket file left by
+              an earlier run is replaced.
+*/
+static int networkListen(const char *endpoint)
+{
+    struct sockaddr_storage Loc_Address;
+    socklen_t Loc_Length;
+    int Loc_Family = networkAddress(endpoint, &Loc_Address, &Loc_Length);
+    int Loc_Socket;
+    int Loc_One = 1;
+
+    if (Loc_Family < 0)
+    {
+        return -1;
+    }
+
+    Loc_Socket = socket(Loc_Family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+
+    if (Loc_Socket < 0)
+    {
+        return -1;
+    }
+
+    if (Loc_Family == AF_UNIX)
+    {
+        unlink(endpoint);
+    }
+    else
+    {
+        setsockopt(Loc_Socket, SOL_SOCKET, SO_REUSEADDR, &Loc_One, sizeof(Loc_One));
+    }
+
+    if ((bind(Loc_Socket, (struct sockaddr *)&Loc_Address, Loc_Length) != 0) || (listen(Loc_Socket, NETWORK_BACKLOG) != 0))
+    {
+        close(Loc_Socket);
+        return -1;
+    }
+
+    return Loc_Socket;
+}
+
+/*
+ Name: networkAccept
+ Input: int epoll, int listening socket, Pointer to list of all connections, Pointer to open connections count,
+        and Pointer to Serve Stats structure
+ Output: void
+ Description: Static Function to accept all pending connections, and register them for reading.
+              Connections over NETWORK_MAX_CONNECTIONS, or without memory, are closed right away.
+*/
+static void networkAccept(int epoll, int listener, ST_networkConnection_t **all, uint32_t *openCount, ST_networkServeStats_t *stats)
+{
+    /* Loop: Until no connection is pending */
+    while (1)
+    {
+        int Loc_Socket = accept4(listener, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        ST_networkConnection_t *Loc_Connection;
+        struct epoll_event Loc_Event;
+        int Loc_One = 1;
+
+        if (Loc_Socket < 0)
+        {
+            break;
+        }
+
+        Loc_Connection = (*openCount < NETWORK_MAX_CONNECTIONS) ? calloc(1, sizeof(ST_networkConnection_t)) : NULL;
+
+        if (Loc_Connection == NULL)
+        {
+            close(Loc_Socket);
+            continue;
+        }
+
+        /* Responses are small, send them right away (fails harmlessly on Unix-domain sockets) */
+        setsockopt(Loc_Socket, IPPROTO_TCP, TCP_NODELAY, &Loc_One, sizeof(Loc_One));
+
+        Loc_Connection->fd     = Loc_Socket;
+        Loc_Connection->events = EPOLLIN;
+        Loc_Event.events       = EPOLLIN;
+        Loc_Event.data.ptr     = Loc_Connection;
+
+        if (epoll_ctl(epoll, EPOLL_CTL_ADD, Loc_Socket, &Loc_Event) != 0)
+        {
+            close(Loc_Socket);
+            free(Loc_Connection);
+            continue;
+        }
+
+        Loc_Connection->next = *all;
+
+        if (*all != NULL)
+        {
+            (*all)->previous = Loc_Connection;
+        }
+
+        *all = Loc_Connection;
+        (*openCount)++;
+        stats->connectionsCount++;
+    }
+}
+
+/*
+ Name: networkClose
+ Input: Pointer to list of all connections, Pointer to open connections count, and Pointer to connection
+ Output: void
+ Description: Static Function to close a connection, and free it. Closing the socket also removes it from epoll.
+*/
+static void networkClose(ST_networkConnection_t **all, uint32_t *openCount, ST_networkConnection_t *connection)
+{
+    if (connection->previous != NULL)
+    {
+        connection->previous->next = connection->next;
+    }
+    else
+    {
+        *all = connection->next;
+    }
+
+    if (connection->next != NULL)
+    {
+        connection->next->previous = connection->previous;
+    }
+
+    close(connection->fd);
+    free(connection);
+    (*openCount)--;
+}
+
+/*
+ Name: networkServe
+ Input: Pointer to endpoint (NULL for NETWORK_DEFAULT_ENDPOINT), and Pointer to Serve Stats structure
+ Output: EN_networkError_t Error or No Error
+ Description: Function to serve terminal clients on an endpoint with an epoll event loop, until networkStop is called.
+              The server must be initialized with serverInit. Each turn of the loop:
+              1. Reads every ready connection, and takes its whole requests into one batch for all connections.
+              2. Authorizes the batch with recieveTransactionDataParallel, and commits it to the log with one commit
+                 (group commit), so a response is only sent once its transaction is on disk. If the commit fails the
+                 batch waits, and its commit is retried every turn (at least every 100 ms) until it succeeds.
+              3. Sends the responses, takes any requests left waiting for room, and repeats until none is left.
+              4. Closes the connections that failed, and the ones closed by their clients once their whole requests
+                 are answered and all the responses are sent, so a client can send its requests then shut down its side.
+*/
+EN_networkError_t networkServe(const char *endpoint, ST_networkServeStats_t *stats)
+{
+    EN_networkError_t Loc_ErrorState = NETWORK_OK;
+    struct epoll_event *Loc_Events = malloc(NETWORK_MAX_EVENTS * sizeof(struct epoll_event));
+    ST_networkBatch_t Loc_Batch;
+    ST_networkConnection_t *Loc_All = NULL;
+    uint32_t Loc_OpenCount = 0;
+    struct epoll_event Loc_Event;
+    int Loc_Listener;
+    int Loc_Epoll;
+
+    if (endpoint == NULL)
+    {
+        endpoint = NETWORK_DEFAULT_ENDPOINT;
+    }
+
+    memset(stats, 0, sizeof(ST_networkServeStats_t));
+    Loc_Batch.count        = 0;
+    Loc_Batch.authorized   = 0;
+    Loc_Batch.stats        = stats;
+    Loc_Batch.transactions = malloc(NETWORK_MAX_BATCH * sizeof(ST_transaction_t));
+    Loc_Batch.states       = malloc(NETWORK_MAX_BATCH * sizeof(EN_transState_t));
+    Loc_Batch.owners       = malloc(NETWORK_MAX_BATCH * sizeof(ST_networkConnection_t *));
+    Loc_Batch.requestIds   = malloc(NETWORK_MAX_BATCH * sizeof(uint32_t));
+
+    /* Check 1: Not enough memory */
+    if ((Loc_Events == NULL) || (Loc_Batch.transactions == NULL) || (Loc_Batch.states == NULL) ||
+        (Loc_Batch.owners == NULL) || (Loc_Batch.requestIds == NULL))
+    {
+        Loc_ErrorState = NETWORK_NO_MEMORY;
+    }
+    else
+    {
+        networkRaiseFilesLimit();
+        Loc_Listener = networkListen(endpoint);
+        Loc_Epoll    = epoll_create1(EPOLL_CLOEXEC);
+        Loc_Event.events   = EPOLLIN;
+        Loc_Event.data.ptr = NULL;
+
+        /* Check 2: Endpoint can't be listened on */
+        if ((Loc_Listener < 0) || (Loc_Epoll < 0) || (epoll_ctl(Loc_Epoll, EPOLL_CTL_ADD, Loc_Listener, &Loc_Event) != 0))
+        {
+            Loc_ErrorState = NETWORK_SOCKET_ERROR;
+        }
+
+        Glb_NetworkStopping = 0;
+
+        /* Loop: Until networkStop is called */
+        while ((Loc_ErrorState == NETWORK_OK) && !Glb_NetworkStopping)
+        {
+            ST_networkConnection_t *Loc_Touched = NULL;
+            int Loc_Count = epoll_wait(Loc_Epoll, Loc_Events, NETWORK_MAX_EVENTS, 100);
+
+            if (Loc_Count < 0)
+            {
+                if (errno != EINTR)
+                {
+                    Loc_ErrorState = NETWORK_SOCKET_ERROR;
+                }
+
+                continue;
+            }
+
+            /* Stage 1: Read every ready connection, and take its requests */
+            for (int Loc_Index = 0; Loc_Index < Loc_Count; Loc_Index++)
+            {
+                ST_networkConnection_t *Loc_Connection = Loc_Events[Loc_Index].data.ptr;
+
+                if (Loc_Connection == NULL)
+                {
+                    networkAccept(Loc_Epoll, Loc_Listener, &Loc_All, &Loc_OpenCount, stats);
+                    continue;
+                }
+
+                if (!Loc_Connection->touched)
+                {
+                    Loc_Connection->touched     = 1;
+                    Loc_Connection->nextTouched = Loc_Touched;
+                    Loc_Touched = Loc_Connection;
+                }
+
+                if (!Loc_Connection->closing && !Loc_Connection->ended && (Loc_Connection->inUsed < sizeof(Loc_Connection->in)) &&
+                    (Loc_Events[Loc_Index].events & (EPOLLIN | EPOLLHUP | EPOLLERR)))
+                {
+                    ssize_t Loc_Read = recv(Loc_Connection->fd, Loc_Connection->in + Loc_Connection->inUsed,
+                                            sizeof(Loc_Connection->in) - Loc_Connection->inUsed, 0);
+
+                    if (Loc_Read > 0)
+                    {
+                        Loc_Connection->inUsed += (uint32_t)Loc_Read;
+                    }
+                    else if (Loc_Read == 0)
+                    {
+                        Loc_Connection->ended = 1;
+                    }
+                    else if ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR))
+                    {
+                        Loc_Connection->closing = 1;
+                    }
+                }
+                else if (Loc_Events[Loc_Index].events & EPOLLERR)
+                {
+                    Loc_Connection->closing = 1;
+                }
+
+                networkTakeRequests(&Loc_Batch, Loc_Connection);
+            }
+
+            /* Stage 2: Authorize, commit and answer, until no request waits for room. The connections of a batch
+               kept from an earlier turn are answered in this one */
+            for (uint32_t Loc_Index = 0; Loc_Batch.authorized && (Loc_Index < Loc_Batch.count); Loc_Index++)
+            {
+                ST_networkConnection_t *Loc_Connection = Loc_Batch.owners[Loc_Index];
+
+                if (!Loc_Connection->touched)
+                {
+                    Loc_Connection->touched     = 1;
+                    Loc_Connection->nextTouched = Loc_Touched;
+                    Loc_Touched = Loc_Connection;
+                }
+            }
+
+            do
+            {
+                networkFlushBatch(&Loc_Batch);
+
+                for (ST_networkConnection_t *Loc_Connection = Loc_Touched; Loc_Connection != NULL; Loc_Connection = Loc_Connection->nextTouched)
+                {
+                    networkWrite(Loc_Connection);
+                    networkTakeRequests(&Loc_Batch, Loc_Connection);
+                }
+            } while ((Loc_Batch.count != 0) && !Loc_Batch.authorized);
+
+            /* Stage 3: Close the connections that are done, and register the others for what they wait for */
+            while (Loc_Touched != NULL)
+            {
+                ST_networkConnection_t *Loc_Connection = Loc_Touched;
+
+                Loc_Touched = Loc_Connection->nextTouched;
+                Loc_Connection->touched = 0;
+
+                if ((Loc_Connection->pendingCount == 0) && (Loc_Connection->closing ||
+                    (Loc_Connection->ended && (Loc_Connection->inUsed < sizeof(ST_networkRequest_t)) && (Loc_Connection->outUsed == 0))))
+                {
+                    networkClose(&Loc_All, &Loc_OpenCount, Loc_Connection);
+                }
+                else
+                {
+                    networkSetEvents(Loc_Epoll, Loc_Connection->fd, &Loc_Connection->events,
+                                     ((!Loc_Connection->closing && !Loc_Connection->ended &&
+                                       (Loc_Connection->inUsed < sizeof(Loc_Connection->in))) ? EPOLLIN : 0) |
+                                     ((!Loc_Connection->closing && (Loc_Connection->outUsed != 0)) ? EPOLLOUT : 0), Loc_Connection);
+                }
+            }
+        }
+
+        /* Loop: Until all connections are closed */
+        while (Loc_All != NULL)
+        {
+            networkClose(&Loc_All, &Loc_OpenCount, Loc_All);
+        }
+
+        if (Loc_Epoll >= 0)
+        {
+            close(Loc_Epoll);
+        }
+
+        if (Loc_Listener >= 0)
+        {
+            close(Loc_Listener);
+
+            if (strspn(endpoint, "0123456789") != strlen(endpoint))
+            {
+                unlink(endpoint);
+            }
+        }
+    }
+
+    free(Loc_Events);
+    free(Loc_Batch.transactions);
+    free(Loc_Batch.states);
+    free(Loc_Batch.owners);
+    free(Loc_Batch.requestIds);
+
+    return Loc_ErrorState;
+}
+
+/*
+ Name: networkConnect
+ Input: Pointer to endpoint
+ Output: int non-blocking connected socket, or -1 on error
+ Description: Static Function to connect to an endpoint.
+*/
+static int networkConnect(const char *endpoint)
+{
+    struct sockaddr_storage Loc_Address;
+    socklen_t Loc_Length;
+    int Loc_Family = networkAddress(endpoint, &Loc_Address, &Loc_Length);
+    int Loc_Socket;
+    int Loc_One = 1;
+
+    if (Loc_Family < 0)
+    {
+        return -1;
+    }
+
+    Loc_Socket = socket(Loc_Family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+    if (Loc_Socket < 0)
+    {
+        return -1;
+    }
+
+    if (connect(Loc_Socket, (struct sockaddr *)&Loc_Address, Loc_Length) != 0)
+    {
+        close(Loc_Socket);
+        return -1;
+    }
+
+    if (Loc_Family == AF_INET)
+    {
+        setsockopt(Loc_Socket, IPPROTO_TCP, TCP_NODELAY, &Loc_One, sizeof(Loc_One));
+    }
+
+    fcntl(Loc_Socket, F_SETFL, fcntl(Loc_Socket, F_GETFL) | O_NONBLOCK);
+
+    return Loc_Socket;
+}
+
+/*
+ Name: networkLoadSend
+ Input: Pointer to client, Pointer to request template, Pointer to requests sent count, uint64 requestsCount, uint32 depth
+ Output: void
+ Description: Static Function to send requests on a client connection until depth of them are in flight, or all
+              requestsCount requests are sent. Requests cycle through the load accounts.
+*/
+static void networkLoadSend(ST_networkClient_t *client, ST_networkRequest_t *request, uint64_t *sentCount, uint64_t requestsCount, uint32_t depth)
+{
+    uint32_t Loc_Sent = 0;
+
+    /* Loop: Until depth requests are in flight, or all are sent */
+    while ((client->inFlight < depth) && (*sentCount < requestsCount))
+    {
+        const char *Loc_PAN = Glb_LoadPANs[*sentCount % (sizeof(Glb_LoadPANs) / sizeof(Glb_LoadPANs[0]))];
+
+        memset(request->primaryAccountNumber, 0, sizeof(request->primaryAccountNumber));
+        memcpy(request->primaryAccountNumber, Loc_PAN, strlen(Loc_PAN));
+        request->requestId = (uint32_t)*sentCount;
+
+        memcpy(client->out + client->outUsed, request, sizeof(ST_networkRequest_t));
+        client->outUsed += sizeof(ST_networkRequest_t);
+        client->sentAt[(client->head + client->inFlight) % NETWORK_MAX_DEPTH] = networkNow();
+        client->inFlight++;
+        (*sentCount)++;
+    }
+
+    /* Loop: Until all queued requests are sent, or the socket is full */
+    while (!client->failed && (Loc_Sent < client->outUsed))
+    {
+        ssize_t Loc_Count = send(client->fd, client->out + Loc_Sent, client->outUsed - Loc_Sent, MSG_NOSIGNAL);
+
+        if (Loc_Count > 0)
+        {
+            Loc_Sent += (uint32_t)Loc_Count;
+        }
+        else if ((Loc_Count < 0) && (errno == EINTR))
+        {
+            continue;
+        }
+        else if ((Loc_Count < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK)))
+        {
+            break;
+        }
+        else
+        {
+            client->failed = 1;
+        }
+    }
+
+    client->outUsed -= Loc_Sent;
+    memmove(client->out, client->out + Loc_Sent, client->outUsed);
+}
+
+/*
+ Name: networkLoadReceive
+ Input: Pointer to client, and Pointer to Load Stats structure
+ Output: void
+ Description: Static Function to read the responses of a client connection, and time the requests they answer.
+*/
+static void networkLoadReceive(ST_networkClient_t *client, ST_networkLoadStats_t *stats)
+{
+    uint32_t Loc_Offset = 0;
+    ssize_t Loc_Read = recv(client->fd, client->in + client->inUsed, sizeof(client->in) - client->inUsed, 0);
+    uint64_t Loc_Now = networkNow();
+
+    if (Loc_Read > 0)
+    {
+        client->inUsed += (uint32_t)Loc_Read;
+    }
+    else if ((Loc_Read == 0) || ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR)))
+    {
+        client->failed = 1;
+        return;
+    }
+
+    /* Loop: Until no whole response is left */
+    while ((client->inUsed - Loc_Offset) >= sizeof(ST_networkResponse_t))
+    {
+        ST_networkResponse_t Loc_Response;
+
+        memcpy(&Loc_Response, client->in + Loc_Offset, sizeof(ST_networkResponse_t));
+        Loc_Offset += sizeof(ST_networkResponse_t);
+
+        /* Check 1: Response to no request */
+        if (client->inFlight == 0)
+        {
+            client->failed = 1;
+            return;
+        }
+
+        stats->latenciesNs[stats->requestsCount++] = Loc_Now - client->sentAt[client->head];
+        client->head = (client->head + 1) % NETWORK_MAX_DEPTH;
+        client->inFlight--;
+
+        if (Loc_Response.transState <= DECLINED_VELOCITY)
+        {
+            stats->states[Loc_Response.transState]++;
+        }
+    }
+
+    client->inUsed -= Loc_Offset;
+    memmove(client->in, client->in + Loc_Offset, client->inUsed);
+}
+
+/*
+ Name: networkLoad
+ Input: Pointer to Load Config structure, and Pointer to Load Stats structure
+ Output: EN_networkError_t Error or No Error
+ Description: Function to load a running networkServe daemon: it opens connectionsCount connections, keeps depth
+              requests in flight on each one, until requestsCount requests are answered, and times each round trip.
+              1. Requests are 0.01 SALE transactions that cycle through running accounts with large balances.
+              2. A connection that fails loses its requests in flight, the others carry on.
+              3. stats must be freed with networkFreeLoadStats, even on error.
+*/
+EN_networkError_t networkLoad(const ST_networkLoadConfig_t *config, ST_networkLoadStats_t *stats)
+{
+    EN_networkError_t Loc_ErrorState = NETWORK_OK;
+    const char *Loc_Endpoint = (config->endpoint != NULL) ? config->endpoint : NETWORK_DEFAULT_ENDPOINT;
+    struct epoll_event *Loc_Events;
+    ST_networkClient_t *Loc_Clients;
+    ST_networkRequest_t Loc_Request;
+    uint64_t Loc_SentCount = 0;
+    uint64_t Loc_LostCount = 0;
+    uint32_t Loc_LiveCount = 0;
+    uint64_t Loc_Start;
+    int Loc_Epoll;
+
+    memset(stats, 0, sizeof(ST_networkLoadStats_t));
+
+    /* Check 1: Wrong config */
+    if ((config->connectionsCount == 0) || (config->connectionsCount > NETWORK_MAX_CONNECTIONS) ||
+        (config->requestsCount == 0) || (config->depth == 0) || (config->depth > NETWORK_MAX_DEPTH))
+    {
+        return NETWORK_WRONG_CONFIG;
+    }
+
+    Loc_Events  = malloc(NETWORK_MAX_EVENTS * sizeof(struct epoll_event));
+    Loc_Clients = calloc(config->connectionsCount, sizeof(ST_networkClient_t));
+    stats->latenciesNs = malloc(config->requestsCount * sizeof(uint64_t));
+
+    /* Check 2: Not enough memory */
+    if ((Loc_Events == NULL) || (Loc_Clients == NULL) || (stats->latenciesNs == NULL))
+    {
+        free(Loc_Events);
+        free(Loc_Clients);
+        return NETWORK_NO_MEMORY;
+    }
+
+    memset(&Loc_Request, 0, sizeof(ST_networkRequest_t));
+    Loc_Request.version        = NETWORK_PROTOCOL_VERSION;
+    Loc_Request.transAmount    = MONEY_AMOUNT(0, 1);
+    Loc_Request.maxTransAmount = MONEY_AMOUNT(4000, 0);
+    strcpy((char *)Loc_Request.cardHolderName, "Network Load Client Card");
+    strcpy((char *)Loc_Request.cardExpirationDate, "12/30");
+    dateToday(Loc_Request.transactionDate);
+
+    networkRaiseFilesLimit();
+    Loc_Epoll = epoll_create1(EPOLL_CLOEXEC);
+
+    /* Loop: Until all connections are open */
+    for (uint32_t Loc_Index = 0; (Loc_Index < config->connectionsCount) && (Loc_Epoll >= 0); Loc_Index++)
+    {
+        struct epoll_event Loc_Event;
+
+        Loc_Clients[Loc_Index].fd     = networkConnect(Loc_Endpoint);
+        Loc_Clients[Loc_Index].events = EPOLLIN;
+        Loc_Event.events   = EPOLLIN;
+        Loc_Event.data.ptr = &Loc_Clients[Loc_Index];
+
+        if ((Loc_Clients[Loc_Index].fd < 0) || (epoll_ctl(Loc_Epoll, EPOLL_CTL_ADD, Loc_Clients[Loc_Index].fd, &Loc_Event) != 0))
+        {
+            Loc_ErrorState = NETWORK_SOCKET_ERROR;
+            break;
+        }
+
+        stats->connectionsCount++;
+    }
+
+    /* Check 3: Not all connections could be opened */
+    if ((Loc_Epoll < 0) || (Loc_ErrorState != NETWORK_OK))
+    {
+        Loc_ErrorState = NETWORK_SOCKET_ERROR;
+    }
+    else
+    {
+        Loc_Start = networkNow();
+        Loc_LiveCount = stats->connectionsCount;
+
+        /* Step 1: Fill every connection */
+        for (uint32_t Loc_Index = 0; Loc_Index < stats->connectionsCount; Loc_Index++)
+        {
+            networkLoadSend(&Loc_Clients[Loc_Index], &Loc_Request, &Loc_SentCount, config->requestsCount, config->depth);
+        }
+
+        /* Step 2: Loop: Until all requests are answered or lost, or all connections failed */
+        while (((stats->requestsCount + Loc_LostCount) < config->requestsCount) && (Loc_LiveCount != 0))
+        {
+            int Loc_Count = epoll_wait(Loc_Epoll, Loc_Events, NETWORK_MAX_EVENTS, 1000);
+
+            if ((Loc_Count < 0) && (errno != EINTR))
+            {
+                Loc_ErrorState = NETWORK_SOCKET_ERROR;
+                break;
+            }
+
+            for (int Loc_Index = 0; Loc_Index < Loc_Count; Loc_Index++)
+            {
+                ST_networkClient_t *Loc_Client = Loc_Events[Loc_Index].data.ptr;
+
+                if (Loc_Client->failed)
+                {
+                    continue;
+                }
+
+                if (Loc_Events[Loc_Index].events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+                {
+                    networkLoadReceive(Loc_Client, stats);
+                }
+
+                if (!Loc_Client->failed)
+                {
+                    networkLoadSend(Loc_Client, &Loc_Request, &Loc_SentCount, config->requestsCount, config->depth);
+                }
+
+                /* Check 4: Connection failed, its requests in flight are lost, and so are the ones nobody can send */
+                if (Loc_Client->failed)
+                {
+                    Loc_LostCount += Loc_Client->inFlight;
+                    Loc_LiveCount--;
+                    close(Loc_Client->fd);
+                    Loc_Client->fd = -1;
+
+                    if (Loc_LiveCount == 0)
+                    {
+                        Loc_LostCount += config->requestsCount - Loc_SentCount;
+                    }
+                }
+                else
+                {
+                    networkSetEvents(Loc_Epoll, Loc_Client->fd, &Loc_Client->events,
+                                     EPOLLIN | ((Loc_Client->outUsed != 0) ? EPOLLOUT : 0), Loc_Client);
+                }
+            }
+        }
+
+        stats->elapsedNs = networkNow() - Loc_Start;
+
+        if (Loc_LostCount != 0)
+        {
+            Loc_ErrorState = NETWORK_SOCKET_ERROR;
+        }
+    }
+
+    /* Loop: Until all connections are closed */
+    for (uint32_t Loc_Index = 0; Loc_Index < stats->connectionsCount; Loc_Index++)
+    {
+        if (Loc_Clients[Loc_Index].fd >= 0)
+        {
+            close(Loc_Clients[Loc_Index].fd);
+        }
+    }
+
+    if (Loc_Epoll >= 0)
+    {
+        close(Loc_Epoll);
+    }
+
+    if (stats->requestsCount != 0)
+    {
+        qsort(stats->latenciesNs, stats->requestsCount, sizeof(uint64_t), networkCompare);
+    }
+
+    free(Loc_Events);
+    free(Loc_Clients);
+
+    return Loc_ErrorState;
+}
+
+#else
+
+/*
+ Name: networkServe
+ Input: Pointer to endpoint, and Pointer to Serve Stats structure
+ Output: NETWORK_UNSUPPORTED
+ Description: The daemon needs epoll, it only runs on Linux.
+*/
+EN_networkError_t networkServe(const char *endpoint, ST_networkServeStats_t *stats)
+{
+    (void)endpoint;
+    memset(stats, 0, sizeof(ST_networkServeStats_t));
+
+    return NETWORK_UNSUPPORTED;
+}
+
+/*
+ Name: networkLoad
+ Input: Pointer to Load Config structure, and Pointer to Load Stats structure
+ Output: NETWORK_UNSUPPORTED
+ Description: The load client needs epoll, it only runs on Linux.
+*/
+EN_networkError_t networkLoad(const ST_networkLoadConfig_t *config, ST_networkLoadStats_t *stats)
+{
+    (void)config;
+    memset(stats, 0, sizeof(ST_networkLoadStats_t));
+
+    return NETWORK_UNSUPPORTED;
+}
+
+#endif
@@ -0,0 +1,116 @@
+/**
+ * @Title      	: Network Module
+ * @Filename   	: network.h
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+#ifndef NETWORK_H_
+#define NETWORK_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../Date/date.h"
+#include "../Report/report.h"
+#include "../Server/server.h"
+
+/* Default endpoint, a Unix-domain socket path, or a TCP port on 127.0.0.1 if it is all digits */
+#define NETWORK_DEFAULT_ENDPOINT	"payment.sock"
+/* Version of the request format, requests of any other version close their connection */
+#define NETWORK_PROTOCOL_VERSION	1
+/* Max. number of pending connections */
+#define NETWORK_BACKLOG				4096
+/* Max. number of connections served at once, more are closed as soon as they are accepted */
+#define NETWORK_MAX_CONNECTIONS		16384
+/* Max. number of socket events handled per event loop turn */
+#define NETWORK_MAX_EVENTS			1024
+/* Max. number of requests authorized together, and committed to the log with one commit */
+#define NETWORK_MAX_BATCH			4096
+/* Requests and responses buffered per connection */
+#define NETWORK_IN_REQUESTS			64
+#define NETWORK_OUT_RESPONSES		256
+/* Max. number of requests a load client connection keeps in flight */
+#define NETWORK_MAX_DEPTH			64
+
+/**************************************************************************************************************************************/
+/*
+* Binary protocol, fixed size frames in the host byte order (client and server run on the same machine):
+*	client -> server	| ST_networkRequest_t | ST_networkRequest_t | ...
+*	server -> client	| ST_networkResponse_t | ST_networkResponse_t | ...
+* A connection may send many requests before it reads any response (pipelining), responses come back in request order.
+* The server answers a request once its transaction is committed to the transactions log.
+*/
+/**************************************************************************************************************************************/
+typedef struct ST_networkRequest_t
+{
+    uint32_t requestId;					/* Echoed back in the response */
+    uint16_t version;					/* NETWORK_PROTOCOL_VERSION */
+    uint16_t reserved;
+    money_t transAmount;				/* Minor units */
+    money_t maxTransAmount;				/* Minor units */
+    uint8_t primaryAccountNumber[20];
+    uint8_t cardHolderName[25];
+    uint8_t cardExpirationDate[6];
+    uint8_t transactionDate[11];
+}ST_networkRequest_t;
+
+typedef struct ST_networkResponse_t
+{
+    uint32_t requestId;
+    uint32_t transState;				/* EN_transState_t */
+    uint32_t transactionSequenceNumber;
+    uint32_t reserved;
+}ST_networkResponse_t;
+
+typedef enum EN_networkError_t
+{
+    NETWORK_OK, NETWORK_SOCKET_ERROR, NETWORK_NO_MEMORY, NETWORK_WRONG_CONFIG, NETWORK_UNSUPPORTED
+}EN_networkError_t;
+
+typedef struct ST_networkServeStats_t
+{
+    uint64_t connectionsCount;			/* Connections accepted */
+    uint64_t requestsCount;				/* Requests answered */
+    uint64_t batchesCount;				/* Batches authorized, one log commit each */
+}ST_networkServeStats_t;
+
+typedef struct ST_networkLoadConfig_t
+{
+    const char *endpoint;				/* NULL for NETWORK_DEFAULT_ENDPOINT */
+    uint32_t connectionsCount;			/* Concurrent connections */
+    uint64_t requestsCount;				/* Requests sent over all connections */
+    uint32_t depth;						/* Requests in flight per connection, 1 to NETWORK_MAX_DEPTH */
+}ST_networkLoadConfig_t;
+
+typedef struct ST_networkLoadStats_t
+{
+    uint32_t connectionsCount;			/* Connections opened */
+    uint64_t requestsCount;				/* Requests answered */
+    uint64_t states[DECLINED_VELOCITY + 1];	/* Requests answered, per transaction state */
+    uint64_t elapsedNs;					/* Wall time from the first request sent to the last response */
+    uint64_t *latenciesNs;				/* Round trip of each request, sorted once the run ends */
+}ST_networkLoadStats_t;
+
+/**************************************************************************************************************************************/
+/*
+*							Prototypes for all used functions inside the network module.
+*/
+/**************************************************************************************************************************************/
+EN_networkError_t networkServe(const char *endpoint, ST_networkServeStats_t *stats);
+void networkStop(void);
+EN_networkError_t networkLoad(const ST_networkLoadConfig_t *config, ST_networkLoadStats_t *stats);
+uint64_t networkPercentile(const ST_networkLoadStats_t *stats, double percentile);
+void networkPrintLoadStats(const ST_networkLoadStats_t *stats);
+void networkFreeLoadStats(ST_networkLoadStats_t *stats);
+
+#endif /* NETWORK_H_ */
@@ -0,0 +1,436 @@
+/**
+ * @Title      	: Range Module
+ * @Filename   	: range.c
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+
+/* Range Module */
+#include "range.h"
+
+/* Platform 64-bit file offsets */
+#ifdef _WIN32
+#include <io.h>
+#define rangeFileSeek(STREAM, OFFSET)		_fseeki64((STREAM), (__int64)(OFFSET), SEEK_SET)
+#define rangeFileSeekEnd(STREAM)			_fseeki64((STREAM), 0, SEEK_END)
+#define rangeFileTell(STREAM)				((uint64_t)_ftelli64(STREAM))
+#define rangeFileTruncate(STREAM, SIZE)		_chsize_s(_fileno(STREAM), (__int64)(SIZE))
+#else
+#include <sys/types.h>
+#include <unistd.h>
+#define rangeFileSeek(STREAM, OFFSET)		fseeko((STREAM), (off_t)(OFFSET), SEEK_SET)
+#define rangeFileSeekEnd(STREAM)			fseeko((STREAM), 0, SEEK_END)
+#define rangeFileTell(STREAM)				((uint64_t)ftello(STREAM))
+#define rangeFileTruncate(STREAM, SIZE)		ftruncate(fileno(STREAM), (off_t)(SIZE))
+#endif
+
+/*
+ Name: rangeOffset
+ Input: uint64 block
+ Output: uint64 offset in bytes
+ Description: Static Function to get the file offset of the entry of a block.
+*/
+static uint64_t rangeOffset(uint64_t block)
+{
+    return sizeof(ST_rangeHeader_t) + (block * sizeof(ST_rangeEntry_t));
+}
+
+/*
+ Name: rangeLevelCount
+ Input: uint64 blocks, and uint32 level
+ Output: uint64 number of entries
+ Description: Static Function to get the number of entries of a level that sum up a number of blocks.
+*/
+static inline uint64_t rangeLevelCount(uint64_t blocks, uint32_t level)
+{
+    return (blocks != 0) ? (((blocks - 1) >> (RANGE_FANOUT_SHIFT * level)) + 1) : 0;
+}
+
+/*
+ Name: rangeGrow
+ Input: Pointer to index, and uint64 blocks
+ Output: EN_rangeError_t Error or No Error
+ Description: Static Function to make room for a number of blocks in all levels, doubling the room each time.
+*/
+static EN_rangeError_t rangeGrow(ST_rangeIndex_t *index, uint64_t blocks)
+{
+    uint64_t Loc_Capacity = (index->capacity != 0) ? index->capacity : RANGE_MIN_CAPACITY;
+
+    /* Loop: Until there is room for all blocks */
+    while (Loc_Capacity < blocks)
+    {
+        Loc_Capacity *= 2;
+    }
+
+    /* Check 1: Already room for all blocks */
+    if (Loc_Capacity == index->capacity)
+    {
+        return RANGE_OK;
+    }
+
+    for (uint32_t Loc_Level = 0; Loc_Level < RANGE_LEVELS_COUNT; Loc_Level++)
+    {
+        ST_rangeEntry_t *Loc_Entries = realloc(index->levels[Loc_Level], (size_t)rangeLevelCount(Loc_Capacity, Loc_Level) * sizeof(ST_rangeEntry_t));
+
+        /* Check 2: Not enough memory, the levels grown so far keep their entries */
+        if (Loc_Entries == NULL)
+        {
+            return RANGE_NO_MEMORY;
+        }
+
+        index->levels[Loc_Level] = Loc_Entries;
+    }
+
+    index->capacity = Loc_Capacity;
+
+    return RANGE_OK;
+}
+
+/*
+ Name: rangeRebuild
+ Input: Pointer to index
+ Output: void
+ Description: Static Function to sum up the blocks again in all levels above them, after they are loaded or cut.
+*/
+static void rangeRebuild(ST_rangeIndex_t *index)
+{
+    uint64_t Loc_Blocks = (index->count + RANGE_BLOCK_RECORDS - 1) >> RANGE_BLOCK_SHIFT;
+
+    /* Loop: Until all levels above the blocks are summed up, from the lowest */
+    for (uint32_t Loc_Level = 1; Loc_Level < RANGE_LEVELS_COUNT; Loc_Level++)
+    {
+        const ST_rangeEntry_t *Loc_Children = index->levels[Loc_Level - 1];
+        uint64_t Loc_ChildrenCount = rangeLevelCount(Loc_Blocks, Loc_Level - 1);
+
+        for (uint64_t Loc_Entry = 0; Loc_Entry < rangeLevelCount(Loc_Blocks, Loc_Level); Loc_Entry++)
+        {
+            ST_rangeEntry_t Loc_Sum = { UINT32_MAX, 0 };
+
+            for (uint64_t Loc_Child = Loc_Entry << RANGE_FANOUT_SHIFT;
+                 (Loc_Child < Loc_ChildrenCount) && (Loc_Child < ((Loc_Entry + 1) << RANGE_FANOUT_SHIFT)); Loc_Child++)
+            {
+                if (Loc_Children[Loc_Child].minKey < Loc_Sum.minKey)
+                {
+                    Loc_Sum.minKey = Loc_Children[Loc_Child].minKey;
+                }
+
+                if (Loc_Children[Loc_Child].maxKey > Loc_Sum.maxKey)
+                {
+                    Loc_Sum.maxKey = Loc_Children[Loc_Child].maxKey;
+                }
+            }
+
+            index->levels[Loc_Level][Loc_Entry] = Loc_Sum;
+        }
+    }
+}
+
+/*
+ Name: rangeLoad
+ Input: Pointer to index
+ Output: EN_rangeError_t Error or No Error
+ Description: Static Function to validate an existing index file, and load the entries of all its blocks.
+              A partial entry at the end, torn by a crash, is cut off.
+*/
+static EN_rangeError_t rangeLoad(ST_rangeIndex_t *index)
+{
+    ST_rangeHeader_t Loc_Header;
+    uint64_t Loc_Size;
+    uint64_t Loc_Blocks;
+
+    /* Check 1: Not an index file */
+    if ((fread(&Loc_Header, sizeof(Loc_Header), 1, index->file) != 1) ||
+        (Loc_Header.magic        != RANGE_MAGIC)   ||
+        (Loc_Header.version      != RANGE_VERSION) ||
+        (Loc_Header.entrySize    != sizeof(ST_rangeEntry_t)) ||
+        (Loc_Header.blockRecords != RANGE_BLOCK_RECORDS))
+    {
+        return RANGE_WRONG_FORMAT;
+    }
+
+    rangeFileSeekEnd(index->file);
+    Loc_Size   = rangeFileTell(index->file);
+    Loc_Blocks = (Loc_Size - sizeof(ST_rangeHeader_t)) / sizeof(ST_rangeEntry_t);
+
+    /* Check 2: Not enough memory, or the entries can't be read */
+    if (rangeGrow(index, Loc_Blocks) != RANGE_OK)
+    {
+        return RANGE_NO_MEMORY;
+    }
+
+    if ((rangeFileSeek(index->file, rangeOffset(0)) != 0) ||
+        (fread(index->levels[0], sizeof(ST_rangeEntry_t), (size_t)Loc_Blocks, index->file) != Loc_Blocks))
+    {
+        return RANGE_FILE_ERROR;
+    }
+
+    /* Check 3: Cut off a torn entry */
+    if ((rangeOffset(Loc_Blocks) != Loc_Size) &&
+        ((fflush(index->file) != 0) || (rangeFileTruncate(index->file, rangeOffset(Loc_Blocks)) != 0)))
+    {
+        return RANGE_FILE_ERROR;
+    }
+
+    index->count        = Loc_Blocks << RANGE_BLOCK_SHIFT;
+    index->syncedBlocks = Loc_Blocks;
+    rangeRebuild(index);
+
+    return RANGE_OK;
+}
+
+/*
+ Name: rangeOpen
+ Input: Pointer to index, Pointer to file name (NULL for an index in memory only), and uint8 truncate
+ Output: EN_rangeError_t Error or No Error
+ Description: Function to open a range index file and load its blocks, it is created empty if it doesn't exist or
+              truncate isn't 0. The records of the last block, which isn't in the file, are added again by the caller
+              (see rangeTruncate).
+*/
+EN_rangeError_t rangeOpen(ST_rangeIndex_t *index, const char *fileName, uint8_t truncate)
+{
+    EN_rangeError_t Loc_ErrorState;
+
+    memset(index, 0, sizeof(ST_rangeIndex_t));
+
+    Loc_ErrorState = rangeGrow(index, RANGE_MIN_CAPACITY);
+    index->file = ((fileName != NULL) && (truncate == 0)) ? fopen(fileName, "r+b") : NULL;
+
+    /* Check 1: File exists, load it */
+    if ((Loc_ErrorState == RANGE_OK) && (index->file != NULL))
+    {
+        Loc_ErrorState = rangeLoad(index);
+    }
+    /* Check 2: File doesn't exist, create it with its header */
+    else if ((Loc_ErrorState == RANGE_OK) && (fileName != NULL))
+    {
+        ST_rangeHeader_t Loc_Header = { RANGE_MAGIC, RANGE_VERSION, sizeof(ST_rangeEntry_t), RANGE_BLOCK_RECORDS };
+
+        index->file = fopen(fileName, "w+b");
+
+        if ((index->file == NULL) || (fwrite(&Loc_Header, sizeof(Loc_Header), 1, index->file) != 1) ||
+            (fflush(index->file) != 0))
+        {
+            Loc_ErrorState = RANGE_FILE_ERROR;
+        }
+    }
+
+    /* Check 3: Index can't be used, release it */
+    if (Loc_ErrorState != RANGE_OK)
+    {
+        rangeClose(index);
+    }
+
+    return Loc_ErrorState;
+}
+
+/*
+ Name: rangeTruncate
+ Input: Pointer to index, and uint64 count
+ Output: EN_rangeError_t Error or No Error
+ Description: Function to keep only the full blocks of the first count records, e.g. when the log they index was cut
+              after a crash. The records from the returned index->count up to count are then added again by the caller.
+              Entries cut off are removed from the file too, so they are never taken for the records added after.
+*/
+EN_rangeError_t rangeTruncate(ST_rangeIndex_t *index, uint64_t count)
+{
+    uint64_t Loc_Blocks = count >> RANGE_BLOCK_SHIFT;
+
+    /* Check 1: Index has no records past count */
+    if (count >= index->count)
+    {
+        return RANGE_OK;
+    }
+
+    index->count = Loc_Blocks << RANGE_BLOCK_SHIFT;
+
+    /* Check 2: Entries cut off are in the file */
+    if ((index->file != NULL) && (index->syncedBlocks > Loc_Blocks))
+    {
+        index->syncedBlocks = Loc_Blocks;
+
+        if ((fflush(index->file) != 0) || (rangeFileTruncate(index->file, rangeOffset(Loc_Blocks)) != 0))
+        {
+            return RANGE_FILE_ERROR;
+        }
+    }
+
+    rangeRebuild(index);
+
+    return RANGE_OK;
+}
+
+/*
+ Name: rangeAdd
+ Input: Pointer to index, and uint32 key
+ Output: EN_rangeError_t Error or No Error
+ Description: Function to add the key of the next record of the log, to its block and the levels above it.
+              A level is only updated while the key widens the range of the level below, so most adds stop at the block.
+              If there is no room for a new block returns RANGE_NO_MEMORY, and the record is not added.
+*/
+EN_rangeError_t rangeAdd(ST_rangeIndex_t *index, uint32_t key)
+{
+    uint64_t Loc_Block = index->count >> RANGE_BLOCK_SHIFT;
+
+    /* Check 1: First record of a block, start its entry and the entries of the groups it starts */
+    if ((index->count & (RANGE_BLOCK_RECORDS - 1)) == 0)
+    {
+        if ((Loc_Block >= index->capacity) && (rangeGrow(index, Loc_Block + 1) != RANGE_OK))
+        {
+            return RANGE_NO_MEMORY;
+        }
+
+        for (uint32_t Loc_Level = 0; Loc_Level < RANGE_LEVELS_COUNT; Loc_Level++)
+        {
+            if ((Loc_Block & ((1ULL << (RANGE_FANOUT_SHIFT * Loc_Level)) - 1)) == 0)
+            {
+                index->levels[Loc_Level][Loc_Block >> (RANGE_FANOUT_SHIFT * Loc_Level)].minKey = UINT32_MAX;
+                index->levels[Loc_Level][Loc_Block >> (RANGE_FANOUT_SHIFT * Loc_Level)].maxKey = 0;
+            }
+        }
+    }
+
+    /* Loop: Until a level already covers the key */
+    for (uint32_t Loc_Level = 0; Loc_Level < RANGE_LEVELS_COUNT; Loc_Level++)
+    {
+        ST_rangeEntry_t *Loc_Entry = &index->levels[Loc_Level][Loc_Block >> (RANGE_FANOUT_SHIFT * Loc_Level)];
+        uint8_t Loc_Widened = 0;
+
+        if (key < Loc_Entry->minKey)
+        {
+            Loc_Entry->minKey = key;
+            Loc_Widened = 1;
+        }
+
+        if (key > Loc_Entry->maxKey)
+        {
+            Loc_Entry->maxKey = key;
+            Loc_Widened = 1;
+        }
+
+        if (Loc_Widened == 0)
+        {
+            break;
+        }
+    }
+
+    index->count++;
+
+    return RANGE_OK;
+}
+
+/*
+ Name: rangeFind
+ Input: Pointer to index, uint32 fromKey, uint32 toKey, and uint64 first
+ Output: uint64 position of a record, or index->count if there is none
+ Description: Function to find the first block, from the one of record first on, that may have a key from fromKey to
+              toKey (both included), and get the position to read its records from (first itself, if it is in it).
+              1. The search goes up a level each time it reaches the end of a group, and skips the whole group above
+                 if it has no key in the range, then goes down into the first group that does.
+              2. A block only has keys in the range of its entry, not all of them, so its records are still checked.
+              3. Call it again with the position after the block for the next one.
+*/
+uint64_t rangeFind(const ST_rangeIndex_t *index, uint32_t fromKey, uint32_t toKey, uint64_t first)
+{
+    uint64_t Loc_Blocks = (index->count + RANGE_BLOCK_RECORDS - 1) >> RANGE_BLOCK_SHIFT;
+    uint64_t Loc_Entry  = first >> RANGE_BLOCK_SHIFT;
+    uint32_t Loc_Level  = 0;
+
+    /* Check 1: Empty range, or no record from first on */
+    if ((fromKey > toKey) || (first >= index->count))
+    {
+        return index->count;
+    }
+
+    /* Loop: Until a block in the range is found, or the last entry of a level is passed */
+    while (Loc_Entry < rangeLevelCount(Loc_Blocks, Loc_Level))
+    {
+        const ST_rangeEntry_t *Loc_Range = &index->levels[Loc_Level][Loc_Entry];
+
+        /* Entry has keys in the range: a block is found, or go down to the first entry of its group */
+        if ((Loc_Range->minKey <= toKey) && (Loc_Range->maxKey >= fromKey))
+        {
+            if (Loc_Level == 0)
+            {
+                uint64_t Loc_Start = Loc_Entry << RANGE_BLOCK_SHIFT;
+
+                return (Loc_Start > first) ? Loc_Start : first;
+            }
+
+            Loc_Level--;
+            Loc_Entry <<= RANGE_FANOUT_SHIFT;
+        }
+        /* Entry has no key in the range: go to the next one, or up to the next group once this one ends */
+        else
+        {
+            Loc_Entry++;
+
+            while (((Loc_Entry & (RANGE_FANOUT - 1)) == 0) && (Loc_Level < (RANGE_LEVELS_COUNT - 1)))
+            {
+                Loc_Entry >>= RANGE_FANOUT_SHIFT;
+                Loc_Level++;
+            }
+        }
+    }
+
+    return index->count;
+}
+
+/*
+ Name: rangeSync
+ Input: Pointer to index, and uint64 count
+ Output: EN_rangeError_t Error or No Error
+ Description: Function to write the entries of the blocks filled within the first count records (the ones already in
+              the log) that are not in the file yet, with one write. The file is not flushed to disk, an index that is
+              behind the log is caught up from the log when it is opened.
+*/
+EN_rangeError_t rangeSync(ST_rangeIndex_t *index, uint64_t count)
+{
+    uint64_t Loc_Blocks = ((count < index->count) ? count : index->count) >> RANGE_BLOCK_SHIFT;
+
+    /* Check 1: Index in memory only, or no new full block */
+    if ((index->file == NULL) || (Loc_Blocks <= index->syncedBlocks))
+    {
+        return RANGE_OK;
+    }
+
+    /* Check 2: Entries can't be written */
+    if ((rangeFileSeek(index->file, rangeOffset(index->syncedBlocks)) != 0) ||
+        (fwrite(&index->levels[0][index->syncedBlocks], sizeof(ST_rangeEntry_t), (size_t)(Loc_Blocks - index->syncedBlocks), index->file) !=
+         (Loc_Blocks - index->syncedBlocks)) ||
+        (fflush(index->file) != 0))
+    {
+        return RANGE_FILE_ERROR;
+    }
+
+    index->syncedBlocks = Loc_Blocks;
+
+    return RANGE_OK;
+}
+
+/*
+ Name: rangeClose
+ Input: Pointer to index
+ Output: void
+ Description: Function to close a range index file, and release its levels. Call rangeSync first to keep new blocks.
+*/
+void rangeClose(ST_rangeIndex_t *index)
+{
+    if (index->file != NULL)
+    {
+        fclose(index->file);
+    }
+
+    for (uint32_t Loc_Level = 0; Loc_Level < RANGE_LEVELS_COUNT; Loc_Level++)
+    {
+        free(index->levels[Loc_Level]);
+    }
+
+    memset(index, 0, sizeof(ST_rangeIndex_t));
+}
@@ -0,0 +1,88 @@
+/**
+ * @Title      	: Range Module
+ * @Filename   	: range.h
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+#ifndef RANGE_H_
+#define RANGE_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Range index file signature "RNGE", and format version */
+#define RANGE_MAGIC				0x45474E52UL
+#define RANGE_VERSION			1
+/* Records in a block, as a power of 2 */
+#define RANGE_BLOCK_SHIFT		10
+#define RANGE_BLOCK_RECORDS		(1ULL << RANGE_BLOCK_SHIFT)
+/* Entries of a level summed up by one entry of the level above, as a power of 2 */
+#define RANGE_FANOUT_SHIFT		6
+#define RANGE_FANOUT			(1ULL << RANGE_FANOUT_SHIFT)
+/* Number of levels, blocks are level 0, enough for RANGE_BLOCK_RECORDS * RANGE_FANOUT^4 records */
+#define RANGE_LEVELS_COUNT		5
+/* Min. number of blocks an index has room for before it grows */
+#define RANGE_MIN_CAPACITY		64
+
+/**************************************************************************************************************************************/
+/*
+* Range index file layout, entries are only ever appended, the entry of a block is at its position:
+*	| ST_rangeHeader_t | ST_rangeEntry_t | ST_rangeEntry_t | ...
+* A sparse index over an append-only log: the records are cut in blocks of RANGE_BLOCK_RECORDS, and each block only
+* keeps the lowest and highest key of its records. Each level above sums up RANGE_FANOUT entries of the level below in
+* one entry, so a search skips every group of blocks that has no key in the range at once, and only goes down into the
+* groups that do. With keys that mostly grow with the log (as dates do), the blocks of a range are next to each other,
+* and finding them is O(log n) plus one step per block. Keys out of order are found too, at the cost of their blocks.
+* Only the full blocks are written to the file, the levels above and the last block are rebuilt when it is opened.
+*/
+/**************************************************************************************************************************************/
+typedef struct ST_rangeHeader_t
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t entrySize;			/* sizeof(ST_rangeEntry_t) the file was written with */
+    uint32_t blockRecords;		/* RANGE_BLOCK_RECORDS the file was written with */
+}ST_rangeHeader_t;
+
+typedef struct ST_rangeEntry_t
+{
+    uint32_t minKey;			/* UINT32_MAX and 0 for a block with no records yet */
+    uint32_t maxKey;
+}ST_rangeEntry_t;
+
+typedef struct ST_rangeIndex_t
+{
+    FILE *file;							/* NULL for an index kept in memory only */
+    ST_rangeEntry_t *levels[RANGE_LEVELS_COUNT];
+    uint64_t capacity;					/* Blocks level 0 has room for */
+    uint64_t count;						/* Records added */
+    uint64_t syncedBlocks;				/* Full blocks on disk */
+}ST_rangeIndex_t;
+
+typedef enum EN_rangeError_t
+{
+    RANGE_OK, RANGE_FILE_ERROR, RANGE_WRONG_FORMAT, RANGE_NO_MEMORY
+}EN_rangeError_t;
+
+/**************************************************************************************************************************************/
+/*
+*							Prototypes for all used functions inside the range module.
+*/
+/**************************************************************************************************************************************/
+EN_rangeError_t rangeOpen(ST_rangeIndex_t *index, const char *fileName, uint8_t truncate);
+EN_rangeError_t rangeTruncate(ST_rangeIndex_t *index, uint64_t count);
+EN_rangeError_t rangeAdd(ST_rangeIndex_t *index, uint32_t key);
+uint64_t rangeFind(const ST_rangeIndex_t *index, uint32_t fromKey, uint32_t toKey, uint64_t first);
+EN_rangeError_t rangeSync(ST_rangeIndex_t *index, uint64_t count);
+void rangeClose(ST_rangeIndex_t *index);
+
+#endif /* RANGE_H_ */
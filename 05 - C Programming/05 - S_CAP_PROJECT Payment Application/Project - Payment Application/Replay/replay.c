@@ -0,0 +1,312 @@
+/**
+ * @Title      	: Replay Module
+ * @Filename   	: replay.c
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+
+/* Replay Module */
+#include "replay.h"
+
+/* Number of latencies the stats hold before they grow for the first time */
+#define REPLAY_INITIAL_CAPACITY		4096
+
+/*
+ Name: replayNow
+ Input: void
+ Output: uint64 time in nanoseconds
+ Description: Static Function to read a monotonic enough wall clock for timing records.
+*/
+static uint64_t replayNow(void)
+{
+    struct timespec Loc_Time;
+
+    timespec_get(&Loc_Time, TIME_UTC);
+
+    return ((uint64_t)Loc_Time.tv_sec * 1000000000ULL) + (uint64_t)Loc_Time.tv_nsec;
+}
+
+/*
+ Name: replayCompare
+ Input: Pointer to first latency, and Pointer to second latency
+ Output: int order of the two latencies
+ Description: Static Function to sort latencies in ascending order with qsort.
+*/
+static int replayCompare(const void *first, const void *second)
+{
+    uint64_t Loc_First  = *(const uint64_t *)first;
+    uint64_t Loc_Second = *(const uint64_t *)second;
+
+    return (Loc_First > Loc_Second) - (Loc_First < Loc_Second);
+}
+
+/*
+ Name: replayTransaction
+ Input: Pointer to record line, Pointer to Terminal Data template, and Pointer to Transaction State
+ Output: EN_replayStage_t stage the record stopped at
+ Description: Static Function to run one record "name,PAN,MM/YY,DD/MM/YYYY,amount" through the same validation chain as
+              the interactive application (card data, then terminal data, then the server), with no console I/O.
+              1. A record without its five fields returns REPLAY_WRONG_RECORD.
+              2. Wrong card data returns REPLAY_CARD_ERROR, wrong terminal data, an expired card, or an amount over the
+                 terminal max. amount return REPLAY_TERMINAL_ERROR.
+              3. Otherwise the server authorizes it, transState is set, and returns REPLAY_SERVER_STATE.
+              The line is split in place.
+*/
+static EN_replayStage_t replayTransaction(char *line, const ST_terminalData_t *terminalData, EN_transState_t *transState)
+{
+    ST_transaction_t Loc_Transaction;
+    char *Loc_Fields[REPLAY_FIELDS_COUNT];
+    uint8_t Loc_FieldsCount = 0;
+    money_t Loc_Amount;
+
+    /* Loop: Until the end of the line, split it into its fields */
+    Loc_Fields[Loc_FieldsCount++] = line;
+
+    for (char *Loc_Cursor = line; *Loc_Cursor != '\0'; Loc_Cursor++)
+    {
+        if (*Loc_Cursor == ',')
+        {
+            /* Check 1: Too many fields */
+            if (Loc_FieldsCount == REPLAY_FIELDS_COUNT)
+            {
+                return REPLAY_WRONG_RECORD;
+            }
+
+            *Loc_Cursor = '\0';
+            Loc_Fields[Loc_FieldsCount++] = Loc_Cursor + 1;
+        }
+        else if ((*Loc_Cursor == '\r') || (*Loc_Cursor == '\n'))
+        {
+            *Loc_Cursor = '\0';
+            break;
+        }
+    }
+
+    /* Check 2: Too few fields */
+    if (Loc_FieldsCount != REPLAY_FIELDS_COUNT)
+    {
+        return REPLAY_WRONG_RECORD;
+    }
+
+    /* Stage 1: Card Data, the validators check the lengths, so the fields fit in the card data once they pass */
+    if ((isValidCardHolderName((uint8_t *)Loc_Fields[0]) != CARD_OK) ||
+        (isValidCardExpiryDate((uint8_t *)Loc_Fields[2]) != CARD_OK) ||
+        (isValidCardPANFormat((uint8_t *)Loc_Fields[1]) != CARD_OK))
+    {
+        return REPLAY_CARD_ERROR;
+    }
+
+    memset(&Loc_Transaction, 0, sizeof(ST_transaction_t));
+    strcpy((char *)Loc_Transaction.cardHolderData.cardHolderName, Loc_Fields[0]);
+    strcpy((char *)Loc_Transaction.cardHolderData.primaryAccountNumber, Loc_Fields[1]);
+    strcpy((char *)Loc_Transaction.cardHolderData.cardExpirationDate, Loc_Fields[2]);
+    dateParseExpiry(Loc_Transaction.cardHolderData.cardExpirationDate, &Loc_Transaction.cardHolderData.packedExpirationDate);
+
+    /* Stage 2: Terminal Data */
+    Loc_Transaction.terminalData = *terminalData;
+
+    if ((setTransactionDate(&Loc_Transaction.terminalData, (uint8_t *)Loc_Fields[3]) != TERMINAL_OK) ||
+        (isCardExpired(&Loc_Transaction.cardHolderData, &Loc_Transaction.terminalData) != TERMINAL_OK) ||
+        (moneyParse(Loc_Fields[4], &Loc_Amount) != MONEY_OK) ||
+        (setTransactionAmount(&Loc_Transaction.terminalData, Loc_Amount) != TERMINAL_OK) ||
+        (isBelowMaxAmount(&Loc_Transaction.terminalData) != TERMINAL_OK))
+    {
+        return REPLAY_TERMINAL_ERROR;
+    }
+
+    /* Stage 3: Server */
+    *transState = recieveTransactionData(&Loc_Transaction);
+
+    return REPLAY_SERVER_STATE;
+}
+
+/*
+ Name: replayRun
+ Input: Pointer to records file name, uint32 passesCount, and Pointer to Stats structure
+ Output: EN_replayError_t Error or No Error
+ Description: Function to stream the records of a file through the validation chain passesCount times, as fast as
+              it can, and time each record.
+              1. The server runs on REPLAY_ACCOUNTS_FILE and REPLAY_JOURNAL_FILE, recreated before each run, so runs
+                 start from the built-in accounts and never debit the accounts of the interactive application.
+              2. Transactions are committed to the log with the server's group commit, and once more at the end.
+              3. Empty lines and lines starting with '#' are skipped, and aren't counted.
+              4. stats must be freed with replayFreeStats, even on error.
+*/
+EN_replayError_t replayRun(const char *fileName, uint32_t passesCount, ST_replayStats_t *stats)
+{
+    EN_replayError_t Loc_ErrorState = REPLAY_OK;
+    ST_serverConfig_t Loc_Config;
+    ST_terminalData_t Loc_TerminalData;
+    char Loc_Line[REPLAY_LINE_SIZE];
+    uint64_t Loc_Capacity = 0;
+    uint64_t Loc_Start;
+    FILE *Loc_File;
+
+    memset(stats, 0, sizeof(ST_replayStats_t));
+    memset(&Loc_TerminalData, 0, sizeof(ST_terminalData_t));
+    memset(&Loc_Config, 0, sizeof(ST_serverConfig_t));
+    Loc_Config.accountsFile     = REPLAY_ACCOUNTS_FILE;
+    Loc_Config.journal.fileName = REPLAY_JOURNAL_FILE;
+    setMaxAmount(&Loc_TerminalData, REPLAY_MAX_AMOUNT);
+
+    /* Check 1: Records file can't be opened */
+    Loc_File = fopen(fileName, "r");
+
+    if (Loc_File == NULL)
+    {
+        return REPLAY_FILE_ERROR;
+    }
+
+    /* Check 2: Server can't be started */
+    serverRemoveFiles(&Loc_Config);
+
+    if (serverInit(&Loc_Config) != SERVER_OK)
+    {
+        fclose(Loc_File);
+        return REPLAY_SERVER_ERROR;
+    }
+
+    Loc_Start = replayNow();
+
+    /* Loop: Until all passes over the file are done */
+    for (uint32_t Loc_Pass = 0; (Loc_Pass < passesCount) && (Loc_ErrorState == REPLAY_OK); Loc_Pass++)
+    {
+        rewind(Loc_File);
+
+        /* Loop: Until the end of the file */
+        while (fgets(Loc_Line, sizeof(Loc_Line), Loc_File) != NULL)
+        {
+            EN_transState_t Loc_TransState = INTERNAL_SERVER_ERROR;
+            EN_replayStage_t Loc_Stage;
+            uint64_t Loc_RecordStart;
+
+            if ((Loc_Line[0] == '#') || (Loc_Line[0] == '\r') || (Loc_Line[0] == '\n'))
+            {
+                continue;
+            }
+
+            /* Check 3: Grow the latencies if needed */
+            if (stats->records == Loc_Capacity)
+            {
+                uint64_t Loc_NewCapacity = (Loc_Capacity == 0) ? REPLAY_INITIAL_CAPACITY : (Loc_Capacity * 2);
+                uint64_t *Loc_Latencies = realloc(stats->latenciesNs, Loc_NewCapacity * sizeof(uint64_t));
+
+                if (Loc_Latencies == NULL)
+                {
+                    Loc_ErrorState = REPLAY_NO_MEMORY;
+                    break;
+                }
+
+                stats->latenciesNs = Loc_Latencies;
+                Loc_Capacity = Loc_NewCapacity;
+            }
+
+            Loc_RecordStart = replayNow();
+            Loc_Stage = replayTransaction(Loc_Line, &Loc_TerminalData, &Loc_TransState);
+            stats->latenciesNs[stats->records++] = replayNow() - Loc_RecordStart;
+
+            stats->stages[Loc_Stage]++;
+
+            if (Loc_Stage == REPLAY_SERVER_STATE)
+            {
+                stats->states[Loc_TransState]++;
+            }
+        }
+    }
+
+    /* Check 4: Pending transactions can't be committed */
+    if ((serverCommit() != SERVER_OK) && (Loc_ErrorState == REPLAY_OK))
+    {
+        Loc_ErrorState = REPLAY_SERVER_ERROR;
+    }
+
+    stats->elapsedNs = replayNow() - Loc_Start;
+
+    serverShutdown();
+    fclose(Loc_File);
+
+    if (stats->records != 0)
+    {
+        qsort(stats->latenciesNs, stats->records, sizeof(uint64_t), replayCompare);
+    }
+
+    return Loc_ErrorState;
+}
+
+/*
+ Name: replayPercentile
+ Input: Pointer to Stats structure, and double percentile from 0 to 100
+ Output: uint64 latency in nanoseconds
+ Description: Function to get the latency percentile of a run (nearest rank), 0 if no record was run.
+*/
+uint64_t replayPercentile(const ST_replayStats_t *stats, double percentile)
+{
+    uint64_t Loc_Rank;
+
+    if (stats->records == 0)
+    {
+        return 0;
+    }
+
+    /* Rank of the percentile, from 1 to records */
+    Loc_Rank = (uint64_t)((percentile / 100.0) * (double)stats->records + 0.999999);
+
+    if (Loc_Rank == 0)
+    {
+        Loc_Rank = 1;
+    }
+    else if (Loc_Rank > stats->records)
+    {
+        Loc_Rank = stats->records;
+    }
+
+    return stats->latenciesNs[Loc_Rank - 1];
+}
+
+/*
+ Name: replayPrintStats
+ Input: Pointer to Stats structure
+ Output: void
+ Description: Function to print out the outcome of each record, the throughput, and the latency percentiles of a run.
+*/
+void replayPrintStats(const ST_replayStats_t *stats)
+{
+    double Loc_Seconds = (double)stats->elapsedNs / 1e9;
+
+    printf(" Records:\t\t%llu in %.3f s, %.0f transactions/s\n", (unsigned long long)stats->records, Loc_Seconds,
+           (Loc_Seconds > 0) ? ((double)stats->records / Loc_Seconds) : 0.0);
+    printf(" Wrong records:\t\t%llu\n", (unsigned long long)stats->stages[REPLAY_WRONG_RECORD]);
+    printf(" Card errors:\t\t%llu\n", (unsigned long long)stats->stages[REPLAY_CARD_ERROR]);
+    printf(" Terminal errors:\t%llu\n", (unsigned long long)stats->stages[REPLAY_TERMINAL_ERROR]);
+
+    /* Loop: Until all transaction states are printed out */
+    for (uint8_t Loc_State = APPROVED; Loc_State <= DECLINED_VELOCITY; Loc_State++)
+    {
+        printf(" %-28s%llu\n", reportStateName((EN_transState_t)Loc_State), (unsigned long long)stats->states[Loc_State]);
+    }
+
+    printf(" Latency (us):\t\tp50 %.2f, p90 %.2f, p99 %.2f, p999 %.2f, max %.2f\n",
+           replayPercentile(stats, 50.0) / 1e3, replayPercentile(stats, 90.0) / 1e3,
+           replayPercentile(stats, 99.0) / 1e3, replayPercentile(stats, 99.9) / 1e3,
+           replayPercentile(stats, 100.0) / 1e3);
+}
+
+/*
+ Name: replayFreeStats
+ Input: Pointer to Stats structure
+ Output: void
+ Description: Function to free the latencies of a run.
+*/
+void replayFreeStats(ST_replayStats_t *stats)
+{
+    free(stats->latenciesNs);
+    stats->latenciesNs = NULL;
+    stats->records = 0;
+}
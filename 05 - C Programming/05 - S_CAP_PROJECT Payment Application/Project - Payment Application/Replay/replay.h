@@ -0,0 +1,70 @@
+/**
+ * @Title      	: Replay Module
+ * @Filename   	: replay.h
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+#ifndef REPLAY_H_
+#define REPLAY_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../Card/card.h"
+#include "../Money/money.h"
+#include "../Terminal/terminal.h"
+#include "../Report/report.h"
+#include "../Server/server.h"
+
+/* Scratch accounts file, recreated with the built-in accounts before each run */
+#define REPLAY_ACCOUNTS_FILE		"replay_accounts.db"
+/* Scratch transactions log, recreated empty before each run */
+#define REPLAY_JOURNAL_FILE			"replay_transactions.log"
+/* Terminal max. amount, the same as the interactive application */
+#define REPLAY_MAX_AMOUNT			MONEY_AMOUNT(4000, 0)
+/* Max. size of one record line */
+#define REPLAY_LINE_SIZE			256
+/* Number of fields of one record: name, PAN, expiry date, transaction date, amount */
+#define REPLAY_FIELDS_COUNT			5
+
+typedef enum EN_replayError_t
+{
+    REPLAY_OK, REPLAY_FILE_ERROR, REPLAY_SERVER_ERROR, REPLAY_NO_MEMORY
+}EN_replayError_t;
+
+/* Where the validation chain stopped a record */
+typedef enum EN_replayStage_t
+{
+    REPLAY_WRONG_RECORD, REPLAY_CARD_ERROR, REPLAY_TERMINAL_ERROR, REPLAY_SERVER_STATE, REPLAY_STAGES_COUNT
+}EN_replayStage_t;
+
+typedef struct ST_replayStats_t
+{
+    uint64_t records;							/* Records run through the validation chain */
+    uint64_t stages[REPLAY_STAGES_COUNT];		/* Records stopped at each stage, server states are counted below */
+    uint64_t states[DECLINED_VELOCITY + 1];	/* Records answered by the server, per transaction state */
+    uint64_t elapsedNs;							/* Wall time of the whole run, reading the records included */
+    uint64_t *latenciesNs;						/* Time of each record, sorted once the run ends */
+}ST_replayStats_t;
+
+/**************************************************************************************************************************************/
+/*
+*							Prototypes for all used functions inside the replay module.
+*/
+/**************************************************************************************************************************************/
+EN_replayError_t replayRun(const char *fileName, uint32_t passesCount, ST_replayStats_t *stats);
+uint64_t replayPercentile(const ST_replayStats_t *stats, double percentile);
+void replayPrintStats(const ST_replayStats_t *stats);
+void replayFreeStats(ST_replayStats_t *stats);
+
+#endif /* REPLAY_H_ */
@@ -0,0 +1,310 @@
+/**
+ * @Title      	: Report Module
+ * @Filename   	: report.c
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+
+/* Report Module */
+#include "report.h"
+
+/* Output file, and its write buffer */
+typedef struct ST_reportWriter_t
+{
+    FILE *file;
+    char *buffer;
+    uint32_t used;
+    uint8_t failed;
+}ST_reportWriter_t;
+
+/* Transaction state names, in EN_transState_t order */
+static const char *Glb_StateNames[] =
+{
+    "APPROVED", "DECLINED_INSUFFECIENT_FUND", "DECLINED_STOLEN_CARD", "FRAUD_CARD", "INTERNAL_SERVER_ERROR",
+    "DECLINED_VELOCITY"
+};
+
+/*
+ Name: reportStateName
+ Input: EN_transState_t transState
+ Output: Pointer to state name
+ Description: Function to get the name of a transaction state, "UNKNOWN" if it is out of range.
+*/
+const char *reportStateName(EN_transState_t transState)
+{
+    if ((uint32_t)transState < (sizeof(Glb_StateNames) / sizeof(Glb_StateNames[0])))
+    {
+        return Glb_StateNames[transState];
+    }
+
+    return "UNKNOWN";
+}
+
+/*
+ Name: reportFlush
+ Input: Pointer to writer
+ Output: void
+ Description: Static Function to write the buffered output to the file, in one block.
+*/
+static void reportFlush(ST_reportWriter_t *writer)
+{
+    if ((writer->used != 0) && (fwrite(writer->buffer, 1, writer->used, writer->file) != writer->used))
+    {
+        writer->failed = 1;
+    }
+
+    writer->used = 0;
+}
+
+/*
+ Name: reportPutChar
+ Input: Pointer to writer, and char character
+ Output: void
+ Description: Static Function to add one character to the buffer.
+*/
+static void reportPutChar(ST_reportWriter_t *writer, char character)
+{
+    writer->buffer[writer->used++] = character;
+}
+
+/*
+ Name: reportPutString
+ Input: Pointer to writer, and Pointer to string
+ Output: void
+ Description: Static Function to add a NUL terminated string to the buffer as it is.
+*/
+static void reportPutString(ST_reportWriter_t *writer, const char *string)
+{
+    /* Loop: Until the end of string */
+    while (*string != '\0')
+    {
+        writer->buffer[writer->used++] = *string++;
+    }
+}
+
+/*
+ Name: reportPutUnsigned
+ Input: Pointer to writer, and uint64 number
+ Output: void
+ Description: Static Function to add the decimal digits of a number to the buffer.
+*/
+static void reportPutUnsigned(ST_reportWriter_t *writer, uint64_t number)
+{
+    char Loc_Digits[20];
+    uint8_t Loc_Count = 0;
+
+    /* Loop: Until all digits are found, from the last one */
+    do
+    {
+        Loc_Digits[Loc_Count++] = (char)('0' + (number % 10));
+        number /= 10;
+    } while (number != 0);
+
+    /* Loop: Until all digits are added, from the first one */
+    while (Loc_Count != 0)
+    {
+        writer->buffer[writer->used++] = Loc_Digits[--Loc_Count];
+    }
+}
+
+/*
+ Name: reportPutAmount
+ Input: Pointer to writer, and money_t amount
+ Output: void
+ Description: Static Function to add an amount to the buffer with two decimals, exactly as it is held.
+*/
+static void reportPutAmount(ST_reportWriter_t *writer, money_t amount)
+{
+    writer->used += moneyFormat(amount, &writer->buffer[writer->used]);
+}
+
+/*
+ Name: reportPutText
+ Input: Pointer to writer, Pointer to text, uint32 max. length, and EN_reportFormat_t format
+ Output: void
+ Description: Static Function to add a text field of up to length characters to the buffer, quoted for the format.
+              CSV fields are quoted with doubled quotes, JSON strings are escaped.
+*/
+static void reportPutText(ST_reportWriter_t *writer, const uint8_t *text, uint32_t length, EN_reportFormat_t format)
+{
+    reportPutChar(writer, '"');
+
+    /* Loop: Until the end of text, or its max. length */
+    for (uint32_t Loc_Index = 0; (Loc_Index < length) && (text[Loc_Index] != '\0'); Loc_Index++)
+    {
+        uint8_t Loc_Char = text[Loc_Index];
+
+        if (Loc_Char == '"')
+        {
+            reportPutString(writer, (format == REPORT_CSV) ? "\"\"" : "\\\"");
+        }
+        else if ((format == REPORT_JSON) && (Loc_Char == '\\'))
+        {
+            reportPutString(writer, "\\\\");
+        }
+        else if ((format == REPORT_JSON) && (Loc_Char < 0x20))
+        {
+            reportPutString(writer, "\\u00");
+            reportPutChar(writer, "0123456789abcdef"[Loc_Char >> 4]);
+            reportPutChar(writer, "0123456789abcdef"[Loc_Char & 0x0F]);
+        }
+        else
+        {
+            reportPutChar(writer, (char)Loc_Char);
+        }
+    }
+
+    reportPutChar(writer, '"');
+}
+
+/*
+ Name: reportPutCsv
+ Input: Pointer to writer, and Pointer to transaction
+ Output: void
+ Description: Static Function to add one transaction to the buffer as a CSV line.
+*/
+static void reportPutCsv(ST_reportWriter_t *writer, const ST_transaction_t *transData)
+{
+    reportPutUnsigned(writer, transData->transactionSequenceNumber);
+    reportPutChar(writer, ',');
+    reportPutText(writer, transData->terminalData.transactionDate, sizeof(transData->terminalData.transactionDate), REPORT_CSV);
+    reportPutChar(writer, ',');
+    reportPutAmount(writer, transData->terminalData.transAmount);
+    reportPutChar(writer, ',');
+    reportPutAmount(writer, transData->terminalData.maxTransAmount);
+    reportPutChar(writer, ',');
+    reportPutString(writer, reportStateName(transData->transState));
+    reportPutChar(writer, ',');
+    reportPutText(writer, transData->cardHolderData.cardHolderName, sizeof(transData->cardHolderData.cardHolderName), REPORT_CSV);
+    reportPutChar(writer, ',');
+    reportPutText(writer, transData->cardHolderData.primaryAccountNumber, sizeof(transData->cardHolderData.primaryAccountNumber), REPORT_CSV);
+    reportPutChar(writer, ',');
+    reportPutText(writer, transData->cardHolderData.cardExpirationDate, sizeof(transData->cardHolderData.cardExpirationDate), REPORT_CSV);
+    reportPutString(writer, "\r\n");
+}
+
+/*
+ Name: reportPutJson
+ Input: Pointer to writer, and Pointer to transaction
+ Output: void
+ Description: Static Function to add one transaction to the buffer as a JSON object.
+*/
+static void reportPutJson(ST_reportWriter_t *writer, const ST_transaction_t *transData)
+{
+    reportPutString(writer, "{\"sequenceNumber\":");
+    reportPutUnsigned(writer, transData->transactionSequenceNumber);
+    reportPutString(writer, ",\"transactionDate\":");
+    reportPutText(writer, transData->terminalData.transactionDate, sizeof(transData->terminalData.transactionDate), REPORT_JSON);
+    reportPutString(writer, ",\"amount\":");
+    reportPutAmount(writer, transData->terminalData.transAmount);
+    reportPutString(writer, ",\"maxAmount\":");
+    reportPutAmount(writer, transData->terminalData.maxTransAmount);
+    reportPutString(writer, ",\"state\":\"");
+    reportPutString(writer, reportStateName(transData->transState));
+    reportPutString(writer, "\",\"cardHolderName\":");
+    reportPutText(writer, transData->cardHolderData.cardHolderName, sizeof(transData->cardHolderData.cardHolderName), REPORT_JSON);
+    reportPutString(writer, ",\"primaryAccountNumber\":");
+    reportPutText(writer, transData->cardHolderData.primaryAccountNumber, sizeof(transData->cardHolderData.primaryAccountNumber), REPORT_JSON);
+    reportPutString(writer, ",\"cardExpirationDate\":");
+    reportPutText(writer, transData->cardHolderData.cardExpirationDate, sizeof(transData->cardHolderData.cardExpirationDate), REPORT_JSON);
+    reportPutChar(writer, '}');
+}
+
+/*
+ Name: reportExport
+ Input: Pointer to journal, uint64 first, uint64 count, EN_reportFormat_t format, and Pointer to file name
+ Output: EN_reportError_t Error or No Error
+ Description: Function to export up to count transactions of the log, starting at position first, to a CSV or JSON file.
+              Transactions are read a page at a time and formatted into a large write buffer, so the whole export
+              costs one read per page and one write per REPORT_BUFFER_SIZE bytes.
+*/
+EN_reportError_t reportExport(ST_journal_t *journal, uint64_t first, uint64_t count, EN_reportFormat_t format, const char *fileName)
+{
+    ST_reportWriter_t Loc_Writer = { NULL, NULL, 0, 0 };
+    ST_transaction_t *Loc_Page = malloc(REPORT_PAGE_SIZE * sizeof(ST_transaction_t));
+    uint64_t Loc_Exported = 0;
+    uint32_t Loc_Read;
+
+    Loc_Writer.buffer = malloc(REPORT_BUFFER_SIZE);
+
+    /* Check 1: Buffers can't be allocated */
+    if ((Loc_Page == NULL) || (Loc_Writer.buffer == NULL))
+    {
+        free(Loc_Page);
+        free(Loc_Writer.buffer);
+        return REPORT_NO_MEMORY;
+    }
+
+    Loc_Writer.file = fopen(fileName, "wb");
+
+    /* Check 2: File can't be created */
+    if (Loc_Writer.file == NULL)
+    {
+        free(Loc_Page);
+        free(Loc_Writer.buffer);
+        return REPORT_FILE_ERROR;
+    }
+
+    reportPutString(&Loc_Writer, (format == REPORT_CSV) ?
+                    "sequenceNumber,transactionDate,amount,maxAmount,state,cardHolderName,primaryAccountNumber,cardExpirationDate\r\n" :
+                    "[");
+
+    /* Loop: Until count transactions are exported, or the end of the log */
+    while (Loc_Exported < count)
+    {
+        uint32_t Loc_PageSize = ((count - Loc_Exported) < REPORT_PAGE_SIZE) ? (uint32_t)(count - Loc_Exported) : REPORT_PAGE_SIZE;
+
+        Loc_Read = journalRead(journal, first + Loc_Exported, Loc_Page, Loc_PageSize);
+
+        if (Loc_Read == 0)
+        {
+            break;
+        }
+
+        for (uint32_t Loc_Index = 0; Loc_Index < Loc_Read; Loc_Index++)
+        {
+            /* Check 3: Buffer may not fit another transaction, write it out */
+            if ((REPORT_BUFFER_SIZE - Loc_Writer.used) < REPORT_MAX_LINE_SIZE)
+            {
+                reportFlush(&Loc_Writer);
+            }
+
+            if (format == REPORT_CSV)
+            {
+                reportPutCsv(&Loc_Writer, &Loc_Page[Loc_Index]);
+            }
+            else
+            {
+                reportPutString(&Loc_Writer, ((Loc_Exported + Loc_Index) == 0) ? "\r\n" : ",\r\n");
+                reportPutJson(&Loc_Writer, &Loc_Page[Loc_Index]);
+            }
+        }
+
+        Loc_Exported += Loc_Read;
+    }
+
+    if (format == REPORT_JSON)
+    {
+        reportPutString(&Loc_Writer, "\r\n]\r\n");
+    }
+
+    reportFlush(&Loc_Writer);
+
+    /* Check 4: File wasn't completely written */
+    if ((fclose(Loc_Writer.file) != 0) || Loc_Writer.failed)
+    {
+        Loc_Writer.failed = 1;
+    }
+
+    free(Loc_Page);
+    free(Loc_Writer.buffer);
+
+    return (Loc_Writer.failed) ? REPORT_FILE_ERROR : REPORT_OK;
+}
@@ -0,0 +1,57 @@
+/**
+ * @Title      	: Report Module
+ * @Filename   	: report.h
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+#ifndef REPORT_H_
+#define REPORT_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../Journal/journal.h"
+
+/* Size of the user-space write buffer, the output file is written in blocks of this size */
+#define REPORT_BUFFER_SIZE			(1 << 20)
+/* Max. size of a text field of length characters once quoted, JSON escapes a control character in 6 ("\u00XX") */
+#define REPORT_TEXT_SIZE(length)	((6 * (length)) + 2)
+/* Max. size of the fixed keys, separators, state name and sequence number of one formatted transaction */
+#define REPORT_FIXED_SIZE			256
+/* Max. size of one formatted transaction with the 4 text fields all escaped, the buffer is written out before it gets fuller than this */
+#define REPORT_MAX_LINE_SIZE		(REPORT_FIXED_SIZE + (2 * MONEY_TEXT_SIZE) + \
+									 REPORT_TEXT_SIZE(sizeof(((ST_transaction_t *)0)->terminalData.transactionDate)) + \
+									 REPORT_TEXT_SIZE(sizeof(((ST_transaction_t *)0)->cardHolderData.cardHolderName)) + \
+									 REPORT_TEXT_SIZE(sizeof(((ST_transaction_t *)0)->cardHolderData.primaryAccountNumber)) + \
+									 REPORT_TEXT_SIZE(sizeof(((ST_transaction_t *)0)->cardHolderData.cardExpirationDate)))
+/* Number of transactions read from the log at once */
+#define REPORT_PAGE_SIZE			4096
+
+typedef enum EN_reportFormat_t
+{
+    REPORT_CSV, REPORT_JSON
+}EN_reportFormat_t;
+
+typedef enum EN_reportError_t
+{
+    REPORT_OK, REPORT_FILE_ERROR, REPORT_NO_MEMORY
+}EN_reportError_t;
+
+/**************************************************************************************************************************************/
+/*
+*							Prototypes for all used functions inside the report module.
+*/
+/**************************************************************************************************************************************/
+const char *reportStateName(EN_transState_t transState);
+EN_reportError_t reportExport(ST_journal_t *journal, uint64_t first, uint64_t count, EN_reportFormat_t format, const char *fileName);
+
+#endif /* REPORT_H_ */
@@ -14,73 +14,1318 @@
  */
 #include "server.h"
 
-/* Accounts Database */
-ST_accountsDB_t  accountsDB[255] =               /* Visa */                               /* MasterCard */
-        /* Balance |  State |        PAN       */  /* Balance |  State |        PAN       */
-        {{  12000.0f   , BLOCKED, "4728459258966333"}, {  68600.3f   , RUNNING, "5183150660610263"},
-         {  5805.5f    , RUNNING, "4946084897338284"}, {  5000.3f    , RUNNING, "5400829062340903"},
-         {  90360.12f  , RUNNING, "4728451059691228"}, {  1800000.0f , RUNNING, "5191786640828580"},
-         {  16800.58f  , RUNNING, "4573762093153876"}, {  40800.0f   , RUNNING, "5367052744350494"},
-         {  520.9f     , RUNNING, "4127856791257426"}, {  18900.45f  , RUNNING, "5248692364161088"},
-         {  6900.33f   , RUNNING, "4946099660091878"}, {  1047751.0f , RUNNING, "5419558003040483"},
-         {  200000.0f  , RUNNING, "4834699064563433"}, {  3026239.0f , RUNNING, "5116136307216426"},
-         {  5000000.0f , RUNNING, "4946069587908256"}, {  9362076.0f , RUNNING, "5335847432506029"},
-         {  25600.0f   , RUNNING, "4946085117749481"}, {  10662670.0f, RUNNING, "5424438206113309"},
-         {  895000.0f  , RUNNING, "4946099683908835"}, {  1824.0f    , RUNNING, "5264166325336492"}};
-
-uint8_t Glb_AccountsDBIndex = 0;
-
-/* Transactions Database */
-ST_transaction_t transactionsDB[255] = {0};
-/* Transactions Database Index */
-static uint8_t Glb_TransactionsDBIndex = 0;
+/* Built-in Accounts, written to a newly created accounts file */
+static const ST_accountsDB_t accountsSeed[] =    /* Visa */                             /* MasterCard */
+         /*        Balance        |  State |        PAN       */    /*        Balance        |  State |        PAN       */
+        {{ MONEY_AMOUNT(12000, 0)   , BLOCKED, "4728459258966333"}, { MONEY_AMOUNT(68600, 30)  , RUNNING, "5183150660610263"},
+         { MONEY_AMOUNT(5805, 50)   , RUNNING, "4946084897338284"}, { MONEY_AMOUNT(5000, 30)   , RUNNING, "5400829062340903"},
+         { MONEY_AMOUNT(90360, 12)  , RUNNING, "4728451059691228"}, { MONEY_AMOUNT(1800000, 0) , RUNNING, "5191786640828580"},
+         { MONEY_AMOUNT(16800, 58)  , RUNNING, "4573762093153876"}, { MONEY_AMOUNT(40800, 0)   , RUNNING, "5367052744350494"},
+         { MONEY_AMOUNT(520, 90)    , RUNNING, "4127856791257426"}, { MONEY_AMOUNT(18900, 45)  , RUNNING, "5248692364161088"},
+         { MONEY_AMOUNT(6900, 33)   , RUNNING, "4946099660091878"}, { MONEY_AMOUNT(1047751, 0) , RUNNING, "5419558003040483"},
+         { MONEY_AMOUNT(200000, 0)  , RUNNING, "4834699064563433"}, { MONEY_AMOUNT(3026239, 0) , RUNNING, "5116136307216426"},
+         { MONEY_AMOUNT(5000000, 0) , RUNNING, "4946069587908256"}, { MONEY_AMOUNT(9362076, 0) , RUNNING, "5335847432506029"},
+         { MONEY_AMOUNT(25600, 0)   , RUNNING, "4946085117749481"}, { MONEY_AMOUNT(10662670, 0), RUNNING, "5424438206113309"},
+         { MONEY_AMOUNT(895000, 0)  , RUNNING, "4946099683908835"}, { MONEY_AMOUNT(1824, 0)    , RUNNING, "5264166325336492"}};
+
+/* Accounts Database, mapped from the accounts file */
+static ST_database_t Glb_AccountsDB = {0};
+
+/* PAN filters kept in sync with the accounts file: every PAN, and the blocked PANs only. A PAN the first one has
+   never seen is a FRAUD_CARD with no index lookup, and a PAN the second one has never seen is not blocked. */
+static ST_filter_t Glb_KnownFilter = {0};
+static ST_filter_t Glb_BlockedFilter = {0};
+
+/* Velocity trackers, one per accounts shard of recieveTransactionDataParallel, so each worker only touches its own */
+static ST_velocity_t *Glb_Velocity = NULL;
+static uint32_t Glb_VelocityCount = 0;
+
+/* Transactions Database, appended to the transactions log */
+static ST_journal_t Glb_TransactionsLog = {0};
+/* Transactions log lock, the log is shared by all worker threads */
+static pthread_mutex_t Glb_TransactionsLogLock = PTHREAD_MUTEX_INITIALIZER;
+/* Running totals of the transactions log, updated with each append under the log lock */
+static ST_settlement_t Glb_Settlement = {0};
+
+/* Checkpoint of the balances: its file, the transactions logged between two of them, and the log position of the newest */
+static char Glb_CheckpointFile[FILENAME_MAX] = { 0 };
+static uint64_t Glb_CheckpointInterval = SERVER_CHECKPOINT_INTERVAL;
+static uint64_t Glb_CheckpointCount = 0;
+
+/* Worker threads of recieveTransactionDataParallel, one per accounts shard */
+static ST_workerPool_t Glb_Workers = {0};
+/* PAN keys and shards of the transactions of a parallel call */
+static ST_panKey_t *Glb_ParallelKeys = NULL;
+static uint8_t *Glb_ParallelShards = NULL;
+static uint32_t Glb_ParallelCapacity = 0;
+
+/* Chunk of a batch: the transactions one run of the stage loops goes over, by their positions in the caller's arrays */
+typedef struct ST_serverChunk_t
+{
+    uint32_t count;
+    uint32_t positions[SERVER_BATCH_SIZE];
+    ST_panKey_t keys[SERVER_BATCH_SIZE];
+    ST_accountsDB_t *accounts[SERVER_BATCH_SIZE];
+    uint64_t hashes[SERVER_BATCH_SIZE];
+}ST_serverChunk_t;
+
+/* Arguments of a parallel call, shared by all workers */
+typedef struct ST_serverParallelJob_t
+{
+    ST_transaction_t *transData;
+    EN_transState_t *transStates;
+    uint32_t count;
+    ST_panKey_t *keys;
+    uint8_t *shards;
+    EN_serverError_t errorState;
+}ST_serverParallelJob_t;
 
 /***********************************************************************************************************************/
 
- /**
- * @author         : Tarek Gohry
- * @brief          : Take all transaction data and validate its data 
- * Description     :
-    - It checks the account details and amount availability 
- * Return          :
-    - FRAUD_CARD if the account does not exist 
-    - DECLINED_INSUFFECIENT_FUND if the amount is not available
-	- DECLINED_STOLEN_CARD if the account is blocked 
-	- INTERNAL_SERVER_ERROR if a transaction can't be saved
-	- APPROVED Otherwise
- */
- EN_transState_t recieveTransactionData(ST_transaction_t *transData) {
-     ST_accountsDB_t accountReference;
+/*
+ Name: serverVelocityOf
+ Input: uint64 PAN hash
+ Output: Pointer to the velocity tracker of the PAN
+ Description: Static Function to get the tracker of the shard a PAN belongs to, the same shard as in serverParallelJob.
+*/
+static inline ST_velocity_t *serverVelocityOf(uint64_t hash)
+{
+    return &Glb_Velocity[((hash >> 32) * Glb_VelocityCount) >> 32];
+}
+
+/*
+ Name: serverIsOverVelocity
+ Input: Pointer to Transaction
+ Output: uint8 1 if the transaction takes its account over a velocity limit, else 0
+ Description: Static Function to check one transaction against the velocity limits of its account, it is counted if it
+              is not over them.
+*/
+static uint8_t serverIsOverVelocity(const ST_transaction_t *transData)
+{
+    ST_panKey_t Loc_Key;
+    uint64_t Loc_Hash;
+
+    if ((Glb_VelocityCount == 0) || (panIndexKey(transData->cardHolderData.primaryAccountNumber, &Loc_Key) != INDEX_OK))
+    {
+        return 0;
+    }
+
+    Loc_Hash = panIndexHash(&Loc_Key);
+
+    return velocityCheck(serverVelocityOf(Loc_Hash), Loc_Hash, transData->terminalData.transAmount, (uint32_t)time(NULL)) == VELOCITY_OVER_LIMIT;
+}
+
+ /**
+ * @author         : Tarek Gohry
+ * @brief          : Take all transaction data and validate its data 
+ * Description     :
+    - It checks the account details and amount availability 
+ * Return          :
+    - FRAUD_CARD if the account does not exist 
+    - DECLINED_INSUFFECIENT_FUND if the amount is not available
+	- DECLINED_STOLEN_CARD if the account is blocked 
+	- DECLINED_VELOCITY if the account is over a velocity limit
+	- INTERNAL_SERVER_ERROR if a transaction can't be saved
+	- APPROVED Otherwise
+ */
+ EN_transState_t recieveTransactionData(ST_transaction_t *transData) {
+     ST_accountsDB_t *accountReference = NULL;
+
+     if (findAccount(&transData->cardHolderData, &accountReference) == ACCOUNT_NOT_FOUND) {
+         transData->transState = FRAUD_CARD;
+         if(saveTransaction(transData) == SERVER_OK) return FRAUD_CARD;
+     }
+
+     else if (isBlockedAccount(accountReference) == BLOCKED_ACCOUNT) {
+         transData->transState = DECLINED_STOLEN_CARD;
+         if(saveTransaction(transData) == SERVER_OK) return DECLINED_STOLEN_CARD;
+     }
+
+     else if (serverIsOverVelocity(transData)) {
+         transData->transState = DECLINED_VELOCITY;
+         if(saveTransaction(transData) == SERVER_OK) return DECLINED_VELOCITY;
+     }
+
+     else if (isAmountAvailable(&transData->terminalData, accountReference) == LOW_BALANCE) {
+         transData->transState = DECLINED_INSUFFECIENT_FUND;
+         if(saveTransaction(transData) == SERVER_OK) return DECLINED_INSUFFECIENT_FUND;
+     }
+
+     else// if(transData->transState == APPROVED)
+     {
+         transData->transState = APPROVED;
+         accountReference->balance -= transData->terminalData.transAmount;
+         if(saveTransaction(transData) == SERVER_OK) return APPROVED;
+         /* Transaction is not saved, so it doesn't debit either! */
+         accountReference->balance += transData->terminalData.transAmount;
+     }
+
+     transData->transState = INTERNAL_SERVER_ERROR;
+     return INTERNAL_SERVER_ERROR;
+ }
+
+/*
+ Name: serverAuthorizeChunk
+ Input: Pointer to chunk, Pointer to Transactions array, and Pointer to Transaction States array
+ Output: void
+ Description: Static Function to run the authorization stages over the transactions of a chunk, whose PAN keys are
+              already found: account resolution (the known PANs filter, then one batch lookup of the PANs it passes
+              that prefetches the index slots and account records), blocked-state check (the blocked PANs filter,
+              confirmed by the account record), velocity check (the tracker of the PAN's shard), then amount check with
+              the debit.
+              The amount check and the debit share a loop, so a later transaction on the same account sees the earlier debit.
+*/
+static void serverAuthorizeChunk(ST_serverChunk_t *chunk, ST_transaction_t *transData, EN_transState_t *transStates)
+{
+    ST_accountsDB_t *Loc_KnownAccounts[SERVER_BATCH_SIZE];
+    uint32_t Loc_KnownIndexes[SERVER_BATCH_SIZE];
+    uint8_t Loc_Known[SERVER_BATCH_SIZE];
+    uint32_t Loc_KnownCount = 0;
+
+    /* Stage 1: Account resolution, only the PANs the known PANs filter passes are looked up, their keys are moved to
+                the front of the keys array */
+    for (uint32_t Loc_Index = 0; Loc_Index < chunk->count; Loc_Index++)
+    {
+        chunk->hashes[Loc_Index] = panIndexHash(&chunk->keys[Loc_Index]);
+    }
+
+    filterContainsBatch(&Glb_KnownFilter, chunk->hashes, chunk->count, Loc_Known);
+
+    for (uint32_t Loc_Index = 0; Loc_Index < chunk->count; Loc_Index++)
+    {
+        chunk->accounts[Loc_Index] = NULL;
+
+        if ((chunk->keys[Loc_Index].length != 0) && Loc_Known[Loc_Index])
+        {
+            chunk->keys[Loc_KnownCount]      = chunk->keys[Loc_Index];
+            Loc_KnownIndexes[Loc_KnownCount] = Loc_Index;
+            Loc_KnownCount++;
+        }
+    }
+
+    databaseFindAccountBatch(&Glb_AccountsDB, chunk->keys, Loc_KnownCount, Loc_KnownAccounts);
+
+    for (uint32_t Loc_Index = 0; Loc_Index < Loc_KnownCount; Loc_Index++)
+    {
+        chunk->accounts[Loc_KnownIndexes[Loc_Index]] = Loc_KnownAccounts[Loc_Index];
+    }
+
+    /* Stage 2: Account is found, and not blocked */
+    for (uint32_t Loc_Index = 0; Loc_Index < chunk->count; Loc_Index++)
+    {
+        uint32_t Loc_Position = chunk->positions[Loc_Index];
+
+        if (chunk->accounts[Loc_Index] == NULL)
+        {
+            transStates[Loc_Position] = FRAUD_CARD;
+        }
+        else if (filterContains(&Glb_BlockedFilter, chunk->hashes[Loc_Index]) &&
+                 (isBlockedAccount(chunk->accounts[Loc_Index]) == BLOCKED_ACCOUNT))
+        {
+            transStates[Loc_Position] = DECLINED_STOLEN_CARD;
+        }
+        else
+        {
+            transStates[Loc_Position] = APPROVED;
+        }
+    }
+
+    /* Stage 3: Account is under its velocity limits, the transactions that reach the amount check are counted */
+    if (Glb_VelocityCount != 0)
+    {
+        uint32_t Loc_Now = (uint32_t)time(NULL);
+
+        for (uint32_t Loc_Index = 0; Loc_Index < chunk->count; Loc_Index++)
+        {
+            velocityPrefetch(serverVelocityOf(chunk->hashes[Loc_Index]), chunk->hashes[Loc_Index]);
+        }
+
+        for (uint32_t Loc_Index = 0; Loc_Index < chunk->count; Loc_Index++)
+        {
+            uint32_t Loc_Position = chunk->positions[Loc_Index];
+
+            if ((transStates[Loc_Position] == APPROVED) &&
+                (velocityCheck(serverVelocityOf(chunk->hashes[Loc_Index]), chunk->hashes[Loc_Index],
+                               transData[Loc_Position].terminalData.transAmount, Loc_Now) == VELOCITY_OVER_LIMIT))
+            {
+                transStates[Loc_Position] = DECLINED_VELOCITY;
+            }
+        }
+    }
+
+    /* Stage 4: Amount is available, and debited */
+    for (uint32_t Loc_Index = 0; Loc_Index < chunk->count; Loc_Index++)
+    {
+        uint32_t Loc_Position = chunk->positions[Loc_Index];
+
+        if (transStates[Loc_Position] != APPROVED)
+        {
+            continue;
+        }
+
+        if (isAmountAvailable(&transData[Loc_Position].terminalData, chunk->accounts[Loc_Index]) == LOW_BALANCE)
+        {
+            transStates[Loc_Position] = DECLINED_INSUFFECIENT_FUND;
+        }
+        else
+        {
+            chunk->accounts[Loc_Index]->balance -= transData[Loc_Position].terminalData.transAmount;
+        }
+    }
+}
+
+/*
+ Name: serverSaveChunk
+ Input: Pointer to chunk, Pointer to Transactions array, and Pointer to Transaction States array
+ Output: EN_sreverError_t Error or No Error
+ Description: Static Function to append the authorized transactions of a chunk to the transactions log, with one lock
+              of the log for the whole chunk. A transaction that can't be appended gets INTERNAL_SERVER_ERROR, and its
+              debit is undone.
+*/
+static EN_serverError_t serverSaveChunk(ST_serverChunk_t *chunk, ST_transaction_t *transData, EN_transState_t *transStates)
+{
+    /* Define local variable to set the error state, No Error */
+    EN_serverError_t Loc_ErrorState = SERVER_OK;
+
+    pthread_mutex_lock(&Glb_TransactionsLogLock);
+
+    /* Stage 5: Log append */
+    for (uint32_t Loc_Index = 0; Loc_Index < chunk->count; Loc_Index++)
+    {
+        uint32_t Loc_Position = chunk->positions[Loc_Index];
+
+        transData[Loc_Position].transState = transStates[Loc_Position];
+
+        if (journalAppend(&Glb_TransactionsLog, &transData[Loc_Position]) != JOURNAL_OK)
+        {
+            /* Update error state, Transaction is not saved, so it doesn't debit either! */
+            if (transStates[Loc_Position] == APPROVED)
+            {
+                chunk->accounts[Loc_Index]->balance += transData[Loc_Position].terminalData.transAmount;
+            }
+
+            transData[Loc_Position].transState = INTERNAL_SERVER_ERROR;
+            transStates[Loc_Position] = INTERNAL_SERVER_ERROR;
+            Loc_ErrorState = SAVING_FAILED;
+        }
+        else
+        {
+            settlementAdd(&Glb_Settlement, &transData[Loc_Position]);
+        }
+    }
+
+    pthread_mutex_unlock(&Glb_TransactionsLogLock);
+
+    return Loc_ErrorState;
+}
+
+/*
+ Name: serverCheckpointPoll
+ Input: void
+ Output: void
+ Description: Static Function to checkpoint the balances once checkpointInterval transactions are logged since the last
+              checkpoint. It is called on the calling thread at the end of a call, when no debit is waiting to be logged.
+*/
+static void serverCheckpointPoll(void)
+{
+    if ((journalCount(&Glb_TransactionsLog) - Glb_CheckpointCount) >= Glb_CheckpointInterval)
+    {
+        serverCheckpoint();
+    }
+}
+
+/*
+ Name: serverKeyOf
+ Input: Pointer to Transaction, and Pointer to PAN key
+ Output: void
+ Description: Static Function to get the PAN key of a transaction, a PAN that can't be a key gets length 0 and is never found.
+*/
+static void serverKeyOf(const ST_transaction_t *transData, ST_panKey_t *panKey)
+{
+    if (panIndexKey(transData->cardHolderData.primaryAccountNumber, panKey) != INDEX_OK)
+    {
+        panKey->length = 0;
+    }
+}
+
+/*
+ Name: serverFailAll
+ Input: Pointer to Transactions array, uint32 count, and Pointer to Transaction States array
+ Output: EN_sreverError_t SAVING_FAILED
+ Description: Static Function to give all transactions INTERNAL_SERVER_ERROR, when the server can't be started.
+*/
+static EN_serverError_t serverFailAll(ST_transaction_t *transData, uint32_t count, EN_transState_t *transStates)
+{
+    for (uint32_t Loc_Index = 0; Loc_Index < count; Loc_Index++)
+    {
+        transData[Loc_Index].transState = INTERNAL_SERVER_ERROR;
+        transStates[Loc_Index] = INTERNAL_SERVER_ERROR;
+    }
+
+    return SAVING_FAILED;
+}
+
+/**
+Name: recieveTransactionDataBatch
+Input: Pointer to Transactions array, uint32 count, Pointer to Transaction States array
+Output: EN_sreverError_t Error or No Error
+Description: 1. This function will take count transactions, and authorize them as recieveTransactionData would
+                one after the other, with the same states and the same debits.
+             2. Each stage runs over SERVER_BATCH_SIZE transactions in a tight loop: account resolution, blocked-state
+                check, velocity check, amount check with the debit, then log append.
+             3. The state of each transaction is written to transStates, and to its transState.
+             4. If any transaction can't be saved it gets INTERNAL_SERVER_ERROR (its debit is undone) and
+                SAVING_FAILED is returned, else will return SERVER_OK.
+*/
+EN_serverError_t recieveTransactionDataBatch(ST_transaction_t *transData, uint32_t count, EN_transState_t *transStates)
+{
+    /* Define local variable to set the error state, No Error */
+    EN_serverError_t Loc_ErrorState = SERVER_OK;
+    ST_serverChunk_t Loc_Chunk;
+
+    /* Check 1: Server is not initialized yet, and can't be */
+    if ((Glb_AccountsDB.mapping == NULL) && (serverInit(NULL) != SERVER_OK))
+    {
+        return serverFailAll(transData, count, transStates);
+    }
+
+    /* Loop: Until all transactions are authorized, SERVER_BATCH_SIZE at a time */
+    for (uint32_t Loc_First = 0; Loc_First < count; Loc_First += SERVER_BATCH_SIZE)
+    {
+        Loc_Chunk.count = ((count - Loc_First) < SERVER_BATCH_SIZE) ? (count - Loc_First) : SERVER_BATCH_SIZE;
+
+        for (uint32_t Loc_Index = 0; Loc_Index < Loc_Chunk.count; Loc_Index++)
+        {
+            Loc_Chunk.positions[Loc_Index] = Loc_First + Loc_Index;
+            serverKeyOf(&transData[Loc_First + Loc_Index], &Loc_Chunk.keys[Loc_Index]);
+        }
+
+        serverAuthorizeChunk(&Loc_Chunk, transData, transStates);
+
+        if (serverSaveChunk(&Loc_Chunk, transData, transStates) != SERVER_OK)
+        {
+            Loc_ErrorState = SAVING_FAILED;
+        }
+    }
+
+    serverCheckpointPoll();
+
+    return Loc_ErrorState;
+}
+
+/*
+ Name: serverParallelJob
+ Input: Pointer to parallel job, and uint32 worker
+ Output: void
+ Description: Static Function run by every worker for recieveTransactionDataParallel.
+              1. Each worker finds the PAN keys and shards of an equal slice of the transactions.
+              2. After all workers are done with step 1, each worker authorizes the transactions of its own shard in
+                 their original order. An account only belongs to one shard, so its balance is only ever touched by
+                 one worker, and needs no lock.
+*/
+static void serverParallelJob(void *argument, uint32_t worker)
+{
+    ST_serverParallelJob_t *Loc_Job = (ST_serverParallelJob_t *)argument;
+    EN_serverError_t Loc_ErrorState = SERVER_OK;
+    ST_serverChunk_t Loc_Chunk;
+    uint32_t Loc_Workers = Glb_Workers.threadsCount;
+    uint32_t Loc_SliceFirst = (uint32_t)(((uint64_t)Loc_Job->count * worker) / Loc_Workers);
+    uint32_t Loc_SliceEnd   = (uint32_t)(((uint64_t)Loc_Job->count * (worker + 1)) / Loc_Workers);
+
+    /* Step 1: PAN keys and shards of this worker's slice */
+    for (uint32_t Loc_Index = Loc_SliceFirst; Loc_Index < Loc_SliceEnd; Loc_Index++)
+    {
+        serverKeyOf(&Loc_Job->transData[Loc_Index], &Loc_Job->keys[Loc_Index]);
+
+        Loc_Job->shards[Loc_Index] = (Loc_Job->keys[Loc_Index].length == 0) ? 0 :
+                                     (uint8_t)(((panIndexHash(&Loc_Job->keys[Loc_Index]) >> 32) * Loc_Workers) >> 32);
+    }
+
+    workerPoolBarrier(&Glb_Workers);
+
+    /* Step 2: Authorize the transactions of this worker's shard, SERVER_BATCH_SIZE at a time */
+    Loc_Chunk.count = 0;
+
+    for (uint32_t Loc_Index = 0; Loc_Index < Loc_Job->count; Loc_Index++)
+    {
+        if (Loc_Job->shards[Loc_Index] != worker)
+        {
+            continue;
+        }
+
+        Loc_Chunk.positions[Loc_Chunk.count] = Loc_Index;
+        Loc_Chunk.keys[Loc_Chunk.count]      = Loc_Job->keys[Loc_Index];
+        Loc_Chunk.count++;
+
+        if ((Loc_Chunk.count == SERVER_BATCH_SIZE) || (Loc_Index == (Loc_Job->count - 1)))
+        {
+            serverAuthorizeChunk(&Loc_Chunk, Loc_Job->transData, Loc_Job->transStates);
+
+            if (serverSaveChunk(&Loc_Chunk, Loc_Job->transData, Loc_Job->transStates) != SERVER_OK)
+            {
+                Loc_ErrorState = SAVING_FAILED;
+            }
+
+            Loc_Chunk.count = 0;
+        }
+    }
+
+    /* Check 1: Last chunk is not full */
+    if (Loc_Chunk.count != 0)
+    {
+        serverAuthorizeChunk(&Loc_Chunk, Loc_Job->transData, Loc_Job->transStates);
+
+        if (serverSaveChunk(&Loc_Chunk, Loc_Job->transData, Loc_Job->transStates) != SERVER_OK)
+        {
+            Loc_ErrorState = SAVING_FAILED;
+        }
+    }
+
+    /* Check 2: Some transactions can't be saved, report it to the caller */
+    if (Loc_ErrorState != SERVER_OK)
+    {
+        pthread_mutex_lock(&Glb_TransactionsLogLock);
+        Loc_Job->errorState = Loc_ErrorState;
+        pthread_mutex_unlock(&Glb_TransactionsLogLock);
+    }
+}
+
+/**
+Name: recieveTransactionDataParallel
+Input: Pointer to Transactions array, uint32 count, Pointer to Transaction States array
+Output: EN_sreverError_t Error or No Error
+Description: 1. This function will authorize count transactions as recieveTransactionDataBatch does, on the server's
+                worker threads (ST_serverConfig_t workersCount), and return once all of them are done.
+             2. Accounts are split into one shard per worker by a hash of the PAN, and each shard is owned by one
+                worker (shared-nothing) with its own velocity tracker, so debits and velocity counts need no lock. The transactions log is the only shared part,
+                it is locked once per SERVER_BATCH_SIZE transactions.
+             3. Transactions on the same account run in their original order, so the states and debits are the same
+                as recieveTransactionData one after the other. Only the order they are saved in the log can differ.
+             4. Without worker threads it runs recieveTransactionDataBatch on the calling thread.
+             5. Call it from one thread at a time, it is the call that spreads the work.
+*/
+EN_serverError_t recieveTransactionDataParallel(ST_transaction_t *transData, uint32_t count, EN_transState_t *transStates)
+{
+    ST_serverParallelJob_t Loc_Job = { transData, transStates, count, NULL, NULL, SERVER_OK };
+
+    /* Check 1: Server is not initialized yet, and can't be */
+    if ((Glb_AccountsDB.mapping == NULL) && (serverInit(NULL) != SERVER_OK))
+    {
+        return serverFailAll(transData, count, transStates);
+    }
+
+    /* Check 2: Grow the keys and shards buffers if needed */
+    if ((Glb_Workers.threadsCount != 0) && (count > Glb_ParallelCapacity))
+    {
+        ST_panKey_t *Loc_Keys = realloc(Glb_ParallelKeys, count * sizeof(ST_panKey_t));
+        uint8_t *Loc_Shards   = (Loc_Keys != NULL) ? realloc(Glb_ParallelShards, count) : NULL;
+
+        if (Loc_Keys != NULL)
+        {
+            Glb_ParallelKeys = Loc_Keys;
+        }
+
+        if (Loc_Shards != NULL)
+        {
+            Glb_ParallelShards   = Loc_Shards;
+            Glb_ParallelCapacity = count;
+        }
+    }
+
+    /* Check 3: No worker threads, or no memory for the buffers */
+    if ((Glb_Workers.threadsCount == 0) || (count > Glb_ParallelCapacity))
+    {
+        return recieveTransactionDataBatch(transData, count, transStates);
+    }
+
+    Loc_Job.keys   = Glb_ParallelKeys;
+    Loc_Job.shards = Glb_ParallelShards;
+
+    workerPoolRun(&Glb_Workers, serverParallelJob, &Loc_Job);
+    serverCheckpointPoll();
+
+    return Loc_Job.errorState;
+}
+
+/*
+ Name: serverCreateAccountsFile
+ Input: Pointer to file name, and uint64 accountsCapacity
+ Output: EN_sreverError_t Error or No Error
+ Description: Static Function to create a new accounts file holding the built-in accounts, and leave it mapped.
+*/
+static EN_serverError_t serverCreateAccountsFile(const char *fileName, uint64_t accountsCapacity)
+{
+    uint32_t Loc_SeedCount = sizeof(accountsSeed) / sizeof(accountsSeed[0]);
+
+    /* Check 1: File can't be created or mapped */
+    if ((accountsCapacity < Loc_SeedCount) ||
+        (databaseCreate(fileName, accountsCapacity) != DATABASE_OK) ||
+        (databaseOpen(&Glb_AccountsDB, fileName) != DATABASE_OK))
+    {
+        return INIT_FAILED;
+    }
+
+    /* Loop: Until the end of the built-in accounts */
+    for (uint32_t Loc_Index = 0; Loc_Index < Loc_SeedCount; Loc_Index++)
+    {
+        if (databaseAddAccount(&Glb_AccountsDB, &accountsSeed[Loc_Index], NULL) != DATABASE_OK)
+        {
+            databaseClose(&Glb_AccountsDB);
+            return INIT_FAILED;
+        }
+    }
+
+    return (databaseSync(&Glb_AccountsDB) == DATABASE_OK) ? SERVER_OK : INIT_FAILED;
+}
+
+/*
+ Name: serverBuildFilters
+ Input: Pointer to Server Config structure, or NULL for the default config
+ Output: EN_sreverError_t Error or No Error
+ Description: Static Function to create the known and blocked PANs filters, and insert the PANs of all accounts of the
+              mapped accounts file, one pass over the records.
+*/
+static EN_serverError_t serverBuildFilters(const ST_serverConfig_t *config)
+{
+    ST_filterConfig_t Loc_KnownConfig   = { 0, 0 };
+    ST_filterConfig_t Loc_BlockedConfig = { 0, 0 };
+    uint64_t Loc_AccountsCount = Glb_AccountsDB.header->accountsCount;
+    uint64_t Loc_BlockedCount = 0;
+    ST_panKey_t Loc_Key;
+
+    if (config != NULL)
+    {
+        Loc_KnownConfig   = config->knownFilter;
+        Loc_BlockedConfig = config->blockedFilter;
+    }
+
+    /* Loop: Until the end of the accounts, count the blocked ones */
+    for (uint64_t Loc_Index = 0; Loc_Index < Loc_AccountsCount; Loc_Index++)
+    {
+        Loc_BlockedCount += (Glb_AccountsDB.accounts[Loc_Index].state == BLOCKED);
+    }
+
+    if (Loc_KnownConfig.capacity == 0)
+    {
+        Loc_KnownConfig.capacity = Glb_AccountsDB.header->accountsCapacity;
+    }
+
+    if (Loc_BlockedConfig.capacity == 0)
+    {
+        Loc_BlockedConfig.capacity = ((Loc_BlockedCount * 2) > SERVER_BLOCKED_CAPACITY) ? (Loc_BlockedCount * 2) : SERVER_BLOCKED_CAPACITY;
+    }
+
+    /* Check 1: Filters can't be created */
+    if ((filterCreate(&Glb_KnownFilter, &Loc_KnownConfig) != FILTER_OK) ||
+        (filterCreate(&Glb_BlockedFilter, &Loc_BlockedConfig) != FILTER_OK))
+    {
+        filterDestroy(&Glb_KnownFilter);
+        filterDestroy(&Glb_BlockedFilter);
+        return INIT_FAILED;
+    }
+
+    /* Loop: Until the end of the accounts, a filter too small for them saturates and passes every PAN */
+    for (uint64_t Loc_Index = 0; Loc_Index < Loc_AccountsCount; Loc_Index++)
+    {
+        if (panIndexKey(Glb_AccountsDB.accounts[Loc_Index].primaryAccountNumber, &Loc_Key) != INDEX_OK)
+        {
+            continue;
+        }
+
+        filterInsert(&Glb_KnownFilter, panIndexHash(&Loc_Key));
+
+        if (Glb_AccountsDB.accounts[Loc_Index].state == BLOCKED)
+        {
+            filterInsert(&Glb_BlockedFilter, panIndexHash(&Loc_Key));
+        }
+    }
+
+    return SERVER_OK;
+}
+
+/*
+ Name: serverDestroyVelocity
+ Input: void
+ Output: void
+ Description: Static Function to free the velocity trackers of all shards.
+*/
+static void serverDestroyVelocity(void)
+{
+    for (uint32_t Loc_Index = 0; Loc_Index < Glb_VelocityCount; Loc_Index++)
+    {
+        velocityDestroy(&Glb_Velocity[Loc_Index]);
+    }
+
+    free(Glb_Velocity);
+    Glb_Velocity      = NULL;
+    Glb_VelocityCount = 0;
+}
+
+/*
+ Name: serverDefaultVelocity
+ Input: Pointer to Velocity Config structure
+ Output: void
+ Description: Function to set the SERVER_VELOCITY_* limits in the velocity config of a server config, for the callers
+              that turn the velocity checks on. The capacity is left 0, for the accounts capacity of the file.
+*/
+void serverDefaultVelocity(ST_velocityConfig_t *velocity)
+{
+    ST_velocityConfig_t Loc_Config = { 0, { { SERVER_VELOCITY_SECONDS, SERVER_VELOCITY_SECONDS_MAX, 0 },
+                                            { SERVER_VELOCITY_MINUTES, SERVER_VELOCITY_MINUTES_MAX, 0 },
+                                            { SERVER_VELOCITY_HOURS, SERVER_VELOCITY_HOURS_MAX, SERVER_VELOCITY_AMOUNT_MAX } } };
+
+    *velocity = Loc_Config;
+}
+
+/*
+ Name: serverBuildVelocity
+ Input: Pointer to Server Config structure, or NULL for the default config, and uint32 workersCount
+ Output: EN_sreverError_t Error or No Error
+ Description: Static Function to create one velocity tracker per accounts shard (one shard with no worker threads),
+              each with room for its part of the capacity. With no config, or no window used, there are no velocity
+              limits and no trackers, see serverDefaultVelocity to turn them on.
+*/
+static EN_serverError_t serverBuildVelocity(const ST_serverConfig_t *config, uint32_t workersCount)
+{
+    ST_velocityConfig_t Loc_Config;
+    uint32_t Loc_Count = (workersCount != 0) ? workersCount : 1;
+    uint32_t Loc_Used = 0;
+
+    /* Check 1: No config, no velocity limits */
+    if (config == NULL)
+    {
+        return SERVER_OK;
+    }
+
+    Loc_Config = config->velocity;
+
+    for (uint32_t Loc_Window = 0; Loc_Window < VELOCITY_WINDOWS_COUNT; Loc_Window++)
+    {
+        Loc_Used |= Loc_Config.windows[Loc_Window].seconds;
+    }
+
+    /* Check 2: No window used, no velocity limits */
+    if (Loc_Used == 0)
+    {
+        return SERVER_OK;
+    }
+
+    if (Loc_Config.capacity == 0)
+    {
+        Loc_Config.capacity = Glb_AccountsDB.header->accountsCapacity;
+    }
+
+    Loc_Config.capacity = (Loc_Config.capacity + Loc_Count - 1) / Loc_Count;
+    Glb_Velocity = calloc(Loc_Count, sizeof(ST_velocity_t));
+
+    /* Check 3: Trackers can't be allocated */
+    if (Glb_Velocity == NULL)
+    {
+        return INIT_FAILED;
+    }
+
+    Glb_VelocityCount = Loc_Count;
+
+    /* Loop: Until the tracker of every shard is created */
+    for (uint32_t Loc_Index = 0; Loc_Index < Loc_Count; Loc_Index++)
+    {
+        if (velocityCreate(&Glb_Velocity[Loc_Index], &Loc_Config) != VELOCITY_OK)
+        {
+            serverDestroyVelocity();
+            return INIT_FAILED;
+        }
+    }
+
+    return SERVER_OK;
+}
+
+/*
+ Name: serverCheckpointFileName
+ Input: Pointer to accounts file name, and Pointer to checkpoint file name of FILENAME_MAX characters
+ Output: uint8 1 if the name fits, else 0
+ Description: Static Function to get the name of the checkpoint file of an accounts file.
+*/
+static uint8_t serverCheckpointFileName(const char *accountsFile, char *checkpointFile)
+{
+    return snprintf(checkpointFile, FILENAME_MAX, "%s%s", accountsFile, SERVER_CHECKPOINT_SUFFIX) < FILENAME_MAX;
+}
+
+/*
+ Name: serverReplay
+ Input: uint64 first, uint64 end, and uint64 accountsCount
+ Output: EN_sreverError_t Error or No Error
+ Description: Static Function to add the transactions of the log from position first up to end to the settlement
+              totals, and debit again the approved ones on the first accountsCount accounts only (none for 0),
+              SERVER_BATCH_SIZE transactions at a time with one batch lookup.
+*/
+static EN_serverError_t serverReplay(uint64_t first, uint64_t end, uint64_t accountsCount)
+{
+    ST_transaction_t *Loc_Page = malloc(SERVER_BATCH_SIZE * sizeof(ST_transaction_t));
+    ST_panKey_t Loc_Keys[SERVER_BATCH_SIZE];
+    ST_accountsDB_t *Loc_Accounts[SERVER_BATCH_SIZE];
+    money_t Loc_Amounts[SERVER_BATCH_SIZE];
+
+    /* Check 1: Page can't be allocated */
+    if (Loc_Page == NULL)
+    {
+        return INIT_FAILED;
+    }
+
+    /* Loop: Until the end of the log, a page at a time */
+    while (first < end)
+    {
+        uint32_t Loc_Wanted = ((end - first) < SERVER_BATCH_SIZE) ? (uint32_t)(end - first) : SERVER_BATCH_SIZE;
+        uint32_t Loc_Read   = journalRead(&Glb_TransactionsLog, first, Loc_Page, Loc_Wanted);
+        uint32_t Loc_Count  = 0;
+
+        /* Check 2: Log can't be read */
+        if (Loc_Read != Loc_Wanted)
+        {
+            free(Loc_Page);
+            return INIT_FAILED;
+        }
+
+        for (uint32_t Loc_Index = 0; Loc_Index < Loc_Read; Loc_Index++)
+        {
+            settlementAdd(&Glb_Settlement, &Loc_Page[Loc_Index]);
+
+            if ((accountsCount != 0) && (Loc_Page[Loc_Index].transState == APPROVED) &&
+                (panIndexKey(Loc_Page[Loc_Index].cardHolderData.primaryAccountNumber, &Loc_Keys[Loc_Count]) == INDEX_OK))
+            {
+                Loc_Amounts[Loc_Count++] = Loc_Page[Loc_Index].terminalData.transAmount;
+            }
+        }
+
+        databaseFindAccountBatch(&Glb_AccountsDB, Loc_Keys, Loc_Count, Loc_Accounts);
+
+        for (uint32_t Loc_Index = 0; Loc_Index < Loc_Count; Loc_Index++)
+        {
+            if ((Loc_Accounts[Loc_Index] != NULL) && ((uint64_t)(Loc_Accounts[Loc_Index] - Glb_AccountsDB.accounts) < accountsCount))
+            {
+                Loc_Accounts[Loc_Index]->balance -= Loc_Amounts[Loc_Index];
+            }
+        }
+
+        first += Loc_Read;
+    }
+
+    free(Loc_Page);
+
+    return SERVER_OK;
+}
+
+/*
+ Name: serverRestore
+ Input: uint8 created, 1 if the accounts file was just created
+ Output: EN_sreverError_t Error or No Error
+ Description: Static Function to bring the balances up to the end of the transactions log after a restart.
+              1. The balances of the newest checkpoint are loaded, and only the transactions logged after it are
+                 replayed, so the time it takes depends on the checkpoint interval, not on the size of the log.
+              2. Accounts added after the checkpoint keep the balance in the accounts file.
+              3. The settlement totals of the checkpoint are loaded the same way. A version 1 checkpoint has none, so they
+                 are added up from the log before it too, with no debit.
+              4. With no usable checkpoint (a new accounts file, no file, or one of a longer log) the balances in the
+                 accounts file are taken as they are, and the settlement totals are added up from the whole log.
+              5. The balances are then checkpointed at the end of the log, so the next restart has nothing to replay,
+                 unless the loaded checkpoint is already at the end of the log with its settlement totals.
+*/
+static EN_serverError_t serverRestore(uint8_t created)
+{
+    EN_serverError_t Loc_ErrorState = SERVER_OK;
+    uint64_t Loc_JournalCount = journalCount(&Glb_TransactionsLog);
+    uint8_t Loc_Loaded = 0;
+    uint8_t Loc_Current = 0;
+    ST_checkpoint_t Loc_Checkpoint;
+
+    settlementReset(&Glb_Settlement);
+
+    /* Check 1: Accounts file has a checkpoint of this log, load it and replay the log after it */
+    if ((created == 0) && (checkpointRead(Glb_CheckpointFile, &Loc_Checkpoint) == CHECKPOINT_OK))
+    {
+        if ((Loc_Checkpoint.journalCount <= Loc_JournalCount) &&
+            (Loc_Checkpoint.accountsCount <= Glb_AccountsDB.header->accountsCount))
+        {
+            for (uint64_t Loc_Index = 0; Loc_Index < Loc_Checkpoint.accountsCount; Loc_Index++)
+            {
+                Glb_AccountsDB.accounts[Loc_Index].balance = Loc_Checkpoint.balances[Loc_Index];
+            }
+
+            if (Loc_Checkpoint.settlement != NULL)
+            {
+                memcpy(&Glb_Settlement, Loc_Checkpoint.settlement, sizeof(ST_settlement_t));
+            }
+            else
+            {
+                Loc_ErrorState = serverReplay(0, Loc_Checkpoint.journalCount, 0);
+            }
+
+            if (Loc_ErrorState == SERVER_OK)
+            {
+                Loc_ErrorState = serverReplay(Loc_Checkpoint.journalCount, Loc_JournalCount, Loc_Checkpoint.accountsCount);
+            }
+
+            Loc_Loaded  = 1;
+            Loc_Current = (Loc_Checkpoint.journalCount == Loc_JournalCount) && (Loc_Checkpoint.settlement != NULL);
+        }
+
+        checkpointFree(&Loc_Checkpoint);
+    }
+
+    /* Check 2: No usable checkpoint, add the settlement totals up from the whole log */
+    if ((Loc_ErrorState == SERVER_OK) && (Loc_Loaded == 0))
+    {
+        Loc_ErrorState = serverReplay(0, Loc_JournalCount, 0);
+    }
+
+    /* Check 3: Log can't be replayed */
+    if (Loc_ErrorState != SERVER_OK)
+    {
+        return INIT_FAILED;
+    }
+
+    /* Check 4: Checkpoint isn't at the end of the log, and the balances can't be checkpointed */
+    if (!Loc_Current && checkpointWrite(Glb_CheckpointFile, Loc_JournalCount, Glb_AccountsDB.accounts, Glb_AccountsDB.header->accountsCount,
+                        &Glb_Settlement) != CHECKPOINT_OK)
+    {
+        return INIT_FAILED;
+    }
+
+    Glb_CheckpointCount = Loc_JournalCount;
+
+    return SERVER_OK;
+}
+
+/**
+Name: serverInit
+Input: Pointer to Server Config structure, or NULL for the default config
+Output: EN_sreverError_t Error or No Error
+Description: 1. This function will be called once when the server starts, before any transaction is received.
+             2. It maps the accounts file (SERVER_ACCOUNTS_FILE by default). The file holds the accounts and their
+                PAN index, so they are used in place with no parse step.
+             3. If the file doesn't exist, it is created with the built-in accounts.
+             4. It builds the known and blocked PANs filters (ST_serverConfig_t knownFilter and blockedFilter) from
+                the accounts, and the velocity trackers (ST_serverConfig_t velocity, none with no config).
+             5. It opens the transactions log, and restores the balances from the newest checkpoint (accounts file name
+                + SERVER_CHECKPOINT_SUFFIX) and the transactions logged after it, so a restart only replays the last
+                checkpointInterval transactions at most.
+             6. It starts workersCount worker threads for recieveTransactionDataParallel, if any.
+             7. Startup still takes time in the number of accounts: a pass over them builds the filters, the
+                velocity trackers (if any) are sized for them, the checkpoint balances are copied onto them, and a
+                checkpoint that isn't at the end of the log is rewritten whole and flushed (see serverRestore).
+                Only the log replay is bounded by checkpointInterval.
+             8. If the file can't be created, mapped, or isn't an accounts file, the filters, the trackers, the
+                balances or the threads can't be made will return INIT_FAILED, else will return SERVER_OK.
+*/
+EN_serverError_t serverInit(const ST_serverConfig_t *config)
+{
+    /* Define local variable to set the error state, No Error */
+    EN_serverError_t Loc_ErrorState = SERVER_OK;
+    const char *Loc_FileName = SERVER_ACCOUNTS_FILE;
+    uint64_t Loc_AccountsCapacity = SERVER_ACCOUNTS_CAPACITY;
+    ST_journalConfig_t Loc_JournalConfig = { SERVER_JOURNAL_FILE, 0, 0 };
+    uint32_t Loc_WorkersCount = 0;
+    uint8_t Loc_Created = 0;
+    FILE *Loc_File;
+
+    /* Check 1: Server is already initialized */
+    if (Glb_AccountsDB.mapping != NULL)
+    {
+        return SERVER_OK;
+    }
+
+    /* Check 2: Config is passed, override the defaults */
+    if (config != NULL)
+    {
+        if (config->accountsFile != NULL)
+        {
+            Loc_FileName = config->accountsFile;
+        }
+
+        if (config->accountsCapacity != 0)
+        {
+            Loc_AccountsCapacity = config->accountsCapacity;
+        }
+
+        Loc_JournalConfig = config->journal;
 
-     if (isValidAccount(&transData->cardHolderData, &accountReference) == ACCOUNT_NOT_FOUND) {
-         transData->transState = FRAUD_CARD;
-         if(saveTransaction(transData) == SERVER_OK) return FRAUD_CARD;
-     }
+        if (Loc_JournalConfig.fileName == NULL)
+        {
+            Loc_JournalConfig.fileName = SERVER_JOURNAL_FILE;
+        }
 
-     else if (isBlockedAccount(&accountReference) == BLOCKED_ACCOUNT) {
-         transData->transState = DECLINED_STOLEN_CARD;
-         if(saveTransaction(transData) == SERVER_OK) return DECLINED_STOLEN_CARD;
-     }
+        Loc_WorkersCount = config->workersCount;
+        Glb_CheckpointInterval = (config->checkpointInterval != 0) ? config->checkpointInterval : SERVER_CHECKPOINT_INTERVAL;
+    }
+    else
+    {
+        Glb_CheckpointInterval = SERVER_CHECKPOINT_INTERVAL;
+    }
 
-     else if (isAmountAvailable(&transData->terminalData, &accountReference) == LOW_BALANCE) {
-         transData->transState = DECLINED_INSUFFECIENT_FUND;
-         if(saveTransaction(transData) == SERVER_OK) return DECLINED_INSUFFECIENT_FUND;
-     }
+    if (!serverCheckpointFileName(Loc_FileName, Glb_CheckpointFile))
+    {
+        return INIT_FAILED;
+    }
 
-     else// if(transData->transState == APPROVED)
-     {
-         transData->transState = APPROVED;
-         accountsDB[Glb_AccountsDBIndex].balance -= transData->terminalData.transAmount;
-         if(saveTransaction(transData) == SERVER_OK)
-         {
-             printf(" New Balance is %0.2f\n", accountsDB[Glb_AccountsDBIndex].balance);
-             return APPROVED;
-         }
-     }
+    /* Check 3: Accounts file doesn't exist, create it */
+    Loc_File = fopen(Loc_FileName, "rb");
 
-     transData->transState = INTERNAL_SERVER_ERROR;
-     return INTERNAL_SERVER_ERROR;
- }
+    if (Loc_File == NULL)
+    {
+        Loc_ErrorState = serverCreateAccountsFile(Loc_FileName, Loc_AccountsCapacity);
+        Loc_Created = 1;
+    }
+    else
+    {
+        fclose(Loc_File);
+        Loc_ErrorState = (databaseOpen(&Glb_AccountsDB, Loc_FileName) == DATABASE_OK) ? SERVER_OK : INIT_FAILED;
+    }
+
+    /* Check 4: PAN filters can't be created */
+    if ((Loc_ErrorState == SERVER_OK) && (serverBuildFilters(config) != SERVER_OK))
+    {
+        Loc_ErrorState = INIT_FAILED;
+        databaseClose(&Glb_AccountsDB);
+    }
+
+    /* Check 5: Velocity trackers can't be created */
+    if ((Loc_ErrorState == SERVER_OK) && (serverBuildVelocity(config, Loc_WorkersCount) != SERVER_OK))
+    {
+        Loc_ErrorState = INIT_FAILED;
+        filterDestroy(&Glb_KnownFilter);
+        filterDestroy(&Glb_BlockedFilter);
+        databaseClose(&Glb_AccountsDB);
+    }
+
+    /* Check 6: Transactions log can't be opened */
+    if ((Loc_ErrorState == SERVER_OK) && (journalOpen(&Glb_TransactionsLog, &Loc_JournalConfig) != JOURNAL_OK))
+    {
+        Loc_ErrorState = INIT_FAILED;
+        filterDestroy(&Glb_KnownFilter);
+        filterDestroy(&Glb_BlockedFilter);
+        serverDestroyVelocity();
+        databaseClose(&Glb_AccountsDB);
+    }
+
+    /* Check 7: Balances can't be restored */
+    if ((Loc_ErrorState == SERVER_OK) && (serverRestore(Loc_Created) != SERVER_OK))
+    {
+        Loc_ErrorState = INIT_FAILED;
+        journalClose(&Glb_TransactionsLog);
+        filterDestroy(&Glb_KnownFilter);
+        filterDestroy(&Glb_BlockedFilter);
+        serverDestroyVelocity();
+        databaseClose(&Glb_AccountsDB);
+    }
+
+    /* Check 8: Worker threads can't be started */
+    if ((Loc_ErrorState == SERVER_OK) && (Loc_WorkersCount != 0) &&
+        (workerPoolStart(&Glb_Workers, Loc_WorkersCount) != WORKER_OK))
+    {
+        Loc_ErrorState = INIT_FAILED;
+        journalClose(&Glb_TransactionsLog);
+        filterDestroy(&Glb_KnownFilter);
+        filterDestroy(&Glb_BlockedFilter);
+        serverDestroyVelocity();
+        databaseClose(&Glb_AccountsDB);
+    }
+
+    return Loc_ErrorState;
+}
+
+/*
+ Name: serverShutdown
+ Input: void
+ Output: void
+ Description: Function to stop the worker threads, commit the pending transactions, checkpoint the balances if any
+              transaction was logged since the last checkpoint, write all balance changes back to the accounts file,
+              and close both files.
+*/
+void serverShutdown(void)
+{
+    /* Check 1: Server is initialized */
+    if (Glb_AccountsDB.mapping != NULL)
+    {
+        if (Glb_Workers.threadsCount != 0)
+        {
+            workerPoolStop(&Glb_Workers);
+        }
+
+        free(Glb_ParallelKeys);
+        free(Glb_ParallelShards);
+        Glb_ParallelKeys     = NULL;
+        Glb_ParallelShards   = NULL;
+        Glb_ParallelCapacity = 0;
+
+        /* Balances only change with logged transactions, an unchanged checkpoint isn't rewritten */
+        if (journalCount(&Glb_TransactionsLog) != Glb_CheckpointCount)
+        {
+            serverCheckpoint();
+        }
+
+        journalClose(&Glb_TransactionsLog);
+        filterDestroy(&Glb_KnownFilter);
+        filterDestroy(&Glb_BlockedFilter);
+        serverDestroyVelocity();
+        databaseSync(&Glb_AccountsDB);
+        databaseClose(&Glb_AccountsDB);
+    }
+}
+
+/*
+ Name: serverCommit
+ Input: void
+ Output: EN_sreverError_t Error or No Error
+ Description: Function to commit all pending transactions to the transactions log, without waiting for the batch
+              to fill or for the commit latency. Returns SAVING_FAILED if they can't be written to disk.
+*/
+EN_serverError_t serverCommit(void)
+{
+    EN_journalError_t Loc_JournalError;
+
+    pthread_mutex_lock(&Glb_TransactionsLogLock);
+    Loc_JournalError = journalCommit(&Glb_TransactionsLog);
+    pthread_mutex_unlock(&Glb_TransactionsLogLock);
+
+    return (Loc_JournalError == JOURNAL_OK) ? SERVER_OK : SAVING_FAILED;
+}
+
+/**
+Name: serverCheckpoint
+Input: void
+Output: EN_sreverError_t Error or No Error
+Description: 1. This function will commit the pending transactions, then write the balances of all accounts as the
+                checkpoint of the whole log, which replaces the last checkpoint only once it is on disk.
+             2. It runs by itself every checkpointInterval logged transactions (ST_serverConfig_t), and at shutdown.
+             3. Call it between transactions, not while recieveTransactionDataParallel is running, so every debit
+                is in the log.
+             4. If the server is not initialized, or the log or the checkpoint can't be written will return
+                SAVING_FAILED, else will return SERVER_OK.
+*/
+EN_serverError_t serverCheckpoint(void)
+{
+    EN_serverError_t Loc_ErrorState = SAVING_FAILED;
+
+    /* Check 1: Server is not initialized */
+    if (Glb_AccountsDB.mapping == NULL)
+    {
+        return SAVING_FAILED;
+    }
+
+    pthread_mutex_lock(&Glb_TransactionsLogLock);
+
+    /* Check 2: Transactions are on disk before a checkpoint includes them, and the checkpoint is written */
+    if ((journalCommit(&Glb_TransactionsLog) == JOURNAL_OK) &&
+        (checkpointWrite(Glb_CheckpointFile, journalCount(&Glb_TransactionsLog), Glb_AccountsDB.accounts,
+                         Glb_AccountsDB.header->accountsCount, &Glb_Settlement) == CHECKPOINT_OK))
+    {
+        Glb_CheckpointCount = journalCount(&Glb_TransactionsLog);
+        Loc_ErrorState = SERVER_OK;
+    }
+
+    pthread_mutex_unlock(&Glb_TransactionsLogLock);
+
+    return Loc_ErrorState;
+}
+
+/*
+ Name: serverRemoveFiles
+ Input: Pointer to Server Config structure, or NULL for the default config
+ Output: void
+ Description: Function to delete the accounts file, its checkpoint, and the transactions log of a config, so the next
+              serverInit starts from the built-in accounts and an empty log. Call it while the server is shut down.
+*/
+void serverRemoveFiles(const ST_serverConfig_t *config)
+{
+    const char *Loc_AccountsFile = ((config != NULL) && (config->accountsFile != NULL)) ? config->accountsFile : SERVER_ACCOUNTS_FILE;
+    const char *Loc_JournalFile  = ((config != NULL) && (config->journal.fileName != NULL)) ? config->journal.fileName : SERVER_JOURNAL_FILE;
+    char Loc_CheckpointFile[FILENAME_MAX];
+
+    if (serverCheckpointFileName(Loc_AccountsFile, Loc_CheckpointFile))
+    {
+        remove(Loc_CheckpointFile);
+    }
+
+    remove(Loc_AccountsFile);
+    journalRemove(Loc_JournalFile);
+}
+
+/**
+Name: serverAddAccount
+Input: Pointer to AccountsDB structure
+Output: EN_sreverError_t Error or No Error
+Description: 1. This function will add a new account to the accounts file, and its PAN to the PAN filters.
+             2. Call it between transactions, not while recieveTransactionDataParallel is running.
+             3. If the server can't be started, the file is full, or the PAN is wrong or already exists will return
+                SAVING_FAILED, else will return SERVER_OK.
+*/
+EN_serverError_t serverAddAccount(const ST_accountsDB_t *account)
+{
+    ST_panKey_t Loc_Key;
+
+    /* Check 1: Server is not initialized yet, and can't be */
+    if ((Glb_AccountsDB.mapping == NULL) && (serverInit(NULL) != SERVER_OK))
+    {
+        return SAVING_FAILED;
+    }
+
+    /* Check 2: Account can't be added */
+    if ((panIndexKey(account->primaryAccountNumber, &Loc_Key) != INDEX_OK) ||
+        (databaseAddAccount(&Glb_AccountsDB, account, NULL) != DATABASE_OK))
+    {
+        return SAVING_FAILED;
+    }
+
+    filterInsert(&Glb_KnownFilter, panIndexHash(&Loc_Key));
+
+    if (account->state == BLOCKED)
+    {
+        filterInsert(&Glb_BlockedFilter, panIndexHash(&Loc_Key));
+    }
+
+    return SERVER_OK;
+}
+
+/**
+Name: serverSetAccountState
+Input: Pointer to PAN, and EN_accountState_t state
+Output: EN_sreverError_t Error or No Error
+Description: 1. This function will block or unblock an account, and add or remove its PAN in the blocked PANs filter.
+                Account states must only change through it, the filter must have every blocked PAN.
+             2. Call it between transactions, not while recieveTransactionDataParallel is running.
+             3. If the PAN doesn't exist will return ACCOUNT_NOT_FOUND, else will return SERVER_OK.
+*/
+EN_serverError_t serverSetAccountState(const uint8_t *primaryAccountNumber, EN_accountState_t state)
+{
+    ST_accountsDB_t *Loc_Account = NULL;
+    ST_panKey_t Loc_Key;
+
+    /* Check 1: Server is not initialized yet, and can't be */
+    if ((Glb_AccountsDB.mapping == NULL) && (serverInit(NULL) != SERVER_OK))
+    {
+        return ACCOUNT_NOT_FOUND;
+    }
+
+    /* Check 2: Account is not found */
+    if ((panIndexKey(primaryAccountNumber, &Loc_Key) != INDEX_OK) ||
+        (databaseFindAccount(&Glb_AccountsDB, primaryAccountNumber, &Loc_Account) != DATABASE_OK))
+    {
+        return ACCOUNT_NOT_FOUND;
+    }
+
+    /* Check 3: State changes, the filter has the PAN while the account is blocked */
+    if ((state == BLOCKED) && (Loc_Account->state != BLOCKED))
+    {
+        filterInsert(&Glb_BlockedFilter, panIndexHash(&Loc_Key));
+        Loc_Account->state = BLOCKED;
+    }
+    else if ((state != BLOCKED) && (Loc_Account->state == BLOCKED))
+    {
+        Loc_Account->state = state;
+        filterDelete(&Glb_BlockedFilter, panIndexHash(&Loc_Key));
+    }
+
+    return SERVER_OK;
+}
+
+/*
+ Name: serverFilterStats
+ Input: Pointer to known PANs Filter Stats structure, and Pointer to blocked PANs Filter Stats structure
+ Output: void
+ Description: Function to get the memory use and expected false positive rate of the PAN filters, either pointer may
+              be NULL. Both are zeroed if the server is not initialized.
+*/
+void serverFilterStats(ST_filterStats_t *knownStats, ST_filterStats_t *blockedStats)
+{
+    if (knownStats != NULL)
+    {
+        filterStats(&Glb_KnownFilter, knownStats);
+    }
+
+    if (blockedStats != NULL)
+    {
+        filterStats(&Glb_BlockedFilter, blockedStats);
+    }
+}
+
+/*
+ Name: serverVelocityStats
+ Input: Pointer to Velocity Stats structure
+ Output: void
+ Description: Function to get the memory use and counters of the velocity trackers of all shards, added up.
+*/
+void serverVelocityStats(ST_velocityStats_t *stats)
+{
+    ST_velocityStats_t Loc_Stats;
+
+    memset(stats, 0, sizeof(ST_velocityStats_t));
+
+    /* Loop: Until the stats of all trackers are added */
+    for (uint32_t Loc_Index = 0; Loc_Index < Glb_VelocityCount; Loc_Index++)
+    {
+        velocityStats(&Glb_Velocity[Loc_Index], &Loc_Stats);
+        stats->count          += Loc_Stats.count;
+        stats->slotsCount     += Loc_Stats.slotsCount;
+        stats->memoryBytes    += Loc_Stats.memoryBytes;
+        stats->declinedCount  += Loc_Stats.declinedCount;
+        stats->untrackedCount += Loc_Stats.untrackedCount;
+    }
+}
+
+/*
+ Name: serverSettlement
+ Input: date_t date (DATE_NONE for all days), EN_settlementNetwork_t network, and Pointer to Settlement Totals structure
+ Output: EN_sreverError_t Error or No Error
+ Description: Function to get the count and amount per transaction state logged on one day, or on all days, for one
+              card network or SETTLEMENT_ALL_NETWORKS, from the running totals of the log with no scan. Returns
+              TRANSACTION_NOT_FOUND if the day is no longer kept, or the network is out of range.
+*/
+EN_serverError_t serverSettlement(date_t date, EN_settlementNetwork_t network, ST_settlementTotals_t *totals)
+{
+    EN_settlementError_t Loc_SettlementError;
+
+    pthread_mutex_lock(&Glb_TransactionsLogLock);
+    Loc_SettlementError = settlementQuery(&Glb_Settlement, date, network, totals);
+    pthread_mutex_unlock(&Glb_TransactionsLogLock);
+
+    return (Loc_SettlementError == SETTLEMENT_OK) ? SERVER_OK : TRANSACTION_NOT_FOUND;
+}
+
+/**
+Name: findAccount
+Input: Pointer to Card Data structure, Pointer to Pointer to AccountsDB structure
+Output: EN_sreverError_t Error or No Error
+Description: 1. This function will take card data and look up the account related to this card in the PAN index.
+             2. A PAN the known PANs filter has never seen is not looked up in the index at all.
+             3. If the PAN doesn't exist will return ACCOUNT_NOT_FOUND, else will return SERVER_OK and a reference
+                to the account record inside the mapped accounts file, so it can be checked and debited in place.
+*/
+EN_serverError_t findAccount(ST_cardData_t *cardData, ST_accountsDB_t **accountRefrence)
+{
+    ST_panKey_t Loc_Key;
+
+    /* Check 1: Server is not initialized yet */
+    if ((Glb_AccountsDB.mapping == NULL) && (serverInit(NULL) != SERVER_OK))
+    {
+        return ACCOUNT_NOT_FOUND;
+    }
+
+    /* Check 2: PAN can't be a key, or the filter has never seen it */
+    if ((panIndexKey(cardData->primaryAccountNumber, &Loc_Key) != INDEX_OK) ||
+        (filterContains(&Glb_KnownFilter, panIndexHash(&Loc_Key)) == 0))
+    {
+        return ACCOUNT_NOT_FOUND;
+    }
+
+    /* Check 3: Account is not found */
+    databaseFindAccountBatch(&Glb_AccountsDB, &Loc_Key, 1, accountRefrence);
+
+    if (*accountRefrence == NULL)
+    {
+        return ACCOUNT_NOT_FOUND;
+    }
+
+    return SERVER_OK;
+}
 
 /**
 Name: isValidAccount
@@ -88,37 +1333,25 @@ Input: Pointer to Card Data structure,
 Input: Pointer to Card Data structure, Pointer to AccountsDB structure
 Output: EN_sreverError_t Error or No Error
 Description: 1. This function will take card data and validate if the account related to this card exists or not.
-             2. It checks if the PAN exists or not in the server's database (searches for the card PAN in the DB).
-             3. If the PAN doesn't exist will return ACCOUNT_NOT_FOUND, else will return SERVER_OK and return a reference
-                to this account in the DB.
+             2. It checks if the PAN exists or not in the server's database (looks up the card PAN in the PAN index).
+             3. If the PAN doesn't exist will return ACCOUNT_NOT_FOUND, else will return SERVER_OK and return a copy
+                of this account in the DB.
 */
 EN_serverError_t isValidAccount(ST_cardData_t *cardData, ST_accountsDB_t *accountRefrence)
 {
     /* Define local variable to set the error state, No Error */
     EN_serverError_t Loc_ErrorState = SERVER_OK;
-    /* Define local variable to set the flag state, Flag Down */
-    EN_flagState_t Loc_Flag = FLAG_DOWN;
+    /* Define local variable to hold the account reference in the accounts file */
+    ST_accountsDB_t *Loc_Account = NULL;
 
-    /* Loop: Until Account is found or until the end of accountsDB */
-    for (uint8_t Loc_Index = 0; Loc_Index < 255; Loc_Index++)
+    /* Check 1: Account is found */
+    if (findAccount(cardData, &Loc_Account) == SERVER_OK)
     {
-        /* Check 1: Account is found */
-        if (!strcmp((char *)cardData->primaryAccountNumber, (char *)accountsDB[Loc_Index].primaryAccountNumber))
-        {
-            /* Copy Account details from accountsDB to passed pointer */
-            *accountRefrence = accountsDB[Loc_Index];
-
-            /* Update accountsDB Index */
-            Glb_AccountsDBIndex = Loc_Index;
-
-            /* Update flag state, Account is Found! */
-            Loc_Flag = FLAG_UP;
-            break;
-        }
+        /* Copy Account details from the accounts file to passed pointer */
+        *accountRefrence = *Loc_Account;
     }
-
     /* Check 2: Account is not found */
-    if (Loc_Flag == FLAG_DOWN)
+    else
     {
         /* Update error state, Account Not Found! */
         Loc_ErrorState = ACCOUNT_NOT_FOUND;
@@ -182,74 +1415,185 @@ EN_serverError_t isAmountAvailable(ST_terminalData_t* termData, ST_accountsDB_t*
 
 /**
 * @author         : Tarek Gohry
-* @brief          : Store all transaction data in the transaction database
+* @brief          : Store all transaction data in the transactions log
 * Description     :
    - It gives a sequence number to a transaction
-   - This number is incremented once a transaction is processed into the server
-   - Must check the last sequence number in the server to give the new transaction a new sequence number
+   - This number is incremented once a transaction is processed into the server, and continues from the last
+     transaction in the log after a restart
    - It saves ant type of a transaction. APPROVED, DECLINED_INSUFFECIENT_FUND, DECLINED_STOLEN_CARD,
-     FRUAD_CARD, INTERNAL_SERVER_ERROR
-   - List all saved transactions using the listSavedTransactions function
+     FRUAD_CARD, INTERNAL_SERVER_ERROR, DECLINED_VELOCITY
+   - The transaction is appended to the log buffer, and committed to disk with the rest of its batch (group commit).
+     Use serverCommit to commit it right away
+   - An approved transaction must already be debited, the balances are checkpointed with the log from here
+   - Nothing is listed here, use listSavedTransactions, querySavedTransactions or exportSavedTransactions
 * Return          :
-   - SERVER_OK, Assuming that the connection between the terminal and server is always connected
+   - SERVER_OK, or SAVING_FAILED if the server can't be started or the log can't be written
 */
 EN_serverError_t saveTransaction(ST_transaction_t *transData)
 {
-    static int trxSeqNumber = 32500;
+    /* Check 1: Server is not initialized yet */
+    if ((Glb_TransactionsLog.file == NULL) && (serverInit(NULL) != SERVER_OK))
+    {
+        return SAVING_FAILED;
+    }
+
+    pthread_mutex_lock(&Glb_TransactionsLogLock);
 
-    transactionsDB[Glb_TransactionsDBIndex].cardHolderData = transData->cardHolderData;
-    transactionsDB[Glb_TransactionsDBIndex].terminalData = transData->terminalData;
-    transactionsDB[Glb_TransactionsDBIndex].transState = transData->transState;
-    transactionsDB[Glb_TransactionsDBIndex].transactionSequenceNumber = trxSeqNumber;
+    /* Check 2: Transaction can't be appended */
+    if (journalAppend(&Glb_TransactionsLog, transData) != JOURNAL_OK)
+    {
+        pthread_mutex_unlock(&Glb_TransactionsLogLock);
+        return SAVING_FAILED;
+    }
 
-    listSavedTransactions();
+    settlementAdd(&Glb_Settlement, transData);
+
+    pthread_mutex_unlock(&Glb_TransactionsLogLock);
+    serverCheckpointPoll();
 
-    trxSeqNumber++;
-    Glb_TransactionsDBIndex++;
     return SERVER_OK;
 }
 
 
+/*
+ Name: querySavedTransactions
+ Input: uint64 first, Pointer to transactions array, and uint32 count
+ Output: uint32 number of transactions
+ Description: Function to read one page of saved transactions, up to count of them starting at position first
+              (0 is the oldest transaction), pending ones included. Returns 0 past the last transaction.
+*/
+uint32_t querySavedTransactions(uint64_t first, ST_transaction_t *transactions, uint32_t count)
+{
+    /* Check 1: Server is not initialized */
+    if (Glb_TransactionsLog.file == NULL)
+    {
+        return 0;
+    }
+
+    pthread_mutex_lock(&Glb_TransactionsLogLock);
+    count = journalRead(&Glb_TransactionsLog, first, transactions, count);
+    pthread_mutex_unlock(&Glb_TransactionsLogLock);
+
+    return count;
+}
+
+/*
+ Name: querySavedTransactionsBySequence
+ Input: uint32 firstSequenceNumber, Pointer to transactions array, and uint32 count
+ Output: uint32 number of transactions
+ Description: Function to read one page of saved transactions, up to count of them starting at a sequence number.
+              Sequence numbers are TRANSACTION_SEQ_START + the log position, so a range of them is one read at its
+              position with no index. Returns 0 past the last transaction.
+*/
+uint32_t querySavedTransactionsBySequence(uint32_t firstSequenceNumber, ST_transaction_t *transactions, uint32_t count)
+{
+    uint64_t Loc_First = 0;
+
+    /* Check 1: Sequence number is after the first transaction, else start at the first one */
+    if (firstSequenceNumber > TRANSACTION_SEQ_START)
+    {
+        Loc_First = firstSequenceNumber - TRANSACTION_SEQ_START;
+    }
+
+    return querySavedTransactions(Loc_First, transactions, count);
+}
+
+/*
+ Name: querySavedTransactionsByDate
+ Input: date_t fromDate, date_t toDate, Pointer to uint64 cursor, Pointer to transactions array, and uint32 count
+ Output: uint32 number of transactions
+ Description: Function to find one page of saved transactions with a transaction date from fromDate to toDate (both
+              included), pending ones included, in log order. Set *cursor to 0 for the first page, it is moved to the
+              next page each call, and the last page is the one that returns less than count.
+              Only the blocks of the log the dates index has in the range are read, see journalFindDates.
+              A fromDate before DATE_EPOCH (DATE_NONE for no lower bound) starts at DATE_EPOCH, no transaction date
+              is packed before it. A toDate before fromDate finds nothing.
+*/
+uint32_t querySavedTransactionsByDate(date_t fromDate, date_t toDate, uint64_t *cursor, ST_transaction_t *transactions, uint32_t count)
+{
+    /* Check 1: Server is not initialized */
+    if (Glb_TransactionsLog.file == NULL)
+    {
+        return 0;
+    }
+
+    /* Check 2: Range starts before the first packed date */
+    if (fromDate < DATE_EPOCH)
+    {
+        fromDate = DATE_EPOCH;
+    }
+
+    pthread_mutex_lock(&Glb_TransactionsLogLock);
+    count = journalFindDates(&Glb_TransactionsLog, fromDate, toDate, cursor, transactions, count);
+    pthread_mutex_unlock(&Glb_TransactionsLogLock);
+
+    return count;
+}
+
+/*
+ Name: exportSavedTransactions
+ Input: Pointer to file name, and EN_reportFormat_t format
+ Output: EN_sreverError_t Error or No Error
+ Description: Function to export all saved transactions to a CSV or JSON file, pending ones included.
+              Returns SAVING_FAILED if the file can't be written.
+*/
+EN_serverError_t exportSavedTransactions(const char *fileName, EN_reportFormat_t format)
+{
+    EN_reportError_t Loc_ReportError;
+
+    /* Check 1: Server is not initialized */
+    if (Glb_TransactionsLog.file == NULL)
+    {
+        return SAVING_FAILED;
+    }
+
+    pthread_mutex_lock(&Glb_TransactionsLogLock);
+    Loc_ReportError = reportExport(&Glb_TransactionsLog, 0, journalCount(&Glb_TransactionsLog), format, fileName);
+    pthread_mutex_unlock(&Glb_TransactionsLogLock);
+
+    return (Loc_ReportError == REPORT_OK) ? SERVER_OK : SAVING_FAILED;
+}
+
 /*
  Name: listSavedTransactions
  Input: void
  Output: void
- Description:
+ Description: Function to print all transactions in the transactions log, pending ones included.
 */
 void listSavedTransactions(void)
 {
-    for(uint8_t Loc_u8Index = 0; Loc_u8Index <= Glb_TransactionsDBIndex; Loc_u8Index++)
-    {
-        printf("\n");
-
-        printf(" ##########################\n");
-        printf(" Transaction Sequence Number: %d\n", transactionsDB[Loc_u8Index].transactionSequenceNumber);
-        printf(" Transaction Date: %s\n", transactionsDB[Loc_u8Index].terminalData.transactionDate);
-        printf(" Transaction Amount: %.3f\n", transactionsDB[Loc_u8Index].terminalData.transAmount);
-        printf(" Transaction State: ");
-        switch (transactionsDB[Loc_u8Index].transState) {
-            case APPROVED:
-                printf("APPROVED\n");
-                break;
-            case DECLINED_INSUFFECIENT_FUND:
-                printf("DECLINED_INSUFFECIENT_FUND\n");
-                break;
-            case DECLINED_STOLEN_CARD:
-                printf("DECLINED_STOLEN_CARD\n");
-                break;
-            case FRAUD_CARD:
-                printf("FRAUD_CARD\n");
-                break;
-            case INTERNAL_SERVER_ERROR:
-                printf("INTERNAL_SERVER_ERROR\n");
-                break;
-        }
-        printf(" Terminal Max Amount: %.3f\n", transactionsDB[Loc_u8Index].terminalData.maxTransAmount);
-        printf(" Cardholder Name: %s\n", transactionsDB[Loc_u8Index].cardHolderData.cardHolderName);
-        printf(" PAN: %s\n", transactionsDB[Loc_u8Index].cardHolderData.primaryAccountNumber);
-        printf(" Card Expiration Date: %s\n", transactionsDB[Loc_u8Index].cardHolderData.cardExpirationDate);
-        printf(" ##########################\n");
-
-        printf("\n");
+    ST_transaction_t Loc_Transactions[64];
+    char Loc_Amount[MONEY_TEXT_SIZE];
+    char Loc_MaxAmount[MONEY_TEXT_SIZE];
+    uint64_t Loc_First = 0;
+    uint32_t Loc_Count;
+
+    /* Loop: Until the end of the transactions log, a page of transactions at a time */
+    while ((Loc_Count = querySavedTransactions(Loc_First, Loc_Transactions, 64)) != 0)
+    {
+        for (uint32_t Loc_Index = 0; Loc_Index < Loc_Count; Loc_Index++)
+        {
+            ST_transaction_t *Loc_Transaction = &Loc_Transactions[Loc_Index];
+
+            moneyFormat(Loc_Transaction->terminalData.transAmount, Loc_Amount);
+            moneyFormat(Loc_Transaction->terminalData.maxTransAmount, Loc_MaxAmount);
+
+            printf("\n");
+
+            printf(" ##########################\n");
+            printf(" Transaction Sequence Number: %d\n", Loc_Transaction->transactionSequenceNumber);
+            printf(" Transaction Date: %s\n", Loc_Transaction->terminalData.transactionDate);
+            printf(" Transaction Amount: %s\n", Loc_Amount);
+            printf(" Transaction State: %s\n", reportStateName(Loc_Transaction->transState));
+            printf(" Terminal Max Amount: %s\n", Loc_MaxAmount);
+            printf(" Cardholder Name: %s\n", Loc_Transaction->cardHolderData.cardHolderName);
+            printf(" PAN: %s\n", Loc_Transaction->cardHolderData.primaryAccountNumber);
+            printf(" Card Expiration Date: %s\n", Loc_Transaction->cardHolderData.cardExpirationDate);
+            printf(" ##########################\n");
+
+            printf("\n");
+        }
+
+        Loc_First += Loc_Count;
     }
 }
\ No newline at end of file
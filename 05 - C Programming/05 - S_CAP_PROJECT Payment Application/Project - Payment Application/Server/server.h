@@ -3,40 +3,59 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #include "../Card/card.h"
 #include "../Terminal/terminal.h"
+#include "../Database/database.h"
+#include "../Checkpoint/checkpoint.h"
+#include "../Filter/filter.h"
+#include "../Journal/journal.h"
+#include "../Report/report.h"
+#include "../Settlement/settlement.h"
+#include "../Velocity/velocity.h"
+#include "../Worker/worker.h"
 
-typedef enum EN_transState_t
-{
-    APPROVED, DECLINED_INSUFFECIENT_FUND, DECLINED_STOLEN_CARD, FRAUD_CARD, INTERNAL_SERVER_ERROR
-}EN_transState_t;
-
-typedef struct ST_transaction_t
-{
-    ST_cardData_t cardHolderData;
-    ST_terminalData_t terminalData;
-    EN_transState_t transState;
-    uint32_t transactionSequenceNumber;
-}ST_transaction_t;
+/* Default accounts file, created with the built-in accounts if it doesn't exist */
+#define SERVER_ACCOUNTS_FILE        "accounts.db"
+/* Max. number of accounts in a newly created accounts file */
+#define SERVER_ACCOUNTS_CAPACITY    1024
+/* Default transactions log, created empty if it doesn't exist */
+#define SERVER_JOURNAL_FILE         "transactions.log"
+/* Suffix of the checkpoint file next to the accounts file */
+#define SERVER_CHECKPOINT_SUFFIX    ".ckpt"
+/* Default number of transactions logged between two checkpoints, a restart replays this many at most */
+#define SERVER_CHECKPOINT_INTERVAL  (1 << 20)
+/* Number of transactions each stage of a batch runs over at once */
+#define SERVER_BATCH_SIZE           256
+/* Min. capacity of the blocked accounts filter, so accounts can be blocked after the server starts */
+#define SERVER_BLOCKED_CAPACITY     1024
+/* Default velocity limits of an account: transactions in 10 seconds, transactions in a minute, then transactions and
+   amount in an hour */
+#define SERVER_VELOCITY_SECONDS     10
+#define SERVER_VELOCITY_SECONDS_MAX 3
+#define SERVER_VELOCITY_MINUTES     60
+#define SERVER_VELOCITY_MINUTES_MAX 10
+#define SERVER_VELOCITY_HOURS       3600
+#define SERVER_VELOCITY_HOURS_MAX   60
+#define SERVER_VELOCITY_AMOUNT_MAX  MONEY_AMOUNT(100000, 0)
 
 typedef enum EN_serverError_t
 {
-    SERVER_OK, SAVING_FAILED, TRANSACTION_NOT_FOUND, ACCOUNT_NOT_FOUND, LOW_BALANCE, BLOCKED_ACCOUNT
+    SERVER_OK, SAVING_FAILED, TRANSACTION_NOT_FOUND, ACCOUNT_NOT_FOUND, LOW_BALANCE, BLOCKED_ACCOUNT, INIT_FAILED
 }EN_serverError_t;
 
-typedef enum EN_accountState_t
-{
-    RUNNING,
-    BLOCKED
-}EN_accountState_t;
-
-typedef struct ST_accountsDB_t
+typedef struct ST_serverConfig_t
 {
-    float balance;
-    EN_accountState_t state;
-    uint8_t primaryAccountNumber[20];
-}ST_accountsDB_t;
+    const char *accountsFile;		/* NULL for SERVER_ACCOUNTS_FILE */
+    uint64_t accountsCapacity;		/* Capacity of a newly created file, 0 for SERVER_ACCOUNTS_CAPACITY */
+    ST_journalConfig_t journal;		/* Transactions log file (NULL for SERVER_JOURNAL_FILE), and its group commit */
+    uint32_t workersCount;			/* Worker threads of recieveTransactionDataParallel, 0 to run it on the calling thread */
+    ST_filterConfig_t knownFilter;	/* Filter of all PANs, capacity 0 for the file's accounts capacity */
+    ST_filterConfig_t blockedFilter;	/* Filter of blocked PANs, capacity 0 for twice the blocked accounts (SERVER_BLOCKED_CAPACITY at least) */
+    uint64_t checkpointInterval;	/* Transactions logged between checkpoints of the balances, 0 for SERVER_CHECKPOINT_INTERVAL */
+    ST_velocityConfig_t velocity;	/* Velocity limits of an account, all windows 0 for none (see serverDefaultVelocity), capacity 0 for the file's accounts capacity */
+}ST_serverConfig_t;
 
 typedef enum EN_flagState_t
 {
@@ -44,11 +63,29 @@ typedef enum EN_flagState_t
 }EN_flagState_t;
 
 /* Functions' Prototypes */
+EN_serverError_t serverInit(const ST_serverConfig_t* config);
+void serverShutdown(void);
+EN_serverError_t serverCommit(void);
+EN_serverError_t serverCheckpoint(void);
+void serverRemoveFiles(const ST_serverConfig_t* config);
+void serverDefaultVelocity(ST_velocityConfig_t* velocity);
+EN_serverError_t serverAddAccount(const ST_accountsDB_t* account);
+EN_serverError_t serverSetAccountState(const uint8_t* primaryAccountNumber, EN_accountState_t state);
+void serverFilterStats(ST_filterStats_t* knownStats, ST_filterStats_t* blockedStats);
+void serverVelocityStats(ST_velocityStats_t* stats);
+EN_serverError_t serverSettlement(date_t date, EN_settlementNetwork_t network, ST_settlementTotals_t* totals);
+EN_serverError_t findAccount(ST_cardData_t* cardData, ST_accountsDB_t** accountRefrence);
 EN_transState_t recieveTransactionData(ST_transaction_t* transData);
+EN_serverError_t recieveTransactionDataBatch(ST_transaction_t* transData, uint32_t count, EN_transState_t* transStates);
+EN_serverError_t recieveTransactionDataParallel(ST_transaction_t* transData, uint32_t count, EN_transState_t* transStates);
 EN_serverError_t isValidAccount(ST_cardData_t* cardData, ST_accountsDB_t* accountRefrence);
 EN_serverError_t isBlockedAccount(ST_accountsDB_t* accountRefrence);
 EN_serverError_t isAmountAvailable(ST_terminalData_t* termData, ST_accountsDB_t* accountRefrence);
 EN_serverError_t saveTransaction(ST_transaction_t* transData);
 void listSavedTransactions(void);
+uint32_t querySavedTransactions(uint64_t first, ST_transaction_t *transactions, uint32_t count);
+uint32_t querySavedTransactionsBySequence(uint32_t firstSequenceNumber, ST_transaction_t *transactions, uint32_t count);
+uint32_t querySavedTransactionsByDate(date_t fromDate, date_t toDate, uint64_t *cursor, ST_transaction_t *transactions, uint32_t count);
+EN_serverError_t exportSavedTransactions(const char *fileName, EN_reportFormat_t format);
 
 #endif /* SERVER_H */
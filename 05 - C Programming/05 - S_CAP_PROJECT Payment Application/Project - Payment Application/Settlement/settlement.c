@@ -0,0 +1,203 @@
+/**
+ * @Title      	: Settlement Module
+ * @Filename   	: settlement.c
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+
+/* Settlement Module */
+#include "settlement.h"
+
+/* Card network names, in EN_settlementNetwork_t order */
+static const char *Glb_NetworkNames[] =
+{
+    "Visa", "MasterCard", "Other", "All"
+};
+
+/*
+ Name: settlementNetworkOf
+ Input: Pointer to PAN
+ Output: EN_settlementNetwork_t card network
+ Description: Static Function to get the card network of a PAN from its first digit.
+*/
+static inline EN_settlementNetwork_t settlementNetworkOf(const uint8_t *primaryAccountNumber)
+{
+    switch (primaryAccountNumber[0])
+    {
+        case '4': return SETTLEMENT_VISA;
+        case '5': return SETTLEMENT_MASTERCARD;
+        default:  return SETTLEMENT_OTHER_NETWORK;
+    }
+}
+
+/*
+ Name: settlementNetworkName
+ Input: EN_settlementNetwork_t network
+ Output: Pointer to network name
+ Description: Function to get the name of a card network, "UNKNOWN" if it is out of range.
+*/
+const char *settlementNetworkName(EN_settlementNetwork_t network)
+{
+    if ((uint32_t)network < (sizeof(Glb_NetworkNames) / sizeof(Glb_NetworkNames[0])))
+    {
+        return Glb_NetworkNames[network];
+    }
+
+    return "UNKNOWN";
+}
+
+/*
+ Name: settlementReset
+ Input: Pointer to settlement totals
+ Output: void
+ Description: Function to empty all totals, as for an empty log.
+*/
+void settlementReset(ST_settlement_t *settlement)
+{
+    memset(settlement, 0, sizeof(ST_settlement_t));
+}
+
+/*
+ Name: settlementAdd
+ Input: Pointer to settlement totals, and Pointer to Transaction
+ Output: void
+ Description: Function to add one logged transaction to the totals of its network and state: the all-days totals, and
+              the bucket of its transaction date if that day is kept. A state out of range is not added.
+*/
+void settlementAdd(ST_settlement_t *settlement, const ST_transaction_t *transData)
+{
+    EN_settlementNetwork_t Loc_Network = settlementNetworkOf(transData->cardHolderData.primaryAccountNumber);
+    uint32_t Loc_State = (uint32_t)transData->transState;
+    money_t Loc_Amount = transData->terminalData.transAmount;
+    date_t Loc_Date = transData->terminalData.packedTransactionDate;
+    ST_settlementDay_t *Loc_Bucket;
+    uint32_t Loc_Day;
+
+    /* Check 1: State has no totals */
+    if (Loc_State >= SETTLEMENT_STATES_COUNT)
+    {
+        return;
+    }
+
+    settlement->networks[Loc_Network].counts[Loc_State]++;
+    settlement->networks[Loc_Network].amounts[Loc_State] += Loc_Amount;
+
+    /* Check 2: Transaction date is only set as text, and doesn't parse */
+    if ((Loc_Date == DATE_NONE) && (dateParse(transData->terminalData.transactionDate, &Loc_Date) != DATE_OK))
+    {
+        return;
+    }
+
+    Loc_Day = dateToDayNumber(Loc_Date) + 1;
+
+    /* Check 3: Day is older than the days kept */
+    if ((settlement->newestDay > SETTLEMENT_DAYS_COUNT) && (Loc_Day <= (settlement->newestDay - SETTLEMENT_DAYS_COUNT)))
+    {
+        return;
+    }
+
+    Loc_Bucket = &settlement->days[(Loc_Day - 1) % SETTLEMENT_DAYS_COUNT];
+
+    /* Check 4: Bucket holds an older day, which is no longer kept */
+    if (Loc_Bucket->dayNumber != Loc_Day)
+    {
+        memset(Loc_Bucket, 0, sizeof(ST_settlementDay_t));
+        Loc_Bucket->dayNumber = Loc_Day;
+    }
+
+    if (Loc_Day > settlement->newestDay)
+    {
+        settlement->newestDay = Loc_Day;
+    }
+
+    Loc_Bucket->networks[Loc_Network].counts[Loc_State]++;
+    Loc_Bucket->networks[Loc_Network].amounts[Loc_State] += Loc_Amount;
+}
+
+/*
+ Name: settlementQuery
+ Input: Pointer to settlement totals, date_t date (DATE_NONE for all days), EN_settlementNetwork_t network, and Pointer to totals
+ Output: EN_settlementError_t Error or No Error
+ Description: Function to get the count and amount per state of one network (or SETTLEMENT_ALL_NETWORKS) on one day,
+              or on all days, in O(1).
+              1. A kept day, or one after the newest transaction date, with no transactions has all totals 0.
+              2. If the network is out of range returns SETTLEMENT_WRONG_NETWORK.
+              3. If the day is older than the days kept returns SETTLEMENT_DAY_NOT_KEPT.
+*/
+EN_settlementError_t settlementQuery(const ST_settlement_t *settlement, date_t date, EN_settlementNetwork_t network, ST_settlementTotals_t *totals)
+{
+    const ST_settlementTotals_t *Loc_Networks = settlement->networks;
+
+    memset(totals, 0, sizeof(ST_settlementTotals_t));
+
+    /* Check 1: Wrong network */
+    if ((uint32_t)network > SETTLEMENT_ALL_NETWORKS)
+    {
+        return SETTLEMENT_WRONG_NETWORK;
+    }
+
+    /* Check 2: One day only */
+    if (date != DATE_NONE)
+    {
+        uint32_t Loc_Day = dateToDayNumber(date) + 1;
+        const ST_settlementDay_t *Loc_Bucket = &settlement->days[(Loc_Day - 1) % SETTLEMENT_DAYS_COUNT];
+
+        /* A bucket left over from a day that is no longer kept misses the transactions added since */
+        if ((settlement->newestDay > SETTLEMENT_DAYS_COUNT) && (Loc_Day <= (settlement->newestDay - SETTLEMENT_DAYS_COUNT)))
+        {
+            return SETTLEMENT_DAY_NOT_KEPT;
+        }
+        else if (Loc_Bucket->dayNumber == Loc_Day)
+        {
+            Loc_Networks = Loc_Bucket->networks;
+        }
+        else
+        {
+            return SETTLEMENT_OK;
+        }
+    }
+
+    /* Loop: Until the totals of the network, or of all networks, are added up */
+    for (uint32_t Loc_Network = 0; Loc_Network < SETTLEMENT_ALL_NETWORKS; Loc_Network++)
+    {
+        if ((network != SETTLEMENT_ALL_NETWORKS) && (Loc_Network != (uint32_t)network))
+        {
+            continue;
+        }
+
+        for (uint32_t Loc_State = 0; Loc_State < SETTLEMENT_STATES_COUNT; Loc_State++)
+        {
+            totals->counts[Loc_State]  += Loc_Networks[Loc_Network].counts[Loc_State];
+            totals->amounts[Loc_State] += Loc_Networks[Loc_Network].amounts[Loc_State];
+        }
+    }
+
+    return SETTLEMENT_OK;
+}
+
+/*
+ Name: settlementPrint
+ Input: Pointer to name, and Pointer to totals
+ Output: void
+ Description: Function to print out the count and amount of each state of a query, under a name.
+*/
+void settlementPrint(const char *name, const ST_settlementTotals_t *totals)
+{
+    char Loc_Amount[MONEY_TEXT_SIZE];
+
+    printf(" %s\n", name);
+
+    /* Loop: Until all transaction states are printed out */
+    for (uint32_t Loc_State = 0; Loc_State < SETTLEMENT_STATES_COUNT; Loc_State++)
+    {
+        moneyFormat(totals->amounts[Loc_State], Loc_Amount);
+        printf("  %-28s%10llu %16s\n", reportStateName((EN_transState_t)Loc_State), (unsigned long long)totals->counts[Loc_State], Loc_Amount);
+    }
+}
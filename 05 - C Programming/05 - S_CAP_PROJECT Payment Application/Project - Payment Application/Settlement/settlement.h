@@ -0,0 +1,82 @@
+/**
+ * @Title      	: Settlement Module
+ * @Filename   	: settlement.h
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+#ifndef SETTLEMENT_H_
+#define SETTLEMENT_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../Date/date.h"
+#include "../Money/money.h"
+#include "../Journal/journal.h"
+#include "../Report/report.h"
+
+/* Number of transaction states totals are kept for */
+#define SETTLEMENT_STATES_COUNT		(DECLINED_VELOCITY + 1)
+/* Number of days totals are kept for, counted back from the newest transaction date */
+#define SETTLEMENT_DAYS_COUNT		366
+
+typedef enum EN_settlementNetwork_t
+{
+    SETTLEMENT_VISA, SETTLEMENT_MASTERCARD, SETTLEMENT_OTHER_NETWORK, SETTLEMENT_ALL_NETWORKS
+}EN_settlementNetwork_t;
+
+/**************************************************************************************************************************************/
+/*
+* Running totals of the transactions log, per card network (from the first PAN digit: 4 Visa, 5 MasterCard) and state:
+*	| all days: networks[SETTLEMENT_ALL_NETWORKS] | day buckets: days[SETTLEMENT_DAYS_COUNT] |
+* A transaction is added to the all-days totals, and to the bucket of its transaction date (day number modulo
+* SETTLEMENT_DAYS_COUNT), which is emptied when a newer day takes it over. So adding a transaction and answering any
+* query are O(1), with no scan of the log. A date that doesn't parse, or older than the days kept, is only in the
+* all-days totals.
+*/
+/**************************************************************************************************************************************/
+typedef struct ST_settlementTotals_t
+{
+    uint64_t counts[SETTLEMENT_STATES_COUNT];
+    money_t amounts[SETTLEMENT_STATES_COUNT];
+}ST_settlementTotals_t;
+
+typedef struct ST_settlementDay_t
+{
+    uint32_t dayNumber;					/* dateToDayNumber + 1 of the day in the bucket, 0 for an unused bucket */
+    ST_settlementTotals_t networks[SETTLEMENT_ALL_NETWORKS];
+}ST_settlementDay_t;
+
+typedef struct ST_settlement_t
+{
+    ST_settlementTotals_t networks[SETTLEMENT_ALL_NETWORKS];
+    ST_settlementDay_t days[SETTLEMENT_DAYS_COUNT];
+    uint32_t newestDay;					/* dateToDayNumber + 1 of the newest transaction date, 0 for none */
+}ST_settlement_t;
+
+typedef enum EN_settlementError_t
+{
+    SETTLEMENT_OK, SETTLEMENT_WRONG_NETWORK, SETTLEMENT_DAY_NOT_KEPT
+}EN_settlementError_t;
+
+/**************************************************************************************************************************************/
+/*
+*							Prototypes for all used functions inside the settlement module.
+*/
+/**************************************************************************************************************************************/
+const char *settlementNetworkName(EN_settlementNetwork_t network);
+void settlementReset(ST_settlement_t *settlement);
+void settlementAdd(ST_settlement_t *settlement, const ST_transaction_t *transData);
+EN_settlementError_t settlementQuery(const ST_settlement_t *settlement, date_t date, EN_settlementNetwork_t network, ST_settlementTotals_t *totals);
+void settlementPrint(const char *name, const ST_settlementTotals_t *totals);
+
+#endif /* SETTLEMENT_H_ */
@@ -37,62 +37,52 @@
 
  EN_terminalError_t getTransactionDate(ST_terminalData_t *termData)
  {
-    uint8_t day;
-    uint8_t month;
-    uint16_t year;
-
-    time_t t = time(NULL);
-    struct tm tm = *localtime(&t);
-
-    sprintf((char *) termData->transactionDate, "%02d/%02d/%04d", tm.tm_mday, tm.tm_mon + 1, tm.tm_year + 1900);
+    // today's date is cached, the clock is only read again into a date once the day changes
+    termData->packedTransactionDate = dateToday(termData->transactionDate);
 
     printf(" Current date:\t\t%s\n", termData->transactionDate);
 
-    /* Validate Date Length*/
-    if(strlen((char *)termData->transactionDate) != 10)
-    {
-        return WRONG_DATE;
-    }
+    return TERMINAL_OK;
+ }
 
-    /* Validate Date Format */
-    if(termData->transactionDate[2] != '/' || termData->transactionDate[5] != '/')
-    {
-        return WRONG_DATE;
-    }
+ /*
+ * @brief          : Check a transaction date without reading the clock
+ * Description     :
+    - This function takes a transaction date "DD/MM/YYYY", so dates of recorded transactions can be checked too
+    - Day is 1 to 31 (29 in February), month is 1 to 12, and year is 1900 to 2100
+ * Return          :
+    - WRONG_DATE ERROR if transaction date is not 10 characters or Wrong format
+    - TERMINAL_OK otherwise
+ */
 
-    /* Validate Day */
-    day = termData->transactionDate[0] - '0';
-    day = (day*10) + (termData->transactionDate[1] - '0');
+ EN_terminalError_t isValidTransactionDate(const uint8_t *transactionDate)
+ {
+    date_t date;
 
-    if(day<1 || day>31)
-    {
-        return WRONG_DATE;
-    }
+    return (dateParse(transactionDate, &date) == DATE_OK) ? TERMINAL_OK : WRONG_DATE;
+ }
 
-    /* Validate Month */
-    month = termData->transactionDate[3] - '0';
-    month = (month*10) + (termData->transactionDate[4] - '0');
+ /*
+ * @brief          : Store a given transaction date in terminal data
+ * Description     :
+    - This function takes a transaction date "DD/MM/YYYY", checks it as isValidTransactionDate does,
+      and stores it both as text and packed
+ * Return          :
+    - WRONG_DATE ERROR if transaction date is not 10 characters or Wrong format, terminal data is not changed
+    - TERMINAL_OK otherwise
+ */
 
-    if(month<1 || month>12)
-    {
-        return WRONG_DATE;
-    }
+ EN_terminalError_t setTransactionDate(ST_terminalData_t *termData, const uint8_t *transactionDate)
+ {
+    date_t date;
 
-    if(month==2 && day>29)
+    if (dateParse(transactionDate, &date) != DATE_OK)
     {
         return WRONG_DATE;
     }
 
-    /* Validate Year */
-    year = termData->transactionDate[6] - '0';
-    year = (year*10) + (termData->transactionDate[7] - '0');
-    year = (year*10) + (termData->transactionDate[8] - '0');
-    year = (year*10) + (termData->transactionDate[9] - '0');
-
-    if(year<1900 || year>2100)
-    {
-        return WRONG_DATE;
-    }
+    memcpy(termData->transactionDate, transactionDate, DATE_TEXT_SIZE);
+    termData->packedTransactionDate = date;
 
     return TERMINAL_OK;
  }
@@ -102,7 +92,7 @@
  * @author Hossam Elwahsh
  * This function takes the maximum allowed amount and stores it into terminal data
  * Note:
- * - Transaction max amount is a float number 
+ * - Transaction max amount is in minor units, see money.h
  * 
  * @param termData [in,out] terminal data
  * @param maxAmount [in] max transaction amount
@@ -110,7 +100,7 @@
  * @return INVALID_MAX_AMOUNT if max amount is less than or equal zero
  * @return TERMINAL_OK otherwise
  */
-EN_terminalError_t setMaxAmount(ST_terminalData_t *termData, float maxAmount)
+EN_terminalError_t setMaxAmount(ST_terminalData_t *termData, money_t maxAmount)
 {
     if (maxAmount > 0) {
         termData->maxTransAmount = maxAmount;
@@ -150,25 +140,37 @@ EN_terminalError_t getTransactionAmount(ST_terminalData_t *termData)
     fflush(stdin);
     fflush(stdout);
 
-    float number;
-    char *endptr;
-    char input[20] = {'\0'};
+    money_t number;
+    char input[32] = {'\0'};
     fgets(input, sizeof(input), stdin);
-    // remove trailing newline from string
-    char* ptr = strchr(input, '\n');
-    if (ptr) *ptr = '\0';
-
-    number = strtof(input, &endptr);
-    if (endptr == input || *endptr != '\n') {
-        if (number <= 0.0) {
-            return INVALID_AMOUNT;
-        } else {
-            termData->transAmount = number;
-            return TERMINAL_OK;
-        }
-    } else {
-        return TERMINAL_OK;
+
+    // amount is read exactly into minor units, more than 2 decimals is not an amount
+    if (moneyParse(input, &number) != MONEY_OK) {
+        return INVALID_AMOUNT;
+    }
+
+    return setTransactionAmount(termData, number);
+}
+
+/**
+ * This function takes a transaction amount and stores it into terminal data, without asking for it
+ * Note:
+ * - Transaction amount is in minor units, see money.h
+ *
+ * @param termData [in,out] terminal data
+ * @param amount [in] transaction amount
+ *
+ * @return INVALID_AMOUNT if amount is less than or equal zero
+ * @return TERMINAL_OK otherwise
+ */
+EN_terminalError_t setTransactionAmount(ST_terminalData_t *termData, money_t amount)
+{
+    if (amount <= 0) {
+        return INVALID_AMOUNT;
     }
+
+    termData->transAmount = amount;
+    return TERMINAL_OK;
 }
 
  /**
@@ -181,78 +183,71 @@ EN_terminalError_t getTransactionAmount(ST_terminalData_t *termData)
  * Description: 1. This function compares the card expiry date with the transaction date.
 			    2. If the card expiration date is before the transaction date will return EXPIRED_CARD,
 				 else return TERMINAL_OK.
+			    3. Both dates are compared packed, with one integer compare, see date.h.
+			    4. A packed date is only used while it matches its text, else the text is packed again, so a text
+				 changed after it was packed is still the one checked.
 */
 EN_terminalError_t isCardExpired(ST_cardData_t *cardData, ST_terminalData_t *termData)
 {
-	/* Define local variable to set the error state, No Error */
-	EN_terminalError_t Loc_ErrorState = TERMINAL_OK;
-	/* Define local variable to store month on Card */
-	uint8_t Loc_CardMonth = ((cardData->cardExpirationDate[0] - '0') * 10) + (cardData->cardExpirationDate[1] - '0');
-	/* Define local variable to store year on Card */
-	uint8_t Loc_CardYear  = ((cardData->cardExpirationDate[3] - '0') * 10) + (cardData->cardExpirationDate[4] - '0');
-	/* Define local variable to store month of transaction */
-	uint8_t Loc_TransMonth = ((termData->transactionDate[3] - '0') * 10) + (termData->transactionDate[4] - '0');
-	/* Define local variable to store year of transaction */
-	uint8_t Loc_TransYear  = ((termData->transactionDate[8] - '0') * 10) + (termData->transactionDate[9] - '0');
-
-	/* Check 1: cardYear < transYear */
-	if (Loc_CardYear < Loc_TransYear)
+	/* Define local variable to store the packed expiry date on Card, the last day of its month */
+	date_t Loc_CardDate = cardData->packedExpirationDate;
+	/* Define local variable to store the packed date of transaction */
+	date_t Loc_TransDate = termData->packedTransactionDate;
+
+	/* Check 1: Dates are only set as text, or their text changed after they were packed, pack them here */
+	if (!dateMatchesExpiry(Loc_CardDate, cardData->cardExpirationDate))
 	{
-		/* Update error state, Expired Card! */
-		Loc_ErrorState = EXPIRED_CARD;
+		dateParseExpiry(cardData->cardExpirationDate, &Loc_CardDate);
 	}
-	/* Check 2: cardYear >= transYear */
-	else
+
+	if (!dateMatches(Loc_TransDate, termData->transactionDate))
 	{
-		/* Check 2.1: cardMonth < TransMonth */
-		if (Loc_CardYear == Loc_TransYear && Loc_CardMonth < Loc_TransMonth)
-		{
-			/* Update error state, Expired Card! */
-			Loc_ErrorState = EXPIRED_CARD;
-		}
+		dateParse(termData->transactionDate, &Loc_TransDate);
 	}
 
-	return Loc_ErrorState;
+	/* Check 2: Card expired before the transaction date */
+	return (Loc_CardDate < Loc_TransDate) ? EXPIRED_CARD : TERMINAL_OK;
 }
 
 /**
  * This function will check if the PAN is a Luhn number or not
+ * Note:
+ * - The PAN is its digits up to the first NUL, a PAN with no digits or with any other character is not a Luhn number
  * @param cardData user credit card data
  * @return INVALID_CARD if not Luhn number
  * @return TERMINAL_OK otherwise
  */
 EN_terminalError_t isValidCardPAN(ST_cardData_t *cardData)
 {
-    int sum = 0;
-    int len = sizeof(cardData->primaryAccountNumber);
-    int is_second = 0;
-
-    for (int i = len - 1; i >= 0; i--) {
-        int digit = cardData->primaryAccountNumber[i];
-        if(digit == 0) continue; // card number is less than 20
-        digit -= '0'; // convert number from char to integer
-
-        // double every second digit
-        if (is_second) {
-            digit *= 2;
-
-            // if result is 2 digits, sum the 2 digits into one
-            while (digit > 9) {
-                digit -= 9;
-            }
-        }
+    uint8_t valid;
 
-        // add digit to total sum
-        sum += digit;
+    luhnCheckBatch(cardData->primaryAccountNumber, sizeof(ST_cardData_t), 1, &valid);
 
-        // flip is_second number flag
-        is_second = !is_second;
-    }
+    return (valid ? TERMINAL_OK : INVALID_CARD);
+}
 
-    // check if sum of the digits is divisible by 10, therefore it is a valid Luhn number
-    // checksum is the last digit
-    return ((sum % 10 == 0) ? TERMINAL_OK : INVALID_CARD);
+/**
+ * This function will check if each PAN of an array of cards is a Luhn number or not, as isValidCardPAN does
+ * Note:
+ * - PANs are checked in place, with the fastest Luhn kernel of the CPU (AVX2, SSSE3 or scalar)
+ * @param cardData [in] array of count user credit cards
+ * @param count [in] number of cards
+ * @param results [out] TERMINAL_OK or INVALID_CARD for each card
+ */
+void isValidCardPANBatch(ST_cardData_t *cardData, uint32_t count, EN_terminalError_t *results)
+{
+    uint8_t valid[256];
 
+    // check the cards 256 at a time, the kernel writes 1 byte per card
+    for (uint32_t first = 0; first < count; first += 256) {
+        uint32_t chunk = ((count - first) < 256) ? (count - first) : 256;
+
+        luhnCheckBatch(cardData[first].primaryAccountNumber, sizeof(ST_cardData_t), chunk, valid);
+
+        for (uint32_t i = 0; i < chunk; i++) {
+            results[first + i] = (valid[i] ? TERMINAL_OK : INVALID_CARD);
+        }
+    }
 }
 
 /* ********************** Main Terminal Functions End ********************************************** */
@@ -17,12 +17,16 @@
 #include <stdint.h>
 #include <time.h>
 #include "../Card/card.h"
+#include "../Date/date.h"
+#include "../Money/money.h"
+#include "../Luhn/luhn.h"
 
 typedef struct ST_terminalData_t
 {
-	float transAmount;
-	float maxTransAmount;
+	money_t transAmount;		/* Minor units */
+	money_t maxTransAmount;		/* Minor units */
 	uint8_t transactionDate[11];
+	date_t packedTransactionDate;	/* transactionDate packed, DATE_NONE if it is only set as text */
 }ST_terminalData_t;
 
 typedef enum EN_terminalError_t
@@ -32,10 +36,14 @@ typedef enum EN_terminalError_t
 
 /* Functions' Prototypes */
 EN_terminalError_t getTransactionDate(ST_terminalData_t *termData);
+EN_terminalError_t isValidTransactionDate(const uint8_t *transactionDate);
+EN_terminalError_t setTransactionDate(ST_terminalData_t *termData, const uint8_t *transactionDate);
 EN_terminalError_t isCardExpired(ST_cardData_t *cardData, ST_terminalData_t *termData);
 EN_terminalError_t getTransactionAmount(ST_terminalData_t *termData);
+EN_terminalError_t setTransactionAmount(ST_terminalData_t *termData, money_t amount);
 EN_terminalError_t isBelowMaxAmount(ST_terminalData_t *termData);
-EN_terminalError_t setMaxAmount(ST_terminalData_t *termData, float maxAmount);
+EN_terminalError_t setMaxAmount(ST_terminalData_t *termData, money_t maxAmount);
 EN_terminalError_t isValidCardPAN(ST_cardData_t *cardData); // Optional
+void isValidCardPANBatch(ST_cardData_t *cardData, uint32_t count, EN_terminalError_t *results);
 
 #endif /* TERMINAL_H */
\ No newline at end of file
@@ -1,6 +1,18 @@
 
 #include "test.h"
 
+/* Sockets and file size limits of the network test, which runs on Linux only */
+#ifdef __linux__
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#endif
+
 /************************************************************************************************************
 * Function : getCardHolderNameTest()
 *//**
@@ -394,6 +406,64 @@ void isCardExpiredTest(void) {
     fclose(fp_test_cases);
 }
 
+/**
+ * Runs test cases for isCardExpired() on dates whose text is changed after they were packed
+ */
+void isCardExpiredEditedTest(void)
+{
+    // Print Test Header
+    printf("==================================\n");
+    printf("Tester Name:\tAbdelrhman Walaa\n");
+    printf("Function Name:\tisCardExpired\n");
+    printf("==================================\n");
+
+    // test cases init
+    char *test_cases_filename = CONCAT(TEST_DIR, "isCardExpiredEdited.csv");
+    const char testCaseDelimiter[4] = ",\r\n";
+    // test cases buffer
+    char testCase[256];
+    ST_cardData_t cardData;
+    ST_terminalData_t terminalData;
+
+    FILE *fp_test_cases;
+    int i = 0;
+
+    fp_test_cases = fopen(test_cases_filename, "r");
+
+    while (fgets(testCase, sizeof(testCase), fp_test_cases)) {
+        // split test case into tokens of packed & edited expiry, packed & edited transaction date & expected result
+        char *packedExpiry = strtok(testCase, testCaseDelimiter);
+        char *editedExpiry = strtok(NULL, testCaseDelimiter);
+        char *packedDate = strtok(NULL, testCaseDelimiter);
+        char *editedDate = strtok(NULL, testCaseDelimiter);
+        char *expectedResult = strtok(NULL, testCaseDelimiter);
+
+        printf("\n------------------------------\n");
+        printf("Test Case %d\n", i + 1);
+        printf("------------------------------\n");
+
+        printf("Input Data:\tcard %s edited to %s, transaction %s edited to %s\n", packedExpiry, editedExpiry, packedDate, editedDate);
+        printf("Expected:\t%s\n", expectedResult);
+
+        /************* Execute test case ***************/
+        // pack the dates as getCardExpiryDate and setTransactionDate do, then change only their text
+        memset(&cardData, 0, sizeof(cardData));
+        memset(&terminalData, 0, sizeof(terminalData));
+        dateParseExpiry((uint8_t *)packedExpiry, &cardData.packedExpirationDate);
+        dateParse((uint8_t *)packedDate, &terminalData.packedTransactionDate);
+        strcpy((char *)cardData.cardExpirationDate, editedExpiry);
+        strcpy((char *)terminalData.transactionDate, editedDate);
+
+        EN_terminalError_t ret = isCardExpired(&cardData, &terminalData);
+
+        printf("Actual Result:\t%s\n", (ret == EXPIRED_CARD) ? "EXPIRED_CARD" : "TERMINAL_OK");
+
+        i++; // next test case
+    }
+
+    fclose(fp_test_cases);
+}
+
 void getTransactionAmountTest(void)
 {
     // test cases init
@@ -488,7 +558,7 @@ void isBelowMaxAmountTest(void)
 
     ST_terminalData_t *terminalData = calloc(1, sizeof(ST_terminalData_t));
 
-    setMaxAmount(terminalData, 4000.0f);
+    setMaxAmount(terminalData, MONEY_AMOUNT(4000, 0));
 
     // Print Test Header
     printf("==================================\n");
@@ -519,7 +589,7 @@ void isBelowMaxAmountTest(void)
         printf("Input Data:\t%s\n", inputData);
         printf("Expected:\t%s\n", expectedResult);
 
-        terminalData->transAmount = atof(inputData);
+        moneyParse(inputData, &terminalData->transAmount);
 
         /************* Execute test case ***************/
         EN_terminalError_t ret = isBelowMaxAmount(terminalData);
@@ -589,8 +659,12 @@ void setMaxAmountTest(void) {
         printf("Input Data:\t%s\n", inputData);
         printf("Expected:\t%s\n", expectedResult);
 
+        // an input that isn't an amount is passed as 0
+        money_t maxAmount;
+        moneyParse(inputData, &maxAmount);
+
         /************* Execute test case ***************/
-        EN_terminalError_t ret = setMaxAmount(terminalData, atof(inputData));
+        EN_terminalError_t ret = setMaxAmount(terminalData, maxAmount);
         // turn on console logs
 
         printf("Actual Result:\t");
@@ -611,6 +685,65 @@ void setMaxAmountTest(void) {
 }
 
 
+/**
+ * Runs test cases for moneyParse(), a parsed amount is printed back with moneyFormat()
+ */
+void moneyParseTest(void)
+{
+    // Print Test Header
+    printf("====================================\n");
+    printf("Tester Name:\tAbdelrhman Walaa\n");
+    printf("Function Name:\tmoneyParse()\n");
+    printf("====================================\n");
+
+    // test cases init
+    char* test_cases_filename = CONCAT(TEST_DIR, "moneyParse.csv");
+    const char testCaseDelimiter[4] = ",\r\n";
+    // test cases buffer
+    char testCase[256];
+    char amountText[MONEY_TEXT_SIZE];
+
+    FILE* fp_test_cases;
+    int i = 0;
+
+    fp_test_cases = fopen(test_cases_filename, "r");
+
+    while (fgets(testCase, sizeof(testCase), fp_test_cases)) {
+        // split test case into tokens of input text & expected result (which were delimited by comma)
+        char* inputData = strtok(testCase, testCaseDelimiter);
+        char* expectedResult = strtok(NULL, testCaseDelimiter);
+        money_t amount;
+
+        printf("\n-----------------------\n");
+        printf("Test Case %d\n", i + 1);
+        printf("-----------------------\n");
+
+        printf("Input Data:\t\"%s\"\n", inputData);
+        printf("Expected:\t%s\n", expectedResult);
+
+        /************* Execute test case ***************/
+        EN_moneyError_t ret = moneyParse(inputData, &amount);
+
+        printf("Actual Result:\t");
+        switch (ret) {
+            case MONEY_OK:
+                moneyFormat(amount, amountText);
+                printf("%s\n", amountText);
+                break;
+            case MONEY_WRONG_FORMAT:
+                printf("MONEY_WRONG_FORMAT\n");
+                break;
+            case MONEY_OVERFLOW:
+                printf("MONEY_OVERFLOW\n");
+                break;
+        }
+
+        i++; // next test case
+    }
+
+    fclose(fp_test_cases);
+}
+
 /**
  * Runs test cases for isValidCardPAN()
  */
@@ -686,6 +819,61 @@ void isValidCardPANTest(void) {
     fclose(fp_test_cases);
 }
 
+/**
+ * Runs the test cases of isValidCardPAN() through isValidCardPANBatch(), all of them in one call
+ */
+void isValidCardPANBatchTest(void) {
+    // test cases init
+    char *test_cases_filename = CONCAT(TEST_DIR, "isValidCardPAN.csv");
+    const char testCaseDelimiter[4] = ",\r\n";
+
+    // test cases buffer
+    char testCase[256];
+    char expectedResults[32][32];
+    ST_cardData_t cardData[32];
+    EN_terminalError_t results[32];
+
+    // Print Test Header
+    printf("===============================\n");
+    printf("Tester Name:\tAbdelrhman Walaa\n");
+    printf("Function Name:\tisValidCardPANBatch\n");
+    printf("===============================\n");
+
+    FILE *fp_test_cases;
+    uint32_t count = 0;
+
+    // read all test cases first, the batch runs them in one call
+    fp_test_cases = fopen(test_cases_filename, "r");
+
+    while ((count < 32) && fgets(testCase, sizeof(testCase), fp_test_cases)) {
+        // split test case into tokens of input data & expected result (which was delimited by comma)
+        char *inputData = strtok(testCase, testCaseDelimiter);
+        char *expectedResult = strtok(NULL, testCaseDelimiter);
+
+        memset(&cardData[count], 0, sizeof(ST_cardData_t));
+        strncpy((char *)cardData[count].primaryAccountNumber, inputData, sizeof(cardData[count].primaryAccountNumber) - 1);
+        strcpy(expectedResults[count], expectedResult);
+        count++;
+    }
+
+    fclose(fp_test_cases);
+
+    /************* Execute test cases ***************/
+    isValidCardPANBatch(cardData, count, results);
+
+    printf("Kernel:\t\t%s\n", luhnKernelName(luhnBestKernel()));
+
+    for (uint32_t i = 0; i < count; i++) {
+        printf("\n-----------------------\n");
+        printf("Test Case %u\n", i + 1);
+        printf("-----------------------\n");
+
+        printf("Input Data:\t%s\n", cardData[i].primaryAccountNumber);
+        printf("Expected:\t%s\n", expectedResults[i]);
+        printf("Actual Result:\t%s\n", (results[i] == TERMINAL_OK) ? "TERMINAL_OK" : "INVALID_CARD");
+    }
+}
+
 /** ***************************************************
 ******************* SERVER MODULE *******************
 *******************************************************/
@@ -763,6 +951,9 @@ void isBlockedAccountTest(void)
         case BLOCKED_ACCOUNT:
             printf("BLOCKED_ACCOUNT\n");
             break;
+        default:
+            printf("unexpected EN_serverError_t %d\n", ret);
+            break;
         }
 
         fclose(fp_fake_stdin);
@@ -835,6 +1026,9 @@ void isValidAccountTest(void)
             case SERVER_OK:
                 printf("SERVER_OK\n");
                 break;
+            default:
+                printf("unexpected EN_serverError_t %d\n", ret);
+                break;
         }
 
         i++; // next test case
@@ -850,17 +1044,20 @@ void isValidAccountTest(void)
 
 void listSavedTransactionsTest(void)
 {
+    char amountText[MONEY_TEXT_SIZE];
     ST_transaction_t transactionsDB[4] = {
             {
                     {
                         "Mohamed Salah Mohamed",
                         "4728459258966333",
-                        "05/25"
+                        "05/25",
+                        DATE_NONE
                     },
                     {
-                            1000.0f,
-                            4000.0f,
-                            "03/10/2020"
+                            MONEY_AMOUNT(1000, 0),
+                            MONEY_AMOUNT(4000, 0),
+                            "03/10/2020",
+                            DATE_NONE
                     },
                     APPROVED,
                     1
@@ -869,12 +1066,14 @@ void listSavedTransactionsTest(void)
                     {
                         "Salah Abdo Hamed",
                         "4946084897338284",
-                        "05/24"
+                        "05/24",
+                        DATE_NONE
                     },
                     {
-                            3500.0f,
-                            4000.0f,
-                            "05/10/2020"
+                            MONEY_AMOUNT(3500, 0),
+                            MONEY_AMOUNT(4000, 0),
+                            "05/10/2020",
+                            DATE_NONE
                     },
                     DECLINED_STOLEN_CARD,
                     2
@@ -883,12 +1082,14 @@ void listSavedTransactionsTest(void)
                     {
                         "Aly Mamdouh Aly",
                         "4728451059691228",
-                        "06/25"
+                        "06/25",
+                        DATE_NONE
                     },
                     {
-                            3200.0f,
-                            4000.0f,
-                            "06/11/2020"
+                            MONEY_AMOUNT(3200, 0),
+                            MONEY_AMOUNT(4000, 0),
+                            "06/11/2020",
+                            DATE_NONE
                     },
                     APPROVED,
                     3
@@ -897,12 +1098,14 @@ void listSavedTransactionsTest(void)
                     {
                         "Mostafa Mohamed Mostafa",
                         "4573762093153876",
-                        "07/26"
+                        "07/26",
+                        DATE_NONE
                     },
                     {
-                            2500.0f,
-                            4000.0f,
-                            "07/10/2021"
+                            MONEY_AMOUNT(2500, 0),
+                            MONEY_AMOUNT(4000, 0),
+                            "07/10/2021",
+                            DATE_NONE
                     },
                     DECLINED_STOLEN_CARD,
                     4
@@ -929,9 +1132,11 @@ void listSavedTransactionsTest(void)
         printf(" ##########################\n");
         printf(" Transaction Sequence Number: %d\n", transactionsDB[i].transactionSequenceNumber);
         printf(" Transaction Date: %s\n", transactionsDB[i].terminalData.transactionDate);
-        printf(" Transaction Amount: %.3f\n", transactionsDB[i].terminalData.transAmount);
+        moneyFormat(transactionsDB[i].terminalData.transAmount, amountText);
+        printf(" Transaction Amount: %s\n", amountText);
         printf(" Transaction State: %d\n", transactionsDB[i].transState);
-        printf(" Terminal Max Amount: %.3f\n", transactionsDB[i].terminalData.maxTransAmount);
+        moneyFormat(transactionsDB[i].terminalData.maxTransAmount, amountText);
+        printf(" Terminal Max Amount: %s\n", amountText);
         printf(" Cardholder Name: %s\n", transactionsDB[i].cardHolderData.cardHolderName);
         printf(" PAN: %s\n", transactionsDB[i].cardHolderData.primaryAccountNumber);
         printf(" Card Expiration Date: %s\n", transactionsDB[i].cardHolderData.cardExpirationDate);
@@ -963,10 +1168,11 @@ void isAmountAvailableTest(void) {
 
     // test cases buffer
     char testCase[256];
+    char amountText[MONEY_TEXT_SIZE];
 
     ST_terminalData_t * terminalData = calloc(1, sizeof(ST_terminalData_t));
     ST_accountsDB_t * accountReference = calloc(1, sizeof(ST_accountsDB_t));
-    accountReference->balance = 8000.0f;
+    accountReference->balance = MONEY_AMOUNT(8000, 0);
 
     // Print Test Header
     printf("===============================\n");
@@ -994,11 +1200,12 @@ void isAmountAvailableTest(void) {
         inputData = strtok(testCase, testCaseDelimiter);
         expectedResult = strtok(NULL, testCaseDelimiter);
 
-        printf("Acc Balance:\t%.2f\n", accountReference->balance);
+        moneyFormat(accountReference->balance, amountText);
+        printf("Acc Balance:\t%s\n", amountText);
         printf("Input Data:\t%s\n", inputData);
         printf("Expected:\t%s\n", expectedResult);
 
-        terminalData->transAmount = atof(inputData);
+        moneyParse(inputData, &terminalData->transAmount);
 
         /************* Execute test case ***************/
         EN_serverError_t ret = isAmountAvailable(terminalData, accountReference);
@@ -1012,6 +1219,9 @@ void isAmountAvailableTest(void) {
             case LOW_BALANCE:
                 printf("LOW_BALANCE\n");
                 break;
+            default:
+                printf("unexpected EN_serverError_t %d\n", ret);
+                break;
         }
 
         i++; // next test case
@@ -1043,12 +1253,14 @@ void receiveTransactionDataTest(void)
                     {
                             "Mohamed Salah Mohamed",
                             "4728459258966333",
-                            "05/25"
+                            "05/25",
+                            DATE_NONE
                     },
                     {
-                            1000.0f,
-                            4000.0f,
-                            "03/10/2020"
+                            MONEY_AMOUNT(1000, 0),
+                            MONEY_AMOUNT(4000, 0),
+                            "03/10/2020",
+                            DATE_NONE
                     },
                     APPROVED,
                     1
@@ -1057,12 +1269,14 @@ void receiveTransactionDataTest(void)
                     {
                             "Alaa Eldin Bayoumi",
                             "4946084897338284",
-                            "05/24"
+                            "05/24",
+                            DATE_NONE
                     },
                     {
-                            3500.0f,
-                            4000.0f,
-                            "05/10/2020"
+                            MONEY_AMOUNT(3500, 0),
+                            MONEY_AMOUNT(4000, 0),
+                            "05/10/2020",
+                            DATE_NONE
                     },
                     DECLINED_STOLEN_CARD,
                     2
@@ -1071,12 +1285,14 @@ void receiveTransactionDataTest(void)
                     {
                             "Aly Mamdouh Aly",
                             "4728451059691228",
-                            "06/25"
+                            "06/25",
+                            DATE_NONE
                     },
                     {
-                            3200.0f,
-                            4000.0f,
-                            "06/11/2020"
+                            MONEY_AMOUNT(3200, 0),
+                            MONEY_AMOUNT(4000, 0),
+                            "06/11/2020",
+                            DATE_NONE
                     },
                     APPROVED,
                     3
@@ -1085,12 +1301,14 @@ void receiveTransactionDataTest(void)
                     {
                             "Mostafa Mohamed Mostafa",
                             "4573762093153876",
-                            "07/26"
+                            "07/26",
+                            DATE_NONE
                     },
                     {
-                            2500.0f,
-                            4000.0f,
-                            "07/10/2021"
+                            MONEY_AMOUNT(2500, 0),
+                            MONEY_AMOUNT(4000, 0),
+                            "07/10/2021",
+                            DATE_NONE
                     },
                     DECLINED_STOLEN_CARD,
                     4
@@ -1139,6 +1357,9 @@ void receiveTransactionDataTest(void)
         case INTERNAL_SERVER_ERROR:
             printf("INTERNAL_SERVER_ERROR\n");
             break;
+        case DECLINED_VELOCITY:
+            printf("DECLINED_VELOCITY\n");
+            break;
         case APPROVED:
             printf("APPROVED\n");
             break;
@@ -1149,86 +1370,930 @@ void receiveTransactionDataTest(void)
     fclose(fp_test_cases);
 }
 
-/**
- * Runs test cases for saveTransaction()
- */
-void saveTransactionTest(void)
+void receiveTransactionDataBatchTest(void)
 {
     // Print Test Header
     printf("====================================\n");
-    printf("Tester Name:\tTarek Gohary\n");
-    printf("Function Name:\tgetTransactionDate()\n");
+    printf("Tester Name:\tAbdelrhman Walaa\n");
+    printf("Function Name:\trecieveTransactionDataBatch()\n");
     printf("====================================\n");
-    printf("Test Case 1\n");
-    printf("Input Data:\tAll transaction data after validation\n");
-    printf("Expected Result:\tSERVER_OK\n");
 
-   ST_transaction_t transData = {
-           {
-                   "Mohamed Salah Mohamed",
-                   "4728459258966333",
-                   "05/25"
-           },
-           {
-                   1000.0f,
-                   4000.0f,
-                   "03/10/2020"
-           },
-           APPROVED,
-           1
-   };
-    EN_serverError_t ret = saveTransaction(&transData);
+    // test cases init
+    char* test_cases_filename = CONCAT(TEST_DIR, "receiveTransactionDataBatch.csv");
+    const char testCaseDelimiter[3] = ",\r";
+    // test cases buffer
+    char testCase[256];
+    char amountText[MONEY_TEXT_SIZE];
+    char expectedResults[16][32];
+    ST_transaction_t transactions[16];
+    EN_transState_t transStates[16];
 
-    switch (ret) {
-        case SERVER_OK:
-            printf("Actual Result:\tSERVER_OK\n");
-            break;
+    FILE* fp_test_cases;
+    uint32_t count = 0;
+
+    // read all test cases first, the batch runs them in one call
+    fp_test_cases = fopen(test_cases_filename, "r");
+
+    while ((count < 16) && fgets(testCase, sizeof(testCase), fp_test_cases)) {
+        // split test case into tokens of PAN, amount & expected result (which were delimited by comma)
+        char* inputPAN = strtok(testCase, testCaseDelimiter);
+        char* inputAmount = strtok(NULL, testCaseDelimiter);
+        char* expectedResult = strtok(NULL, testCaseDelimiter);
+
+        memset(&transactions[count], 0, sizeof(ST_transaction_t));
+        strcpy((char *)transactions[count].cardHolderData.cardHolderName, "Batch Card Holder");
+        strcpy((char *)transactions[count].cardHolderData.primaryAccountNumber, inputPAN);
+        strcpy((char *)transactions[count].cardHolderData.cardExpirationDate, "05/30");
+        strcpy((char *)transactions[count].terminalData.transactionDate, "17/10/2026");
+        moneyParse(inputAmount, &transactions[count].terminalData.transAmount);
+        transactions[count].terminalData.maxTransAmount = MONEY_AMOUNT(4000, 0);
+        strcpy(expectedResults[count], expectedResult);
+        count++;
+    }
+
+    fclose(fp_test_cases);
+
+    /************* Execute test cases ***************/
+    recieveTransactionDataBatch(transactions, count, transStates);
+
+    for (uint32_t i = 0; i < count; i++) {
+        printf("\n-----------------------\n");
+        printf("Test Case %u\n", i + 1);
+        printf("-----------------------\n");
+
+        moneyFormat(transactions[i].terminalData.transAmount, amountText);
+        printf("Input Data:\t%s, %s\n", transactions[i].cardHolderData.primaryAccountNumber, amountText);
+        printf("Expected:\t%s\n", expectedResults[i]);
+        printf("Actual Result:\t%s\n", reportStateName(transStates[i]));
+    }
+}
+
+void receiveTransactionDataParallelTest(void)
+{
+    // Print Test Header
+    printf("====================================\n");
+    printf("Tester Name:\tAbdelrhman Walaa\n");
+    printf("Function Name:\trecieveTransactionDataParallel()\n");
+    printf("====================================\n");
+
+    // test cases init
+    char* test_cases_filename = CONCAT(TEST_DIR, "receiveTransactionDataParallel.csv");
+    const char testCaseDelimiter[3] = ",\r";
+    // test cases buffer
+    char testCase[256];
+    char amountText[MONEY_TEXT_SIZE];
+    char expectedResults[16][32];
+    ST_transaction_t transactions[16];
+    EN_transState_t transStates[16];
+
+    FILE* fp_test_cases;
+    uint32_t count = 0;
+
+    // read all test cases first, the worker threads run them in one call
+    fp_test_cases = fopen(test_cases_filename, "r");
+
+    while ((count < 16) && fgets(testCase, sizeof(testCase), fp_test_cases)) {
+        // split test case into tokens of PAN, amount & expected result (which were delimited by comma)
+        char* inputPAN = strtok(testCase, testCaseDelimiter);
+        char* inputAmount = strtok(NULL, testCaseDelimiter);
+        char* expectedResult = strtok(NULL, testCaseDelimiter);
+
+        memset(&transactions[count], 0, sizeof(ST_transaction_t));
+        strcpy((char *)transactions[count].cardHolderData.cardHolderName, "Parallel Card Holder");
+        strcpy((char *)transactions[count].cardHolderData.primaryAccountNumber, inputPAN);
+        strcpy((char *)transactions[count].cardHolderData.cardExpirationDate, "05/30");
+        strcpy((char *)transactions[count].terminalData.transactionDate, "17/10/2026");
+        moneyParse(inputAmount, &transactions[count].terminalData.transAmount);
+        transactions[count].terminalData.maxTransAmount = MONEY_AMOUNT(4000, 0);
+        strcpy(expectedResults[count], expectedResult);
+        count++;
+    }
+
+    fclose(fp_test_cases);
+
+    /************* Execute test cases ***************/
+    recieveTransactionDataParallel(transactions, count, transStates);
+
+    for (uint32_t i = 0; i < count; i++) {
+        printf("\n-----------------------\n");
+        printf("Test Case %u\n", i + 1);
+        printf("-----------------------\n");
+
+        moneyFormat(transactions[i].terminalData.transAmount, amountText);
+        printf("Input Data:\t%s, %s\n", transactions[i].cardHolderData.primaryAccountNumber, amountText);
+        printf("Expected:\t%s\n", expectedResults[i]);
+        printf("Actual Result:\t%s\n", reportStateName(transStates[i]));
     }
 }
 
+void serverSetAccountStateTest(void)
+{
+    // Print Test Header
+    printf("====================================\n");
+    printf("Tester Name:\tAbdelrhman Walaa\n");
+    printf("Function Name:\tserverSetAccountState()\n");
+    printf("====================================\n");
+
+    // test cases init
+    char* test_cases_filename = CONCAT(TEST_DIR, "serverSetAccountState.csv");
+    const char testCaseDelimiter[3] = ",\r";
+    // test cases buffer
+    char testCase[256];
+    ST_transaction_t transaction;
+    EN_transState_t transState;
+
+    FILE* fp_test_cases;
+    int i = 0;
+
+    fp_test_cases = fopen(test_cases_filename, "r");
+
+    // each test case sets the account state, then runs one transaction through the filtered batch path
+    while (fgets(testCase, sizeof(testCase), fp_test_cases)) {
+        // split test case into tokens of PAN, state, amount & expected result (which were delimited by comma)
+        char* inputPAN = strtok(testCase, testCaseDelimiter);
+        char* inputState = strtok(NULL, testCaseDelimiter);
+        char* inputAmount = strtok(NULL, testCaseDelimiter);
+        char* expectedResult = strtok(NULL, testCaseDelimiter);
+
+        printf("\n-----------------------\n");
+        printf("Test Case %d\n", i + 1);
+        printf("-----------------------\n");
+
+        printf("Input Data:\t%s, %s, %s\n", inputPAN, inputState, inputAmount);
+        printf("Expected:\t%s\n", expectedResult);
+
+        /************* Execute test case ***************/
+        serverSetAccountState((uint8_t *)inputPAN, strcmp(inputState, "BLOCKED") ? RUNNING : BLOCKED);
+
+        memset(&transaction, 0, sizeof(ST_transaction_t));
+        strcpy((char *)transaction.cardHolderData.cardHolderName, "Filter Card Holder");
+        strcpy((char *)transaction.cardHolderData.primaryAccountNumber, inputPAN);
+        strcpy((char *)transaction.cardHolderData.cardExpirationDate, "05/30");
+        strcpy((char *)transaction.terminalData.transactionDate, "17/10/2026");
+        moneyParse(inputAmount, &transaction.terminalData.transAmount);
+        transaction.terminalData.maxTransAmount = MONEY_AMOUNT(4000, 0);
+
+        recieveTransactionDataBatch(&transaction, 1, &transState);
+
+        printf("Actual Result:\t%s\n", reportStateName(transState));
+        i++; // next test case
+    }
+
+    fclose(fp_test_cases);
+}
 
 /**
- * Call this from main.c to test all project modules
+ * Runs test cases for velocityCheck()
  */
-void testAll()
+void velocityCheckTest(void)
 {
-    // clear commandline
-    system("cls");
+    // Print Test Header
+    printf("====================================\n");
+    printf("Tester Name:\tAbdelrhman Walaa\n");
+    printf("Function Name:\tvelocityCheck()\n");
+    printf("====================================\n");
 
+    // test cases init
+    char* test_cases_filename = CONCAT(TEST_DIR, "velocityCheck.csv");
+    const char testCaseDelimiter[4] = ",\r\n";
+    // test cases buffer
+    char testCase[256];
+    // 3 transactions in 10 seconds, an amount of 1000.00 in a minute, 6 transactions in an hour
+    ST_velocityConfig_t velocityConfig = { 16, { { 10, 3, 0 }, { 60, 0, MONEY_AMOUNT(1000, 0) }, { 3600, 6, 0 } } };
+    ST_velocity_t velocity;
+    ST_panKey_t panKey;
 
-    /** CARD MODULE */
-    printf("\n\n");
-    printf("/**********************************************************************\\\n");
-    printf("\t\t\tTESTING CARD MODULE\t\t\t\n");
-    printf("/**********************************************************************\\\n");
-    printf("\n\n");
-    getCardExpiryDateTest();
-    getCardHolderNameTest();
-    getCardPANTest();
+    FILE* fp_test_cases;
+    int i = 0;
 
-    /** TERMINAL MODULE */
-    printf("\n\n");
-    printf("/**********************************************************************\\\n");
-    printf("\t\t\tTESTING TERMINAL MODULE\t\t\t\n");
-    printf("/**********************************************************************\\\n");
-    printf("\n\n");
-    getTransactionDateTest();
-    isCardExpiredTest();
-    getTransactionAmountTest();
-    isBelowMaxAmountTest();
-    setMaxAmountTest();
-    isValidCardPANTest();
+    velocityCreate(&velocity, &velocityConfig);
+    fp_test_cases = fopen(test_cases_filename, "r");
 
-    /** SERVER MODULE */
-    printf("\n\n");
-    printf("/**********************************************************************\\\n");
-    printf("\t\t\tTESTING SERVER MODULE\t\t\t\n");
-    printf("/**********************************************************************\\\n");
-    printf("\n\n");
-    isValidAccountTest();
-    isBlockedAccountTest();
-    isAmountAvailableTest();
-    listSavedTransactionsTest();
-    receiveTransactionDataTest();
+    // the test cases run one after the other on the same tracker, each one at its own time in seconds
+    while (fgets(testCase, sizeof(testCase), fp_test_cases)) {
+        // split test case into tokens of PAN, time, amount & expected result (which were delimited by comma)
+        char* inputPAN = strtok(testCase, testCaseDelimiter);
+        char* inputTime = strtok(NULL, testCaseDelimiter);
+        char* inputAmount = strtok(NULL, testCaseDelimiter);
+        char* expectedResult = strtok(NULL, testCaseDelimiter);
+        money_t amount = 0;
+
+        printf("\n-----------------------\n");
+        printf("Test Case %d\n", i + 1);
+        printf("-----------------------\n");
+
+        printf("Input Data:\t%s, %s s, %s\n", inputPAN, inputTime, inputAmount);
+        printf("Expected:\t%s\n", expectedResult);
+
+        /************* Execute test case ***************/
+        panIndexKey((uint8_t *)inputPAN, &panKey);
+        moneyParse(inputAmount, &amount);
+        EN_velocityError_t ret = velocityCheck(&velocity, panIndexHash(&panKey), amount, (uint32_t)strtoul(inputTime, NULL, 10));
+
+        printf("Actual Result:\t");
+        switch (ret) {
+            case VELOCITY_OK:
+                printf("VELOCITY_OK\n");
+                break;
+            case VELOCITY_OVER_LIMIT:
+                printf("VELOCITY_OVER_LIMIT\n");
+                break;
+            case VELOCITY_UNTRACKED:
+                printf("VELOCITY_UNTRACKED\n");
+                break;
+            case VELOCITY_WRONG_CONFIG:
+                printf("VELOCITY_WRONG_CONFIG\n");
+                break;
+            case VELOCITY_NO_MEMORY:
+                printf("VELOCITY_NO_MEMORY\n");
+                break;
+        }
+
+        i++; // next test case
+    }
+
+    fclose(fp_test_cases);
+    velocityDestroy(&velocity);
+}
+
+/**
+ * Runs test cases for settlementQuery()
+ */
+void settlementQueryTest(void)
+{
+    // Print Test Header
+    printf("====================================\n");
+    printf("Tester Name:\tAbdelrhman Walaa\n");
+    printf("Function Name:\tsettlementQuery()\n");
+    printf("====================================\n");
+
+    // test cases init
+    char* test_cases_filename = CONCAT(TEST_DIR, "settlementQuery.csv");
+    const char testCaseDelimiter[4] = ",\r\n";
+    // test cases buffer
+    char testCase[256];
+    ST_settlement_t* settlement = malloc(sizeof(ST_settlement_t));
+    ST_settlementTotals_t totals;
+    ST_transaction_t transData;
+    char amountText[MONEY_TEXT_SIZE];
+
+    FILE* fp_test_cases;
+    int i = 0;
+
+    settlementReset(settlement);
+    fp_test_cases = fopen(test_cases_filename, "r");
+
+    // the test cases add up one after the other, each one adds a transaction then queries the count & amount of its state
+    while (fgets(testCase, sizeof(testCase), fp_test_cases)) {
+        // split test case into tokens of PAN, date, amount, state, query date, network & expected result (which were delimited by comma)
+        char* inputPAN = strtok(testCase, testCaseDelimiter);
+        char* inputDate = strtok(NULL, testCaseDelimiter);
+        char* inputAmount = strtok(NULL, testCaseDelimiter);
+        char* inputState = strtok(NULL, testCaseDelimiter);
+        char* inputQueryDate = strtok(NULL, testCaseDelimiter);
+        char* inputNetwork = strtok(NULL, testCaseDelimiter);
+        char* expectedResult = strtok(NULL, testCaseDelimiter);
+        EN_transState_t state = APPROVED;
+        EN_settlementNetwork_t network = SETTLEMENT_VISA;
+        date_t queryDate = DATE_NONE;
+
+        printf("\n-----------------------\n");
+        printf("Test Case %d\n", i + 1);
+        printf("-----------------------\n");
+
+        printf("Input Data:\t%s, %s, %s, %s, query %s %s\n", inputPAN, inputDate, inputAmount, inputState, inputQueryDate, inputNetwork);
+        printf("Expected:\t%s\n", expectedResult);
+
+        /************* Execute test case ***************/
+        memset(&transData, 0, sizeof(transData));
+        strcpy((char *)transData.cardHolderData.primaryAccountNumber, inputPAN);
+        strcpy((char *)transData.terminalData.transactionDate, inputDate);
+        moneyParse(inputAmount, &transData.terminalData.transAmount);
+        while ((state < DECLINED_VELOCITY) && (strcmp(reportStateName(state), inputState) != 0)) {
+            state++;
+        }
+        while ((network < SETTLEMENT_ALL_NETWORKS) && (strcmp(settlementNetworkName(network), inputNetwork) != 0)) {
+            network++;
+        }
+        if (strcmp(inputQueryDate, "ALL") != 0) {
+            dateParse((uint8_t *)inputQueryDate, &queryDate);
+        }
+        transData.transState = state;
+
+        settlementAdd(settlement, &transData);
+        EN_settlementError_t ret = settlementQuery(settlement, queryDate, network, &totals);
+
+        printf("Actual Result:\t");
+        switch (ret) {
+            case SETTLEMENT_OK:
+                moneyFormat(totals.amounts[state], amountText);
+                printf("%llu %s\n", (unsigned long long)totals.counts[state], amountText);
+                break;
+            case SETTLEMENT_WRONG_NETWORK:
+                printf("SETTLEMENT_WRONG_NETWORK\n");
+                break;
+            case SETTLEMENT_DAY_NOT_KEPT:
+                printf("SETTLEMENT_DAY_NOT_KEPT\n");
+                break;
+        }
+
+        i++; // next test case
+    }
+
+    fclose(fp_test_cases);
+    free(settlement);
+}
+
+/**
+ * Runs test cases for rangeFind()
+ */
+void rangeFindTest(void)
+{
+    // Print Test Header
+    printf("====================================\n");
+    printf("Tester Name:\tAbdelrhman Walaa\n");
+    printf("Function Name:\trangeFind()\n");
+    printf("====================================\n");
+
+    // test cases init
+    char* test_cases_filename = CONCAT(TEST_DIR, "rangeFind.csv");
+    const char testCaseDelimiter[4] = ",\r\n";
+    // test cases buffer
+    char testCase[256];
+    ST_rangeIndex_t index;
+
+    FILE* fp_test_cases;
+    int i = 0;
+
+    // 8500 records in blocks of 1024: keys 100 to 103 for two blocks each, then 104 in a last partial block,
+    // with one record out of order (key 90) in the block of records 4096 to 5119
+    rangeOpen(&index, NULL, 0);
+    for (uint32_t record = 0; record < 8500; record++) {
+        rangeAdd(&index, (record == 5000) ? 90 : (100 + (record / 2048)));
+    }
+
+    fp_test_cases = fopen(test_cases_filename, "r");
+
+    while (fgets(testCase, sizeof(testCase), fp_test_cases)) {
+        // split test case into tokens of from key, to key, first record & expected result (which were delimited by comma)
+        char* inputFrom = strtok(testCase, testCaseDelimiter);
+        char* inputTo = strtok(NULL, testCaseDelimiter);
+        char* inputFirst = strtok(NULL, testCaseDelimiter);
+        char* expectedResult = strtok(NULL, testCaseDelimiter);
+
+        printf("\n-----------------------\n");
+        printf("Test Case %d\n", i + 1);
+        printf("-----------------------\n");
+
+        printf("Input Data:\tkeys %s to %s, from record %s\n", inputFrom, inputTo, inputFirst);
+        printf("Expected:\t%s\n", expectedResult);
+
+        /************* Execute test case ***************/
+        uint64_t ret = rangeFind(&index, (uint32_t)strtoul(inputFrom, NULL, 10), (uint32_t)strtoul(inputTo, NULL, 10),
+                                 strtoull(inputFirst, NULL, 10));
+
+        printf("Actual Result:\t");
+        if (ret == index.count) {
+            printf("NONE\n");
+        }
+        else {
+            printf("%llu\n", (unsigned long long)ret);
+        }
+
+        i++; // next test case
+    }
+
+    fclose(fp_test_cases);
+    rangeClose(&index);
+}
+
+/**
+ * Runs test cases for workloadRun()
+ */
+void workloadRunTest(void)
+{
+    // Print Test Header
+    printf("====================================\n");
+    printf("Tester Name:\tAbdelrhman Walaa\n");
+    printf("Function Name:\tworkloadRun()\n");
+    printf("====================================\n");
+
+    // test cases init
+    char* test_cases_filename = CONCAT(TEST_DIR, "workloadRun.csv");
+    const char testCaseDelimiter[4] = ",\r\n";
+    // test cases buffer
+    char testCase[256];
+    ST_workloadConfig_t config;
+    ST_workloadStats_t stats;
+
+    FILE* fp_test_cases;
+    int i = 0;
+
+    fp_test_cases = fopen(test_cases_filename, "r");
+
+    while (fgets(testCase, sizeof(testCase), fp_test_cases)) {
+        // split test case into tokens of options & expected result (which were delimited by comma)
+        char* inputOptions = strtok(testCase, testCaseDelimiter);
+        char* expectedResult = strtok(NULL, testCaseDelimiter);
+        EN_workloadError_t ret = WORKLOAD_OK;
+
+        printf("\n-----------------------\n");
+        printf("Test Case %d\n", i + 1);
+        printf("-----------------------\n");
+
+        printf("Input Data:\t%s\n", inputOptions);
+        printf("Expected:\t%s\n", expectedResult);
+
+        /************* Execute test case ***************/
+        // the options are set over the default workload, one at a time (delimited by space)
+        workloadDefaultConfig(&config);
+        for (char* option = strtok(inputOptions, " "); (option != NULL) && (ret == WORKLOAD_OK); option = strtok(NULL, " ")) {
+            ret = workloadParseOption(&config, option);
+        }
+        if (ret == WORKLOAD_OK) {
+            ret = workloadRun(&config, &stats);
+        }
+
+        printf("Actual Result:\t");
+        switch (ret) {
+            case WORKLOAD_OK:
+                printf("approved %llu insufficient %llu stolen %llu fraud %llu terminal %llu\n",
+                       (unsigned long long)stats.states[APPROVED], (unsigned long long)stats.states[DECLINED_INSUFFECIENT_FUND],
+                       (unsigned long long)stats.states[DECLINED_STOLEN_CARD], (unsigned long long)stats.states[FRAUD_CARD],
+                       (unsigned long long)stats.terminalErrors);
+                workloadFreeStats(&stats);
+                break;
+            case WORKLOAD_WRONG_OPTION:
+                printf("WORKLOAD_WRONG_OPTION\n");
+                break;
+            case WORKLOAD_WRONG_CONFIG:
+                printf("WORKLOAD_WRONG_CONFIG\n");
+                break;
+            default:
+                printf("WORKLOAD_SERVER_ERROR\n");
+                workloadFreeStats(&stats);
+                break;
+        }
+
+        i++; // next test case
+    }
+
+    fclose(fp_test_cases);
+}
+
+/**
+ * Runs test cases for reportExport()
+ */
+void reportExportTest(void)
+{
+    // Print Test Header
+    printf("====================================\n");
+    printf("Tester Name:\tAbdelrhman Walaa\n");
+    printf("Function Name:\treportExport()\n");
+    printf("====================================\n");
+
+    // test cases init
+    char* test_cases_filename = CONCAT(TEST_DIR, "reportExport.csv");
+    const char testCaseDelimiter[4] = ",\r\n";
+    // test cases buffer
+    char testCase[256];
+    ST_journalConfig_t config = { TEST_REPORT_JOURNAL_FILE, 0, 0 };
+    ST_transaction_t plain = {
+            { "Report Test Card Holder", "4728459258966333", "05/30", DATE_NONE },
+            { MONEY_AMOUNT(100, 0), MONEY_AMOUNT(4000, 0), "17/10/2026", DATE_NONE },
+            APPROVED,
+            0
+    };
+    ST_transaction_t control;
+    ST_journal_t journal;
+
+    FILE* fp_test_cases;
+    int i = 0;
+
+    // longest transaction: longest amounts and state, and every byte of its text fields a control character, escaped in JSON
+    control = plain;
+    control.terminalData.transAmount = INT64_MIN;
+    control.terminalData.maxTransAmount = INT64_MIN;
+    control.transState = DECLINED_INSUFFECIENT_FUND;
+    memset(control.cardHolderData.cardHolderName, 0x01, sizeof(control.cardHolderData.cardHolderName));
+    memset(control.cardHolderData.primaryAccountNumber, 0x01, sizeof(control.cardHolderData.primaryAccountNumber));
+    memset(control.cardHolderData.cardExpirationDate, 0x01, sizeof(control.cardHolderData.cardExpirationDate));
+    memset(control.terminalData.transactionDate, 0x01, sizeof(control.terminalData.transactionDate));
+
+    fp_test_cases = fopen(test_cases_filename, "r");
+
+    while (fgets(testCase, sizeof(testCase), fp_test_cases)) {
+        // split test case into tokens of plain count, control count, format & expected result (which were delimited by comma)
+        char* inputPlain = strtok(testCase, testCaseDelimiter);
+        char* inputControl = strtok(NULL, testCaseDelimiter);
+        char* inputFormat = strtok(NULL, testCaseDelimiter);
+        char* expectedResult = strtok(NULL, testCaseDelimiter);
+        uint64_t plainCount = strtoull(inputPlain, NULL, 10);
+        uint64_t controlCount = strtoull(inputControl, NULL, 10);
+        EN_reportFormat_t format = (strcmp(inputFormat, "JSON") == 0) ? REPORT_JSON : REPORT_CSV;
+        EN_reportError_t ret = REPORT_FILE_ERROR;
+
+        printf("\n-----------------------\n");
+        printf("Test Case %d\n", i + 1);
+        printf("-----------------------\n");
+
+        printf("Input Data:\t%s plain then %s control character transactions, as %s\n", inputPlain, inputControl, inputFormat);
+        printf("Expected:\t%s\n", expectedResult);
+
+        /************* Execute test case ***************/
+        // a fresh log of the plain transactions then the control ones, exported whole
+        journalRemove(TEST_REPORT_JOURNAL_FILE);
+        if (journalOpen(&journal, &config) == JOURNAL_OK) {
+            for (uint64_t record = 0; record < (plainCount + controlCount); record++) {
+                ST_transaction_t transData = (record < plainCount) ? plain : control;
+
+                journalAppend(&journal, &transData);
+            }
+            journalCommit(&journal);
+            ret = reportExport(&journal, 0, plainCount + controlCount, format, TEST_REPORT_FILE);
+            journalClose(&journal);
+        }
+
+        printf("Actual Result:\t");
+        if (ret == REPORT_OK) {
+            FILE* fp_report = fopen(TEST_REPORT_FILE, "rb");
+
+            fseek(fp_report, 0, SEEK_END);
+            printf("REPORT_OK %ld bytes\n", ftell(fp_report));
+            fclose(fp_report);
+        }
+        else {
+            printf("%s\n", (ret == REPORT_NO_MEMORY) ? "REPORT_NO_MEMORY" : "REPORT_FILE_ERROR");
+        }
+
+        i++; // next test case
+    }
+
+    fclose(fp_test_cases);
+    journalRemove(TEST_REPORT_JOURNAL_FILE);
+    remove(TEST_REPORT_FILE);
+}
+
+/**
+ * Runs test cases for saveTransaction()
+ */
+void saveTransactionTest(void)
+{
+    // Print Test Header
+    printf("====================================\n");
+    printf("Tester Name:\tTarek Gohary\n");
+    printf("Function Name:\tgetTransactionDate()\n");
+    printf("====================================\n");
+    printf("Test Case 1\n");
+    printf("Input Data:\tAll transaction data after validation\n");
+    printf("Expected Result:\tSERVER_OK\n");
+
+   ST_transaction_t transData = {
+           {
+                   "Mohamed Salah Mohamed",
+                   "4728459258966333",
+                   "05/25",
+                   DATE_NONE
+           },
+           {
+                   MONEY_AMOUNT(1000, 0),
+                   MONEY_AMOUNT(4000, 0),
+                   "03/10/2020",
+                   DATE_NONE
+           },
+           APPROVED,
+           1
+   };
+    EN_serverError_t ret = saveTransaction(&transData);
+
+    switch (ret) {
+        case SERVER_OK:
+            printf("Actual Result:\tSERVER_OK\n");
+            break;
+        case SAVING_FAILED:
+            printf("Actual Result:\tSAVING_FAILED\n");
+            break;
+        default:
+            printf("Actual Result:\tunexpected EN_serverError_t %d\n", ret);
+            break;
+    }
+}
+
+
+/**
+ * Runs test cases for querySavedTransactionsByDate()
+ */
+void querySavedTransactionsByDateTest(void)
+{
+    // Print Test Header
+    printf("====================================\n");
+    printf("Tester Name:\tAbdelrhman Walaa\n");
+    printf("Function Name:\tquerySavedTransactionsByDate()\n");
+    printf("====================================\n");
+
+    // test cases init
+    char* test_cases_filename = CONCAT(TEST_DIR, "querySavedTransactionsByDate.csv");
+    const char testCaseDelimiter[4] = ",\r\n";
+    // test cases buffer
+    char testCase[256];
+    ST_transaction_t transData = {
+            { "Date Query Test Holder", "5191786640828580", "05/30", DATE_NONE },
+            { MONEY_AMOUNT(1, 0), MONEY_AMOUNT(4000, 0), "01/01/1900", DATE_NONE },
+            APPROVED,
+            0
+    };
+    ST_transaction_t found;
+
+    FILE* fp_test_cases;
+    int i = 0;
+
+    // one transaction on the first day with a day number, and one on the next day, no other test uses 1900
+    saveTransaction(&transData);
+    strcpy((char*)transData.terminalData.transactionDate, "02/01/1900");
+    saveTransaction(&transData);
+
+    fp_test_cases = fopen(test_cases_filename, "r");
+
+    while (fgets(testCase, sizeof(testCase), fp_test_cases)) {
+        // split test case into tokens of from date, to date & expected result (which were delimited by comma)
+        char* inputFrom = strtok(testCase, testCaseDelimiter);
+        char* inputTo = strtok(NULL, testCaseDelimiter);
+        char* expectedResult = strtok(NULL, testCaseDelimiter);
+        date_t fromDate;
+        date_t toDate;
+        uint64_t cursor = 0;
+        uint32_t foundCount = 0;
+
+        printf("\n-----------------------\n");
+        printf("Test Case %d\n", i + 1);
+        printf("-----------------------\n");
+
+        printf("Input Data:\tfrom %s to %s\n", inputFrom, inputTo);
+        printf("Expected:\t%s\n", expectedResult);
+
+        /************* Execute test case ***************/
+        // NONE is not a date, it parses to DATE_NONE
+        dateParse((uint8_t*)inputFrom, &fromDate);
+        dateParse((uint8_t*)inputTo, &toDate);
+        // one transaction a page, so the cursor moves on every page
+        while (querySavedTransactionsByDate(fromDate, toDate, &cursor, &found, 1) == 1) {
+            foundCount++;
+        }
+
+        printf("Actual Result:\t%u found\n", foundCount);
+
+        i++; // next test case
+    }
+
+    fclose(fp_test_cases);
+}
+
+
+#ifdef __linux__
+/* Thread of networkServeCommitTest(), serves until networkStop() */
+static void* networkServeTestThread(void* stats)
+{
+    networkServe(TEST_NETWORK_ENDPOINT, (ST_networkServeStats_t*)stats);
+    return NULL;
+}
+#endif
+
+/**
+ * Runs test cases for networkServe() while the transactions log can't be written
+ */
+void networkServeCommitTest(void)
+{
+    // Print Test Header
+    printf("====================================\n");
+    printf("Tester Name:\tAbdelrhman Walaa\n");
+    printf("Function Name:\tnetworkServe()\n");
+    printf("====================================\n");
+
+#ifdef __linux__
+    // test cases init
+    char* test_cases_filename = CONCAT(TEST_DIR, "networkServeCommit.csv");
+    const char testCaseDelimiter[4] = ",\r\n";
+    // test cases buffer
+    char testCase[256];
+    ST_networkServeStats_t serveStats;
+    ST_networkRequest_t request;
+    ST_networkResponse_t response;
+    ST_transaction_t logged;
+    struct sockaddr_un address;
+    struct pollfd client;
+    struct rlimit limit;
+    struct rlimit fullLimit;
+    struct stat logStat;
+    pthread_t serveThread;
+
+    FILE* fp_test_cases;
+    int i = 0;
+
+    // serve on a Unix-domain socket of its own, and connect once it listens
+    unlink(TEST_NETWORK_ENDPOINT);
+    pthread_create(&serveThread, NULL, networkServeTestThread, &serveStats);
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, TEST_NETWORK_ENDPOINT, sizeof(address.sun_path) - 1);
+    client.fd = -1;
+    client.events = POLLIN;
+    for (int attempt = 0; (attempt < 100) && (client.fd < 0); attempt++) {
+        client.fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (connect(client.fd, (struct sockaddr*)&address, sizeof(address)) != 0) {
+            close(client.fd);
+            client.fd = -1;
+            usleep(10000);
+        }
+    }
+
+    // every test case sends the same transaction, on an account with enough balance for all of them
+    memset(&request, 0, sizeof(request));
+    request.version = NETWORK_PROTOCOL_VERSION;
+    request.transAmount = MONEY_AMOUNT(10, 0);
+    request.maxTransAmount = MONEY_AMOUNT(4000, 0);
+    strcpy((char*)request.primaryAccountNumber, "5191786640828580");
+    strcpy((char*)request.cardHolderName, "Mohamed Salah Mohamed");
+    strcpy((char*)request.cardExpirationDate, "05/25");
+    strcpy((char*)request.transactionDate, "03/10/2020");
+
+    // a write past the file size limit fails with EFBIG, instead of killing the tests
+    signal(SIGXFSZ, SIG_IGN);
+    getrlimit(RLIMIT_FSIZE, &limit);
+
+    fp_test_cases = fopen(test_cases_filename, "r");
+
+    while (fgets(testCase, sizeof(testCase), fp_test_cases)) {
+        // split test case into tokens of transactions log state & expected result (which were delimited by comma)
+        char* logState = strtok(testCase, testCaseDelimiter);
+        char* expectedResult = strtok(NULL, testCaseDelimiter);
+
+        printf("\n-----------------------\n");
+        printf("Test Case %d\n", i + 1);
+        printf("-----------------------\n");
+
+        printf("Input Data:\t%s\n", logState);
+        printf("Expected:\t%s\n", expectedResult);
+        fflush(stdout);
+
+        /************* Execute test case ***************/
+        // a full log can't grow past its current size, so every commit fails until the limit is lifted
+        if (strcmp(logState, "full") == 0) {
+            stat(TEST_JOURNAL_FILE, &logStat);
+            fullLimit.rlim_cur = logStat.st_size;
+            fullLimit.rlim_max = limit.rlim_max;
+            setrlimit(RLIMIT_FSIZE, &fullLimit);
+        }
+        request.requestId = i + 1;
+        send(client.fd, &request, sizeof(request), 0);
+
+        // every response until none comes for 300 ms, with the log still full
+        printf("Actual Result:\t");
+        int responsesCount = 0;
+        char responses[256] = "";
+        while ((poll(&client, 1, 300) == 1) &&
+               (recv(client.fd, &response, sizeof(response), MSG_WAITALL) == sizeof(response))) {
+            // a response is only sent once its transaction is in the log
+            uint8_t isLogged = (querySavedTransactionsBySequence(response.transactionSequenceNumber, &logged, 1) == 1) &&
+                               (logged.transactionSequenceNumber == response.transactionSequenceNumber);
+            snprintf(responses + strlen(responses), sizeof(responses) - strlen(responses), "%s%u %s %s",
+                     (responsesCount == 0) ? "" : " ", response.requestId,
+                     reportStateName((EN_transState_t)response.transState), isLogged ? "logged" : "not_logged");
+            responsesCount++;
+        }
+        setrlimit(RLIMIT_FSIZE, &limit);
+        printf("%s\n", (responsesCount == 0) ? "NO_RESPONSE" : responses);
+
+        i++;
+    }
+
+    fclose(fp_test_cases);
+    close(client.fd);
+    networkStop();
+    pthread_join(serveThread, NULL);
+    unlink(TEST_NETWORK_ENDPOINT);
+#else
+    printf("Actual Result:\tNETWORK_UNSUPPORTED\n");
+#endif
+}
+
+
+/**
+ * Call this from main.c to test all project modules
+ */
+void testAll()
+{
+    // clear commandline
+    system("cls");
+
+
+    /** CARD MODULE */
+    printf("\n\n");
+    printf("/**********************************************************************\\\n");
+    printf("\t\t\tTESTING CARD MODULE\t\t\t\n");
+    printf("/**********************************************************************\\\n");
+    printf("\n\n");
+    getCardExpiryDateTest();
+    getCardHolderNameTest();
+    getCardPANTest();
+
+    /** MONEY MODULE */
+    printf("\n\n");
+    printf("/**********************************************************************\\\n");
+    printf("\t\t\tTESTING MONEY MODULE\t\t\t\n");
+    printf("/**********************************************************************\\\n");
+    printf("\n\n");
+    moneyParseTest();
+
+    /** TERMINAL MODULE */
+    printf("\n\n");
+    printf("/**********************************************************************\\\n");
+    printf("\t\t\tTESTING TERMINAL MODULE\t\t\t\n");
+    printf("/**********************************************************************\\\n");
+    printf("\n\n");
+    getTransactionDateTest();
+    isCardExpiredTest();
+    isCardExpiredEditedTest();
+    getTransactionAmountTest();
+    isBelowMaxAmountTest();
+    setMaxAmountTest();
+    isValidCardPANTest();
+    isValidCardPANBatchTest();
+
+    /** VELOCITY MODULE */
+    printf("\n\n");
+    printf("/**********************************************************************\\\n");
+    printf("\t\t\tTESTING VELOCITY MODULE\t\t\t\n");
+    printf("/**********************************************************************\\\n");
+    printf("\n\n");
+    velocityCheckTest();
+
+    /** SETTLEMENT MODULE */
+    printf("\n\n");
+    printf("/**********************************************************************\\\n");
+    printf("\t\t\tTESTING SETTLEMENT MODULE\t\t\t\n");
+    printf("/**********************************************************************\\\n");
+    printf("\n\n");
+    settlementQueryTest();
+
+    /** RANGE MODULE */
+    printf("\n\n");
+    printf("/**********************************************************************\\\n");
+    printf("\t\t\tTESTING RANGE MODULE\t\t\t\n");
+    printf("/**********************************************************************\\\n");
+    printf("\n\n");
+    rangeFindTest();
+
+    /** SERVER MODULE */
+    printf("\n\n");
+    printf("/**********************************************************************\\\n");
+    printf("\t\t\tTESTING SERVER MODULE\t\t\t\n");
+    printf("/**********************************************************************\\\n");
+    printf("\n\n");
+
+    // start the server on fresh accounts and transactions files, so an earlier run doesn't change the results
+    ST_serverConfig_t serverConfig;
+    memset(&serverConfig, 0, sizeof(serverConfig));
+    serverConfig.accountsFile = TEST_ACCOUNTS_FILE;
+    serverConfig.journal.fileName = TEST_JOURNAL_FILE;
+    serverConfig.workersCount = TEST_WORKERS_COUNT;
+    serverShutdown();
+    serverRemoveFiles(&serverConfig);
+    serverInit(&serverConfig);
+
+    isValidAccountTest();
+    isBlockedAccountTest();
+    isAmountAvailableTest();
+    listSavedTransactionsTest();
+    receiveTransactionDataTest();
+    receiveTransactionDataBatchTest();
+    receiveTransactionDataParallelTest();
     saveTransactionTest();
+    querySavedTransactionsByDateTest();
+    serverSetAccountStateTest();
+
+    /** NETWORK MODULE */
+    printf("\n\n");
+    printf("/**********************************************************************\\\n");
+    printf("\t\t\tTESTING NETWORK MODULE\t\t\t\n");
+    printf("/**********************************************************************\\\n");
+    printf("\n\n");
+    // served by the server started above
+    networkServeCommitTest();
+
+    serverShutdown();
+
+    printf("\n\n");
+    printf("/**********************************************************************\\\n");
+    printf("\t\t\tTESTING WORKLOAD MODULE\t\t\t\n");
+    printf("/**********************************************************************\\\n");
+    printf("\n\n");
+    workloadRunTest();
+
+    /** REPORT MODULE */
+    printf("\n\n");
+    printf("/**********************************************************************\\\n");
+    printf("\t\t\tTESTING REPORT MODULE\t\t\t\n");
+    printf("/**********************************************************************\\\n");
+    printf("\n\n");
+    reportExportTest();
 }
@@ -7,9 +7,22 @@
 #include "../Card/card.h"
 #include "../Terminal/terminal.h"
 #include "../Server/server.h"
+#include "../Network/network.h"
+#include "../Workload/workload.h"
 
 #define TEST_DIR "Test/TestCases/"
 #define CONCAT(STR1, STR2) STR1 STR2
+/* Accounts file of the server tests, created fresh with the built-in accounts on every run */
+#define TEST_ACCOUNTS_FILE CONCAT(TEST_DIR, "accounts.db")
+/* Transactions log of the server tests, created empty on every run */
+#define TEST_JOURNAL_FILE CONCAT(TEST_DIR, "transactions.log")
+/* Transactions log and export file of the report tests, created fresh for every test case */
+#define TEST_REPORT_JOURNAL_FILE CONCAT(TEST_DIR, "report.log")
+#define TEST_REPORT_FILE CONCAT(TEST_DIR, "report.out")
+/* Unix-domain socket of the network tests */
+#define TEST_NETWORK_ENDPOINT CONCAT(TEST_DIR, "network.sock")
+/* Worker threads of the server tests, so the parallel test runs on more than one thread */
+#define TEST_WORKERS_COUNT 2
 
 /**
  * Retrieves full file name for test case (input data / expected result) depending on fileType
@@ -30,21 +43,48 @@ void getCardHolderNameTest(void);
 void getCardPANTest(void);
 
 
+/******************** MONEY MODULE ********************/
+void moneyParseTest(void);
+
 /******************** TERMINAL MODULE ********************/
 void getTransactionDateTest(void);
 void isCardExpiredTest(void);
+void isCardExpiredEditedTest(void);
 void getTransactionAmountTest(void);
 void isBelowMaxAmountTest(void);
 void setMaxAmountTest(void);
 void isValidCardPANTest(void); // (optional) Luhn Number Check
+void isValidCardPANBatchTest(void);
+
+/******************** VELOCITY MODULE ********************/
+void velocityCheckTest(void);
+
+/******************** SETTLEMENT MODULE ********************/
+void settlementQueryTest(void);
+
+/******************** RANGE MODULE ********************/
+void rangeFindTest(void);
 
 /******************** SERVER MODULE ********************/
 void receiveTransactionDataTest(void);
+void receiveTransactionDataBatchTest(void);
+void receiveTransactionDataParallelTest(void);
+void serverSetAccountStateTest(void);
 void isValidAccountTest(void);
 void isBlockedAccountTest(void);
 void isAmountAvailableTest(void);
 void saveTransactionTest(void);
 void listSavedTransactionsTest(void);
+void querySavedTransactionsByDateTest(void);
+
+/******************** NETWORK MODULE ********************/
+void networkServeCommitTest(void);
+
+/******************** WORKLOAD MODULE ********************/
+void workloadRunTest(void);
+
+/******************** REPORT MODULE ********************/
+void reportExportTest(void);
 
 /******************** RUN ALL TESTS ********************/
 void testAll();
@@ -0,0 +1,332 @@
+/**
+ * @Title      	: Velocity Module
+ * @Filename   	: velocity.c
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+
+/* Velocity Module */
+#include "velocity.h"
+
+/* Start loading a cache line early, a no-op for compilers without the builtin */
+#if defined(__GNUC__) || defined(__clang__)
+#define velocityPrefetchLine(ADDRESS)	__builtin_prefetch((ADDRESS), 1)
+#else
+#define velocityPrefetchLine(ADDRESS)	((void)(ADDRESS))
+#endif
+
+/*
+ Name: velocityAdvance
+ Input: Pointer to counts, Pointer to amounts, uint32 seconds, uint32 lastSeen, and uint32 now
+ Output: uint32 seconds of the previous bucket still inside the window, 1 to seconds
+ Description: Static Function to move one window of an entry from the bucket of lastSeen to the bucket of now: the
+              current bucket becomes the previous one if now is in the next bucket, both are emptied if now is further
+              on. A clock that went back stays in the bucket of lastSeen.
+*/
+static inline uint32_t velocityAdvance(uint32_t *counts, uint32_t *amounts, uint32_t seconds, uint32_t lastSeen, uint32_t now)
+{
+    uint32_t Loc_Bucket = lastSeen / seconds;
+    uint32_t Loc_Start;
+
+    if (now > lastSeen)
+    {
+        uint32_t Loc_NowBucket = now / seconds;
+
+        if (Loc_NowBucket == (Loc_Bucket + 1))
+        {
+            counts[1]  = counts[0];
+            amounts[1] = amounts[0];
+            counts[0]  = 0;
+            amounts[0] = 0;
+        }
+        else if (Loc_NowBucket > (Loc_Bucket + 1))
+        {
+            counts[0]  = counts[1]  = 0;
+            amounts[0] = amounts[1] = 0;
+        }
+
+        Loc_Bucket = Loc_NowBucket;
+    }
+
+    Loc_Start = Loc_Bucket * seconds;
+
+    return (now > Loc_Start) ? (seconds - (now - Loc_Start)) : seconds;
+}
+
+/*
+ Name: velocityFind
+ Input: Pointer to tracker, uint64 hash, and uint32 now
+ Output: Pointer to the entry of the hash, NULL if it isn't in the table and there is no slot for it
+ Description: Static Function to find the entry of an account, or take a slot for it: the first empty slot, or the first
+              slot of an idle account on the way. Up to VELOCITY_MAX_PROBES slots are looked at.
+*/
+static ST_velocityEntry_t *velocityFind(ST_velocity_t *velocity, uint64_t hash, uint32_t now)
+{
+    ST_velocityEntry_t *Loc_Free = NULL;
+    uint64_t Loc_Slot = hash & velocity->slotsMask;
+
+    /* Loop: Until the hash, or an empty slot is found */
+    for (uint32_t Loc_Probe = 0; Loc_Probe < VELOCITY_MAX_PROBES; Loc_Probe++)
+    {
+        ST_velocityEntry_t *Loc_Entry = &velocity->entries[(Loc_Slot + Loc_Probe) & velocity->slotsMask];
+
+        if (Loc_Entry->hash == hash)
+        {
+            return Loc_Entry;
+        }
+
+        /* Slots are never emptied, so the hash can't be after an empty one */
+        if (Loc_Entry->hash == 0)
+        {
+            if (Loc_Free == NULL)
+            {
+                Loc_Free = Loc_Entry;
+            }
+
+            break;
+        }
+
+        if ((Loc_Free == NULL) && (now >= Loc_Entry->lastSeen) && ((now - Loc_Entry->lastSeen) >= velocity->idleSeconds))
+        {
+            Loc_Free = Loc_Entry;
+        }
+    }
+
+    /* Check 1: No slot for the hash */
+    if (Loc_Free == NULL)
+    {
+        return NULL;
+    }
+
+    if (Loc_Free->hash == 0)
+    {
+        velocity->count++;
+    }
+
+    memset(Loc_Free, 0, sizeof(ST_velocityEntry_t));
+    Loc_Free->hash     = hash;
+    Loc_Free->lastSeen = now;
+
+    return Loc_Free;
+}
+
+/*
+ Name: velocityCreate
+ Input: Pointer to tracker, and Pointer to Velocity Config structure
+ Output: EN_velocityError_t Error or No Error
+ Description: Function to create an empty tracker for up to capacity active accounts.
+              1. The number of slots is the smallest power of 2 at or above 1.5 times capacity, VELOCITY_MIN_SLOTS at least.
+              2. If all windows are unused no table is made, and every transaction is allowed.
+              3. A capacity of 0 with a used window, or a window over 2^31 seconds returns VELOCITY_WRONG_CONFIG.
+*/
+EN_velocityError_t velocityCreate(ST_velocity_t *velocity, const ST_velocityConfig_t *config)
+{
+    uint64_t Loc_Slots = VELOCITY_MIN_SLOTS;
+    uint32_t Loc_Longest = 0;
+
+    memset(velocity, 0, sizeof(ST_velocity_t));
+
+    /* Loop: Until the longest window is found */
+    for (uint32_t Loc_Window = 0; Loc_Window < VELOCITY_WINDOWS_COUNT; Loc_Window++)
+    {
+        velocity->windows[Loc_Window] = config->windows[Loc_Window];
+
+        if (config->windows[Loc_Window].seconds > Loc_Longest)
+        {
+            Loc_Longest = config->windows[Loc_Window].seconds;
+        }
+    }
+
+    /* Check 1: No window is used, nothing to track */
+    if (Loc_Longest == 0)
+    {
+        return VELOCITY_OK;
+    }
+
+    /* Check 2: Wrong capacity or window */
+    if ((config->capacity == 0) || (config->capacity > (1ULL << 40)) || (Loc_Longest > 0x80000000UL))
+    {
+        memset(velocity, 0, sizeof(ST_velocity_t));
+        return VELOCITY_WRONG_CONFIG;
+    }
+
+    /* Loop: Until the slots hold capacity at a load of 2/3 */
+    while (Loc_Slots < (config->capacity + (config->capacity / 2)))
+    {
+        Loc_Slots *= 2;
+    }
+
+    velocity->memory = calloc(1, (size_t)(Loc_Slots * sizeof(ST_velocityEntry_t)) + VELOCITY_ENTRY_ALIGN);
+
+    /* Check 3: Not enough memory */
+    if (velocity->memory == NULL)
+    {
+        memset(velocity, 0, sizeof(ST_velocity_t));
+        return VELOCITY_NO_MEMORY;
+    }
+
+    /* Entries start on a cache line, so each one is a single line */
+    velocity->entries   = (ST_velocityEntry_t *)(((uintptr_t)velocity->memory + VELOCITY_ENTRY_ALIGN - 1) & ~(uintptr_t)(VELOCITY_ENTRY_ALIGN - 1));
+    velocity->slotsMask = Loc_Slots - 1;
+    /* A transaction is in the previous bucket of its window until two windows after its bucket starts */
+    velocity->idleSeconds = (Loc_Longest < 0x80000000UL) ? (Loc_Longest * 2) : 0xFFFFFFFFUL;
+
+    return VELOCITY_OK;
+}
+
+/*
+ Name: velocityDestroy
+ Input: Pointer to tracker
+ Output: void
+ Description: Function to free the table of a tracker, it then allows every transaction.
+*/
+void velocityDestroy(ST_velocity_t *velocity)
+{
+    free(velocity->memory);
+    memset(velocity, 0, sizeof(ST_velocity_t));
+}
+
+/*
+ Name: velocityPrefetch
+ Input: Pointer to tracker, and uint64 hash of the account
+ Output: void
+ Description: Function to start loading the home slot of an account, so a velocityCheck of it a little later finds it
+              in the cache. Prefetching a batch of accounts first overlaps their cache misses.
+*/
+void velocityPrefetch(const ST_velocity_t *velocity, uint64_t hash)
+{
+    if (velocity->entries != NULL)
+    {
+        velocityPrefetchLine(&velocity->entries[((hash != 0) ? hash : 1) & velocity->slotsMask]);
+    }
+}
+
+/*
+ Name: velocityCheck
+ Input: Pointer to tracker, uint64 hash of the account, money_t amount, and uint32 now in seconds
+ Output: EN_velocityError_t Error or No Error
+ Description: Function to check one transaction of an account against the limits of all windows, and count it if it is allowed.
+              1. If the transaction takes the estimated count or amount of any window over its limit, nothing is counted
+                 and VELOCITY_OVER_LIMIT is returned.
+              2. If the account has no slot (the table is full around its hash), the transaction is allowed but not
+                 counted and VELOCITY_UNTRACKED is returned.
+              3. Else the transaction is counted in all windows, and VELOCITY_OK is returned.
+              The time is in seconds, and must be taken from the same clock for all transactions of the tracker.
+*/
+EN_velocityError_t velocityCheck(ST_velocity_t *velocity, uint64_t hash, money_t amount, uint32_t now)
+{
+    ST_velocityEntry_t *Loc_Entry;
+    uint8_t Loc_Over = 0;
+
+    /* Check 1: Empty tracker, every transaction is allowed */
+    if (velocity->entries == NULL)
+    {
+        return VELOCITY_OK;
+    }
+
+    Loc_Entry = velocityFind(velocity, (hash != 0) ? hash : 1, now);
+
+    /* Check 2: No slot for the account */
+    if (Loc_Entry == NULL)
+    {
+        velocity->untrackedCount++;
+        return VELOCITY_UNTRACKED;
+    }
+
+    /* Loop: Until all windows are moved to now, and checked */
+    for (uint32_t Loc_Window = 0; Loc_Window < VELOCITY_WINDOWS_COUNT; Loc_Window++)
+    {
+        const ST_velocityLimit_t *Loc_Limit = &velocity->windows[Loc_Window];
+        uint32_t *Loc_Counts  = Loc_Entry->counts[Loc_Window];
+        uint32_t *Loc_Amounts = Loc_Entry->amounts[Loc_Window];
+        uint32_t Loc_Remaining;
+
+        if (Loc_Limit->seconds == 0)
+        {
+            continue;
+        }
+
+        Loc_Remaining = velocityAdvance(Loc_Counts, Loc_Amounts, Loc_Limit->seconds, Loc_Entry->lastSeen, now);
+
+        /* previous count * remaining / seconds + current count + 1 > maxCount, kept in integers */
+        if ((Loc_Limit->maxCount != 0) &&
+            (((uint64_t)Loc_Counts[1] * Loc_Remaining) + (((uint64_t)Loc_Counts[0] + 1) * Loc_Limit->seconds) >
+             ((uint64_t)Loc_Limit->maxCount * Loc_Limit->seconds)))
+        {
+            Loc_Over = 1;
+        }
+
+        if ((Loc_Limit->maxAmount != 0) &&
+            (((double)Loc_Amounts[1] * Loc_Remaining / Loc_Limit->seconds) + (double)Loc_Amounts[0] + (double)amount >
+             (double)Loc_Limit->maxAmount))
+        {
+            Loc_Over = 1;
+        }
+    }
+
+    /* The buckets are now the ones of now, unless the clock went back */
+    if (now > Loc_Entry->lastSeen)
+    {
+        Loc_Entry->lastSeen = now;
+    }
+
+    /* Check 3: Over the limit of a window */
+    if (Loc_Over)
+    {
+        velocity->declinedCount++;
+        return VELOCITY_OVER_LIMIT;
+    }
+
+    for (uint32_t Loc_Window = 0; Loc_Window < VELOCITY_WINDOWS_COUNT; Loc_Window++)
+    {
+        uint64_t Loc_Amount = (uint64_t)Loc_Entry->amounts[Loc_Window][0] + (uint64_t)((amount > 0) ? amount : 0);
+
+        Loc_Entry->counts[Loc_Window][0]  += (Loc_Entry->counts[Loc_Window][0] != 0xFFFFFFFFUL);
+        Loc_Entry->amounts[Loc_Window][0]  = (Loc_Amount < VELOCITY_MAX_BUCKET_AMOUNT) ? (uint32_t)Loc_Amount : VELOCITY_MAX_BUCKET_AMOUNT;
+    }
+
+    return VELOCITY_OK;
+}
+
+/*
+ Name: velocityStats
+ Input: Pointer to tracker, and Pointer to Velocity Stats structure
+ Output: void
+ Description: Function to get the size, memory use, and counters of a tracker.
+*/
+void velocityStats(const ST_velocity_t *velocity, ST_velocityStats_t *stats)
+{
+    memset(stats, 0, sizeof(ST_velocityStats_t));
+
+    /* Check 1: Empty tracker */
+    if (velocity->entries == NULL)
+    {
+        return;
+    }
+
+    stats->count          = velocity->count;
+    stats->slotsCount     = velocity->slotsMask + 1;
+    stats->memoryBytes    = stats->slotsCount * sizeof(ST_velocityEntry_t);
+    stats->declinedCount  = velocity->declinedCount;
+    stats->untrackedCount = velocity->untrackedCount;
+}
+
+/*
+ Name: velocityPrintStats
+ Input: Pointer to name, and Pointer to Velocity Stats structure
+ Output: void
+ Description: Function to print out the stats of a tracker on one line.
+*/
+void velocityPrintStats(const char *name, const ST_velocityStats_t *stats)
+{
+    printf(" %-16s %10llu accounts | %10.1f KiB | %10llu declined | %10llu untracked\n",
+           name, (unsigned long long)stats->count, stats->memoryBytes / 1024.0,
+           (unsigned long long)stats->declinedCount, (unsigned long long)stats->untrackedCount);
+}
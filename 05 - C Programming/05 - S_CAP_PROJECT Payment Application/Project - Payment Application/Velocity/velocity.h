@@ -0,0 +1,107 @@
+/**
+ * @Title      	: Velocity Module
+ * @Filename   	: velocity.h
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+#ifndef VELOCITY_H_
+#define VELOCITY_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../Money/money.h"
+
+/* Number of windows an account is tracked over, e.g. seconds, minutes and hours */
+#define VELOCITY_WINDOWS_COUNT		3
+/* Min. number of slots in a tracker */
+#define VELOCITY_MIN_SLOTS			64
+/* Max. number of slots looked at to find an account, one that isn't found in them is not tracked */
+#define VELOCITY_MAX_PROBES			16
+/* Size an entry is aligned to, one cache line */
+#define VELOCITY_ENTRY_ALIGN		64
+/* Max. amount a bucket holds, in minor units */
+#define VELOCITY_MAX_BUCKET_AMOUNT	0xFFFFFFFFUL
+
+/**************************************************************************************************************************************/
+/*
+* Velocity tracker: an open-addressing table of accounts by 64-bit hash, each with a sliding window counter per window.
+* A window of N seconds is kept as two buckets of N seconds, the current one and the one before it. The count and amount
+* over the last N seconds are estimated as all of the current bucket, plus the part of the previous bucket still inside
+* the window (as if its transactions were spread evenly over it). So a check is O(1), and an account takes the same
+* memory whatever its number of transactions: one cache line, with the amount of a bucket kept in 32 bits of minor units
+* (it stops at VELOCITY_MAX_BUCKET_AMOUNT). The buckets of all windows are the ones of the last check of the account.
+* Slots are never emptied: an account with no transaction for twice the longest window has nothing left to count, and its
+* slot is taken over by the next new account that probes it, so the table holds the active accounts only.
+*/
+/**************************************************************************************************************************************/
+typedef struct ST_velocityLimit_t
+{
+    uint32_t seconds;					/* Window length, 0 for an unused window */
+    uint32_t maxCount;					/* Max. transactions in the window, 0 for no limit */
+    money_t maxAmount;					/* Max. total amount in the window, 0 for no limit */
+}ST_velocityLimit_t;
+
+typedef struct ST_velocityConfig_t
+{
+    uint64_t capacity;					/* Max. number of active accounts */
+    ST_velocityLimit_t windows[VELOCITY_WINDOWS_COUNT];	/* All windows unused for no tracker */
+}ST_velocityConfig_t;
+
+typedef struct ST_velocityEntry_t
+{
+    uint64_t hash;						/* 0 is an empty slot */
+    uint32_t lastSeen;					/* Time of the last check */
+    uint32_t counts[VELOCITY_WINDOWS_COUNT][2];		/* Current and previous bucket of each window */
+    uint32_t amounts[VELOCITY_WINDOWS_COUNT][2];
+    uint32_t reserved;
+}ST_velocityEntry_t;
+
+typedef struct ST_velocity_t
+{
+    void *memory;						/* Allocation the entries are aligned in */
+    ST_velocityEntry_t *entries;
+    uint64_t slotsMask;					/* Number of slots - 1 */
+    ST_velocityLimit_t windows[VELOCITY_WINDOWS_COUNT];
+    uint32_t idleSeconds;				/* Twice the longest window, an account idle this long counts nothing */
+    uint64_t count;						/* Slots ever taken */
+    uint64_t declinedCount;				/* Transactions over a limit */
+    uint64_t untrackedCount;			/* Transactions of accounts with no free slot, allowed */
+}ST_velocity_t;
+
+typedef struct ST_velocityStats_t
+{
+    uint64_t count;						/* Accounts in the table, active or idle */
+    uint64_t slotsCount;
+    uint64_t memoryBytes;				/* Size of the table */
+    uint64_t declinedCount;
+    uint64_t untrackedCount;
+}ST_velocityStats_t;
+
+typedef enum EN_velocityError_t
+{
+    VELOCITY_OK, VELOCITY_WRONG_CONFIG, VELOCITY_NO_MEMORY, VELOCITY_OVER_LIMIT, VELOCITY_UNTRACKED
+}EN_velocityError_t;
+
+/**************************************************************************************************************************************/
+/*
+*							Prototypes for all used functions inside the velocity module.
+*/
+/**************************************************************************************************************************************/
+EN_velocityError_t velocityCreate(ST_velocity_t *velocity, const ST_velocityConfig_t *config);
+void velocityDestroy(ST_velocity_t *velocity);
+void velocityPrefetch(const ST_velocity_t *velocity, uint64_t hash);
+EN_velocityError_t velocityCheck(ST_velocity_t *velocity, uint64_t hash, money_t amount, uint32_t now);
+void velocityStats(const ST_velocity_t *velocity, ST_velocityStats_t *stats);
+void velocityPrintStats(const char *name, const ST_velocityStats_t *stats);
+
+#endif /* VELOCITY_H_ */
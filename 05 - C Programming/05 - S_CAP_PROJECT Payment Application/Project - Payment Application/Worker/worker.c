@@ -0,0 +1,212 @@
+/**
+ * @Title      	: Worker Module
+ * @Filename   	: worker.c
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+
+/* Worker Module */
+#include "worker.h"
+
+/* Platform number of cores */
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+/*
+ Name: workerCoresCount
+ Input: void
+ Output: uint32 number of cores
+ Description: Function to get the number of cores the OS runs threads on, at least 1.
+*/
+uint32_t workerCoresCount(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO Loc_Info;
+
+    GetSystemInfo(&Loc_Info);
+
+    return (Loc_Info.dwNumberOfProcessors != 0) ? (uint32_t)Loc_Info.dwNumberOfProcessors : 1;
+#else
+    long Loc_Cores = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return (Loc_Cores > 0) ? (uint32_t)Loc_Cores : 1;
+#endif
+}
+
+/*
+ Name: workerMain
+ Input: Pointer to worker thread
+ Output: NULL
+ Description: Static Function run by every worker thread, to wait for jobs and run them until the pool stops.
+*/
+static void *workerMain(void *argument)
+{
+    ST_workerThread_t *Loc_Thread = (ST_workerThread_t *)argument;
+    ST_workerPool_t *Loc_Pool = Loc_Thread->pool;
+    uint64_t Loc_SeenGeneration = 0;
+
+    pthread_mutex_lock(&Loc_Pool->lock);
+
+    /* Loop: Until the pool stops */
+    while (1)
+    {
+        /* Loop: Until a new job is posted, or the pool stops */
+        while ((Loc_Pool->jobGeneration == Loc_SeenGeneration) && !Loc_Pool->stopping)
+        {
+            pthread_cond_wait(&Loc_Pool->jobPosted, &Loc_Pool->lock);
+        }
+
+        if (Loc_Pool->stopping)
+        {
+            break;
+        }
+
+        Loc_SeenGeneration = Loc_Pool->jobGeneration;
+
+        /* Run the job without holding the lock */
+        pthread_mutex_unlock(&Loc_Pool->lock);
+        Loc_Pool->job(Loc_Pool->argument, Loc_Thread->worker);
+        pthread_mutex_lock(&Loc_Pool->lock);
+
+        /* Check 1: Last worker to finish, wake up the caller */
+        if (--Loc_Pool->runningCount == 0)
+        {
+            pthread_cond_signal(&Loc_Pool->jobDone);
+        }
+    }
+
+    pthread_mutex_unlock(&Loc_Pool->lock);
+
+    return NULL;
+}
+
+/*
+ Name: workerPoolStart
+ Input: Pointer to pool, and uint32 threadsCount
+ Output: EN_workerError_t Error or No Error
+ Description: Function to start threadsCount worker threads, from 1 to WORKER_MAX_THREADS.
+*/
+EN_workerError_t workerPoolStart(ST_workerPool_t *pool, uint32_t threadsCount)
+{
+    /* Check 1: Wrong number of threads */
+    if ((threadsCount == 0) || (threadsCount > WORKER_MAX_THREADS))
+    {
+        return WORKER_WRONG_COUNT;
+    }
+
+    memset(pool, 0, sizeof(ST_workerPool_t));
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->jobPosted, NULL);
+    pthread_cond_init(&pool->jobDone, NULL);
+    pthread_cond_init(&pool->barrierReached, NULL);
+
+    /* Loop: Until all threads are started */
+    for (uint32_t Loc_Worker = 0; Loc_Worker < threadsCount; Loc_Worker++)
+    {
+        pool->threads[Loc_Worker].pool   = pool;
+        pool->threads[Loc_Worker].worker = Loc_Worker;
+
+        /* Check 2: Thread can't be started, stop the ones that are */
+        if (pthread_create(&pool->threads[Loc_Worker].thread, NULL, workerMain, &pool->threads[Loc_Worker]) != 0)
+        {
+            workerPoolStop(pool);
+            return WORKER_THREAD_ERROR;
+        }
+
+        pool->threadsCount++;
+    }
+
+    return WORKER_OK;
+}
+
+/*
+ Name: workerPoolRun
+ Input: Pointer to pool, job, and Pointer to job argument
+ Output: void
+ Description: Function to run a job on all workers at once, and wait until all of them have finished it.
+*/
+void workerPoolRun(ST_workerPool_t *pool, workerJob_t job, void *argument)
+{
+    pthread_mutex_lock(&pool->lock);
+
+    pool->job          = job;
+    pool->argument     = argument;
+    pool->runningCount = pool->threadsCount;
+    pool->jobGeneration++;
+    pthread_cond_broadcast(&pool->jobPosted);
+
+    /* Loop: Until the last worker finishes */
+    while (pool->runningCount != 0)
+    {
+        pthread_cond_wait(&pool->jobDone, &pool->lock);
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+}
+
+/*
+ Name: workerPoolBarrier
+ Input: Pointer to pool
+ Output: void
+ Description: Function called by the workers inside a job, to wait until all of them have reached the same point.
+*/
+void workerPoolBarrier(ST_workerPool_t *pool)
+{
+    pthread_mutex_lock(&pool->lock);
+
+    uint64_t Loc_Generation = pool->barrierGeneration;
+
+    /* Check 1: Last worker to arrive, release all of them */
+    if (++pool->barrierCount == pool->threadsCount)
+    {
+        pool->barrierCount = 0;
+        pool->barrierGeneration++;
+        pthread_cond_broadcast(&pool->barrierReached);
+    }
+    else
+    {
+        /* Loop: Until the last worker arrives */
+        while (pool->barrierGeneration == Loc_Generation)
+        {
+            pthread_cond_wait(&pool->barrierReached, &pool->lock);
+        }
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+}
+
+/*
+ Name: workerPoolStop
+ Input: Pointer to pool
+ Output: void
+ Description: Function to stop all worker threads once they are idle, and wait for them to exit.
+*/
+void workerPoolStop(ST_workerPool_t *pool)
+{
+    pthread_mutex_lock(&pool->lock);
+    pool->stopping = 1;
+    pthread_cond_broadcast(&pool->jobPosted);
+    pthread_mutex_unlock(&pool->lock);
+
+    /* Loop: Until all threads exit */
+    for (uint32_t Loc_Worker = 0; Loc_Worker < pool->threadsCount; Loc_Worker++)
+    {
+        pthread_join(pool->threads[Loc_Worker].thread, NULL);
+    }
+
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->jobPosted);
+    pthread_cond_destroy(&pool->jobDone);
+    pthread_cond_destroy(&pool->barrierReached);
+    pool->threadsCount = 0;
+}
@@ -0,0 +1,76 @@
+/**
+ * @Title      	: Worker Module
+ * @Filename   	: worker.h
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+#ifndef WORKER_H_
+#define WORKER_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+/* Max. number of worker threads in a pool */
+#define WORKER_MAX_THREADS			64
+
+/* Job run by every worker of a pool, worker is the worker number from 0 to threadsCount - 1 */
+typedef void (*workerJob_t)(void *argument, uint32_t worker);
+
+typedef struct ST_workerPool_t ST_workerPool_t;
+
+typedef struct ST_workerThread_t
+{
+    ST_workerPool_t *pool;
+    uint32_t worker;
+    pthread_t thread;
+}ST_workerThread_t;
+
+/**************************************************************************************************************************************/
+/*
+* Fork-join pool: workerPoolRun() hands one job to all workers, and returns once every worker has finished it.
+* Workers sleep on a condition variable between jobs.
+*/
+/**************************************************************************************************************************************/
+struct ST_workerPool_t
+{
+    ST_workerThread_t threads[WORKER_MAX_THREADS];
+    uint32_t threadsCount;
+    pthread_mutex_t lock;
+    pthread_cond_t jobPosted;
+    pthread_cond_t jobDone;
+    pthread_cond_t barrierReached;
+    workerJob_t job;
+    void *argument;
+    uint64_t jobGeneration;				/* Incremented for every posted job */
+    uint32_t runningCount;				/* Workers that didn't finish the current job yet */
+    uint64_t barrierGeneration;			/* Incremented every time all workers reach the barrier */
+    uint32_t barrierCount;				/* Workers waiting at the barrier */
+    uint8_t stopping;
+};
+
+typedef enum EN_workerError_t
+{
+    WORKER_OK, WORKER_WRONG_COUNT, WORKER_THREAD_ERROR
+}EN_workerError_t;
+
+/**************************************************************************************************************************************/
+/*
+*							Prototypes for all used functions inside the worker module.
+*/
+/**************************************************************************************************************************************/
+uint32_t workerCoresCount(void);
+EN_workerError_t workerPoolStart(ST_workerPool_t *pool, uint32_t threadsCount);
+void workerPoolRun(ST_workerPool_t *pool, workerJob_t job, void *argument);
+void workerPoolBarrier(ST_workerPool_t *pool);
+void workerPoolStop(ST_workerPool_t *pool);
+
+#endif /* WORKER_H_ */
@@ -0,0 +1,1001 @@
+/**
+ * @Title      	: Workload Module
+ * @Filename   	: workload.c
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+
+/* Workload Module */
+#include "workload.h"
+
+/* Number of transactions generated at once, then run through the validation chain */
+#define WORKLOAD_BATCH_SIZE			1024
+/* Number of digits of a PAN after its first digit, the last one is the Luhn check digit */
+#define WORKLOAD_PAN_DIGITS			15
+/* Accounts an account number is mapped over, 14 digits */
+#define WORKLOAD_PAN_RANGE			100000000000000ULL
+
+/**************************************************************************************************************************************/
+/*
+* Heap allocations are only counted in builds made with WORKLOAD_COUNT_ALLOCATIONS defined, for the workload benchmark:
+* malloc, calloc and realloc of the C library are replaced, for the whole program, with ones that count the calls then
+* call the C library's own functions. It can only be done with glibc, which exports them as __libc_*. free and aligned
+* allocations aren't replaced, and such a build can't run under AddressSanitizer or valgrind, which replace them too.
+*/
+/**************************************************************************************************************************************/
+#if defined(__GLIBC__) && defined(WORKLOAD_COUNT_ALLOCATIONS)
+#define WORKLOAD_COUNTS_ALLOCATIONS	1
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *memory, size_t size);
+
+static uint64_t Glb_AllocationsCount = 0;
+
+void *malloc(size_t size)
+{
+    __atomic_fetch_add(&Glb_AllocationsCount, 1, __ATOMIC_RELAXED);
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size)
+{
+    __atomic_fetch_add(&Glb_AllocationsCount, 1, __ATOMIC_RELAXED);
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *memory, size_t size)
+{
+    __atomic_fetch_add(&Glb_AllocationsCount, 1, __ATOMIC_RELAXED);
+    return __libc_realloc(memory, size);
+}
+
+#define workloadAllocations()		__atomic_load_n(&Glb_AllocationsCount, __ATOMIC_RELAXED)
+#else
+#define WORKLOAD_COUNTS_ALLOCATIONS	0
+#define workloadAllocations()		0ULL
+#endif
+
+/* Zipf sampler over ranks 1 to count, by rejection-inversion, so a pick is O(1) with no table of the ranks */
+typedef struct ST_workloadZipf_t
+{
+    uint64_t count;
+    double exponent;
+    double hIntegralX1;
+    double hIntegralN;
+    double cut;
+}ST_workloadZipf_t;
+
+/* Transactions generator of a run */
+typedef struct ST_workloadGenerator_t
+{
+    const ST_workloadConfig_t *config;
+    uint64_t seed;
+    uint64_t blockedCount;
+    ST_workloadZipf_t running;
+    ST_workloadZipf_t blocked;
+    ST_transaction_t template;			/* Card holder name, transaction date and max. amount of all transactions */
+    uint8_t validExpiry[6];
+    uint8_t expiredExpiry[6];
+    date_t packedValidExpiry;
+    date_t packedExpiredExpiry;
+}ST_workloadGenerator_t;
+
+/* Amounts distribution names, in EN_workloadAmounts_t order */
+static const char *Glb_AmountsNames[] =
+{
+    "fixed", "uniform", "lognormal"
+};
+
+/* Stage names, in EN_workloadStage_t order */
+static const char *Glb_StageNames[] =
+{
+    "card", "terminal", "server", "total"
+};
+
+/*
+ Name: workloadNow
+ Input: void
+ Output: uint64 time in nanoseconds
+ Description: Static Function to read a monotonic enough wall clock for timing the stages.
+*/
+static uint64_t workloadNow(void)
+{
+    struct timespec Loc_Time;
+
+    timespec_get(&Loc_Time, TIME_UTC);
+
+    return ((uint64_t)Loc_Time.tv_sec * 1000000000ULL) + (uint64_t)Loc_Time.tv_nsec;
+}
+
+/*
+ Name: workloadCompare
+ Input: Pointer to first latency, and Pointer to second latency
+ Output: int order of the two latencies
+ Description: Static Function to sort latencies in ascending order with qsort.
+*/
+static int workloadCompare(const void *first, const void *second)
+{
+    uint64_t Loc_First  = *(const uint64_t *)first;
+    uint64_t Loc_Second = *(const uint64_t *)second;
+
+    return (Loc_First > Loc_Second) - (Loc_First < Loc_Second);
+}
+
+/*
+ Name: workloadRandom
+ Input: Pointer to uint64 state
+ Output: uint64 random number
+ Description: Static Function to generate pseudo random numbers (xorshift64*), the same ones for the same seed.
+*/
+static uint64_t workloadRandom(uint64_t *state)
+{
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+
+    return *state * 0x2545F4914F6CDD1DULL;
+}
+
+/*
+ Name: workloadUniform
+ Input: Pointer to uint64 state
+ Output: double random number from 0 to 1, 1 excluded
+ Description: Static Function to generate a uniform random number with 53 random bits.
+*/
+static double workloadUniform(uint64_t *state)
+{
+    return (double)(workloadRandom(state) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/*
+ Name: workloadLog1pRatio
+ Input: double x
+ Output: double log(1 + x) / x
+ Description: Static Function to get log(1 + x) / x, with no loss of precision near 0.
+*/
+static double workloadLog1pRatio(double x)
+{
+    return (fabs(x) > 1e-8) ? (log1p(x) / x) : (1.0 - x * (0.5 - x * ((1.0 / 3.0) - 0.25 * x)));
+}
+
+/*
+ Name: workloadExpm1Ratio
+ Input: double x
+ Output: double (exp(x) - 1) / x
+ Description: Static Function to get (exp(x) - 1) / x, with no loss of precision near 0.
+*/
+static double workloadExpm1Ratio(double x)
+{
+    return (fabs(x) > 1e-8) ? (expm1(x) / x) : (1.0 + x * 0.5 * (1.0 + x * (1.0 / 3.0) * (1.0 + 0.25 * x)));
+}
+
+/*
+ Name: workloadZipfIntegral
+ Input: Pointer to Zipf sampler, and double x
+ Output: double integral of 1 / t^exponent from 1 to x
+ Description: Static Function to get the integral the ranks are picked by, for any exponent (1 included).
+*/
+static double workloadZipfIntegral(const ST_workloadZipf_t *zipf, double x)
+{
+    double Loc_Log = log(x);
+
+    return workloadExpm1Ratio((1.0 - zipf->exponent) * Loc_Log) * Loc_Log;
+}
+
+/*
+ Name: workloadZipfWeight
+ Input: Pointer to Zipf sampler, and double x
+ Output: double 1 / x^exponent
+ Description: Static Function to get the weight of a rank.
+*/
+static double workloadZipfWeight(const ST_workloadZipf_t *zipf, double x)
+{
+    return exp(-zipf->exponent * log(x));
+}
+
+/*
+ Name: workloadZipfInverse
+ Input: Pointer to Zipf sampler, and double integral
+ Output: double x the integral from 1 to x is
+ Description: Static Function to invert workloadZipfIntegral.
+*/
+static double workloadZipfInverse(const ST_workloadZipf_t *zipf, double integral)
+{
+    double Loc_Product = integral * (1.0 - zipf->exponent);
+
+    if (Loc_Product < -1.0)
+    {
+        Loc_Product = -1.0;
+    }
+
+    return exp(workloadLog1pRatio(Loc_Product) * integral);
+}
+
+/*
+ Name: workloadZipfInit
+ Input: Pointer to Zipf sampler, uint64 count of ranks, and double exponent
+ Output: void
+ Description: Static Function to set up a sampler of ranks 1 to count, with exponent 0 for uniform ranks.
+*/
+static void workloadZipfInit(ST_workloadZipf_t *zipf, uint64_t count, double exponent)
+{
+    zipf->count    = count;
+    zipf->exponent = exponent;
+
+    if (exponent > 0.0)
+    {
+        zipf->hIntegralX1 = workloadZipfIntegral(zipf, 1.5) - 1.0;
+        zipf->hIntegralN  = workloadZipfIntegral(zipf, (double)count + 0.5);
+        zipf->cut         = 2.0 - workloadZipfInverse(zipf, workloadZipfIntegral(zipf, 2.5) - workloadZipfWeight(zipf, 2.0));
+    }
+}
+
+/*
+ Name: workloadZipfNext
+ Input: Pointer to Zipf sampler, and Pointer to uint64 random state
+ Output: uint64 rank from 1 to count
+ Description: Static Function to pick a rank (Hormann and Derflinger's rejection-inversion): a point is picked under
+              the integral of the weights, and its rank is kept unless the point falls between the weight of the rank
+              and the integral around it, which is rare, so about one try is needed whatever the count.
+*/
+static uint64_t workloadZipfNext(const ST_workloadZipf_t *zipf, uint64_t *state)
+{
+    /* Check 1: Uniform ranks */
+    if (zipf->exponent <= 0.0)
+    {
+        return 1 + (workloadRandom(state) % zipf->count);
+    }
+
+    /* Loop: Until a rank is kept */
+    for (;;)
+    {
+        double Loc_Integral = zipf->hIntegralN + workloadUniform(state) * (zipf->hIntegralX1 - zipf->hIntegralN);
+        double Loc_X = workloadZipfInverse(zipf, Loc_Integral);
+        uint64_t Loc_Rank = (uint64_t)(Loc_X + 0.5);
+
+        if (Loc_Rank < 1)
+        {
+            Loc_Rank = 1;
+        }
+        else if (Loc_Rank > zipf->count)
+        {
+            Loc_Rank = zipf->count;
+        }
+
+        if ((((double)Loc_Rank - Loc_X) <= zipf->cut) ||
+            (Loc_Integral >= (workloadZipfIntegral(zipf, (double)Loc_Rank + 0.5) - workloadZipfWeight(zipf, (double)Loc_Rank))))
+        {
+            return Loc_Rank;
+        }
+    }
+}
+
+/*
+ Name: workloadMakePAN
+ Input: uint8 first digit, uint64 account number, and Pointer to PAN string
+ Output: void
+ Description: Static Function to write the 16 digits PAN of an account number, with a Luhn check digit.
+              The 14 digits after the first one are a bijection of the account number (below WORKLOAD_PAN_RANGE, so
+              the product doesn't overflow), so PANs never repeat and are not sequential.
+*/
+static void workloadMakePAN(uint8_t firstDigit, uint64_t accountNumber, uint8_t *primaryAccountNumber)
+{
+    uint64_t Loc_Digits = ((accountNumber * 104729ULL) + 14426950408889ULL) % WORKLOAD_PAN_RANGE;
+    uint32_t Loc_Sum = 0;
+
+    primaryAccountNumber[0] = firstDigit;
+    primaryAccountNumber[WORKLOAD_PAN_DIGITS + 1] = '\0';
+
+    /* Loop: Until all 14 digits are written, from the last one, every other one doubled from it for the check digit */
+    for (uint8_t Loc_Index = WORKLOAD_PAN_DIGITS - 1; Loc_Index > 0; Loc_Index--)
+    {
+        uint32_t Loc_Digit = (uint32_t)(Loc_Digits % 10);
+
+        primaryAccountNumber[Loc_Index] = (uint8_t)('0' + Loc_Digit);
+        Loc_Digits /= 10;
+
+        if (((WORKLOAD_PAN_DIGITS - 1 - Loc_Index) % 2) == 0)
+        {
+            Loc_Digit = (Loc_Digit * 2 > 9) ? (Loc_Digit * 2 - 9) : (Loc_Digit * 2);
+        }
+
+        Loc_Sum += Loc_Digit;
+    }
+
+    /* The first digit is the 15th from the check digit, so it is doubled too */
+    Loc_Sum += ((firstDigit - '0') * 2 > 9) ? ((firstDigit - '0') * 2 - 9) : ((firstDigit - '0') * 2);
+    primaryAccountNumber[WORKLOAD_PAN_DIGITS] = (uint8_t)('0' + ((10 - (Loc_Sum % 10)) % 10));
+}
+
+/*
+ Name: workloadMakeExpiry
+ Input: uint16 year, uint8 month, Pointer to expiry text, and Pointer to packed expiry date
+ Output: void
+ Description: Static Function to write a card expiry date "MM/YY" into a buffer of EXPIRY_DATE_MAX_SIZE + 1 bytes,
+              and its packed date. Both numbers are kept to two digits.
+*/
+static void workloadMakeExpiry(uint16_t year, uint8_t month, uint8_t *expiry, date_t *packedExpiry)
+{
+    snprintf((char *)expiry, EXPIRY_DATE_MAX_SIZE + 1, "%02u/%02u", (unsigned)(month % 100), (unsigned)(year % 100));
+    dateParseExpiry(expiry, packedExpiry);
+}
+
+/*
+ Name: workloadAmount
+ Input: Pointer to generator
+ Output: money_t amount, 0.01 at least
+ Description: Static Function to pick the amount of a transaction from the configured distribution.
+*/
+static money_t workloadAmount(ST_workloadGenerator_t *generator)
+{
+    money_t Loc_Amount = generator->config->amount;
+
+    switch (generator->config->amounts)
+    {
+        case WORKLOAD_UNIFORM_AMOUNTS:
+            Loc_Amount = 1 + (money_t)(workloadRandom(&generator->seed) % (uint64_t)(2 * Loc_Amount));
+            break;
+        case WORKLOAD_LOGNORMAL_AMOUNTS:
+        {
+            /* Normal random number of the log (Box-Muller), the amount is its median times e^(sigma * normal) */
+            double Loc_Radius = sqrt(-2.0 * log(1.0 - workloadUniform(&generator->seed)));
+            double Loc_Normal = Loc_Radius * cos(6.283185307179586 * workloadUniform(&generator->seed));
+
+            Loc_Amount = (money_t)((double)Loc_Amount * exp(WORKLOAD_LOGNORMAL_SIGMA * Loc_Normal) + 0.5);
+            break;
+        }
+        default:
+        case WORKLOAD_FIXED_AMOUNTS:
+            break;
+    }
+
+    return (Loc_Amount < 1) ? 1 : Loc_Amount;
+}
+
+/*
+ Name: workloadMake
+ Input: Pointer to generator, Pointer to Transaction, and Pointer to amount
+ Output: void
+ Description: Static Function to generate the next transaction of the workload: its card, from the fraud, blocked and
+              running accounts by their ratios and popularity, and its expiry date and amount. The amount is returned
+              for the terminal stage to set, not set in the transaction.
+*/
+static void workloadMake(ST_workloadGenerator_t *generator, ST_transaction_t *transaction, money_t *amount)
+{
+    const ST_workloadConfig_t *Loc_Config = generator->config;
+    uint8_t *Loc_PAN = transaction->cardHolderData.primaryAccountNumber;
+    double Loc_Pick = workloadUniform(&generator->seed);
+
+    *transaction = generator->template;
+
+    /* Step 1: Card, an account number past all accounts has no account */
+    if (Loc_Pick < Loc_Config->fraudRatio)
+    {
+        workloadMakePAN('4', Loc_Config->accountsCount + (workloadRandom(&generator->seed) >> 24), Loc_PAN);
+    }
+    else if (Loc_Pick < (Loc_Config->fraudRatio + Loc_Config->blockedRatio))
+    {
+        workloadMakePAN('5', workloadZipfNext(&generator->blocked, &generator->seed) - 1, Loc_PAN);
+    }
+    else
+    {
+        workloadMakePAN('4', workloadZipfNext(&generator->running, &generator->seed) - 1, Loc_PAN);
+    }
+
+    /* Step 2: Expiry date */
+    if (workloadUniform(&generator->seed) < Loc_Config->expiredRatio)
+    {
+        memcpy(transaction->cardHolderData.cardExpirationDate, generator->expiredExpiry, sizeof(generator->expiredExpiry));
+        transaction->cardHolderData.packedExpirationDate = generator->packedExpiredExpiry;
+    }
+    else
+    {
+        memcpy(transaction->cardHolderData.cardExpirationDate, generator->validExpiry, sizeof(generator->validExpiry));
+        transaction->cardHolderData.packedExpirationDate = generator->packedValidExpiry;
+    }
+
+    /* Step 3: Amount */
+    *amount = workloadAmount(generator);
+}
+
+/*
+ Name: workloadCreateAccounts
+ Input: Pointer to Workload Config structure, and uint64 blockedCount
+ Output: EN_databaseError_t Error or No Error
+ Description: Static Function to create the scratch accounts file with the running accounts, then the blocked ones.
+*/
+static EN_databaseError_t workloadCreateAccounts(const ST_workloadConfig_t *config, uint64_t blockedCount)
+{
+    ST_database_t Loc_Database;
+    ST_accountsDB_t Loc_Account = { config->balance, RUNNING, "" };
+    EN_databaseError_t Loc_ErrorState = databaseCreate(WORKLOAD_ACCOUNTS_FILE, config->accountsCount + blockedCount);
+
+    if (Loc_ErrorState == DATABASE_OK)
+    {
+        Loc_ErrorState = databaseOpen(&Loc_Database, WORKLOAD_ACCOUNTS_FILE);
+    }
+
+    if (Loc_ErrorState == DATABASE_OK)
+    {
+        /* Loop: Until all running accounts are added */
+        for (uint64_t Loc_Index = 0; (Loc_Index < config->accountsCount) && (Loc_ErrorState == DATABASE_OK); Loc_Index++)
+        {
+            workloadMakePAN('4', Loc_Index, Loc_Account.primaryAccountNumber);
+            Loc_ErrorState = databaseAddAccount(&Loc_Database, &Loc_Account, NULL);
+        }
+
+        Loc_Account.state = BLOCKED;
+
+        /* Loop: Until all blocked accounts are added */
+        for (uint64_t Loc_Index = 0; (Loc_Index < blockedCount) && (Loc_ErrorState == DATABASE_OK); Loc_Index++)
+        {
+            workloadMakePAN('5', Loc_Index, Loc_Account.primaryAccountNumber);
+            Loc_ErrorState = databaseAddAccount(&Loc_Database, &Loc_Account, NULL);
+        }
+
+        databaseClose(&Loc_Database);
+    }
+
+    return Loc_ErrorState;
+}
+
+/*
+ Name: workloadChain
+ Input: Pointer to Transaction, money_t amount, and Pointer to Stats structure
+ Output: void
+ Description: Static Function to run one transaction through the same validation chain as the interactive application,
+              with no console I/O, and time each stage it reaches:
+              1. Card: the name, expiry date and PAN formats, and the PAN's Luhn check digit.
+              2. Terminal: the expiry date against the transaction date, then the amount against the max. amount.
+              3. Server: recieveTransactionData.
+              A timed stage includes one clock read.
+*/
+static void workloadChain(ST_transaction_t *transaction, money_t amount, ST_workloadStats_t *stats)
+{
+    uint64_t Loc_Start = workloadNow();
+    uint64_t Loc_Time[3];
+    EN_transState_t Loc_TransState;
+
+    /* Stage 1: Card Data */
+    uint8_t Loc_Passed = (isValidCardHolderName(transaction->cardHolderData.cardHolderName) == CARD_OK) &&
+                         (isValidCardExpiryDate(transaction->cardHolderData.cardExpirationDate) == CARD_OK) &&
+                         (isValidCardPANFormat(transaction->cardHolderData.primaryAccountNumber) == CARD_OK) &&
+                         (isValidCardPAN(&transaction->cardHolderData) == TERMINAL_OK);
+
+    Loc_Time[0] = workloadNow();
+    stats->latenciesNs[WORKLOAD_CARD_STAGE][stats->counts[WORKLOAD_CARD_STAGE]++] = Loc_Time[0] - Loc_Start;
+
+    if (!Loc_Passed)
+    {
+        stats->cardErrors++;
+        stats->latenciesNs[WORKLOAD_TOTAL][stats->counts[WORKLOAD_TOTAL]++] = Loc_Time[0] - Loc_Start;
+        return;
+    }
+
+    /* Stage 2: Terminal Data */
+    Loc_Passed = (isCardExpired(&transaction->cardHolderData, &transaction->terminalData) == TERMINAL_OK) &&
+                 (setTransactionAmount(&transaction->terminalData, amount) == TERMINAL_OK) &&
+                 (isBelowMaxAmount(&transaction->terminalData) == TERMINAL_OK);
+
+    Loc_Time[1] = workloadNow();
+    stats->latenciesNs[WORKLOAD_TERMINAL_STAGE][stats->counts[WORKLOAD_TERMINAL_STAGE]++] = Loc_Time[1] - Loc_Time[0];
+
+    if (!Loc_Passed)
+    {
+        stats->terminalErrors++;
+        stats->latenciesNs[WORKLOAD_TOTAL][stats->counts[WORKLOAD_TOTAL]++] = Loc_Time[1] - Loc_Start;
+        return;
+    }
+
+    /* Stage 3: Server */
+    Loc_TransState = recieveTransactionData(transaction);
+
+    Loc_Time[2] = workloadNow();
+    stats->latenciesNs[WORKLOAD_SERVER_STAGE][stats->counts[WORKLOAD_SERVER_STAGE]++] = Loc_Time[2] - Loc_Time[1];
+    stats->latenciesNs[WORKLOAD_TOTAL][stats->counts[WORKLOAD_TOTAL]++] = Loc_Time[2] - Loc_Start;
+
+    if ((uint32_t)Loc_TransState <= DECLINED_VELOCITY)
+    {
+        stats->states[Loc_TransState]++;
+    }
+}
+
+/*
+ Name: workloadDefaultConfig
+ Input: Pointer to Workload Config structure
+ Output: void
+ Description: Function to set the default workload: 1M transactions over 100K accounts with Zipf popularity
+              (exponent 1), 1% fraud, 1% blocked cards, 2% expired cards, and log-normal amounts around 50.00.
+*/
+void workloadDefaultConfig(ST_workloadConfig_t *config)
+{
+    memset(config, 0, sizeof(ST_workloadConfig_t));
+
+    config->transactionsCount = 1000000ULL;
+    config->accountsCount     = 100000ULL;
+    config->zipfExponent      = 1.0;
+    config->fraudRatio        = 0.01;
+    config->blockedRatio      = 0.01;
+    config->expiredRatio      = 0.02;
+    config->amounts           = WORKLOAD_LOGNORMAL_AMOUNTS;
+    config->amount            = MONEY_AMOUNT(50, 0);
+    config->balance           = MONEY_AMOUNT(100000, 0);
+    config->velocity          = 0;
+    config->seed              = 0x9E3779B97F4A7C15ULL;
+    config->reportFile        = WORKLOAD_REPORT_FILE;
+}
+
+/*
+ Name: workloadParseOption
+ Input: Pointer to Workload Config structure, and Pointer to option "name=value"
+ Output: EN_workloadError_t Error or No Error
+ Description: Function to set one setting of a workload from its option:
+              transactions=N, accounts=N, zipf=exponent (0 for uniform), fraud=ratio, blocked=ratio, expired=ratio,
+              amounts=fixed|uniform|lognormal, amount=A, balance=A, velocity=0|1, seed=N, report=file.
+              1. Ratios are from 0 to 1, amounts are in major units with up to 2 decimals.
+              2. The report file name is kept, not copied.
+              3. An unknown name, or a wrong value returns WORKLOAD_WRONG_OPTION, and config is kept as it was.
+*/
+EN_workloadError_t workloadParseOption(ST_workloadConfig_t *config, const char *option)
+{
+    const char *Loc_Value = strchr(option, '=');
+    char Loc_Name[WORKLOAD_OPTION_SIZE];
+    char *Loc_End = NULL;
+    size_t Loc_NameSize;
+
+    /* Check 1: No value, or a name too long to be an option */
+    if ((Loc_Value == NULL) || ((Loc_NameSize = (size_t)(Loc_Value - option)) >= sizeof(Loc_Name)) || (*(++Loc_Value) == '\0'))
+    {
+        return WORKLOAD_WRONG_OPTION;
+    }
+
+    memcpy(Loc_Name, option, Loc_NameSize);
+    Loc_Name[Loc_NameSize] = '\0';
+
+    /* Check 2: Counts, a whole number from 1 */
+    if ((strcmp(Loc_Name, "transactions") == 0) || (strcmp(Loc_Name, "accounts") == 0) || (strcmp(Loc_Name, "seed") == 0))
+    {
+        unsigned long long Loc_Count = strtoull(Loc_Value, &Loc_End, 10);
+
+        if ((*Loc_End != '\0') || (Loc_Value[0] == '-') || (Loc_Count == 0))
+        {
+            return WORKLOAD_WRONG_OPTION;
+        }
+
+        if (Loc_Name[0] == 't')
+        {
+            config->transactionsCount = Loc_Count;
+        }
+        else if (Loc_Name[0] == 'a')
+        {
+            config->accountsCount = Loc_Count;
+        }
+        else
+        {
+            config->seed = Loc_Count;
+        }
+    }
+    /* Check 3: Zipf exponent, and ratios */
+    else if ((strcmp(Loc_Name, "zipf") == 0) || (strcmp(Loc_Name, "fraud") == 0) ||
+             (strcmp(Loc_Name, "blocked") == 0) || (strcmp(Loc_Name, "expired") == 0))
+    {
+        double Loc_Number = strtod(Loc_Value, &Loc_End);
+
+        if ((*Loc_End != '\0') || !(Loc_Number >= 0.0) || ((Loc_Name[0] != 'z') && (Loc_Number > 1.0)) || (Loc_Number > 100.0))
+        {
+            return WORKLOAD_WRONG_OPTION;
+        }
+
+        switch (Loc_Name[0])
+        {
+            case 'z': config->zipfExponent = Loc_Number; break;
+            case 'f': config->fraudRatio   = Loc_Number; break;
+            case 'b': config->blockedRatio = Loc_Number; break;
+            default:  config->expiredRatio = Loc_Number; break;
+        }
+    }
+    /* Check 4: Amounts distribution */
+    else if (strcmp(Loc_Name, "amounts") == 0)
+    {
+        uint32_t Loc_Amounts = 0;
+
+        while ((Loc_Amounts < (sizeof(Glb_AmountsNames) / sizeof(Glb_AmountsNames[0]))) && (strcmp(Glb_AmountsNames[Loc_Amounts], Loc_Value) != 0))
+        {
+            Loc_Amounts++;
+        }
+
+        if (Loc_Amounts == (sizeof(Glb_AmountsNames) / sizeof(Glb_AmountsNames[0])))
+        {
+            return WORKLOAD_WRONG_OPTION;
+        }
+
+        config->amounts = (EN_workloadAmounts_t)Loc_Amounts;
+    }
+    /* Check 5: Amounts, the transaction amount from 0.01, and the balance from 0 */
+    else if ((strcmp(Loc_Name, "amount") == 0) || (strcmp(Loc_Name, "balance") == 0))
+    {
+        money_t Loc_Amount;
+
+        if ((moneyParse(Loc_Value, &Loc_Amount) != MONEY_OK) || (Loc_Amount < ((Loc_Name[0] == 'a') ? 1 : 0)))
+        {
+            return WORKLOAD_WRONG_OPTION;
+        }
+
+        if (Loc_Name[0] == 'a')
+        {
+            config->amount = Loc_Amount;
+        }
+        else
+        {
+            config->balance = Loc_Amount;
+        }
+    }
+    /* Check 6: Velocity limits on or off */
+    else if (strcmp(Loc_Name, "velocity") == 0)
+    {
+        if (((Loc_Value[0] != '0') && (Loc_Value[0] != '1')) || (Loc_Value[1] != '\0'))
+        {
+            return WORKLOAD_WRONG_OPTION;
+        }
+
+        config->velocity = (uint8_t)(Loc_Value[0] - '0');
+    }
+    /* Check 7: Report file */
+    else if (strcmp(Loc_Name, "report") == 0)
+    {
+        config->reportFile = Loc_Value;
+    }
+    else
+    {
+        return WORKLOAD_WRONG_OPTION;
+    }
+
+    return WORKLOAD_OK;
+}
+
+/*
+ Name: workloadStageName
+ Input: EN_workloadStage_t stage
+ Output: Pointer to stage name
+ Description: Function to get the name of a stage, "unknown" if it is out of range.
+*/
+const char *workloadStageName(EN_workloadStage_t stage)
+{
+    if ((uint32_t)stage < (sizeof(Glb_StageNames) / sizeof(Glb_StageNames[0])))
+    {
+        return Glb_StageNames[stage];
+    }
+
+    return "unknown";
+}
+
+/*
+ Name: workloadRun
+ Input: Pointer to Workload Config structure, and Pointer to Stats structure
+ Output: EN_workloadError_t Error or No Error
+ Description: Function to generate the transactions of a workload and run them through the validation chain, as fast
+              as it can, timing each stage of each transaction.
+              1. The server runs on WORKLOAD_ACCOUNTS_FILE and WORKLOAD_JOURNAL_FILE, created with the workload accounts
+                 before the run and removed after it, so runs never debit the accounts of the interactive application.
+              2. Transactions are generated WORKLOAD_BATCH_SIZE at a time, outside of the timed stages, all on today's
+                 date.
+              3. Transactions are committed to the log with the server's group commit, and once more at the end.
+              4. If a count is 0, or the fraud and blocked ratios add up to more than 1 returns WORKLOAD_WRONG_CONFIG.
+              5. stats must be freed with workloadFreeStats, even on error.
+*/
+EN_workloadError_t workloadRun(const ST_workloadConfig_t *config, ST_workloadStats_t *stats)
+{
+    EN_workloadError_t Loc_ErrorState = WORKLOAD_OK;
+    ST_serverConfig_t Loc_ServerConfig;
+    ST_workloadGenerator_t Loc_Generator;
+    ST_transaction_t *Loc_Transactions;
+    money_t *Loc_Amounts;
+    date_t Loc_Today;
+    uint64_t Loc_Start = workloadNow();
+    uint64_t Loc_Allocations;
+
+    memset(stats, 0, sizeof(ST_workloadStats_t));
+    stats->allocationsCounted = WORKLOAD_COUNTS_ALLOCATIONS;
+
+    /* Check 1: Wrong workload */
+    if ((config->transactionsCount == 0) || (config->accountsCount == 0) || (config->accountsCount > (WORKLOAD_PAN_RANGE / 2)) ||
+        ((config->fraudRatio + config->blockedRatio) > 1.0) || (config->amount < 1) || (config->balance < 0))
+    {
+        return WORKLOAD_WRONG_CONFIG;
+    }
+
+    /* Check 2: Not enough memory */
+    Loc_Transactions = malloc(WORKLOAD_BATCH_SIZE * sizeof(ST_transaction_t));
+    Loc_Amounts      = malloc(WORKLOAD_BATCH_SIZE * sizeof(money_t));
+
+    for (uint32_t Loc_Stage = 0; Loc_Stage < WORKLOAD_STAGES_COUNT; Loc_Stage++)
+    {
+        stats->latenciesNs[Loc_Stage] = malloc(config->transactionsCount * sizeof(uint64_t));
+
+        if (stats->latenciesNs[Loc_Stage] == NULL)
+        {
+            Loc_ErrorState = WORKLOAD_NO_MEMORY;
+        }
+    }
+
+    if ((Loc_Transactions == NULL) || (Loc_Amounts == NULL) || (Loc_ErrorState != WORKLOAD_OK))
+    {
+        free(Loc_Transactions);
+        free(Loc_Amounts);
+        return WORKLOAD_NO_MEMORY;
+    }
+
+    /* Step 1: Generator, the blocked accounts have the same popularity as the running ones */
+    memset(&Loc_Generator, 0, sizeof(ST_workloadGenerator_t));
+    Loc_Generator.config       = config;
+    Loc_Generator.seed         = (config->seed != 0) ? config->seed : 0x9E3779B97F4A7C15ULL;
+    Loc_Generator.blockedCount = (config->accountsCount + WORKLOAD_BLOCKED_SHARE - 1) / WORKLOAD_BLOCKED_SHARE;
+
+    workloadZipfInit(&Loc_Generator.running, config->accountsCount, config->zipfExponent);
+    workloadZipfInit(&Loc_Generator.blocked, Loc_Generator.blockedCount, config->zipfExponent);
+
+    strcpy((char *)Loc_Generator.template.cardHolderData.cardHolderName, WORKLOAD_CARD_HOLDER);
+    setMaxAmount(&Loc_Generator.template.terminalData, WORKLOAD_MAX_AMOUNT);
+    Loc_Today = dateToday(Loc_Generator.template.terminalData.transactionDate);
+    Loc_Generator.template.terminalData.packedTransactionDate = Loc_Today;
+
+    workloadMakeExpiry(DATE_YEAR(Loc_Today) + WORKLOAD_VALID_YEARS, DATE_MONTH(Loc_Today),
+                       Loc_Generator.validExpiry, &Loc_Generator.packedValidExpiry);
+    workloadMakeExpiry(DATE_YEAR(Loc_Today) - (DATE_MONTH(Loc_Today) == 1), (DATE_MONTH(Loc_Today) == 1) ? 12 : (DATE_MONTH(Loc_Today) - 1),
+                       Loc_Generator.expiredExpiry, &Loc_Generator.packedExpiredExpiry);
+
+    /* Step 2: Server, on the scratch accounts */
+    memset(&Loc_ServerConfig, 0, sizeof(ST_serverConfig_t));
+    Loc_ServerConfig.accountsFile     = WORKLOAD_ACCOUNTS_FILE;
+    Loc_ServerConfig.journal.fileName = WORKLOAD_JOURNAL_FILE;
+
+    if (config->velocity)
+    {
+        serverDefaultVelocity(&Loc_ServerConfig.velocity);
+    }
+
+    serverShutdown();
+    serverRemoveFiles(&Loc_ServerConfig);
+
+    /* Check 3: Server can't be started */
+    if ((workloadCreateAccounts(config, Loc_Generator.blockedCount) != DATABASE_OK) || (serverInit(&Loc_ServerConfig) != SERVER_OK))
+    {
+        serverRemoveFiles(&Loc_ServerConfig);
+        free(Loc_Transactions);
+        free(Loc_Amounts);
+        return WORKLOAD_SERVER_ERROR;
+    }
+
+    Loc_Allocations = workloadAllocations();
+
+    /* Loop: Until all transactions are run, a batch at a time */
+    while (stats->transactions < config->transactionsCount)
+    {
+        uint64_t Loc_Count = config->transactionsCount - stats->transactions;
+        uint64_t Loc_ChainStart;
+
+        if (Loc_Count > WORKLOAD_BATCH_SIZE)
+        {
+            Loc_Count = WORKLOAD_BATCH_SIZE;
+        }
+
+        for (uint64_t Loc_Index = 0; Loc_Index < Loc_Count; Loc_Index++)
+        {
+            workloadMake(&Loc_Generator, &Loc_Transactions[Loc_Index], &Loc_Amounts[Loc_Index]);
+        }
+
+        Loc_ChainStart = workloadNow();
+
+        for (uint64_t Loc_Index = 0; Loc_Index < Loc_Count; Loc_Index++)
+        {
+            workloadChain(&Loc_Transactions[Loc_Index], Loc_Amounts[Loc_Index], stats);
+        }
+
+        stats->elapsedNs    += workloadNow() - Loc_ChainStart;
+        stats->transactions += Loc_Count;
+    }
+
+    /* Check 4: Pending transactions can't be committed */
+    Loc_Allocations = workloadAllocations() - Loc_Allocations;
+
+    {
+        uint64_t Loc_CommitStart = workloadNow();
+
+        if (serverCommit() != SERVER_OK)
+        {
+            Loc_ErrorState = WORKLOAD_SERVER_ERROR;
+        }
+
+        stats->elapsedNs += workloadNow() - Loc_CommitStart;
+    }
+
+    stats->allocationsCount = Loc_Allocations;
+
+    serverShutdown();
+    serverRemoveFiles(&Loc_ServerConfig);
+    free(Loc_Transactions);
+    free(Loc_Amounts);
+
+    /* Loop: Until the latencies of all stages are sorted */
+    for (uint32_t Loc_Stage = 0; Loc_Stage < WORKLOAD_STAGES_COUNT; Loc_Stage++)
+    {
+        qsort(stats->latenciesNs[Loc_Stage], stats->counts[Loc_Stage], sizeof(uint64_t), workloadCompare);
+    }
+
+    stats->wallNs = workloadNow() - Loc_Start;
+
+    return Loc_ErrorState;
+}
+
+/*
+ Name: workloadPercentile
+ Input: Pointer to Stats structure, EN_workloadStage_t stage, and double percentile from 0 to 100
+ Output: uint64 latency in nanoseconds
+ Description: Function to get the latency percentile of a stage (nearest rank), 0 if no transaction reached it.
+*/
+uint64_t workloadPercentile(const ST_workloadStats_t *stats, EN_workloadStage_t stage, double percentile)
+{
+    uint64_t Loc_Count = stats->counts[stage];
+    uint64_t Loc_Rank;
+
+    if (Loc_Count == 0)
+    {
+        return 0;
+    }
+
+    /* Rank of the percentile, from 1 to count */
+    Loc_Rank = (uint64_t)((percentile / 100.0) * (double)Loc_Count + 0.999999);
+
+    if (Loc_Rank == 0)
+    {
+        Loc_Rank = 1;
+    }
+    else if (Loc_Rank > Loc_Count)
+    {
+        Loc_Rank = Loc_Count;
+    }
+
+    return stats->latenciesNs[stage][Loc_Rank - 1];
+}
+
+/*
+ Name: workloadPrintStats
+ Input: Pointer to Stats structure
+ Output: void
+ Description: Function to print out the outcome of the transactions, the throughput, the latency percentiles of each
+              stage, and the heap allocations of a run.
+*/
+void workloadPrintStats(const ST_workloadStats_t *stats)
+{
+    double Loc_Seconds = (double)stats->elapsedNs / 1e9;
+
+    printf(" Transactions:\t\t%llu in %.3f s, %.0f transactions/s\n", (unsigned long long)stats->transactions, Loc_Seconds,
+           (Loc_Seconds > 0) ? ((double)stats->transactions / Loc_Seconds) : 0.0);
+    printf(" Card errors:\t\t%llu\n", (unsigned long long)stats->cardErrors);
+    printf(" Terminal errors:\t%llu\n", (unsigned long long)stats->terminalErrors);
+
+    /* Loop: Until all transaction states are printed out */
+    for (uint8_t Loc_State = APPROVED; Loc_State <= DECLINED_VELOCITY; Loc_State++)
+    {
+        printf(" %-28s%llu\n", reportStateName((EN_transState_t)Loc_State), (unsigned long long)stats->states[Loc_State]);
+    }
+
+    /* Loop: Until the latencies of all stages are printed out */
+    for (uint32_t Loc_Stage = 0; Loc_Stage < WORKLOAD_STAGES_COUNT; Loc_Stage++)
+    {
+        printf(" %-9s latency (us):\tp50 %.2f, p90 %.2f, p99 %.2f, p999 %.2f, max %.2f\n", Glb_StageNames[Loc_Stage],
+               workloadPercentile(stats, Loc_Stage, 50.0) / 1e3, workloadPercentile(stats, Loc_Stage, 90.0) / 1e3,
+               workloadPercentile(stats, Loc_Stage, 99.0) / 1e3, workloadPercentile(stats, Loc_Stage, 99.9) / 1e3,
+               workloadPercentile(stats, Loc_Stage, 100.0) / 1e3);
+    }
+
+    if (stats->allocationsCounted)
+    {
+        printf(" Allocations:\t\t%llu, %.6f per transaction\n", (unsigned long long)stats->allocationsCount,
+               (stats->transactions != 0) ? ((double)stats->allocationsCount / (double)stats->transactions) : 0.0);
+    }
+    else
+    {
+        printf(" Allocations:\t\tnot counted in this build\n");
+    }
+}
+
+/*
+ Name: workloadWriteReport
+ Input: Pointer to Workload Config structure, Pointer to Stats structure, and Pointer to report file name
+ Output: EN_workloadError_t Error or No Error
+ Description: Function to write the workload and the outcome of a run to a JSON file, so runs of two versions can be
+              compared by a script. Times are in nanoseconds, amounts in major units, and allocations is null if they
+              aren't counted in this build.
+*/
+EN_workloadError_t workloadWriteReport(const ST_workloadConfig_t *config, const ST_workloadStats_t *stats, const char *fileName)
+{
+    char Loc_Amount[MONEY_TEXT_SIZE];
+    char Loc_Balance[MONEY_TEXT_SIZE];
+    FILE *Loc_File = fopen(fileName, "w");
+
+    /* Check 1: Report file can't be created */
+    if (Loc_File == NULL)
+    {
+        return WORKLOAD_FILE_ERROR;
+    }
+
+    moneyFormat(config->amount, Loc_Amount);
+    moneyFormat(config->balance, Loc_Balance);
+
+    fprintf(Loc_File, "{\n  \"version\": %d,\n", WORKLOAD_REPORT_VERSION);
+    fprintf(Loc_File, "  \"config\": {\"transactions\": %llu, \"accounts\": %llu, \"zipf\": %g, \"fraud\": %g, \"blocked\": %g, "
+                      "\"expired\": %g, \"amounts\": \"%s\", \"amount\": %s, \"balance\": %s, \"velocity\": %u, \"seed\": %llu},\n",
+            (unsigned long long)config->transactionsCount, (unsigned long long)config->accountsCount, config->zipfExponent,
+            config->fraudRatio, config->blockedRatio, config->expiredRatio, Glb_AmountsNames[config->amounts], Loc_Amount,
+            Loc_Balance, (unsigned)config->velocity, (unsigned long long)config->seed);
+    fprintf(Loc_File, "  \"transactions\": %llu,\n  \"elapsedNs\": %llu,\n  \"wallNs\": %llu,\n  \"throughput\": %.1f,\n",
+            (unsigned long long)stats->transactions, (unsigned long long)stats->elapsedNs, (unsigned long long)stats->wallNs,
+            (stats->elapsedNs != 0) ? ((double)stats->transactions * 1e9 / (double)stats->elapsedNs) : 0.0);
+
+    /* Step 1: Outcomes */
+    fprintf(Loc_File, "  \"outcomes\": {\"CARD_ERROR\": %llu, \"TERMINAL_ERROR\": %llu",
+            (unsigned long long)stats->cardErrors, (unsigned long long)stats->terminalErrors);
+
+    for (uint8_t Loc_State = APPROVED; Loc_State <= DECLINED_VELOCITY; Loc_State++)
+    {
+        fprintf(Loc_File, ", \"%s\": %llu", reportStateName((EN_transState_t)Loc_State), (unsigned long long)stats->states[Loc_State]);
+    }
+
+    /* Step 2: Latency percentiles of each stage */
+    fprintf(Loc_File, "},\n  \"stages\": {\n");
+
+    for (uint32_t Loc_Stage = 0; Loc_Stage < WORKLOAD_STAGES_COUNT; Loc_Stage++)
+    {
+        fprintf(Loc_File, "    \"%s\": {\"count\": %llu, \"p50\": %llu, \"p90\": %llu, \"p99\": %llu, \"p999\": %llu, \"max\": %llu}%s\n",
+                Glb_StageNames[Loc_Stage], (unsigned long long)stats->counts[Loc_Stage],
+                (unsigned long long)workloadPercentile(stats, Loc_Stage, 50.0), (unsigned long long)workloadPercentile(stats, Loc_Stage, 90.0),
+                (unsigned long long)workloadPercentile(stats, Loc_Stage, 99.0), (unsigned long long)workloadPercentile(stats, Loc_Stage, 99.9),
+                (unsigned long long)workloadPercentile(stats, Loc_Stage, 100.0), (Loc_Stage + 1 < WORKLOAD_STAGES_COUNT) ? "," : "");
+    }
+
+    /* Step 3: Heap allocations */
+    if (stats->allocationsCounted)
+    {
+        fprintf(Loc_File, "  },\n  \"allocations\": {\"count\": %llu, \"perTransaction\": %.6f}\n}\n", (unsigned long long)stats->allocationsCount,
+                (stats->transactions != 0) ? ((double)stats->allocationsCount / (double)stats->transactions) : 0.0);
+    }
+    else
+    {
+        fprintf(Loc_File, "  },\n  \"allocations\": null\n}\n");
+    }
+
+    /* Check 2: Report file can't be written */
+    if (fclose(Loc_File) != 0)
+    {
+        return WORKLOAD_FILE_ERROR;
+    }
+
+    return WORKLOAD_OK;
+}
+
+/*
+ Name: workloadFreeStats
+ Input: Pointer to Stats structure
+ Output: void
+ Description: Function to free the latencies of a run.
+*/
+void workloadFreeStats(ST_workloadStats_t *stats)
+{
+    for (uint32_t Loc_Stage = 0; Loc_Stage < WORKLOAD_STAGES_COUNT; Loc_Stage++)
+    {
+        free(stats->latenciesNs[Loc_Stage]);
+        stats->latenciesNs[Loc_Stage] = NULL;
+        stats->counts[Loc_Stage] = 0;
+    }
+
+    stats->transactions = 0;
+}
@@ -0,0 +1,124 @@
+/**
+ * @Title      	: Workload Module
+ * @Filename   	: workload.h
+ * @Author     	: Abdelrhman Walaa
+ * @Origin Date	: Oct 17, 2026
+ * @Version		: 1.0.0
+ * @Compiler	: MinGW
+ * @Target     	: General Purpose Processor / PCs
+ * @Notes		: The code is written with ANSI_C Standard.
+ *
+ * THIS SOFTWARE IS PROVIDED BY HACKER KERMIT - TEAM_1 at Sprints_Automotive_BC_W11.
+ *
+ */
+#ifndef WORKLOAD_H_
+#define WORKLOAD_H_
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../Card/card.h"
+#include "../Database/database.h"
+#include "../Money/money.h"
+#include "../Terminal/terminal.h"
+#include "../Report/report.h"
+#include "../Server/server.h"
+
+/* Scratch accounts file, created with the workload accounts before each run and removed after it */
+#define WORKLOAD_ACCOUNTS_FILE		"workload_accounts.db"
+/* Scratch transactions log, created empty before each run and removed after it */
+#define WORKLOAD_JOURNAL_FILE		"workload_transactions.log"
+/* Default report file of the application */
+#define WORKLOAD_REPORT_FILE		"workload_report.json"
+/* Format version of the report, changed whenever a field is renamed or its meaning changes */
+#define WORKLOAD_REPORT_VERSION		1
+/* Terminal max. amount, the same as the interactive application */
+#define WORKLOAD_MAX_AMOUNT			MONEY_AMOUNT(4000, 0)
+/* Card holder name of all generated cards */
+#define WORKLOAD_CARD_HOLDER		"Workload Card Holder"
+/* Number of blocked accounts per WORKLOAD_BLOCKED_SHARE running accounts, 1 at least */
+#define WORKLOAD_BLOCKED_SHARE		100
+/* Years a card that isn't expired is still valid for, from the transaction date */
+#define WORKLOAD_VALID_YEARS		5
+/* Spread (sigma of its log) of the log-normal amounts */
+#define WORKLOAD_LOGNORMAL_SIGMA	1.0
+/* Max. size of an option name */
+#define WORKLOAD_OPTION_SIZE		32
+
+typedef enum EN_workloadError_t
+{
+    WORKLOAD_OK, WORKLOAD_WRONG_OPTION, WORKLOAD_WRONG_CONFIG, WORKLOAD_FILE_ERROR, WORKLOAD_SERVER_ERROR, WORKLOAD_NO_MEMORY
+}EN_workloadError_t;
+
+typedef enum EN_workloadAmounts_t
+{
+    WORKLOAD_FIXED_AMOUNTS, WORKLOAD_UNIFORM_AMOUNTS, WORKLOAD_LOGNORMAL_AMOUNTS
+}EN_workloadAmounts_t;
+
+/* Stages of the validation chain a transaction is timed at, and all of them together */
+typedef enum EN_workloadStage_t
+{
+    WORKLOAD_CARD_STAGE, WORKLOAD_TERMINAL_STAGE, WORKLOAD_SERVER_STAGE, WORKLOAD_TOTAL, WORKLOAD_STAGES_COUNT
+}EN_workloadStage_t;
+
+/**************************************************************************************************************************************/
+/*
+* Workload of a run, all ratios are shares of the transactions, from 0 to 1:
+*	1. fraudRatio of the transactions are for cards with no account (FRAUD_CARD).
+*	2. blockedRatio are for the blocked accounts, one per WORKLOAD_BLOCKED_SHARE running accounts (DECLINED_STOLEN_CARD).
+*	3. The rest are for the running accounts.
+*	4. expiredRatio of all transactions are on a card that expired the month before (stopped by the terminal).
+* The account of a transaction is picked with the same popularity over the running, or blocked, accounts: uniform for
+* zipfExponent 0, else the account of rank k is picked in proportion to 1 / k^zipfExponent, so a few accounts take most
+* of the transactions (and run out of balance first).
+*/
+/**************************************************************************************************************************************/
+typedef struct ST_workloadConfig_t
+{
+    uint64_t transactionsCount;
+    uint64_t accountsCount;				/* Running accounts */
+    double zipfExponent;				/* 0 for uniform popularity */
+    double fraudRatio;
+    double blockedRatio;
+    double expiredRatio;
+    EN_workloadAmounts_t amounts;		/* Fixed at amount, uniform from 0.01 to twice amount, or log-normal with median amount */
+    money_t amount;
+    money_t balance;					/* Balance of every account when the run starts */
+    uint8_t velocity;					/* 1 to check the server's default velocity limits, 0 for none */
+    uint64_t seed;						/* Same seed, same transactions */
+    const char *reportFile;				/* Report file of the application */
+}ST_workloadConfig_t;
+
+typedef struct ST_workloadStats_t
+{
+    uint64_t transactions;						/* Transactions run through the validation chain */
+    uint64_t cardErrors;						/* Stopped at the card stage */
+    uint64_t terminalErrors;					/* Stopped at the terminal stage: expired card, or over the max. amount */
+    uint64_t states[DECLINED_VELOCITY + 1];	/* Answered by the server, per transaction state */
+    uint64_t elapsedNs;							/* Time of the validation chain, generating the transactions not included */
+    uint64_t wallNs;							/* Wall time of the whole run, creating the accounts included */
+    uint8_t allocationsCounted;					/* 1 if the heap allocations below are counted in this build */
+    uint64_t allocationsCount;					/* malloc, calloc and realloc calls while the chain ran */
+    uint64_t counts[WORKLOAD_STAGES_COUNT];		/* Transactions timed at each stage */
+    uint64_t *latenciesNs[WORKLOAD_STAGES_COUNT];	/* Time of each transaction at each stage, sorted once the run ends */
+}ST_workloadStats_t;
+
+/**************************************************************************************************************************************/
+/*
+*							Prototypes for all used functions inside the workload module.
+*/
+/**************************************************************************************************************************************/
+void workloadDefaultConfig(ST_workloadConfig_t *config);
+EN_workloadError_t workloadParseOption(ST_workloadConfig_t *config, const char *option);
+const char *workloadStageName(EN_workloadStage_t stage);
+EN_workloadError_t workloadRun(const ST_workloadConfig_t *config, ST_workloadStats_t *stats);
+uint64_t workloadPercentile(const ST_workloadStats_t *stats, EN_workloadStage_t stage, double percentile);
+void workloadPrintStats(const ST_workloadStats_t *stats);
+EN_workloadError_t workloadWriteReport(const ST_workloadConfig_t *config, const ST_workloadStats_t *stats, const char *fileName);
+void workloadFreeStats(ST_workloadStats_t *stats);
+
+#endif /* WORKLOAD_H_ */